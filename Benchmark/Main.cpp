@@ -0,0 +1,23 @@
+#include "Source/Benchmark.h"
+
+#include "Source/Core/Algorithm/HashBenchmark.h"
+
+#include "Source/Core/Memory/TLSFAllocatorBenchmark.h"
+#include "Source/Core/Memory/AllocationReplayBenchmark.h"
+#include "Source/Core/Memory/ConcurrentPoolAllocatorBenchmark.h"
+#include "Source/Core/Memory/MemoryUtilitiesBenchmark.h"
+
+#include "Source/Core/Types/DelegateBenchmark.h"
+
+#include "Source/Core/Containers/FlatHashMapBenchmark.h"
+#include "Source/Core/Containers/QueueBenchmark.h"
+#include "Source/Core/Containers/StackBenchmark.h"
+#include "Source/Core/Containers/LinkedListBenchmark.h"
+#include "Source/Core/Containers/InlineArrayBenchmark.h"
+#include "Source/Core/Containers/SoAArrayBenchmark.h"
+#include "Source/Core/Containers/ChunkedArrayBenchmark.h"
+
+int main(int argc, char** args)
+{
+	return Benchmark::RunAllBenchmarks(argc, args);
+}
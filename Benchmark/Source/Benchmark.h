@@ -0,0 +1,137 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <intrin.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace Benchmark
+{
+	using Clock = std::chrono::high_resolution_clock;
+
+	/**
+	 * @brief A registered benchmark case.
+	 */
+	struct BenchmarkCase
+	{
+		const char* m_suite;
+		const char* m_name;
+		void(*m_function)(void);
+	};
+
+	/**
+	 * @brief Gets the list of all benchmark cases registered through the
+	 * BENCHMARK macro.
+	 */
+	inline std::vector<BenchmarkCase>& GetRegistry(void)
+	{
+		static std::vector<BenchmarkCase> registry;
+		return registry;
+	}
+
+	struct BenchmarkRegistrar
+	{
+		BenchmarkRegistrar(const char* suite, const char* name, void(*function)(void))
+		{
+			GetRegistry().push_back({ suite, name, function });
+		}
+	};
+
+	/**
+	 * @brief Prevents the compiler from discarding a computed value.
+	 */
+	template<typename InType>
+	inline void DoNotOptimize(const InType& value)
+	{
+		static volatile const void* sink;
+		sink = &value;
+		_ReadWriteBarrier();
+	}
+
+	/**
+	 * @brief Prevents the compiler from reordering or eliding memory writes
+	 * across this point.
+	 */
+	inline void ClobberMemory(void)
+	{
+		_ReadWriteBarrier();
+	}
+
+	/**
+	 * @brief Runs a function repeatedly, doubling the number of iterations
+	 * until a batch takes at least the minimum time.
+	 *
+	 * @param[in] function    The function to measure.
+	 * @param[in] min_seconds The minimum duration of the measured batch.
+	 *
+	 * @returns The average time of a single call in nanoseconds.
+	 */
+	template<typename InFunction>
+	inline double MeasureNanoseconds(InFunction&& function, double min_seconds = 0.1)
+	{
+		function();
+
+		for (unsigned long long iterations = 1;; iterations *= 2)
+		{
+			Clock::time_point start = Clock::now();
+
+			for (unsigned long long i = 0; i < iterations; i++)
+				function();
+
+			double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+			if (elapsed >= min_seconds * 1e9 || iterations >= (1ull << 40))
+				return elapsed / iterations;
+		}
+	}
+
+	/**
+	 * @brief Formats a byte count as a short human readable string.
+	 */
+	inline const char* FormatBytes(char* buffer, size_t buffer_size, unsigned long long bytes)
+	{
+		if (bytes >= (1ull << 20))
+			snprintf(buffer, buffer_size, "%llu MB", bytes >> 20);
+		else if (bytes >= (1ull << 10))
+			snprintf(buffer, buffer_size, "%llu KB", bytes >> 10);
+		else
+			snprintf(buffer, buffer_size, "%llu B", bytes);
+
+		return buffer;
+	}
+
+	/**
+	 * @brief Runs every registered benchmark whose "Suite.Name" contains the
+	 * filter, or all of them if no filter is passed.
+	 */
+	inline int RunAllBenchmarks(int argc, char** args)
+	{
+		const char* filter = argc > 1 ? args[1] : nullptr;
+
+		for (const BenchmarkCase& benchmark : GetRegistry())
+		{
+			char full_name[256];
+			snprintf(full_name, sizeof(full_name), "%s.%s", benchmark.m_suite, benchmark.m_name);
+
+			if (filter && !strstr(full_name, filter))
+				continue;
+
+			printf("[ RUN      ] %s\n", full_name);
+			benchmark.m_function();
+			printf("[     DONE ] %s\n\n", full_name);
+		}
+
+		return 0;
+	}
+}
+
+#define BENCHMARK(__SUITE__, __NAME__)                                      \
+	static void __SUITE__##_##__NAME__(void);                               \
+	static Benchmark::BenchmarkRegistrar __SUITE__##_##__NAME__##_registrar \
+		(#__SUITE__, #__NAME__, __SUITE__##_##__NAME__);                    \
+	static void __SUITE__##_##__NAME__(void)
+
+#endif // BENCHMARK_H
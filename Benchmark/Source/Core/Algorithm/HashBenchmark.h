@@ -0,0 +1,65 @@
+#ifndef HASH_BENCHMARK_H
+#define HASH_BENCHMARK_H
+
+#include <malloc.h>
+#include <string_view>
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Algorithm/Hash/XXHash3.h"
+#include "Core/Public/Algorithm/Hash/ConstHash.h"
+
+using namespace Forge;
+using namespace Forge::Algorithm;
+
+namespace HashBenchmark
+{
+	constexpr Size MIN_BYTES = 4;
+	constexpr Size MAX_BYTES = 16ull * 1024 * 1024;
+
+	/// Streaming updates are fed in parts of this size.
+	constexpr Size UPDATE_BYTES = 4096;
+
+	/**
+	 * Prints one row per buffer size with the throughput in GB/s of the
+	 * standard library hash, FNV-1a and the one-shot and streaming XXH3.
+	 */
+	BENCHMARK(HashBenchmark, Throughput)
+	{
+		BytePtr buffer = static_cast<BytePtr>(_aligned_malloc(MAX_BYTES, 64));
+
+		for (Size i = 0; i < MAX_BYTES; i++)
+			buffer[i] = static_cast<Byte>(i * 31 + 7);
+
+		printf("%-10s %10s %10s %10s %10s    (GB/s)\n", "size", "std", "fnv1a", "xxh3", "stream");
+
+		for (Size bytes = MIN_BYTES; bytes <= MAX_BYTES; bytes *= 4)
+		{
+			char size_name[32];
+			printf("%-10s", Benchmark::FormatBytes(size_name, sizeof(size_name), bytes));
+
+			std::string_view view(reinterpret_cast<ConstCharPtr>(buffer), bytes);
+
+			double std_ns = Benchmark::MeasureNanoseconds([&]() { Benchmark::DoNotOptimize(std::hash<std::string_view>()(view)); });
+			double fnv_ns = Benchmark::MeasureNanoseconds([&]() { Benchmark::DoNotOptimize(HashFnv1a64(view.data(), bytes)); });
+			double xxh3_ns = Benchmark::MeasureNanoseconds([&]() { Benchmark::DoNotOptimize(XXHash3::Hash64(buffer, bytes)); });
+
+			double stream_ns = Benchmark::MeasureNanoseconds([&]()
+				{
+					XXHash3 hash;
+
+					for (Size offset = 0; offset < bytes; offset += UPDATE_BYTES)
+						hash.Update(buffer + offset, bytes - offset < UPDATE_BYTES ? bytes - offset : UPDATE_BYTES);
+
+					Benchmark::DoNotOptimize(hash.GetHash64());
+				}
+			);
+
+			printf(" %10.2f %10.2f %10.2f %10.2f\n", bytes / std_ns, bytes / fnv_ns, bytes / xxh3_ns, bytes / stream_ns);
+		}
+
+		_aligned_free(buffer);
+	}
+}
+
+#endif // HASH_BENCHMARK_H
@@ -0,0 +1,143 @@
+#ifndef CHUNKED_ARRAY_BENCHMARK_H
+#define CHUNKED_ARRAY_BENCHMARK_H
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Containers/TDynamicArray.h"
+#include "Core/Public/Containers/TChunkedArray.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace ChunkedArrayBenchmark
+{
+	struct Resource
+	{
+		U64 m_id;
+		U64 m_data[7];
+	};
+
+	using ChunkedArray = TChunkedArray<Resource, 256>;
+
+	/**
+	 * Measures the average time of appending an element to a dynamic array,
+	 * which moves every element each time it grows.
+	 */
+	double MeasureDynamicFill(Size count)
+	{
+		return Benchmark::MeasureNanoseconds([count]()
+		{
+			TDynamicArray<Resource> array;
+
+			for (Size i = 0; i < count; i++)
+				array.PushBack(Resource { i });
+
+			Benchmark::DoNotOptimize(array[count - 1]);
+		}) / count;
+	}
+
+	/**
+	 * Measures the average time of adding an element to a chunked array.
+	 */
+	double MeasureChunkedFill(Size count)
+	{
+		return Benchmark::MeasureNanoseconds([count]()
+		{
+			ChunkedArray array;
+
+			for (Size i = 0; i < count; i++)
+				array.Add(Resource { i });
+
+			Benchmark::DoNotOptimize(array[count - 1]);
+		}) / count;
+	}
+
+	double MeasureDynamicVisit(Size count)
+	{
+		TDynamicArray<Resource> array;
+
+		for (Size i = 0; i < count; i++)
+			array.PushBack(Resource { i });
+
+		return Benchmark::MeasureNanoseconds([&array, count]()
+		{
+			U64 sum = 0;
+
+			for (Size i = 0; i < count; i++)
+				sum += array[i].m_id;
+
+			Benchmark::DoNotOptimize(sum);
+		}) / count;
+	}
+
+	/**
+	 * Measures the average time of visiting an element of a chunked array,
+	 * through its iterator or chunk by chunk.
+	 */
+	double MeasureChunkedVisit(Size count, Bool by_chunk)
+	{
+		ChunkedArray array;
+
+		for (Size i = 0; i < count; i++)
+			array.Add(Resource { i });
+
+		return Benchmark::MeasureNanoseconds([&array, by_chunk]()
+		{
+			U64 sum = 0;
+
+			if (by_chunk)
+			{
+				for (Size i = 0; i < array.GetChunkCount(); i++)
+				{
+					auto chunk = array.GetChunk(i);
+
+					for (Size j = 0; j < chunk.GetCount(); j++)
+						sum += chunk[j].m_id;
+				}
+			}
+			else
+			{
+				for (auto itr = array.GetStartItr(); itr != array.GetEndItr(); itr++)
+					sum += itr->m_id;
+			}
+
+			Benchmark::DoNotOptimize(sum);
+		}) / count;
+	}
+
+	/**
+	 * Compares filling a dynamic array against a chunked array.
+	 */
+	BENCHMARK(ChunkedArrayBenchmark, Fill)
+	{
+		printf("%-10s %12s %12s    (ns/element)\n", "count", "dynamic", "chunked");
+
+		for (Size count = 1000; count <= 1000000; count *= 10)
+		{
+			double dynamic_time = MeasureDynamicFill(count);
+			double chunked_time = MeasureChunkedFill(count);
+
+			printf("%-10llu %12.2f %12.2f\n", count, dynamic_time, chunked_time);
+		}
+	}
+
+	/**
+	 * Compares visiting every element of a dynamic array against a chunked
+	 * array.
+	 */
+	BENCHMARK(ChunkedArrayBenchmark, Visit)
+	{
+		printf("%-10s %12s %12s %12s    (ns/element)\n", "count", "dynamic", "iterator", "chunk");
+
+		for (Size count = 1000; count <= 1000000; count *= 10)
+		{
+			double dynamic_time = MeasureDynamicVisit(count);
+			double iterator_time = MeasureChunkedVisit(count, false);
+			double chunk_time = MeasureChunkedVisit(count, true);
+
+			printf("%-10llu %12.2f %12.2f %12.2f\n", count, dynamic_time, iterator_time, chunk_time);
+		}
+	}
+}
+
+#endif // CHUNKED_ARRAY_BENCHMARK_H
@@ -0,0 +1,140 @@
+#ifndef FLAT_HASH_MAP_BENCHMARK_H
+#define FLAT_HASH_MAP_BENCHMARK_H
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Containers/TFlatHashMap.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace FlatHashMapBenchmark
+{
+	constexpr Size MIN_COUNT = 1000;
+	constexpr Size MAX_COUNT = 10000000;
+
+	/// Every measurement touches at least this many elements, small maps
+	/// are rebuilt and measured several times.
+	constexpr Size MIN_OPS = 10000000;
+
+	/**
+	 * The operations measured on both maps, written once against the
+	 * interface of each map.
+	 */
+	struct StdMap
+	{
+		std::unordered_map<U64, U64> m_map;
+
+		Void Insert(U64 key, U64 value)       { m_map.emplace(key, value); }
+		Bool Contains(U64 key) const          { return m_map.find(key) != m_map.end(); }
+		Void Remove(U64 key)                  { m_map.erase(key); }
+	};
+
+	struct FlatMap
+	{
+		TFlatHashMap<U64, U64> m_map;
+
+		Void Insert(U64 key, U64 value)       { m_map.Insert(key, value); }
+		Bool Contains(U64 key) const          { return m_map.Contains(key); }
+		Void Remove(U64 key)                  { m_map.Remove(key); }
+	};
+
+	/**
+	 * Generates distinct pseudo random keys, the first half is inserted and
+	 * the second half is only used for missed lookups.
+	 */
+	std::vector<U64> GenerateKeys(Size count)
+	{
+		std::vector<U64> keys(count * 2);
+
+		U64 state = 0x9E3779B97F4A7C15ull;
+
+		for (Size i = 0; i < keys.size(); i++)
+		{
+			state += 0x9E3779B97F4A7C15ull;
+			keys[i] = Algorithm::HashMix64(state);
+		}
+
+		return keys;
+	}
+
+	/**
+	 * Measures the average time of a single insert, hit lookup, missed lookup
+	 * and erase into a map of the specified size.
+	 */
+	template<typename InMap>
+	Void Measure(const std::vector<U64>& keys, Size count, double results[4])
+	{
+		Size num_of_rounds = std::max<Size>(1, MIN_OPS / count);
+
+		const U64* inserted = keys.data();
+		const U64* missing = keys.data() + count;
+
+		for (Size i = 0; i < 4; i++)
+			results[i] = 0.0;
+
+		for (Size round = 0; round < num_of_rounds; round++)
+		{
+			InMap map;
+			Size found = 0;
+
+			Benchmark::Clock::time_point start = Benchmark::Clock::now();
+			for (Size i = 0; i < count; i++)
+				map.Insert(inserted[i], i);
+			Benchmark::Clock::time_point inserted_time = Benchmark::Clock::now();
+
+			for (Size i = 0; i < count; i++)
+				found += map.Contains(inserted[count - i - 1]);
+			Benchmark::Clock::time_point hit_time = Benchmark::Clock::now();
+
+			for (Size i = 0; i < count; i++)
+				found += map.Contains(missing[i]);
+			Benchmark::Clock::time_point miss_time = Benchmark::Clock::now();
+
+			for (Size i = 0; i < count; i++)
+				map.Remove(inserted[i]);
+			Benchmark::Clock::time_point remove_time = Benchmark::Clock::now();
+
+			Benchmark::DoNotOptimize(found);
+
+			results[0] += std::chrono::duration<double, std::nano>(inserted_time - start).count();
+			results[1] += std::chrono::duration<double, std::nano>(hit_time - inserted_time).count();
+			results[2] += std::chrono::duration<double, std::nano>(miss_time - hit_time).count();
+			results[3] += std::chrono::duration<double, std::nano>(remove_time - miss_time).count();
+		}
+
+		for (Size i = 0; i < 4; i++)
+			results[i] /= static_cast<double>(num_of_rounds * count);
+	}
+
+	/**
+	 * Compares TFlatHashMap against std::unordered_map for a growing number
+	 * of 64-bit keys, inserted without reserving.
+	 */
+	BENCHMARK(FlatHashMapBenchmark, Operations)
+	{
+		std::vector<U64> keys = GenerateKeys(MAX_COUNT);
+
+		printf("%-10s %-6s %10s %10s %10s %10s    (ns/op)\n", "count", "map", "insert", "hit", "miss", "erase");
+
+		for (Size count = MIN_COUNT; count <= MAX_COUNT; count *= 10)
+		{
+			double std_results[4], flat_results[4];
+
+			/// Keys missed by this size follow the inserted ones.
+			std::vector<U64> size_keys(keys.begin(), keys.begin() + count);
+			size_keys.insert(size_keys.end(), keys.begin() + MAX_COUNT, keys.begin() + MAX_COUNT + count);
+
+			Measure<StdMap>(size_keys, count, std_results);
+			Measure<FlatMap>(size_keys, count, flat_results);
+
+			printf("%-10llu %-6s %10.2f %10.2f %10.2f %10.2f\n", count, "std", std_results[0], std_results[1], std_results[2], std_results[3]);
+			printf("%-10llu %-6s %10.2f %10.2f %10.2f %10.2f\n", count, "flat", flat_results[0], flat_results[1], flat_results[2], flat_results[3]);
+		}
+	}
+}
+
+#endif // FLAT_HASH_MAP_BENCHMARK_H
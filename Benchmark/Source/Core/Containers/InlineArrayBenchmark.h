@@ -0,0 +1,60 @@
+#ifndef INLINE_ARRAY_BENCHMARK_H
+#define INLINE_ARRAY_BENCHMARK_H
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Containers/TDynamicArray.h"
+#include "Core/Public/Containers/TInlineArray.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace InlineArrayBenchmark
+{
+	constexpr Size NUM_OF_LISTS = 1024;
+
+	/**
+	 * Measures the average time of building a short list, like the binding
+	 * list of a draw, summing it and destroying it.
+	 */
+	template<typename InArray>
+	double MeasureShortLists(Size length)
+	{
+		return Benchmark::MeasureNanoseconds([length]()
+		{
+			U64 sum = 0;
+
+			for (Size i = 0; i < NUM_OF_LISTS; i++)
+			{
+				InArray list;
+
+				for (Size j = 0; j < length; j++)
+					list.PushBack(i + j);
+
+				for (auto itr = list.GetStartItr(); itr != list.GetEndItr(); itr++)
+					sum += *itr;
+			}
+
+			Benchmark::DoNotOptimize(sum);
+		}) / NUM_OF_LISTS;
+	}
+
+	/**
+	 * Compares TInlineArray against TDynamicArray on lists within and past
+	 * the inline capacity.
+	 */
+	BENCHMARK(InlineArrayBenchmark, ShortLists)
+	{
+		printf("%-10s %12s %12s    (ns/list)\n", "length", "dynamic", "inline");
+
+		for (Size length = 2; length <= 32; length *= 2)
+		{
+			double dynamic_time = MeasureShortLists<TDynamicArray<U64>>(length);
+			double inline_time = MeasureShortLists<TInlineArray<U64, 16>>(length);
+
+			printf("%-10llu %12.2f %12.2f\n", length, dynamic_time, inline_time);
+		}
+	}
+}
+
+#endif // INLINE_ARRAY_BENCHMARK_H
@@ -0,0 +1,148 @@
+#ifndef LINKED_LIST_BENCHMARK_H
+#define LINKED_LIST_BENCHMARK_H
+
+#include <vector>
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Containers/TLinkedList.h"
+#include "Core/Public/Containers/TIntrusiveList.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace LinkedListBenchmark
+{
+	using HeapList = TLinkedList<U64>;
+	using PoolList = TLinkedList<U64, Memory::NodePoolAllocatorPolicy>;
+
+	struct Entry
+	{
+		U64 m_value;
+
+		IntrusiveListHook m_hook;
+	};
+
+	using IntrusiveList = TIntrusiveList<Entry, &Entry::m_hook>;
+
+	/**
+	 * Fills a list while other allocations of varying sizes are made in
+	 * between, like the nodes of a long lived list would be, then measures
+	 * the average time of visiting a node.
+	 */
+	template<typename InList>
+	double MeasureTraversal(Size count)
+	{
+		InList list;
+		std::vector<VoidPtr> noise;
+
+		for (Size i = 0; i < count; i++)
+		{
+			list.PushBack(i);
+			noise.push_back(malloc(16 + (i * 7919) % 240));
+		}
+
+		double time = Benchmark::MeasureNanoseconds([&list]()
+		{
+			U64 sum = 0;
+
+			for (auto itr = list.GetStartItr(); itr != list.GetEndItr(); itr++)
+				sum += *itr;
+
+			Benchmark::DoNotOptimize(sum);
+		}) / count;
+
+		for (VoidPtr address : noise)
+			free(address);
+
+		return time;
+	}
+
+	/**
+	 * Measures the average time of removing a node from the middle of a list
+	 * and inserting it back at its end, the pattern of a least recently used
+	 * list.
+	 */
+	template<typename InList>
+	double MeasureChurn(Size count)
+	{
+		InList list;
+
+		for (Size i = 0; i < count; i++)
+			list.PushBack(i);
+
+		return Benchmark::MeasureNanoseconds([&list, count]()
+		{
+			for (Size i = 0; i < count; i++)
+			{
+				U64 value = list.PeekFront();
+
+				list.PopFront();
+				list.PushBack(value);
+			}
+
+			Benchmark::DoNotOptimize(list);
+		}) / count;
+	}
+
+	double MeasureIntrusiveChurn(Size count)
+	{
+		std::vector<Entry> entries(count);
+		IntrusiveList list;
+
+		for (Size i = 0; i < count; i++)
+		{
+			entries[i].m_value = i;
+			list.PushBack(entries[i]);
+		}
+
+		double time = Benchmark::MeasureNanoseconds([&list, count]()
+		{
+			for (Size i = 0; i < count; i++)
+				list.MoveToBack(list.PeekFront());
+
+			Benchmark::DoNotOptimize(list);
+		}) / count;
+
+		list.Clear();
+
+		return time;
+	}
+
+	/**
+	 * Compares a linked list allocating its nodes from the heap against one
+	 * allocating them from a node pool.
+	 */
+	BENCHMARK(LinkedListBenchmark, Traversal)
+	{
+		printf("%-10s %12s %12s    (ns/node)\n", "count", "heap", "pool");
+
+		for (Size count = 1000; count <= 1000000; count *= 10)
+		{
+			double heap_time = MeasureTraversal<HeapList>(count);
+			double pool_time = MeasureTraversal<PoolList>(count);
+
+			printf("%-10llu %12.2f %12.2f\n", count, heap_time, pool_time);
+		}
+	}
+
+	/**
+	 * Compares recycling the front node to the back of a heap linked list, a
+	 * pooled linked list and an intrusive list.
+	 */
+	BENCHMARK(LinkedListBenchmark, Churn)
+	{
+		printf("%-10s %12s %12s %12s    (ns/operation)\n", "count", "heap", "pool", "intrusive");
+
+		for (Size count = 1000; count <= 1000000; count *= 10)
+		{
+			double heap_time = MeasureChurn<HeapList>(count);
+			double pool_time = MeasureChurn<PoolList>(count);
+			double intrusive_time = MeasureIntrusiveChurn(count);
+
+			printf("%-10llu %12.2f %12.2f %12.2f\n", count, heap_time, pool_time, intrusive_time);
+		}
+	}
+}
+
+#endif // LINKED_LIST_BENCHMARK_H
@@ -0,0 +1,167 @@
+#ifndef QUEUE_BENCHMARK_H
+#define QUEUE_BENCHMARK_H
+
+#include <list>
+#include <queue>
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Containers/TStaticQueue.h"
+#include "Core/Public/Containers/TDynamicQueue.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace QueueBenchmark
+{
+	constexpr Size STATIC_CAPACITY = 4096;
+
+	/**
+	 * The queues measured, written once against the interface of each queue.
+	 *
+	 * ShiftQueue and ListQueue reproduce the previous TStaticQueue, which
+	 * shifted every element down on a pop, and the previous TDynamicQueue,
+	 * which allocated a linked list node per element.
+	 */
+	struct ShiftQueue
+	{
+		U64  m_elements[STATIC_CAPACITY];
+		Size m_count = 0;
+
+		Void Push(U64 value) { m_elements[m_count++] = value; }
+		U64  Peek(Void) const { return m_elements[0]; }
+
+		Void Pop(Void)
+		{
+			for (Size i = 1; i < m_count; i++)
+				m_elements[i - 1] = m_elements[i];
+
+			m_count--;
+		}
+	};
+
+	struct RingQueue
+	{
+		TStaticQueue<U64, STATIC_CAPACITY> m_queue;
+
+		Void Push(U64 value) { m_queue.Push(value); }
+		U64  Peek(Void) const { return m_queue.Peek(); }
+		Void Pop(Void)        { m_queue.Pop(); }
+	};
+
+	struct ListQueue
+	{
+		std::queue<U64, std::list<U64>> m_queue;
+
+		Void Push(U64 value) { m_queue.push(value); }
+		U64  Peek(Void) const { return m_queue.front(); }
+		Void Pop(Void)        { m_queue.pop(); }
+	};
+
+	struct DequeQueue
+	{
+		TDynamicQueue<U64> m_queue;
+
+		Void Push(U64 value) { m_queue.Push(value); }
+		U64  Peek(Void)       { return m_queue.Peek(); }
+		Void Pop(Void)        { m_queue.Pop(); }
+	};
+
+	/**
+	 * Measures the average time of pushing a number of elements and then
+	 * popping all of them.
+	 */
+	template<typename InQueue>
+	double MeasureFillDrain(Size count)
+	{
+		return Benchmark::MeasureNanoseconds([count]()
+		{
+			InQueue* queue = new InQueue();
+			U64 sum = 0;
+
+			for (Size i = 0; i < count; i++)
+				queue->Push(i);
+
+			for (Size i = 0; i < count; i++)
+			{
+				sum += queue->Peek();
+				queue->Pop();
+			}
+
+			Benchmark::DoNotOptimize(sum);
+
+			delete queue;
+		}) / count;
+	}
+
+	/**
+	 * Measures the average time of a push and a pop on a queue holding a
+	 * steady number of elements, like a job or message queue.
+	 */
+	template<typename InQueue>
+	double MeasureSteady(Size count)
+	{
+		InQueue* queue = new InQueue();
+
+		for (Size i = 0; i < count; i++)
+			queue->Push(i);
+
+		double time = Benchmark::MeasureNanoseconds([queue, count]()
+		{
+			U64 sum = 0;
+
+			for (Size i = 0; i < count; i++)
+			{
+				queue->Push(i);
+				sum += queue->Peek();
+				queue->Pop();
+			}
+
+			Benchmark::DoNotOptimize(sum);
+		}) / count;
+
+		delete queue;
+
+		return time;
+	}
+
+	/**
+	 * Compares the ring buffer TStaticQueue against popping by shifting the
+	 * remaining elements.
+	 */
+	BENCHMARK(QueueBenchmark, StaticQueue)
+	{
+		printf("%-10s %12s %12s    (ns/element)\n", "count", "shift", "ring");
+
+		for (Size count = 16; count < STATIC_CAPACITY; count *= 4)
+		{
+			double shift_time = MeasureFillDrain<ShiftQueue>(count);
+			double ring_time = MeasureFillDrain<RingQueue>(count);
+
+			printf("%-10llu %12.2f %12.2f\n", count, shift_time, ring_time);
+		}
+	}
+
+	/**
+	 * Compares the block based TDynamicQueue against a queue allocating a
+	 * linked list node per element.
+	 */
+	BENCHMARK(QueueBenchmark, DynamicQueue)
+	{
+		printf("%-10s %-8s %12s %12s    (ns/element)\n", "count", "mode", "list", "deque");
+
+		for (Size count = 1000; count <= 1000000; count *= 10)
+		{
+			double list_fill = MeasureFillDrain<ListQueue>(count);
+			double deque_fill = MeasureFillDrain<DequeQueue>(count);
+
+			double list_steady = MeasureSteady<ListQueue>(count);
+			double deque_steady = MeasureSteady<DequeQueue>(count);
+
+			printf("%-10llu %-8s %12.2f %12.2f\n", count, "fill", list_fill, deque_fill);
+			printf("%-10llu %-8s %12.2f %12.2f\n", count, "steady", list_steady, deque_steady);
+		}
+	}
+}
+
+#endif // QUEUE_BENCHMARK_H
@@ -0,0 +1,105 @@
+#ifndef SOA_ARRAY_BENCHMARK_H
+#define SOA_ARRAY_BENCHMARK_H
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Containers/TDynamicArray.h"
+#include "Core/Public/Containers/TSoAArray.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace SoAArrayBenchmark
+{
+	struct Vector
+	{
+		F32 x, y, z;
+	};
+
+	struct Color
+	{
+		F32 r, g, b, a;
+	};
+
+	struct Particle
+	{
+		Vector m_position;
+		Vector m_velocity;
+		Color  m_color;
+		F32    m_age;
+	};
+
+	using ParticleArray = TSoAArray<Vector, Vector, Color, F32>;
+
+	enum { POSITION, VELOCITY, COLOR, AGE };
+
+	/**
+	 * Measures the average time of a pass integrating the positions of
+	 * particles stored as an array of structs.
+	 */
+	double MeasureAoS(Size count)
+	{
+		TDynamicArray<Particle> particles;
+
+		for (Size i = 0; i < count; i++)
+			particles.PushBack(Particle { { F32(i), 0.0f, 0.0f }, { 1.0f, 2.0f, 3.0f }, { 1.0f, 1.0f, 1.0f, 1.0f }, 0.0f });
+
+		return Benchmark::MeasureNanoseconds([&particles, count]()
+		{
+			for (Size i = 0; i < count; i++)
+			{
+				particles[i].m_position.x += particles[i].m_velocity.x * 0.016f;
+				particles[i].m_position.y += particles[i].m_velocity.y * 0.016f;
+				particles[i].m_position.z += particles[i].m_velocity.z * 0.016f;
+			}
+
+			Benchmark::DoNotOptimize(particles[count - 1]);
+		}) / count;
+	}
+
+	/**
+	 * Measures the average time of the same pass over particles stored as
+	 * a structure of arrays, reading only the position and velocity columns.
+	 */
+	double MeasureSoA(Size count)
+	{
+		ParticleArray particles;
+
+		for (Size i = 0; i < count; i++)
+			particles.PushBack(Vector { F32(i), 0.0f, 0.0f }, Vector { 1.0f, 2.0f, 3.0f }, Color { 1.0f, 1.0f, 1.0f, 1.0f }, 0.0f);
+
+		return Benchmark::MeasureNanoseconds([&particles, count]()
+		{
+			Vector* positions = particles.GetColumn<POSITION>().GetPointer();
+			const Vector* velocities = particles.GetColumn<VELOCITY>().GetPointer();
+
+			for (Size i = 0; i < count; i++)
+			{
+				positions[i].x += velocities[i].x * 0.016f;
+				positions[i].y += velocities[i].y * 0.016f;
+				positions[i].z += velocities[i].z * 0.016f;
+			}
+
+			Benchmark::DoNotOptimize(positions[count - 1]);
+		}) / count;
+	}
+
+	/**
+	 * Compares integrating particle positions in an array of structs against
+	 * a structure of arrays.
+	 */
+	BENCHMARK(SoAArrayBenchmark, Integrate)
+	{
+		printf("%-10s %12s %12s    (ns/particle)\n", "count", "aos", "soa");
+
+		for (Size count = 1000; count <= 1000000; count *= 10)
+		{
+			double aos_time = MeasureAoS(count);
+			double soa_time = MeasureSoA(count);
+
+			printf("%-10llu %12.2f %12.2f\n", count, aos_time, soa_time);
+		}
+	}
+}
+
+#endif // SOA_ARRAY_BENCHMARK_H
@@ -0,0 +1,136 @@
+#ifndef STACK_BENCHMARK_H
+#define STACK_BENCHMARK_H
+
+#include <list>
+#include <stack>
+#include <vector>
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Containers/TDynamicStack.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace StackBenchmark
+{
+	/**
+	 * The stacks measured, written once against the interface of each stack.
+	 *
+	 * ListStack reproduces the previous TDynamicStack, which allocated a
+	 * linked list node per element.
+	 */
+	struct ListStack
+	{
+		std::stack<U64, std::list<U64>> m_stack;
+
+		Void Push(U64 value)  { m_stack.push(value); }
+		U64  Peek(Void) const { return m_stack.top(); }
+		Void Pop(Void)        { m_stack.pop(); }
+		Bool IsEmpty(Void) const { return m_stack.empty(); }
+	};
+
+	struct VectorStack
+	{
+		std::stack<U64, std::vector<U64>> m_stack;
+
+		Void Push(U64 value)  { m_stack.push(value); }
+		U64  Peek(Void) const { return m_stack.top(); }
+		Void Pop(Void)        { m_stack.pop(); }
+		Bool IsEmpty(Void) const { return m_stack.empty(); }
+	};
+
+	struct ChunkedStack
+	{
+		TDynamicStack<U64> m_stack;
+
+		Void Push(U64 value) { m_stack.Push(value); }
+		U64  Peek(Void)      { return m_stack.Peek(); }
+		Void Pop(Void)       { m_stack.Pop(); }
+		Bool IsEmpty(Void) const { return m_stack.IsEmpty(); }
+	};
+
+	/**
+	 * Measures the average time of pushing a number of elements on a new
+	 * stack and then popping all of them.
+	 */
+	template<typename InStack>
+	double MeasurePushPop(Size count)
+	{
+		return Benchmark::MeasureNanoseconds([count]()
+		{
+			InStack stack;
+			U64 sum = 0;
+
+			for (Size i = 0; i < count; i++)
+				stack.Push(i);
+
+			for (Size i = 0; i < count; i++)
+			{
+				sum += stack.Peek();
+				stack.Pop();
+			}
+
+			Benchmark::DoNotOptimize(sum);
+		}) / count;
+	}
+
+	/**
+	 * Measures the average time per visited node of a depth first traversal
+	 * of an implicit binary tree, driven by a worklist stack that is reused
+	 * across traversals.
+	 */
+	template<typename InStack>
+	double MeasureWorklist(Size count)
+	{
+		InStack stack;
+
+		return Benchmark::MeasureNanoseconds([&stack, count]()
+		{
+			U64 sum = 0;
+
+			stack.Push(0);
+
+			while (!stack.IsEmpty())
+			{
+				U64 node = stack.Peek();
+				stack.Pop();
+
+				sum += node;
+
+				if (node * 2 + 1 < count)
+					stack.Push(node * 2 + 1);
+				if (node * 2 + 2 < count)
+					stack.Push(node * 2 + 2);
+			}
+
+			Benchmark::DoNotOptimize(sum);
+		}) / count;
+	}
+
+	/**
+	 * Compares the block based TDynamicStack against a stack allocating a
+	 * linked list node per element and a stack on a growing array.
+	 */
+	BENCHMARK(StackBenchmark, Throughput)
+	{
+		printf("%-10s %-9s %10s %10s %10s    (ns/element)\n", "count", "mode", "list", "vector", "chunked");
+
+		for (Size count = 1000; count <= 1000000; count *= 10)
+		{
+			double list_time = MeasurePushPop<ListStack>(count);
+			double vector_time = MeasurePushPop<VectorStack>(count);
+			double chunked_time = MeasurePushPop<ChunkedStack>(count);
+
+			printf("%-10llu %-9s %10.2f %10.2f %10.2f\n", count, "push-pop", list_time, vector_time, chunked_time);
+
+			list_time = MeasureWorklist<ListStack>(count);
+			vector_time = MeasureWorklist<VectorStack>(count);
+			chunked_time = MeasureWorklist<ChunkedStack>(count);
+
+			printf("%-10llu %-9s %10.2f %10.2f %10.2f\n", count, "worklist", list_time, vector_time, chunked_time);
+		}
+	}
+}
+
+#endif // STACK_BENCHMARK_H
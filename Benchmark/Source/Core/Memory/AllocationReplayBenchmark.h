@@ -0,0 +1,369 @@
+#ifndef ALLOCATION_REPLAY_BENCHMARK_H
+#define ALLOCATION_REPLAY_BENCHMARK_H
+
+#include <cstdlib>
+#include <algorithm>
+#include <unordered_map>
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Memory/CAllocator.h"
+#include "Core/Public/Memory/PoolAllocator.h"
+#include "Core/Public/Memory/TLSFAllocator.h"
+#include "Core/Public/Memory/FreeListAllocator.h"
+#include "Core/Public/Memory/RecordingAllocator.h"
+#include "Core/Public/Memory/ThreadCachingAllocator.h"
+
+using namespace Forge;
+using namespace Forge::Memory;
+
+namespace AllocationReplayBenchmark
+{
+	constexpr Size POOL_SIZE = 512ull * 1024 * 1024;
+	constexpr Size MAX_POOL_CHUNK_SIZE = 64 * 1024;
+
+	/**
+	 * A captured trace is replayed if this environment variable names it,
+	 * otherwise a synthetic session is recorded and replayed instead.
+	 */
+	constexpr const char* TRACE_PATH_VARIABLE = "FORGE_ALLOCATION_TRACE";
+	constexpr const char* SYNTHETIC_TRACE_PATH = "SyntheticAllocationTrace.bin";
+
+	struct ReplayResult
+	{
+		Size m_num_of_ops;
+		Size m_num_of_failures;
+
+		std::vector<double> m_latencies;
+
+		Size m_peak_live_bytes;
+		Size m_peak_span;
+	};
+
+	Bool LoadTrace(const char* path, std::vector<AllocationTraceRecord>& records)
+	{
+		FILE* file;
+
+		if (fopen_s(&file, path, "rb") != 0)
+			return false;
+
+		AllocationTraceHeader header;
+
+		if (fread(&header, sizeof(AllocationTraceHeader), 1, file) != 1 ||
+			header.m_magic != RecordingAllocator::TRACE_MAGIC || header.m_version != RecordingAllocator::TRACE_VERSION)
+		{
+			fclose(file);
+			return false;
+		}
+
+		records.resize(header.m_num_of_records);
+		records.resize(fread(records.data(), sizeof(AllocationTraceRecord), records.size(), file));
+
+		fclose(file);
+
+		return true;
+	}
+
+	/**
+	 * Records a deterministic session shaped like a game loop: long-lived
+	 * objects created in bursts, containers growing through reallocation,
+	 * and short-lived per-frame allocations of mixed sizes.
+	 */
+	Void RecordSyntheticTrace(const char* path)
+	{
+		TLSFAllocator backing_allocator(POOL_SIZE);
+		RecordingAllocator allocator(&backing_allocator, path);
+
+		U64 state = 0x9E3779B97F4A7C15ull;
+		auto next_random = [&state]() -> U32
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			return static_cast<U32>(state >> 33);
+		};
+
+		std::vector<VoidPtr> objects;
+		std::vector<std::pair<VoidPtr, Size>> containers(64, { nullptr, 0 });
+
+		for (U32 frame = 0; frame < 2000; frame++)
+		{
+			/// Objects spawn in bursts and a random subset dies every frame.
+			if (frame % 50 == 0)
+				for (U32 i = 0; i < 200; i++)
+					objects.push_back(allocator.Allocate(64 + next_random() % 960, 16));
+
+			for (U32 i = 0; i < 4 && !objects.empty(); i++)
+			{
+				Size index = next_random() % objects.size();
+
+				allocator.Deallocate(objects[index]);
+				objects[index] = objects.back();
+				objects.pop_back();
+			}
+
+			/// Containers double their capacity and are cleared now and then.
+			std::pair<VoidPtr, Size>& container = containers[next_random() % containers.size()];
+
+			if (container.second > 256 * 1024)
+			{
+				allocator.Deallocate(container.first);
+				container = { nullptr, 0 };
+			}
+			else
+			{
+				container.second = container.second ? container.second * 2 : 64;
+				container.first = allocator.Reallocate(container.first, container.second, 16);
+			}
+
+			/// Transient per-frame data.
+			VoidPtr transients[64];
+			U32 num_of_transients = 16 + next_random() % 48;
+
+			for (U32 i = 0; i < num_of_transients; i++)
+				transients[i] = allocator.Allocate(16 + next_random() % (next_random() % 8 ? 256 : 8192), 8);
+
+			for (U32 i = num_of_transients; i > 0; i--)
+				allocator.Deallocate(transients[i - 1]);
+		}
+
+		for (VoidPtr object : objects)
+			allocator.Deallocate(object);
+
+		for (std::pair<VoidPtr, Size>& container : containers)
+			if (container.first)
+				allocator.Deallocate(container.first);
+	}
+
+	/**
+	 * Replays a trace against an allocator on the calling thread, in the
+	 * order the calls were recorded. Only the allocator calls are timed.
+	 */
+	ReplayResult ReplayTrace(AbstractAllocator& allocator, const std::vector<AllocationTraceRecord>& records)
+	{
+		ReplayResult result = {};
+		result.m_latencies.reserve(records.size());
+
+		std::unordered_map<U64, std::pair<VoidPtr, Size>> live_addresses;
+		live_addresses.reserve(1 << 16);
+
+		Size live_bytes = 0;
+		U64 min_address = ~0ull, max_address = 0;
+
+		auto record_span = [&](VoidPtr address, Size size)
+		{
+			min_address = std::min(min_address, reinterpret_cast<U64>(address));
+			max_address = std::max(max_address, reinterpret_cast<U64>(address) + size);
+		};
+
+		for (const AllocationTraceRecord& record : records)
+		{
+			Byte alignment = record.m_alignment ? record.m_alignment : 4;
+
+			try
+			{
+				switch (record.m_op)
+				{
+				case AllocationTraceOp::FORGE_ALLOCATE:
+				{
+					Benchmark::Clock::time_point start = Benchmark::Clock::now();
+					VoidPtr address = allocator.Allocate(record.m_size, alignment);
+					result.m_latencies.push_back(std::chrono::duration<double, std::nano>(Benchmark::Clock::now() - start).count());
+
+					if (!address)
+					{
+						result.m_num_of_failures++;
+						break;
+					}
+
+					live_addresses[record.m_address] = { address, record.m_size };
+					live_bytes += record.m_size;
+					record_span(address, record.m_size);
+					break;
+				}
+				case AllocationTraceOp::FORGE_REALLOCATE:
+				{
+					auto it = live_addresses.find(record.m_address);
+					VoidPtr prev_address = it != live_addresses.end() ? it->second.first : nullptr;
+					Size prev_size = it != live_addresses.end() ? it->second.second : 0;
+
+					Benchmark::Clock::time_point start = Benchmark::Clock::now();
+					VoidPtr address = allocator.Reallocate(prev_address, record.m_size, alignment);
+					result.m_latencies.push_back(std::chrono::duration<double, std::nano>(Benchmark::Clock::now() - start).count());
+
+					if (!address)
+					{
+						result.m_num_of_failures++;
+						break;
+					}
+
+					if (it != live_addresses.end())
+						live_addresses.erase(it);
+
+					live_addresses[record.m_new_address] = { address, record.m_size };
+					live_bytes += record.m_size - prev_size;
+					record_span(address, record.m_size);
+					break;
+				}
+				case AllocationTraceOp::FORGE_DEALLOCATE:
+				{
+					auto it = live_addresses.find(record.m_address);
+
+					if (it == live_addresses.end())
+						break;
+
+					Benchmark::Clock::time_point start = Benchmark::Clock::now();
+					allocator.Deallocate(it->second.first);
+					result.m_latencies.push_back(std::chrono::duration<double, std::nano>(Benchmark::Clock::now() - start).count());
+
+					live_bytes -= it->second.second;
+					live_addresses.erase(it);
+					break;
+				}
+				case AllocationTraceOp::FORGE_RESET:
+				{
+					allocator.Reset();
+
+					live_addresses.clear();
+					live_bytes = 0;
+					break;
+				}
+				}
+			}
+			catch (...)
+			{
+				result.m_num_of_failures++;
+			}
+
+			result.m_peak_live_bytes = std::max(result.m_peak_live_bytes, live_bytes);
+		}
+
+		/// Anything the trace left live is released outside of the measurement.
+		for (auto& live_address : live_addresses)
+			allocator.Deallocate(live_address.second.first);
+
+		result.m_num_of_ops = result.m_latencies.size();
+		result.m_peak_span = max_address > min_address ? max_address - min_address : 0;
+
+		return result;
+	}
+
+	/**
+	 * Prints throughput over the time spent inside the allocator, latency
+	 * percentiles and fragmentation. Fragmentation is the share of the address
+	 * span touched by the allocator that was not covered by live data at its
+	 * peak, which is only meaningful for allocators managing a single pool.
+	 */
+	Void PrintResult(const char* name, ReplayResult& result, Bool has_pool)
+	{
+		double total = 0.0;
+		for (double latency : result.m_latencies)
+			total += latency;
+
+		std::sort(result.m_latencies.begin(), result.m_latencies.end());
+
+		auto percentile = [&result](double p)
+		{
+			return result.m_latencies.empty() ? 0.0 : result.m_latencies[static_cast<Size>(p * (result.m_latencies.size() - 1))];
+		};
+
+		char live_buffer[32], span_buffer[32], fragmentation_buffer[32];
+
+		if (has_pool && result.m_peak_span)
+		{
+			snprintf(fragmentation_buffer, sizeof(fragmentation_buffer), "%.1f%%", 100.0 * (1.0 - static_cast<double>(result.m_peak_live_bytes) / result.m_peak_span));
+			Benchmark::FormatBytes(span_buffer, sizeof(span_buffer), result.m_peak_span);
+		}
+		else
+		{
+			snprintf(fragmentation_buffer, sizeof(fragmentation_buffer), "-");
+			snprintf(span_buffer, sizeof(span_buffer), "-");
+		}
+
+		printf("%-16s %10.2f %8.1f %8.1f %8.1f %8.1f %10.1f %10s %10s %8s %8llu\n", name,
+			total > 0.0 ? result.m_num_of_ops / total * 1e3 : 0.0,
+			percentile(0.5), percentile(0.9), percentile(0.99), percentile(0.999), percentile(1.0),
+			Benchmark::FormatBytes(live_buffer, sizeof(live_buffer), result.m_peak_live_bytes), span_buffer,
+			fragmentation_buffer, result.m_num_of_failures);
+	}
+
+	/**
+	 * Replays a captured, or otherwise a synthetic, allocation trace against
+	 * every allocator of the engine and the system allocator.
+	 */
+	BENCHMARK(AllocationReplayBenchmark, Replay)
+	{
+		char* trace_path = nullptr;
+		size_t trace_path_length = 0;
+
+		_dupenv_s(&trace_path, &trace_path_length, TRACE_PATH_VARIABLE);
+
+		if (!trace_path)
+			RecordSyntheticTrace(SYNTHETIC_TRACE_PATH);
+
+		std::vector<AllocationTraceRecord> records;
+
+		if (!LoadTrace(trace_path ? trace_path : SYNTHETIC_TRACE_PATH, records))
+		{
+			printf("Failed to load allocation trace %s\n", trace_path ? trace_path : SYNTHETIC_TRACE_PATH);
+			free(trace_path);
+			return;
+		}
+
+		printf("trace: %s, %llu records\n", trace_path ? trace_path : SYNTHETIC_TRACE_PATH, records.size());
+		free(trace_path);
+
+		/// The pool allocator can only serve traces whose requests all fit a
+		/// single chunk, it is sized for the peak number of live addresses.
+		Size max_size = 0, max_live_count = 0, live_count = 0;
+
+		for (const AllocationTraceRecord& record : records)
+		{
+			max_size = std::max(max_size, record.m_size);
+
+			if (record.m_op == AllocationTraceOp::FORGE_ALLOCATE)
+				max_live_count = std::max(max_live_count, ++live_count);
+			else if (record.m_op == AllocationTraceOp::FORGE_DEALLOCATE)
+				live_count--;
+			else if (record.m_op == AllocationTraceOp::FORGE_RESET)
+				live_count = 0;
+		}
+
+		printf("%-16s %10s %8s %8s %8s %8s %10s %10s %10s %8s %8s    (ns/op)\n",
+			"allocator", "M ops/s", "p50", "p90", "p99", "p99.9", "max", "peak live", "peak span", "frag", "failed");
+
+		{
+			FreeListAllocator allocator(POOL_SIZE);
+			ReplayResult result = ReplayTrace(allocator, records);
+			PrintResult("free-list", result, true);
+		}
+		{
+			TLSFAllocator allocator(POOL_SIZE);
+			ReplayResult result = ReplayTrace(allocator, records);
+			PrintResult("tlsf", result, true);
+		}
+		{
+			TLSFAllocator central_allocator(POOL_SIZE);
+			ThreadCachingAllocator allocator(&central_allocator);
+			ReplayResult result = ReplayTrace(allocator, records);
+			PrintResult("thread-cache", result, true);
+		}
+
+		if (max_size <= MAX_POOL_CHUNK_SIZE)
+		{
+			Size chunk_size = (std::max<Size>(max_size, sizeof(VoidPtr)) + 15) & ~15ull;
+
+			PoolAllocator allocator(chunk_size, (max_live_count + 1) * chunk_size);
+			ReplayResult result = ReplayTrace(allocator, records);
+			PrintResult("pool", result, true);
+		}
+		else
+			printf("%-16s skipped, the trace has requests larger than %llu bytes\n", "pool", MAX_POOL_CHUNK_SIZE);
+
+		{
+			CAllocator allocator;
+			ReplayResult result = ReplayTrace(allocator, records);
+			PrintResult("malloc", result, false);
+		}
+	}
+}
+
+#endif // ALLOCATION_REPLAY_BENCHMARK_H
@@ -0,0 +1,143 @@
+#ifndef CONCURRENT_POOL_ALLOCATOR_BENCHMARK_H
+#define CONCURRENT_POOL_ALLOCATOR_BENCHMARK_H
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Memory/PoolAllocator.h"
+#include "Core/Public/Memory/ConcurrentPoolAllocator.h"
+
+using namespace Forge;
+using namespace Forge::Memory;
+
+namespace ConcurrentPoolAllocatorBenchmark
+{
+	constexpr Size CHUNK_SIZE = 64;
+	constexpr Size BATCH_SIZE = 32;
+	constexpr Size NUM_OF_ROUNDS = 100000;
+	constexpr Size MAX_NUM_OF_THREADS = 16;
+
+	/**
+	 * The single-threaded pool made shareable the way callers do it today.
+	 */
+	struct MutexPoolAllocator
+	{
+		PoolAllocator m_pool;
+		std::mutex    m_mutex;
+
+		MutexPoolAllocator(Size capacity)
+			: m_pool(CHUNK_SIZE, capacity) {}
+
+		VoidPtr Allocate(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_pool.Allocate(CHUNK_SIZE);
+		}
+		Void Deallocate(VoidPtr address)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_pool.Deallocate(address);
+		}
+	};
+
+	struct LockFreePoolAllocator
+	{
+		ConcurrentPoolAllocator m_pool;
+
+		LockFreePoolAllocator(Size capacity, Size cache_size)
+			: m_pool(CHUNK_SIZE, capacity, cache_size) {}
+
+		VoidPtr Allocate(Void)
+		{
+			return m_pool.Allocate(CHUNK_SIZE);
+		}
+		Void Deallocate(VoidPtr address)
+		{
+			m_pool.Deallocate(address);
+		}
+	};
+
+	/**
+	 * Every thread repeatedly allocates a batch of chunks, touches them and
+	 * frees them again. All threads are released at once and the wall time
+	 * until the last one finishes is measured.
+	 *
+	 * @returns The throughput in millions of allocate/free pairs per second.
+	 */
+	template<typename InAllocator>
+	double MeasureThroughput(InAllocator& allocator, Size num_of_threads)
+	{
+		std::atomic<Size> num_of_ready(0);
+		std::atomic<Bool> is_started(false);
+
+		std::vector<std::thread> threads;
+
+		for (Size i = 0; i < num_of_threads; i++)
+		{
+			threads.emplace_back([&]()
+			{
+				VoidPtr chunks[BATCH_SIZE];
+
+				num_of_ready.fetch_add(1);
+				while (!is_started.load(std::memory_order_acquire));
+
+				for (Size round = 0; round < NUM_OF_ROUNDS; round++)
+				{
+					for (Size j = 0; j < BATCH_SIZE; j++)
+					{
+						chunks[j] = allocator.Allocate();
+						*static_cast<Size*>(chunks[j]) = j;
+					}
+
+					for (Size j = 0; j < BATCH_SIZE; j++)
+						allocator.Deallocate(chunks[j]);
+				}
+			});
+		}
+
+		while (num_of_ready.load() != num_of_threads);
+
+		Benchmark::Clock::time_point start = Benchmark::Clock::now();
+		is_started.store(true, std::memory_order_release);
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		double elapsed = std::chrono::duration<double, std::micro>(Benchmark::Clock::now() - start).count();
+
+		return (num_of_threads * NUM_OF_ROUNDS * BATCH_SIZE) / elapsed;
+	}
+
+	/**
+	 * Compares a mutex-wrapped PoolAllocator against the lock-free pool with
+	 * and without per-thread caching, for a growing number of threads.
+	 */
+	BENCHMARK(ConcurrentPoolAllocatorBenchmark, Throughput)
+	{
+		Size max_num_of_threads = std::thread::hardware_concurrency();
+
+		if (max_num_of_threads > MAX_NUM_OF_THREADS)
+			max_num_of_threads = MAX_NUM_OF_THREADS;
+
+		Size capacity = (MAX_NUM_OF_THREADS * BATCH_SIZE + 1) * CHUNK_SIZE;
+
+		printf("%-8s %14s %14s %14s    (M ops/s)\n", "threads", "mutex-pool", "lock-free", "lock-free+tc");
+
+		for (Size num_of_threads = 1; num_of_threads <= max_num_of_threads; num_of_threads *= 2)
+		{
+			MutexPoolAllocator mutex_pool(capacity);
+			LockFreePoolAllocator lock_free_pool(capacity, 0);
+			LockFreePoolAllocator cached_pool(capacity + num_of_threads * 64 * CHUNK_SIZE, 64);
+
+			printf("%-8llu %14.2f %14.2f %14.2f\n", num_of_threads,
+				MeasureThroughput(mutex_pool, num_of_threads),
+				MeasureThroughput(lock_free_pool, num_of_threads),
+				MeasureThroughput(cached_pool, num_of_threads));
+		}
+	}
+}
+
+#endif // CONCURRENT_POOL_ALLOCATOR_BENCHMARK_H
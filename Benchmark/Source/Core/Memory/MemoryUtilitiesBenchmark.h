@@ -0,0 +1,108 @@
+#ifndef MEMORY_UTILITIES_BENCHMARK_H
+#define MEMORY_UTILITIES_BENCHMARK_H
+
+#include <malloc.h>
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Memory/MemoryUtilities.h"
+
+using namespace Forge;
+using namespace Forge::Memory;
+
+namespace MemoryUtilitiesBenchmark
+{
+	constexpr Size MIN_BYTES = 8;
+	constexpr Size MAX_BYTES = 64ull * 1024 * 1024;
+
+	const char* ROUTINE_SET_NAMES[] = { "scalar", "sse2", "avx2", "avx512" };
+
+	/**
+	 * Prints one row per buffer size with the throughput in GB/s of libc and
+	 * every routine set supported by the processor.
+	 */
+	template<typename InLibcFunction, typename InForgeFunction>
+	void RunThroughputTable(const char* operation, InLibcFunction libc_function, InForgeFunction forge_function)
+	{
+		Byte supported = static_cast<Byte>(DetectMemoryRoutineSet());
+
+		printf("%-10s %10s", operation, "libc");
+		for (Byte i = 0; i <= supported; i++)
+			printf(" %10s", ROUTINE_SET_NAMES[i]);
+		printf("    (GB/s)\n");
+
+		for (Size bytes = MIN_BYTES; bytes <= MAX_BYTES; bytes *= 2)
+		{
+			char size_name[32];
+			printf("%-10s", Benchmark::FormatBytes(size_name, sizeof(size_name), bytes));
+
+			double libc_ns = Benchmark::MeasureNanoseconds([&]() { libc_function(bytes); });
+			printf(" %10.2f", bytes / libc_ns);
+
+			for (Byte i = 0; i <= supported; i++)
+			{
+				MemoryRoutineTable table = GetMemoryRoutineTable(static_cast<MemoryRoutineSet>(i));
+
+				double forge_ns = Benchmark::MeasureNanoseconds([&]() { forge_function(table, bytes); });
+				printf(" %10.2f", bytes / forge_ns);
+			}
+
+			printf("\n");
+		}
+	}
+
+	/**
+	 * Benchmarks MemoryCopy against memcpy.
+	 */
+	BENCHMARK(MemoryUtilitiesBenchmark, MemoryCopy)
+	{
+		BytePtr src = static_cast<BytePtr>(_aligned_malloc(MAX_BYTES, 64));
+		BytePtr dst = static_cast<BytePtr>(_aligned_malloc(MAX_BYTES, 64));
+
+		memset(src, 0x5A, MAX_BYTES);
+		memset(dst, 0x00, MAX_BYTES);
+
+		RunThroughputTable("copy",
+			[&](Size bytes) { memcpy(dst, src, bytes); Benchmark::ClobberMemory(); },
+			[&](const MemoryRoutineTable& table, Size bytes) { table.m_copy(dst, src, bytes); Benchmark::ClobberMemory(); });
+
+		_aligned_free(src);
+		_aligned_free(dst);
+	}
+
+	/**
+	 * Benchmarks MemorySet against memset.
+	 */
+	BENCHMARK(MemoryUtilitiesBenchmark, MemorySet)
+	{
+		BytePtr dst = static_cast<BytePtr>(_aligned_malloc(MAX_BYTES, 64));
+
+		RunThroughputTable("set",
+			[&](Size bytes) { memset(dst, 0x5A, bytes); Benchmark::ClobberMemory(); },
+			[&](const MemoryRoutineTable& table, Size bytes) { table.m_set(dst, 0x5A, bytes); Benchmark::ClobberMemory(); });
+
+		_aligned_free(dst);
+	}
+
+	/**
+	 * Benchmarks MemoryCompare against memcmp on equal buffers, which is the
+	 * worst case as every byte has to be visited.
+	 */
+	BENCHMARK(MemoryUtilitiesBenchmark, MemoryCompare)
+	{
+		BytePtr lhs = static_cast<BytePtr>(_aligned_malloc(MAX_BYTES, 64));
+		BytePtr rhs = static_cast<BytePtr>(_aligned_malloc(MAX_BYTES, 64));
+
+		memset(lhs, 0x5A, MAX_BYTES);
+		memset(rhs, 0x5A, MAX_BYTES);
+
+		RunThroughputTable("compare",
+			[&](Size bytes) { Benchmark::DoNotOptimize(memcmp(lhs, rhs, bytes)); },
+			[&](const MemoryRoutineTable& table, Size bytes) { Benchmark::DoNotOptimize(table.m_compare(lhs, rhs, bytes)); });
+
+		_aligned_free(lhs);
+		_aligned_free(rhs);
+	}
+}
+
+#endif // MEMORY_UTILITIES_BENCHMARK_H
@@ -0,0 +1,153 @@
+#ifndef TLSF_ALLOCATOR_BENCHMARK_H
+#define TLSF_ALLOCATOR_BENCHMARK_H
+
+#include <algorithm>
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Memory/TLSFAllocator.h"
+#include "Core/Public/Memory/FreeListAllocator.h"
+
+using namespace Forge;
+using namespace Forge::Memory;
+
+namespace TLSFAllocatorBenchmark
+{
+	constexpr Size POOL_SIZE = 256ull * 1024 * 1024;
+	constexpr Size NUM_OF_OPS = 200000;
+
+	/**
+	 * A single step of the replayed workload, a size of zero frees the slot
+	 * and any other size allocates into it.
+	 */
+	struct WorkloadOp
+	{
+		U32 m_slot;
+		U32 m_size;
+	};
+
+	/**
+	 * Generates a deterministic mixed-size workload, 70% small (16 B - 256 B),
+	 * 25% medium (256 B - 4 KB) and 5% large (4 KB - 64 KB) requests. The
+	 * slots are first filled, then each step either frees or refills a random
+	 * slot, which keeps the number of live allocations around the slot count.
+	 */
+	std::vector<WorkloadOp> GenerateWorkload(U32 num_of_slots)
+	{
+		std::vector<WorkloadOp> workload;
+		std::vector<Bool> is_live(num_of_slots, false);
+
+		U64 state = 0x9E3779B97F4A7C15ull;
+		auto next_random = [&state]() -> U32
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			return static_cast<U32>(state >> 33);
+		};
+		auto next_size = [&next_random]() -> U32
+		{
+			U32 bucket = next_random() % 100;
+
+			if (bucket < 70)
+				return 16 + next_random() % (256 - 16);
+			if (bucket < 95)
+				return 256 + next_random() % (4096 - 256);
+
+			return 4096 + next_random() % (65536 - 4096);
+		};
+
+		for (U32 i = 0; i < num_of_slots; i++)
+		{
+			workload.push_back({ i, next_size() });
+			is_live[i] = true;
+		}
+
+		for (Size i = 0; i < NUM_OF_OPS; i++)
+		{
+			U32 slot = next_random() % num_of_slots;
+
+			workload.push_back({ slot, is_live[slot] ? 0 : next_size() });
+			is_live[slot] = !is_live[slot];
+		}
+
+		for (U32 i = 0; i < num_of_slots; i++)
+			if (is_live[i])
+				workload.push_back({ i, 0 });
+
+		return workload;
+	}
+
+	/**
+	 * Replays the workload against an allocator, timing every operation, and
+	 * prints the average and tail latencies.
+	 */
+	void ReplayWorkload(const char* name, AbstractAllocator& allocator, const std::vector<WorkloadOp>& workload, U32 num_of_slots)
+	{
+		std::vector<VoidPtr> slots(num_of_slots, nullptr);
+		std::vector<double> latencies;
+		latencies.reserve(workload.size());
+
+		Size num_of_failures = 0;
+
+		for (const WorkloadOp& op : workload)
+		{
+			Benchmark::Clock::time_point start = Benchmark::Clock::now();
+
+			if (op.m_size)
+			{
+				try
+				{
+					slots[op.m_slot] = allocator.Allocate(op.m_size, 16);
+				}
+				catch (...)
+				{
+					num_of_failures++;
+				}
+			}
+			else if (slots[op.m_slot])
+			{
+				allocator.Deallocate(slots[op.m_slot]);
+				slots[op.m_slot] = nullptr;
+			}
+
+			latencies.push_back(std::chrono::duration<double, std::nano>(Benchmark::Clock::now() - start).count());
+		}
+
+		double total = 0.0;
+		for (double latency : latencies)
+			total += latency;
+
+		std::sort(latencies.begin(), latencies.end());
+
+		auto percentile = [&latencies](double p) { return latencies[static_cast<Size>(p * (latencies.size() - 1))]; };
+
+		printf("%-12s %8u %10.1f %10.1f %10.1f %10.1f %12.1f %8llu\n", name, num_of_slots,
+			total / latencies.size(), percentile(0.5), percentile(0.99), percentile(0.999),
+			latencies.back(), num_of_failures);
+	}
+
+	/**
+	 * Replays the same mixed-size workload against the linear-scan free list
+	 * allocator and the TLSF allocator with a growing number of live blocks.
+	 */
+	BENCHMARK(TLSFAllocatorBenchmark, MixedWorkload)
+	{
+		printf("%-12s %8s %10s %10s %10s %10s %12s %8s    (ns/op)\n",
+			"allocator", "live", "mean", "p50", "p99", "p99.9", "max", "failed");
+
+		for (U32 num_of_slots : { 256u, 1024u, 4096u })
+		{
+			std::vector<WorkloadOp> workload = GenerateWorkload(num_of_slots);
+
+			{
+				FreeListAllocator allocator(POOL_SIZE);
+				ReplayWorkload("free-list", allocator, workload, num_of_slots);
+			}
+			{
+				TLSFAllocator allocator(POOL_SIZE);
+				ReplayWorkload("tlsf", allocator, workload, num_of_slots);
+			}
+		}
+	}
+}
+
+#endif // TLSF_ALLOCATOR_BENCHMARK_H
@@ -0,0 +1,102 @@
+#ifndef DELEGATE_BENCHMARK_H
+#define DELEGATE_BENCHMARK_H
+
+#include <functional>
+
+#include "Source/Benchmark.h"
+
+#include "Core/Public/Types/TDelegate.h"
+
+using namespace Forge;
+using namespace Forge::Common;
+
+namespace DelegateBenchmark
+{
+	constexpr Size NUM_OF_CALLS = 1000;
+
+	FORGE_NO_INLINE I64 AddOne(I64 value) { return value + 1; }
+
+	/**
+	 * Captures of the sizes measured, the large one does not fit the inline
+	 * storage of a delegate.
+	 */
+	struct SmallCapture
+	{
+		I64 m_values[2];
+
+		I64 operator ()(I64 value) const { return value + m_values[0] + m_values[1]; }
+	};
+
+	struct LargeCapture
+	{
+		I64 m_values[8];
+
+		I64 operator ()(I64 value) const { return value + m_values[0] + m_values[7]; }
+	};
+
+	/**
+	 * Measures the average time of invoking and of copying a callable.
+	 */
+	template<typename InCallable>
+	Void Measure(ConstCharPtr name, const InCallable& callable)
+	{
+		double invoke_time = Benchmark::MeasureNanoseconds([&]()
+		{
+			I64 value = 0;
+
+			for (Size i = 0; i < NUM_OF_CALLS; i++)
+				value = callable(value);
+
+			Benchmark::DoNotOptimize(value);
+		}) / NUM_OF_CALLS;
+
+		double copy_time = Benchmark::MeasureNanoseconds([&]()
+		{
+			InCallable copy = callable;
+
+			Benchmark::DoNotOptimize(copy);
+		});
+
+		printf("%-28s %10.2f %10.2f\n", name, invoke_time, copy_time);
+	}
+
+	/**
+	 * Adapts a delegate to the call syntax of the other callables.
+	 */
+	template<Size InInlineSize>
+	struct DelegateCallable
+	{
+		TDelegate<I64(I64), InInlineSize> m_delegate;
+
+		I64 operator ()(I64 value) const { return m_delegate.Invoke(value); }
+	};
+
+	/**
+	 * Compares invoking and copying TDelegate against a raw function pointer
+	 * and std::function, for a global function and lambda captures stored
+	 * inline and on the heap.
+	 */
+	BENCHMARK(DelegateBenchmark, InvokeAndCopy)
+	{
+		SmallCapture small_capture = { { 1, 2 } };
+		LargeCapture large_capture = { { 1, 2, 3, 4, 5, 6, 7, 8 } };
+
+		I64(*volatile function_ptr)(I64) = &AddOne;
+
+		printf("%-28s %10s %10s    (ns/op)\n", "callable", "invoke", "copy");
+
+		Measure("raw function pointer", function_ptr);
+
+		Measure("std::function global", std::function<I64(I64)>(function_ptr));
+		Measure("TDelegate global", DelegateCallable<32>{ function_ptr });
+
+		Measure("std::function small", std::function<I64(I64)>(small_capture));
+		Measure("TDelegate small", DelegateCallable<32>{ small_capture });
+
+		Measure("std::function large", std::function<I64(I64)>(large_capture));
+		Measure("TDelegate large", DelegateCallable<32>{ large_capture });
+		Measure("TDelegate large inline", DelegateCallable<64>{ large_capture });
+	}
+}
+
+#endif // DELEGATE_BENCHMARK_H
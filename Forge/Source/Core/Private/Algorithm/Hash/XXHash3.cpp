@@ -0,0 +1,757 @@
+#include <intrin.h>
+#include <immintrin.h>
+
+#include "Core/Public/Memory/MemoryUtilities.h"
+#include "Core/Public/Algorithm/Hash/XXHash3.h"
+
+namespace Forge {
+	namespace Algorithm
+	{
+		namespace
+		{
+			constexpr U32 PRIME32_1 = 0x9E3779B1U;
+			constexpr U32 PRIME32_2 = 0x85EBCA77U;
+			constexpr U32 PRIME32_3 = 0xC2B2AE3DU;
+
+			constexpr U64 PRIME64_1 = 0x9E3779B185EBCA87ULL;
+			constexpr U64 PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+			constexpr U64 PRIME64_3 = 0x165667B19E3779F9ULL;
+			constexpr U64 PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+			constexpr U64 PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+			constexpr U64 PRIME_MX1 = 0x165667919E3779F9ULL;
+			constexpr U64 PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+			/// Offsets into the secret, fixed by the algorithm.
+			constexpr Size SECRET_SIZE_MIN         = 136;
+			constexpr Size SECRET_LAST_OFFSET      = 17;
+			constexpr Size SECRET_MID_OFFSET       = 3;
+			constexpr Size SECRET_MERGE_OFFSET     = 11;
+			constexpr Size SECRET_LAST_ACC_OFFSET  = 7;
+			constexpr Size SECRET_CONSUME_RATE     = 8;
+
+			constexpr Size STRIPE_SIZE       = XXHash3::STRIPE_SIZE;
+			constexpr Size SECRET_SIZE       = XXHash3::SECRET_SIZE;
+			constexpr Size STRIPES_PER_BLOCK = (SECRET_SIZE - STRIPE_SIZE) / SECRET_CONSUME_RATE;
+			constexpr Size BLOCK_SIZE        = STRIPE_SIZE * STRIPES_PER_BLOCK;
+
+			/**
+			 * The default secret of the algorithm, seeded hashes of long inputs
+			 * derive their secret from it.
+			 */
+			FORGE_ALIGN(64) const Byte DEFAULT_SECRET[SECRET_SIZE] =
+			{
+				0xB8, 0xFE, 0x6C, 0x39, 0x23, 0xA4, 0x4B, 0xBE, 0x7C, 0x01, 0x81, 0x2C, 0xF7, 0x21, 0xAD, 0x1C,
+				0xDE, 0xD4, 0x6D, 0xE9, 0x83, 0x90, 0x97, 0xDB, 0x72, 0x40, 0xA4, 0xA4, 0xB7, 0xB3, 0x67, 0x1F,
+				0xCB, 0x79, 0xE6, 0x4E, 0xCC, 0xC0, 0xE5, 0x78, 0x82, 0x5A, 0xD0, 0x7D, 0xCC, 0xFF, 0x72, 0x21,
+				0xB8, 0x08, 0x46, 0x74, 0xF7, 0x43, 0x24, 0x8E, 0xE0, 0x35, 0x90, 0xE6, 0x81, 0x3A, 0x26, 0x4C,
+				0x3C, 0x28, 0x52, 0xBB, 0x91, 0xC3, 0x00, 0xCB, 0x88, 0xD0, 0x65, 0x8B, 0x1B, 0x53, 0x2E, 0xA3,
+				0x71, 0x64, 0x48, 0x97, 0xA2, 0x0D, 0xF9, 0x4E, 0x38, 0x19, 0xEF, 0x46, 0xA9, 0xDE, 0xAC, 0xD8,
+				0xA8, 0xFA, 0x76, 0x3F, 0xE3, 0x9C, 0x34, 0x3F, 0xF9, 0xDC, 0xBB, 0xC7, 0xC7, 0x0B, 0x4F, 0x1D,
+				0x8A, 0x51, 0xE0, 0x4B, 0xCD, 0xB4, 0x59, 0x31, 0xC8, 0x9F, 0x7E, 0xC9, 0xD9, 0x78, 0x73, 0x64,
+				0xEA, 0xC5, 0xAC, 0x83, 0x34, 0xD3, 0xEB, 0xC3, 0xC5, 0x81, 0xA0, 0xFF, 0xFA, 0x13, 0x63, 0xEB,
+				0x17, 0x0D, 0xDD, 0x51, 0xB7, 0xF0, 0xDA, 0x49, 0xD3, 0x16, 0x55, 0x26, 0x29, 0xD4, 0x68, 0x9E,
+				0x2B, 0x16, 0xBE, 0x58, 0x7D, 0x47, 0xA1, 0xFC, 0x8F, 0xF8, 0xB8, 0xD1, 0x7A, 0xD0, 0x31, 0xCE,
+				0x45, 0xCB, 0x3A, 0x8F, 0x95, 0x16, 0x04, 0x28, 0xAF, 0xD7, 0xFB, 0xCA, 0xBB, 0x4B, 0x40, 0x7E,
+			};
+
+			FORGE_FORCE_INLINE U64 LoadU64(ConstBytePtr src) { return *reinterpret_cast<const __unaligned U64*>(src); }
+			FORGE_FORCE_INLINE U32 LoadU32(ConstBytePtr src) { return *reinterpret_cast<const __unaligned U32*>(src); }
+
+			FORGE_FORCE_INLINE Void StoreU64(BytePtr dst, U64 value) { *reinterpret_cast<__unaligned U64*>(dst) = value; }
+
+			FORGE_FORCE_INLINE HashResult128 Multiply128(U64 lhs, U64 rhs)
+			{
+				HashResult128 result;
+
+				result.m_low = _umul128(lhs, rhs, &result.m_high);
+
+				return result;
+			}
+
+			FORGE_FORCE_INLINE U64 MultiplyFold64(U64 lhs, U64 rhs)
+			{
+				HashResult128 product = Multiply128(lhs, rhs);
+
+				return product.m_low ^ product.m_high;
+			}
+
+			FORGE_FORCE_INLINE U64 XXH64Avalanche(U64 hash)
+			{
+				hash ^= hash >> 33;
+				hash *= PRIME64_2;
+				hash ^= hash >> 29;
+				hash *= PRIME64_3;
+				hash ^= hash >> 32;
+
+				return hash;
+			}
+
+			FORGE_FORCE_INLINE U64 Avalanche(U64 hash)
+			{
+				hash ^= hash >> 37;
+				hash *= PRIME_MX1;
+				hash ^= hash >> 32;
+
+				return hash;
+			}
+
+			FORGE_FORCE_INLINE U64 RotateMultiplyAvalanche(U64 hash, U64 size)
+			{
+				hash ^= _rotl64(hash, 49) ^ _rotl64(hash, 24);
+				hash *= PRIME_MX2;
+				hash ^= (hash >> 35) + size;
+				hash *= PRIME_MX2;
+				hash ^= hash >> 28;
+
+				return hash;
+			}
+
+			FORGE_FORCE_INLINE U64 Mix16(ConstBytePtr data, ConstBytePtr secret, U64 seed)
+			{
+				return MultiplyFold64(LoadU64(data) ^ (LoadU64(secret) + seed),
+				                      LoadU64(data + 8) ^ (LoadU64(secret + 8) - seed));
+			}
+
+			FORGE_FORCE_INLINE Void Mix32(HashResult128& accumulator, ConstBytePtr data_one, ConstBytePtr data_two, ConstBytePtr secret, U64 seed)
+			{
+				accumulator.m_low += Mix16(data_one, secret, seed);
+				accumulator.m_low ^= LoadU64(data_two) + LoadU64(data_two + 8);
+				accumulator.m_high += Mix16(data_two, secret + 16, seed);
+				accumulator.m_high ^= LoadU64(data_one) + LoadU64(data_one + 8);
+			}
+
+			/// Short 64-bit hashes.
+
+			U64 Hash64Up16(ConstBytePtr data, Size size, ConstBytePtr secret, U64 seed)
+			{
+				if (size > 8)
+				{
+					U64 bitflip_one = (LoadU64(secret + 24) ^ LoadU64(secret + 32)) + seed;
+					U64 bitflip_two = (LoadU64(secret + 40) ^ LoadU64(secret + 48)) - seed;
+					U64 input_low = LoadU64(data) ^ bitflip_one;
+					U64 input_high = LoadU64(data + size - 8) ^ bitflip_two;
+
+					return Avalanche(size + _byteswap_uint64(input_low) + input_high + MultiplyFold64(input_low, input_high));
+				}
+
+				if (size >= 4)
+				{
+					seed ^= static_cast<U64>(_byteswap_ulong(static_cast<U32>(seed))) << 32;
+
+					U64 bitflip = (LoadU64(secret + 8) ^ LoadU64(secret + 16)) - seed;
+					U64 input = LoadU32(data + size - 4) + (static_cast<U64>(LoadU32(data)) << 32);
+
+					return RotateMultiplyAvalanche(input ^ bitflip, size);
+				}
+
+				if (size)
+				{
+					U32 combined = (static_cast<U32>(data[0]) << 16) | (static_cast<U32>(data[size >> 1]) << 24) |
+					               (static_cast<U32>(data[size - 1])) | (static_cast<U32>(size) << 8);
+					U64 bitflip = (LoadU32(secret) ^ LoadU32(secret + 4)) + seed;
+
+					return XXH64Avalanche(static_cast<U64>(combined) ^ bitflip);
+				}
+
+				return XXH64Avalanche(seed ^ (LoadU64(secret + 56) ^ LoadU64(secret + 64)));
+			}
+
+			U64 Hash64Up128(ConstBytePtr data, Size size, ConstBytePtr secret, U64 seed)
+			{
+				U64 accumulator = size * PRIME64_1;
+
+				if (size > 32)
+				{
+					if (size > 64)
+					{
+						if (size > 96)
+						{
+							accumulator += Mix16(data + 48, secret + 96, seed);
+							accumulator += Mix16(data + size - 64, secret + 112, seed);
+						}
+
+						accumulator += Mix16(data + 32, secret + 64, seed);
+						accumulator += Mix16(data + size - 48, secret + 80, seed);
+					}
+
+					accumulator += Mix16(data + 16, secret + 32, seed);
+					accumulator += Mix16(data + size - 32, secret + 48, seed);
+				}
+
+				accumulator += Mix16(data, secret, seed);
+				accumulator += Mix16(data + size - 16, secret + 16, seed);
+
+				return Avalanche(accumulator);
+			}
+
+			U64 Hash64Up240(ConstBytePtr data, Size size, ConstBytePtr secret, U64 seed)
+			{
+				U64 accumulator = size * PRIME64_1;
+				Size num_of_rounds = size / 16;
+
+				for (Size i = 0; i < 8; i++)
+					accumulator += Mix16(data + (16 * i), secret + (16 * i), seed);
+
+				accumulator = Avalanche(accumulator);
+
+				for (Size i = 8; i < num_of_rounds; i++)
+					accumulator += Mix16(data + (16 * i), secret + (16 * (i - 8)) + SECRET_MID_OFFSET, seed);
+
+				accumulator += Mix16(data + size - 16, secret + SECRET_SIZE_MIN - SECRET_LAST_OFFSET, seed);
+
+				return Avalanche(accumulator);
+			}
+
+			/// Short 128-bit hashes.
+
+			HashResult128 Hash128Up16(ConstBytePtr data, Size size, ConstBytePtr secret, U64 seed)
+			{
+				HashResult128 result;
+
+				if (size > 8)
+				{
+					U64 bitflip_low = (LoadU64(secret + 32) ^ LoadU64(secret + 40)) - seed;
+					U64 bitflip_high = (LoadU64(secret + 48) ^ LoadU64(secret + 56)) + seed;
+					U64 input_low = LoadU64(data);
+					U64 input_high = LoadU64(data + size - 8);
+
+					HashResult128 product = Multiply128(input_low ^ input_high ^ bitflip_low, PRIME64_1);
+
+					product.m_low += static_cast<U64>(size - 1) << 54;
+					input_high ^= bitflip_high;
+					product.m_high += input_high + (static_cast<U64>(static_cast<U32>(input_high)) * (PRIME32_2 - 1));
+					product.m_low ^= _byteswap_uint64(product.m_high);
+
+					result = Multiply128(product.m_low, PRIME64_2);
+					result.m_high += product.m_high * PRIME64_2;
+					result.m_low = Avalanche(result.m_low);
+					result.m_high = Avalanche(result.m_high);
+
+					return result;
+				}
+
+				if (size >= 4)
+				{
+					seed ^= static_cast<U64>(_byteswap_ulong(static_cast<U32>(seed))) << 32;
+
+					U64 input = LoadU32(data) + (static_cast<U64>(LoadU32(data + size - 4)) << 32);
+					U64 bitflip = (LoadU64(secret + 16) ^ LoadU64(secret + 24)) + seed;
+
+					result = Multiply128(input ^ bitflip, PRIME64_1 + (size << 2));
+					result.m_high += result.m_low << 1;
+					result.m_low ^= result.m_high >> 3;
+					result.m_low ^= result.m_low >> 35;
+					result.m_low *= PRIME_MX2;
+					result.m_low ^= result.m_low >> 28;
+					result.m_high = Avalanche(result.m_high);
+
+					return result;
+				}
+
+				if (size)
+				{
+					U32 combined_low = (static_cast<U32>(data[0]) << 16) | (static_cast<U32>(data[size >> 1]) << 24) |
+					                   (static_cast<U32>(data[size - 1])) | (static_cast<U32>(size) << 8);
+					U32 combined_high = _rotl(_byteswap_ulong(combined_low), 13);
+
+					U64 bitflip_low = (LoadU32(secret) ^ LoadU32(secret + 4)) + seed;
+					U64 bitflip_high = (LoadU32(secret + 8) ^ LoadU32(secret + 12)) - seed;
+
+					result.m_low = XXH64Avalanche(static_cast<U64>(combined_low) ^ bitflip_low);
+					result.m_high = XXH64Avalanche(static_cast<U64>(combined_high) ^ bitflip_high);
+
+					return result;
+				}
+
+				result.m_low = XXH64Avalanche(seed ^ LoadU64(secret + 64) ^ LoadU64(secret + 72));
+				result.m_high = XXH64Avalanche(seed ^ LoadU64(secret + 80) ^ LoadU64(secret + 88));
+
+				return result;
+			}
+
+			FORGE_FORCE_INLINE HashResult128 Hash128Finalize(HashResult128 accumulator, Size size, U64 seed)
+			{
+				HashResult128 result;
+
+				result.m_low = Avalanche(accumulator.m_low + accumulator.m_high);
+				result.m_high = 0 - Avalanche((accumulator.m_low * PRIME64_1) + (accumulator.m_high * PRIME64_4) + ((size - seed) * PRIME64_2));
+
+				return result;
+			}
+
+			HashResult128 Hash128Up128(ConstBytePtr data, Size size, ConstBytePtr secret, U64 seed)
+			{
+				HashResult128 accumulator = { size * PRIME64_1, 0 };
+
+				if (size > 32)
+				{
+					if (size > 64)
+					{
+						if (size > 96)
+							Mix32(accumulator, data + 48, data + size - 64, secret + 96, seed);
+
+						Mix32(accumulator, data + 32, data + size - 48, secret + 64, seed);
+					}
+
+					Mix32(accumulator, data + 16, data + size - 32, secret + 32, seed);
+				}
+
+				Mix32(accumulator, data, data + size - 16, secret, seed);
+
+				return Hash128Finalize(accumulator, size, seed);
+			}
+
+			HashResult128 Hash128Up240(ConstBytePtr data, Size size, ConstBytePtr secret, U64 seed)
+			{
+				HashResult128 accumulator = { size * PRIME64_1, 0 };
+				Size num_of_rounds = size / 32;
+
+				for (Size i = 0; i < 4; i++)
+					Mix32(accumulator, data + (32 * i), data + (32 * i) + 16, secret + (32 * i), seed);
+
+				accumulator.m_low = Avalanche(accumulator.m_low);
+				accumulator.m_high = Avalanche(accumulator.m_high);
+
+				for (Size i = 4; i < num_of_rounds; i++)
+					Mix32(accumulator, data + (32 * i), data + (32 * i) + 16, secret + SECRET_MID_OFFSET + (32 * (i - 4)), seed);
+
+				Mix32(accumulator, data + size - 16, data + size - 32, secret + SECRET_SIZE_MIN - SECRET_LAST_OFFSET - 16, 0 - seed);
+
+				return Hash128Finalize(accumulator, size, seed);
+			}
+
+			/// Stripe routines of long inputs, every routine set produces the
+			/// same accumulators.
+
+			using AccumulateFunc = Void(*)(U64* accumulators, ConstBytePtr data, ConstBytePtr secret, Size num_of_stripes);
+			using ScrambleFunc   = Void(*)(U64* accumulators, ConstBytePtr secret);
+
+			Void ScalarAccumulate(U64* accumulators, ConstBytePtr data, ConstBytePtr secret, Size num_of_stripes)
+			{
+				for (Size stripe = 0; stripe < num_of_stripes; stripe++)
+				{
+					ConstBytePtr stripe_data = data + (stripe * STRIPE_SIZE);
+					ConstBytePtr stripe_secret = secret + (stripe * SECRET_CONSUME_RATE);
+
+					for (Size i = 0; i < XXHash3::NUM_OF_ACCUMULATORS; i++)
+					{
+						U64 data_value = LoadU64(stripe_data + (8 * i));
+						U64 data_key = data_value ^ LoadU64(stripe_secret + (8 * i));
+
+						accumulators[i ^ 1] += data_value;
+						accumulators[i] += static_cast<U64>(static_cast<U32>(data_key)) * (data_key >> 32);
+					}
+				}
+			}
+
+			Void ScalarScramble(U64* accumulators, ConstBytePtr secret)
+			{
+				for (Size i = 0; i < XXHash3::NUM_OF_ACCUMULATORS; i++)
+				{
+					U64 accumulator = accumulators[i];
+
+					accumulator ^= accumulator >> 47;
+					accumulator ^= LoadU64(secret + (8 * i));
+					accumulator *= PRIME32_1;
+
+					accumulators[i] = accumulator;
+				}
+			}
+
+#if defined(FORGE_CPU_X86)
+			Void SSE2Accumulate(U64* accumulators, ConstBytePtr data, ConstBytePtr secret, Size num_of_stripes)
+			{
+				__m128i* accumulator_vectors = reinterpret_cast<__m128i*>(accumulators);
+
+				__m128i acc[4];
+
+				for (Size i = 0; i < 4; i++)
+					acc[i] = _mm_loadu_si128(accumulator_vectors + i);
+
+				for (Size stripe = 0; stripe < num_of_stripes; stripe++)
+				{
+					const __m128i* data_vectors = reinterpret_cast<const __m128i*>(data + (stripe * STRIPE_SIZE));
+					const __m128i* secret_vectors = reinterpret_cast<const __m128i*>(secret + (stripe * SECRET_CONSUME_RATE));
+
+					for (Size i = 0; i < 4; i++)
+					{
+						__m128i data_vec = _mm_loadu_si128(data_vectors + i);
+						__m128i data_key = _mm_xor_si128(data_vec, _mm_loadu_si128(secret_vectors + i));
+
+						/// Multiplies the low and high halves of every 64-bit lane
+						/// and adds the swapped lanes of the data.
+						__m128i product = _mm_mul_epu32(data_key, _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)));
+						__m128i data_swap = _mm_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+
+						acc[i] = _mm_add_epi64(acc[i], _mm_add_epi64(product, data_swap));
+					}
+				}
+
+				for (Size i = 0; i < 4; i++)
+					_mm_storeu_si128(accumulator_vectors + i, acc[i]);
+			}
+
+			Void SSE2Scramble(U64* accumulators, ConstBytePtr secret)
+			{
+				__m128i* accumulator_vectors = reinterpret_cast<__m128i*>(accumulators);
+				const __m128i* secret_vectors = reinterpret_cast<const __m128i*>(secret);
+
+				__m128i prime = _mm_set1_epi32(static_cast<I32>(PRIME32_1));
+
+				for (Size i = 0; i < 4; i++)
+				{
+					__m128i acc = _mm_loadu_si128(accumulator_vectors + i);
+
+					acc = _mm_xor_si128(acc, _mm_srli_epi64(acc, 47));
+					acc = _mm_xor_si128(acc, _mm_loadu_si128(secret_vectors + i));
+
+					__m128i product_low = _mm_mul_epu32(acc, prime);
+					__m128i product_high = _mm_mul_epu32(_mm_shuffle_epi32(acc, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+
+					_mm_storeu_si128(accumulator_vectors + i, _mm_add_epi64(product_low, _mm_slli_epi64(product_high, 32)));
+				}
+			}
+
+			Void AVX2Accumulate(U64* accumulators, ConstBytePtr data, ConstBytePtr secret, Size num_of_stripes)
+			{
+				__m256i* accumulator_vectors = reinterpret_cast<__m256i*>(accumulators);
+
+				__m256i acc[2];
+
+				for (Size i = 0; i < 2; i++)
+					acc[i] = _mm256_loadu_si256(accumulator_vectors + i);
+
+				for (Size stripe = 0; stripe < num_of_stripes; stripe++)
+				{
+					const __m256i* data_vectors = reinterpret_cast<const __m256i*>(data + (stripe * STRIPE_SIZE));
+					const __m256i* secret_vectors = reinterpret_cast<const __m256i*>(secret + (stripe * SECRET_CONSUME_RATE));
+
+					for (Size i = 0; i < 2; i++)
+					{
+						__m256i data_vec = _mm256_loadu_si256(data_vectors + i);
+						__m256i data_key = _mm256_xor_si256(data_vec, _mm256_loadu_si256(secret_vectors + i));
+
+						__m256i product = _mm256_mul_epu32(data_key, _mm256_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)));
+						__m256i data_swap = _mm256_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+
+						acc[i] = _mm256_add_epi64(acc[i], _mm256_add_epi64(product, data_swap));
+					}
+				}
+
+				for (Size i = 0; i < 2; i++)
+					_mm256_storeu_si256(accumulator_vectors + i, acc[i]);
+			}
+
+			Void AVX2Scramble(U64* accumulators, ConstBytePtr secret)
+			{
+				__m256i* accumulator_vectors = reinterpret_cast<__m256i*>(accumulators);
+				const __m256i* secret_vectors = reinterpret_cast<const __m256i*>(secret);
+
+				__m256i prime = _mm256_set1_epi32(static_cast<I32>(PRIME32_1));
+
+				for (Size i = 0; i < 2; i++)
+				{
+					__m256i acc = _mm256_loadu_si256(accumulator_vectors + i);
+
+					acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47));
+					acc = _mm256_xor_si256(acc, _mm256_loadu_si256(secret_vectors + i));
+
+					__m256i product_low = _mm256_mul_epu32(acc, prime);
+					__m256i product_high = _mm256_mul_epu32(_mm256_shuffle_epi32(acc, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+
+					_mm256_storeu_si256(accumulator_vectors + i, _mm256_add_epi64(product_low, _mm256_slli_epi64(product_high, 32)));
+				}
+			}
+#endif
+
+			struct StripeRoutines
+			{
+				AccumulateFunc m_accumulate;
+				ScrambleFunc   m_scramble;
+			};
+
+			/**
+			 * Selects the widest stripe routines the processor supports, using
+			 * the detection of the memory routines.
+			 */
+			StripeRoutines SelectStripeRoutines(Void)
+			{
+#if defined(FORGE_CPU_X86)
+				if (Memory::DetectMemoryRoutineSet() >= Memory::MemoryRoutineSet::FORGE_AVX2)
+					return { AVX2Accumulate, AVX2Scramble };
+
+				return { SSE2Accumulate, SSE2Scramble };
+#else
+				return { ScalarAccumulate, ScalarScramble };
+#endif
+			}
+
+			FORGE_FORCE_INLINE const StripeRoutines& GetStripeRoutines(Void)
+			{
+				static const StripeRoutines s_routines = SelectStripeRoutines();
+
+				return s_routines;
+			}
+
+			/// Long inputs.
+
+			FORGE_FORCE_INLINE Void InitAccumulators(U64* accumulators)
+			{
+				accumulators[0] = PRIME32_3;
+				accumulators[1] = PRIME64_1;
+				accumulators[2] = PRIME64_2;
+				accumulators[3] = PRIME64_3;
+				accumulators[4] = PRIME64_4;
+				accumulators[5] = PRIME32_2;
+				accumulators[6] = PRIME64_5;
+				accumulators[7] = PRIME32_1;
+			}
+
+			FORGE_FORCE_INLINE Void InitSecret(BytePtr secret, U64 seed)
+			{
+				for (Size i = 0; i < SECRET_SIZE; i += 16)
+				{
+					StoreU64(secret + i, LoadU64(DEFAULT_SECRET + i) + seed);
+					StoreU64(secret + i + 8, LoadU64(DEFAULT_SECRET + i + 8) - seed);
+				}
+			}
+
+			U64 MergeAccumulators(const U64* accumulators, ConstBytePtr secret, U64 start)
+			{
+				U64 result = start;
+
+				for (Size i = 0; i < 4; i++)
+					result += MultiplyFold64(accumulators[2 * i] ^ LoadU64(secret + (16 * i)),
+					                         accumulators[(2 * i) + 1] ^ LoadU64(secret + (16 * i) + 8));
+
+				return Avalanche(result);
+			}
+
+			/**
+			 * Accumulates the whole input, scrambling the accumulators after
+			 * every block. The last stripe always ends at the end of the input,
+			 * overlapping the previous one if the input is not a multiple of
+			 * the stripe size.
+			 */
+			Void AccumulateLong(U64* accumulators, ConstBytePtr data, Size size, ConstBytePtr secret)
+			{
+				const StripeRoutines& routines = GetStripeRoutines();
+
+				Size num_of_blocks = (size - 1) / BLOCK_SIZE;
+
+				InitAccumulators(accumulators);
+
+				for (Size block = 0; block < num_of_blocks; block++)
+				{
+					routines.m_accumulate(accumulators, data + (block * BLOCK_SIZE), secret, STRIPES_PER_BLOCK);
+					routines.m_scramble(accumulators, secret + SECRET_SIZE - STRIPE_SIZE);
+				}
+
+				Size num_of_stripes = ((size - 1) - (BLOCK_SIZE * num_of_blocks)) / STRIPE_SIZE;
+
+				routines.m_accumulate(accumulators, data + (num_of_blocks * BLOCK_SIZE), secret, num_of_stripes);
+				routines.m_accumulate(accumulators, data + size - STRIPE_SIZE, secret + SECRET_SIZE - STRIPE_SIZE - SECRET_LAST_ACC_OFFSET, 1);
+			}
+
+			/**
+			 * Accumulates stripes of a stream continuing after the specified
+			 * number of stripes of the current block.
+			 */
+			Void ConsumeStreamStripes(U64* accumulators, Size& num_of_block_stripes, ConstBytePtr data, Size num_of_stripes, ConstBytePtr secret)
+			{
+				const StripeRoutines& routines = GetStripeRoutines();
+
+				if (STRIPES_PER_BLOCK - num_of_block_stripes <= num_of_stripes)
+				{
+					Size num_of_stripes_to_end = STRIPES_PER_BLOCK - num_of_block_stripes;
+
+					routines.m_accumulate(accumulators, data, secret + (num_of_block_stripes * SECRET_CONSUME_RATE), num_of_stripes_to_end);
+					routines.m_scramble(accumulators, secret + SECRET_SIZE - STRIPE_SIZE);
+					routines.m_accumulate(accumulators, data + (num_of_stripes_to_end * STRIPE_SIZE), secret, num_of_stripes - num_of_stripes_to_end);
+
+					num_of_block_stripes = num_of_stripes - num_of_stripes_to_end;
+				}
+				else
+				{
+					routines.m_accumulate(accumulators, data, secret + (num_of_block_stripes * SECRET_CONSUME_RATE), num_of_stripes);
+
+					num_of_block_stripes += num_of_stripes;
+				}
+			}
+		}
+
+		XXHash3::XXHash3(U64 seed)
+		{
+			Reset(seed);
+		}
+
+		U64 XXHash3::Hash64(ConstVoidPtr data, Size size, U64 seed)
+		{
+			ConstBytePtr input = reinterpret_cast<ConstBytePtr>(data);
+
+			if (size <= 16)
+				return Hash64Up16(input, size, DEFAULT_SECRET, seed);
+			if (size <= 128)
+				return Hash64Up128(input, size, DEFAULT_SECRET, seed);
+			if (size <= 240)
+				return Hash64Up240(input, size, DEFAULT_SECRET, seed);
+
+			FORGE_ALIGN(64) U64 accumulators[NUM_OF_ACCUMULATORS];
+			FORGE_ALIGN(64) Byte secret[SECRET_SIZE];
+
+			InitSecret(secret, seed);
+			AccumulateLong(accumulators, input, size, secret);
+
+			return MergeAccumulators(accumulators, secret + SECRET_MERGE_OFFSET, size * PRIME64_1);
+		}
+		HashResult128 XXHash3::Hash128(ConstVoidPtr data, Size size, U64 seed)
+		{
+			ConstBytePtr input = reinterpret_cast<ConstBytePtr>(data);
+
+			if (size <= 16)
+				return Hash128Up16(input, size, DEFAULT_SECRET, seed);
+			if (size <= 128)
+				return Hash128Up128(input, size, DEFAULT_SECRET, seed);
+			if (size <= 240)
+				return Hash128Up240(input, size, DEFAULT_SECRET, seed);
+
+			FORGE_ALIGN(64) U64 accumulators[NUM_OF_ACCUMULATORS];
+			FORGE_ALIGN(64) Byte secret[SECRET_SIZE];
+
+			InitSecret(secret, seed);
+			AccumulateLong(accumulators, input, size, secret);
+
+			HashResult128 result;
+
+			result.m_low = MergeAccumulators(accumulators, secret + SECRET_MERGE_OFFSET, size * PRIME64_1);
+			result.m_high = MergeAccumulators(accumulators, secret + SECRET_SIZE - STRIPE_SIZE - SECRET_MERGE_OFFSET, ~(size * PRIME64_2));
+
+			return result;
+		}
+
+		Void XXHash3::ConsumeStripes(ConstBytePtr data, Size num_of_stripes)
+		{
+			ConsumeStreamStripes(m_accumulators, m_num_of_stripes, data, num_of_stripes, m_secret);
+		}
+
+		/// The stream state is left untouched, so that more data can be fed
+		/// after a digest.
+		Void XXHash3::DigestLong(U64* accumulators) const
+		{
+			Memory::MemoryCopy(accumulators, m_accumulators, sizeof(m_accumulators));
+
+			FORGE_ALIGN(64) Byte last_stripe[STRIPE_SIZE];
+			ConstBytePtr last_stripe_ptr;
+
+			if (m_buffer_size >= STRIPE_SIZE)
+			{
+				Size num_of_block_stripes = m_num_of_stripes;
+
+				ConsumeStreamStripes(accumulators, num_of_block_stripes, m_buffer, (m_buffer_size - 1) / STRIPE_SIZE, m_secret);
+
+				last_stripe_ptr = m_buffer + m_buffer_size - STRIPE_SIZE;
+			}
+			else
+			{
+				/// The last stripe continues from the end of the previously
+				/// consumed buffer, which is kept at the end of the buffer.
+				Size catchup_size = STRIPE_SIZE - m_buffer_size;
+
+				Memory::MemoryCopy(last_stripe, m_buffer + BUFFER_SIZE - catchup_size, catchup_size);
+				Memory::MemoryCopy(last_stripe + catchup_size, m_buffer, m_buffer_size);
+
+				last_stripe_ptr = last_stripe;
+			}
+
+			GetStripeRoutines().m_accumulate(accumulators, last_stripe_ptr, m_secret + SECRET_SIZE - STRIPE_SIZE - SECRET_LAST_ACC_OFFSET, 1);
+		}
+
+		Void XXHash3::Reset(U64 seed)
+		{
+			InitAccumulators(m_accumulators);
+			InitSecret(m_secret, seed);
+
+			m_buffer_size = 0;
+			m_num_of_stripes = 0;
+			m_total_size = 0;
+			m_seed = seed;
+		}
+
+		/// At least a byte is always kept buffered, so that the last stripe is
+		/// only accumulated once the stream is digested.
+		Void XXHash3::Update(ConstVoidPtr data, Size size)
+		{
+			if (!size)
+				return;
+
+			ConstBytePtr input = reinterpret_cast<ConstBytePtr>(data);
+			ConstBytePtr end = input + size;
+
+			m_total_size += size;
+
+			if (size <= BUFFER_SIZE - m_buffer_size)
+			{
+				Memory::MemoryCopy(m_buffer + m_buffer_size, input, size);
+				m_buffer_size += size;
+
+				return;
+			}
+
+			if (m_buffer_size)
+			{
+				Size load_size = BUFFER_SIZE - m_buffer_size;
+
+				Memory::MemoryCopy(m_buffer + m_buffer_size, input, load_size);
+				input += load_size;
+
+				ConsumeStripes(m_buffer, BUFFER_SIZE / STRIPE_SIZE);
+
+				m_buffer_size = 0;
+			}
+
+			if (static_cast<Size>(end - input) > BUFFER_SIZE)
+			{
+				do
+				{
+					ConsumeStripes(input, BUFFER_SIZE / STRIPE_SIZE);
+					input += BUFFER_SIZE;
+				} while (static_cast<Size>(end - input) > BUFFER_SIZE);
+
+				Memory::MemoryCopy(m_buffer + BUFFER_SIZE - STRIPE_SIZE, input - STRIPE_SIZE, STRIPE_SIZE);
+			}
+
+			m_buffer_size = static_cast<Size>(end - input);
+
+			Memory::MemoryCopy(m_buffer, input, m_buffer_size);
+		}
+
+		U64 XXHash3::GetHash64(Void) const
+		{
+			if (m_total_size <= 240)
+				return Hash64(m_buffer, m_total_size, m_seed);
+
+			FORGE_ALIGN(64) U64 accumulators[NUM_OF_ACCUMULATORS];
+
+			DigestLong(accumulators);
+
+			return MergeAccumulators(accumulators, m_secret + SECRET_MERGE_OFFSET, m_total_size * PRIME64_1);
+		}
+		HashResult128 XXHash3::GetHash128(Void) const
+		{
+			if (m_total_size <= 240)
+				return Hash128(m_buffer, m_total_size, m_seed);
+
+			FORGE_ALIGN(64) U64 accumulators[NUM_OF_ACCUMULATORS];
+
+			DigestLong(accumulators);
+
+			HashResult128 result;
+
+			result.m_low = MergeAccumulators(accumulators, m_secret + SECRET_MERGE_OFFSET, m_total_size * PRIME64_1);
+			result.m_high = MergeAccumulators(accumulators, m_secret + SECRET_SIZE - STRIPE_SIZE - SECRET_MERGE_OFFSET, ~(m_total_size * PRIME64_2));
+
+			return result;
+		}
+	}
+}
@@ -0,0 +1,133 @@
+#include <cstring>
+
+#include "Core/Public/Event/EventBus.h"
+
+namespace Forge {
+	namespace Event
+	{
+		namespace Internal
+		{
+			Type::ConstStringHash GetEventId(ConstCharPtr function_signature)
+			{
+#if defined(FORGE_COMPILER_MSVC)
+				/// "... TEventId<struct Namespace::EventType>::Get(void)"
+				ConstCharPtr start = std::strstr(function_signature, "TEventId<");
+				ConstCharPtr end = std::strstr(function_signature, ">::Get");
+
+				if (start)
+				{
+					start += sizeof("TEventId<") - 1;
+
+					if (!std::strncmp(start, "struct ", 7))
+						start += 7;
+					else if (!std::strncmp(start, "class ", 6))
+						start += 6;
+				}
+#else
+				/// "... TEventId<InEventType>::Get() [with InEventType = Namespace::EventType]"
+				ConstCharPtr start = std::strstr(function_signature, "InEventType = ");
+				ConstCharPtr end = start ? std::strpbrk(start, ";]") : nullptr;
+
+				if (start)
+					start += sizeof("InEventType = ") - 1;
+#endif
+
+				/// The whole signature still identifies the type uniquely.
+				if (!start || !end || end <= start)
+					return Type::ConstStringHash(function_signature);
+
+				return Type::ConstStringHash(start, static_cast<Size>(end - start));
+			}
+		}
+
+		EventBus::EventBus(Size capacity)
+			: m_queue(capacity), m_next_subscription_id(1), m_num_of_dispatches(0), m_is_dispatching(false), m_num_of_dropped_events(0)
+		{
+		}
+
+		EventBus::~EventBus()
+		{
+			for (auto itr = m_subscribers.GetStartItr(); itr != m_subscribers.GetEndItr(); ++itr)
+				delete itr->m_second;
+		}
+
+		Internal::AbstractEventSubscribers* EventBus::FindSubscribers(const Type::ConstStringHash& event_id)
+		{
+			Internal::AbstractEventSubscribers** subscribers = m_subscribers.FindValue(event_id);
+
+			return subscribers ? *subscribers : nullptr;
+		}
+
+		Void EventBus::Unsubscribe(const EventSubscription& subscription)
+		{
+			if (!subscription.IsValid())
+				return;
+
+			Internal::AbstractEventSubscribers* subscribers = FindSubscribers(subscription.m_event_id);
+
+			if (subscribers)
+				subscribers->Remove(subscription.m_id);
+		}
+
+		Size EventBus::Dispatch(Void)
+		{
+			if (m_is_dispatching)
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Event bus is already dispatching")
+
+			m_num_of_dispatches++;
+
+			/// Ends the dispatch even if a callback throws, the events left in
+			/// the batch are dropped.
+			struct DispatchScope
+			{
+				EventBus* m_bus;
+
+				~DispatchScope(Void)
+				{
+					m_bus->m_is_dispatching = false;
+					m_bus->m_batch.Clear();
+				}
+			};
+
+			DispatchScope scope = { this };
+
+			/// Only the events queued when the dispatch starts are drained, so
+			/// producers publishing continuously cannot stall the frame.
+			Size num_of_events = m_queue.GetCount();
+
+			BatchedEvent batched_event;
+
+			for (Size i = 0; i < num_of_events && m_queue.TryDequeue(batched_event.m_record); i++)
+			{
+				Internal::AbstractEventSubscribers* subscribers = FindSubscribers(batched_event.m_record.m_event_id);
+
+				/// Nobody listens to the event, it is dropped before coalescing.
+				if (!subscribers)
+					continue;
+
+				if (batched_event.m_record.m_coalesce_function)
+				{
+					if (subscribers->m_batch_dispatch == m_num_of_dispatches &&
+						batched_event.m_record.m_coalesce_function(m_batch[subscribers->m_batch_index].m_record.m_payload, batched_event.m_record.m_payload))
+						continue;
+
+					subscribers->m_batch_index = m_batch.GetCount();
+					subscribers->m_batch_dispatch = m_num_of_dispatches;
+				}
+
+				batched_event.m_subscribers = subscribers;
+
+				m_batch.PushBack(batched_event);
+			}
+
+			Size num_of_dispatched_events = m_batch.GetCount();
+
+			m_is_dispatching = true;
+
+			for (Size i = 0; i < m_batch.GetCount(); i++)
+				m_batch[i].m_subscribers->Dispatch(m_batch[i].m_record.m_payload);
+
+			return num_of_dispatched_events;
+		}
+	}
+}
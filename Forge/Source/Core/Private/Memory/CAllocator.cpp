@@ -42,8 +42,8 @@ namespace Forge {
 		}
 		Void    CAllocator::Deallocate(VoidPtr address)
 		{
-			free(address);
-			m_stats.m_num_of_allocs--;
+			_aligned_free(address);
+			m_stats.m_num_of_deallocs++;
 		}
 
 		Void  CAllocator::Reset()
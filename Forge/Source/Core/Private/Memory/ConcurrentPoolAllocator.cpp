@@ -0,0 +1,347 @@
+#include <stdlib.h>
+
+#include "Core/Public/Memory/ConcurrentPoolAllocator.h"
+#include "Core/Public/Memory/ThreadCacheSlots.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		namespace
+		{
+			/**
+			 * Links are chunk indices offset by one, so that zero can terminate
+			 * the stack. The head stores the top link in its low half and the
+			 * modification tag in its high half.
+			 */
+			constexpr U32 NULL_LINK = 0;
+		}
+
+		ConcurrentPoolAllocator::ConcurrentPoolAllocator(Size chunk_size, Size capacity, Size cache_size, Byte alignment)
+			: AbstractAllocator(nullptr, capacity)
+		{
+			if (chunk_size < sizeof(U32))
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Chunk size must be larger than or equal to U32")
+			}
+
+			if (!alignment || (alignment & (alignment - 1)))
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Alignment must be power of two")
+			}
+
+			m_start_ptr = malloc(capacity);
+
+			m_is_mem_owned = true;
+			m_chunk_alignment = alignment > alignof(std::atomic<U32>) ? alignment : alignof(std::atomic<U32>);
+			m_chunk_size = (chunk_size + m_chunk_alignment - 1) & ~(m_chunk_alignment - 1);
+			m_cache_size = static_cast<U32>(cache_size > 1 ? cache_size : 0);
+			m_thread_caches = nullptr;
+
+			m_id = Internal::AcquireThreadCacheOwnerId();
+
+			InitializePool();
+		}
+		ConcurrentPoolAllocator::ConcurrentPoolAllocator(VoidPtr start, Size chunk_size, Size capacity, Size cache_size, Byte alignment)
+			: AbstractAllocator(start, capacity)
+		{
+			if (chunk_size < sizeof(U32))
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Chunk size must be larger than or equal to U32")
+			}
+
+			if (!alignment || (alignment & (alignment - 1)))
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Alignment must be power of two")
+			}
+
+			m_is_mem_owned = false;
+			m_chunk_alignment = alignment > alignof(std::atomic<U32>) ? alignment : alignof(std::atomic<U32>);
+			m_chunk_size = (chunk_size + m_chunk_alignment - 1) & ~(m_chunk_alignment - 1);
+			m_cache_size = static_cast<U32>(cache_size > 1 ? cache_size : 0);
+			m_thread_caches = nullptr;
+
+			m_id = Internal::AcquireThreadCacheOwnerId();
+
+			InitializePool();
+		}
+
+		ConcurrentPoolAllocator::~ConcurrentPoolAllocator()
+		{
+			while (m_thread_caches)
+			{
+				ThreadCache* cache = m_thread_caches;
+				m_thread_caches = cache->m_next;
+
+				delete[] cache->m_chunks;
+				delete cache;
+			}
+
+			if (m_is_mem_owned)
+				free(m_start_ptr);
+		}
+
+		FORGE_FORCE_INLINE U64 ConcurrentPoolAllocator::MakeHead(U32 link, U32 tag)
+		{
+			return (static_cast<U64>(tag) << 32) | link;
+		}
+
+		FORGE_FORCE_INLINE VoidPtr ConcurrentPoolAllocator::GetChunkAddress(U32 link)
+		{
+			return AddAddress(m_pool_ptr, (link - 1) * m_chunk_size);
+		}
+		FORGE_FORCE_INLINE U32     ConcurrentPoolAllocator::GetChunkLink(VoidPtr address)
+		{
+			return static_cast<U32>((reinterpret_cast<U64>(address) - reinterpret_cast<U64>(m_pool_ptr)) / m_chunk_size) + 1;
+		}
+
+		FORGE_FORCE_INLINE U32  ConcurrentPoolAllocator::LoadNextLink(U32 link)
+		{
+			/// A popping thread may read the link of a chunk that another thread
+			/// has just popped and is writing to, the value is then discarded by
+			/// the failing compare-and-swap, but the access itself must be atomic.
+			return reinterpret_cast<std::atomic<U32>*>(GetChunkAddress(link))->load(std::memory_order_relaxed);
+		}
+		FORGE_FORCE_INLINE Void ConcurrentPoolAllocator::StoreNextLink(U32 link, U32 next_link)
+		{
+			reinterpret_cast<std::atomic<U32>*>(GetChunkAddress(link))->store(next_link, std::memory_order_relaxed);
+		}
+
+		Void ConcurrentPoolAllocator::InitializePool(Void)
+		{
+			/// Chunk sizes are multiples of the alignment, so aligning the first
+			/// chunk aligns all of them.
+			Size adjustment = AlignAddressUpwardAdjustment(m_start_ptr, static_cast<Byte>(m_chunk_alignment));
+
+			m_pool_ptr = AddAddress(m_start_ptr, adjustment);
+			m_num_of_chunks = adjustment < this->m_stats.m_total_size ? static_cast<U32>((this->m_stats.m_total_size - adjustment) / m_chunk_size) : 0;
+
+			if (!m_num_of_chunks)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "Memory pool is too small to hold a single chunk")
+			}
+
+			for (U32 link = 1; link < m_num_of_chunks; link++)
+				StoreNextLink(link, link + 1);
+
+			StoreNextLink(m_num_of_chunks, NULL_LINK);
+
+			m_head.store(MakeHead(1, 0), std::memory_order_release);
+		}
+
+		U32  ConcurrentPoolAllocator::PopChunk(Void)
+		{
+			U64 head = m_head.load(std::memory_order_acquire);
+			U64 new_head;
+
+			do
+			{
+				U32 link = static_cast<U32>(head);
+
+				if (link == NULL_LINK)
+					return NULL_LINK;
+
+				new_head = MakeHead(LoadNextLink(link), static_cast<U32>(head >> 32) + 1);
+			} while (!m_head.compare_exchange_weak(head, new_head, std::memory_order_acquire, std::memory_order_acquire));
+
+			return static_cast<U32>(head);
+		}
+		Void ConcurrentPoolAllocator::PushChunks(U32 first_link, U32 last_link)
+		{
+			U64 head = m_head.load(std::memory_order_relaxed);
+			U64 new_head;
+
+			do
+			{
+				StoreNextLink(last_link, static_cast<U32>(head));
+
+				new_head = MakeHead(first_link, static_cast<U32>(head >> 32) + 1);
+			} while (!m_head.compare_exchange_weak(head, new_head, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		ConcurrentPoolAllocator::ThreadCache* ConcurrentPoolAllocator::GetThreadCache(Void)
+		{
+			ThreadCache* cache = static_cast<ThreadCache*>(Internal::FindThreadCacheSlot(m_id));
+
+			if (cache)
+				return cache;
+
+			cache = CreateThreadCache();
+
+			Internal::StoreThreadCacheSlot(m_id, cache);
+
+			return cache;
+		}
+		ConcurrentPoolAllocator::ThreadCache* ConcurrentPoolAllocator::CreateThreadCache(Void)
+		{
+			std::thread::id thread_id = std::this_thread::get_id();
+
+			std::lock_guard<std::mutex> lock(m_cache_mutex);
+
+			/// The slot may have been evicted by another allocator, in which
+			/// case this thread already has a registered cache.
+			for (ThreadCache* cache = m_thread_caches; cache; cache = cache->m_next)
+				if (cache->m_thread_id == thread_id)
+					return cache;
+
+			ThreadCache* cache = new ThreadCache();
+
+			cache->m_thread_id = thread_id;
+			cache->m_chunks = m_cache_size ? new U32[m_cache_size] : nullptr;
+			cache->m_count = 0;
+
+			cache->m_num_of_allocs.store(0, std::memory_order_relaxed);
+			cache->m_num_of_deallocs.store(0, std::memory_order_relaxed);
+
+			cache->m_next = m_thread_caches;
+			m_thread_caches = cache;
+
+			return cache;
+		}
+
+		Size ConcurrentPoolAllocator::GetUsedMemory(Void)
+		{
+			Size num_of_allocs = GetNumOfAllocs();
+			Size num_of_deallocs = GetNumOfDeallocs();
+
+			return num_of_allocs > num_of_deallocs ? (num_of_allocs - num_of_deallocs) * m_chunk_size : 0;
+		}
+		Size ConcurrentPoolAllocator::GetNumOfAllocs(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_cache_mutex);
+
+			Size num_of_allocs = 0;
+
+			for (ThreadCache* cache = m_thread_caches; cache; cache = cache->m_next)
+				num_of_allocs += cache->m_num_of_allocs.load(std::memory_order_relaxed);
+
+			return num_of_allocs;
+		}
+		Size ConcurrentPoolAllocator::GetNumOfDeallocs(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_cache_mutex);
+
+			Size num_of_deallocs = 0;
+
+			for (ThreadCache* cache = m_thread_caches; cache; cache = cache->m_next)
+				num_of_deallocs += cache->m_num_of_deallocs.load(std::memory_order_relaxed);
+
+			return num_of_deallocs;
+		}
+
+		VoidPtr ConcurrentPoolAllocator::Allocate(Size size, Byte alignment)
+		{
+			if (size > m_chunk_size)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "Requested size must be less than or equal to allocator's chunk size")
+			}
+
+			if (alignment > m_chunk_alignment)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "Requested alignment must be less than or equal to allocator's chunk alignment")
+			}
+
+			ThreadCache* cache = GetThreadCache();
+
+			if (!cache->m_count && m_cache_size)
+			{
+				for (U32 i = 0; i < m_cache_size / 2 + 1; i++)
+				{
+					U32 link = PopChunk();
+
+					if (link == NULL_LINK)
+						break;
+
+					cache->m_chunks[cache->m_count++] = link;
+				}
+			}
+
+			U32 link = cache->m_count ? cache->m_chunks[--cache->m_count] : PopChunk();
+
+			if (link == NULL_LINK)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "No sufficent space for required size")
+			}
+
+			/// Only the owning thread writes its counters, so a relaxed
+			/// load-store pair avoids a locked instruction on the fast path.
+			cache->m_num_of_allocs.store(cache->m_num_of_allocs.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+			return GetChunkAddress(link);
+		}
+		VoidPtr ConcurrentPoolAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
+		{
+			FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Concurrent pool allocator does not support reallocation of memory addresses")
+
+			return nullptr;
+		}
+		Void    ConcurrentPoolAllocator::Deallocate(VoidPtr address)
+		{
+			if (!WithinAddressBounds(m_pool_ptr, address, m_num_of_chunks * m_chunk_size))
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS, "Address is out of the memory pool bounds")
+			}
+
+			ThreadCache* cache = GetThreadCache();
+
+			cache->m_num_of_deallocs.store(cache->m_num_of_deallocs.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+			U32 link = GetChunkLink(address);
+
+			if (!m_cache_size)
+			{
+				PushChunks(link, link);
+				return;
+			}
+
+			cache->m_chunks[cache->m_count++] = link;
+
+			/// Flush the older half of a full cache as a single pre-linked
+			/// chain, which costs one compare-and-swap regardless of its length.
+			if (cache->m_count == m_cache_size)
+			{
+				U32 flush_count = m_cache_size / 2;
+
+				for (U32 i = 0; i + 1 < flush_count; i++)
+					StoreNextLink(cache->m_chunks[i], cache->m_chunks[i + 1]);
+
+				PushChunks(cache->m_chunks[0], cache->m_chunks[flush_count - 1]);
+
+				cache->m_count -= flush_count;
+
+				for (U32 i = 0; i < cache->m_count; i++)
+					cache->m_chunks[i] = cache->m_chunks[i + flush_count];
+			}
+		}
+
+		Void ConcurrentPoolAllocator::FlushThreadCache(Void)
+		{
+			/// Falls back to the registered caches when the slot was evicted.
+			ThreadCache* cache = GetThreadCache();
+
+			if (!cache->m_count)
+				return;
+
+			for (U32 i = 0; i + 1 < cache->m_count; i++)
+				StoreNextLink(cache->m_chunks[i], cache->m_chunks[i + 1]);
+
+			PushChunks(cache->m_chunks[0], cache->m_chunks[cache->m_count - 1]);
+
+			cache->m_count = 0;
+		}
+
+		Void ConcurrentPoolAllocator::Reset(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_cache_mutex);
+
+			for (ThreadCache* cache = m_thread_caches; cache; cache = cache->m_next)
+			{
+				cache->m_count = 0;
+
+				cache->m_num_of_allocs.store(0, std::memory_order_relaxed);
+				cache->m_num_of_deallocs.store(0, std::memory_order_relaxed);
+			}
+
+			InitializePool();
+		}
+	}
+}
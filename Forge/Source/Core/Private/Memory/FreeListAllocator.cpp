@@ -44,115 +44,102 @@ namespace Forge {
 			}
 
 			FreeBlockNode* prev_block = nullptr;
-			FreeBlockNode* best_block = nullptr;
 			FreeBlockNode* curr_block = this->m_free_list;
 
-			Byte adjustment, required_space;
+			FreeBlockNode* best_prev_block = nullptr;
+			FreeBlockNode* best_block = nullptr;
+
+			Size adjustment, required_space;
+			Size best_adjustment = 0, best_required_space = 0;
 
 			Size smallest_diff = ~(Size)0;
 
 			while (curr_block)
 			{
-				adjustment = AlignAddressUpwardAdjustment(curr_block, alignment);
+				adjustment = AlignAddressUpwardAdjustment(AddAddress(curr_block, sizeof(AllocationHeader)), alignment);
 				required_space = size + adjustment + sizeof(AllocationHeader);
 
-				if (required_space > this->m_stats.m_total_size)
-				{
-					/// Throw Exception
-				}
+				/// Keep every block boundary pointer-aligned so the free block
+				/// nodes written at them stay naturally aligned.
+				required_space = (required_space + sizeof(VoidPtr) - 1) & ~(sizeof(VoidPtr) - 1);
 
 				if (curr_block->m_block_size >= required_space &&
 				   (curr_block->m_block_size - required_space) < smallest_diff)
 				{
-					prev_block = best_block;
+					best_prev_block = prev_block;
 					best_block = curr_block;
 
+					best_adjustment = adjustment;
+					best_required_space = required_space;
+
 					smallest_diff = curr_block->m_block_size - required_space;
 				}
 
+				prev_block = curr_block;
 				curr_block = curr_block->m_link;
 			}
 
-			Size remaining_size = best_block->m_block_size - required_space;
-			
-			if (remaining_size)
+			if (!best_block)
 			{
-				FreeBlockNode* new_block = reinterpret_cast<FreeBlockNode*>(AddAddress(best_block, required_space));
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "No free block large enough is available in the memory pool")
+			}
 
-				new_block->m_block_size = remaining_size;
-				new_block->m_link = best_block->m_link;
+			Size remaining_size = best_block->m_block_size - best_required_space;
+			FreeBlockNode* next_block = best_block->m_link;
 
-				if (prev_block)
-					prev_block->m_link = new_block;
-				else
-					m_free_list = new_block;
-			}
+			/// A remainder too small to hold a free block node is absorbed
+			/// into the allocation instead of being lost.
+			if (remaining_size >= sizeof(FreeBlockNode))
+			{
+				next_block = reinterpret_cast<FreeBlockNode*>(AddAddress(best_block, best_required_space));
 
-			VoidPtr aligned_address = AddAddress(best_block, adjustment);
+				next_block->m_block_size = remaining_size;
+				next_block->m_link = best_block->m_link;
+			}
+			else
+				best_required_space = best_block->m_block_size;
 
-			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(best_block);
+			if (best_prev_block)
+				best_prev_block->m_link = next_block;
+			else
+				m_free_list = next_block;
 
-			header->m_padding = adjustment;
-			header->m_alloc_size = size;
+			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(AddAddress(best_block, best_adjustment));
 
-			if (this->m_stats.m_peak_size < size)
-				this->m_stats.m_peak_size = size;
+			header->m_padding = static_cast<Byte>(best_adjustment);
+			header->m_alloc_size = best_required_space - best_adjustment - sizeof(AllocationHeader);
 
-			this->m_stats.m_used_memory += required_space;
+			this->m_stats.m_used_memory += best_required_space;
 			this->m_stats.m_num_of_allocs++;
 
-			return AddAddress(aligned_address, sizeof(AllocationHeader));
+			if (this->m_stats.m_peak_size < this->m_stats.m_used_memory)
+				this->m_stats.m_peak_size = this->m_stats.m_used_memory;
+
+			return AddAddress(header, sizeof(AllocationHeader));
 		}
 		VoidPtr FreeListAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
 		{
 			if (!address)
-			{
-				/// Throw Expection
-			}
-
-			if (size > this->m_stats.m_total_size)
-			{
-				/// Throw Exception
-			}
+				return Allocate(size, alignment);
 
 			if (!WithinAddressBounds(this->m_start_ptr, address, this->m_stats.m_total_size))
 			{
-				/// Throw Expection
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS, "Address is out of the memory pool bounds")
 			}
 
-			FreeBlockNode* curr_block = this->m_free_list;
-			FreeBlockNode* prev_block = nullptr;
-			FreeBlockNode* next_block = nullptr;
-
 			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubAddress(address, sizeof(AllocationHeader)));
 
-			Size amt_to_shift = size - header->m_alloc_size;
-
-			while (curr_block)
-			{
-				next_block = curr_block->m_link;
+			/// Shrinking keeps the chunk as it is, the tail is reclaimed once
+			/// the chunk is freed.
+			if (size <= header->m_alloc_size)
+				return address;
 
-				if (address < curr_block)
-				{
-					MemorySet(curr_block, 0, curr_block->m_block_size);
-
-					if (!prev_block)
-					{
-						this->m_free_list = reinterpret_cast<FreeBlockNode*>(AddAddress(curr_block, amt_to_shift));
-						this->m_free_list->m_link = next_block;
-					}
-					else
-					{
-						prev_block->m_link = reinterpret_cast<FreeBlockNode*>(AddAddress(curr_block, amt_to_shift));
-						prev_block->m_link->m_link = next_block;
-					}
-				}
+			VoidPtr new_address = Allocate(size, alignment);
 
-				prev_block = curr_block;
-				curr_block = curr_block->m_link;
-			}
+			MemoryCopy(new_address, address, header->m_alloc_size);
+			Deallocate(address);
 
-			return address;
+			return new_address;
 		}
 		Void    FreeListAllocator::Deallocate(VoidPtr address)
 		{
@@ -180,43 +167,42 @@ namespace Forge {
 			MemorySet(free_block, 0, total_size);
 
 			free_block->m_block_size = total_size;
-			free_block->m_link = nullptr;
 
-			while (curr_block)
+			/// The free list is kept sorted by address so that physical
+			/// neighbours can be coalesced.
+			while (curr_block && curr_block < free_block)
 			{
-				if (address < curr_block)
-				{
-					if (!prev_block)
-					{
-						this->m_free_list = free_block;
-						break;
-					}
-
-					prev_block->m_link = free_block;
-					free_block->m_link = curr_block;
-				}
-
 				prev_block = curr_block;
 				curr_block = curr_block->m_link;
 			}
 
-			if (free_block->m_link &&
-				AddAddress(free_block, free_block->m_block_size) == free_block->m_link)
+			free_block->m_link = curr_block;
+
+			if (prev_block)
+				prev_block->m_link = free_block;
+			else
+				this->m_free_list = free_block;
+
+			if (curr_block &&
+				AddAddress(free_block, free_block->m_block_size) == curr_block)
 			{
-				free_block->m_block_size += free_block->m_link->m_block_size;
-				free_block->m_link = free_block->m_link->m_link;
+				free_block->m_block_size += curr_block->m_block_size;
+				free_block->m_link = curr_block->m_link;
 
-				MemorySet(free_block->m_link, 0, free_block->m_block_size);
+				MemorySet(curr_block, 0, sizeof(FreeBlockNode));
 			}
 
-			if (prev_block && prev_block->m_link &&
-				AddAddress(prev_block, prev_block->m_block_size) == prev_block->m_link)
+			if (prev_block &&
+				AddAddress(prev_block, prev_block->m_block_size) == free_block)
 			{
-				prev_block->m_block_size += prev_block->m_link->m_block_size;
-				prev_block->m_link = prev_block->m_link->m_link;
+				prev_block->m_block_size += free_block->m_block_size;
+				prev_block->m_link = free_block->m_link;
 
-				MemorySet(prev_block->m_link, 0, prev_block->m_block_size);
+				MemorySet(free_block, 0, sizeof(FreeBlockNode));
 			}
+
+			this->m_stats.m_used_memory -= total_size;
+			this->m_stats.m_num_of_deallocs++;
 		}
 
 		Void FreeListAllocator::Reset(void)
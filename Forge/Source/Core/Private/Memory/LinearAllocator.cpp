@@ -1,8 +1,19 @@
 #include "Core/Public/Memory/LinearAllocator.h"
 
+#include "Platform/Public/Base/AbstractPlatform.h"
+
 namespace Forge {
 	namespace Memory
 	{
+		namespace
+		{
+			/**
+			 * Pages are committed in steps of at least this size, so that a run
+			 * of small allocations does not turn into a system call per page.
+			 */
+			constexpr Size COMMIT_GRANULARITY = 64 * 1024;
+		}
+
 		LinearAllocator::LinearAllocator(Size total_size)
 			: AbstractAllocator(nullptr, total_size)
 		{
@@ -11,6 +22,9 @@ namespace Forge {
 			m_is_mem_owned = true;
 			m_offset_ptr = m_start_ptr;
 
+			m_platform = nullptr;
+			m_page_size = m_committed_size = m_retained_size = 0;
+
 			MemorySet(m_start_ptr, 0, m_stats.m_total_size);
 		}
 		LinearAllocator::LinearAllocator(VoidPtr start, Size total_size)
@@ -19,34 +33,95 @@ namespace Forge {
 			m_is_mem_owned = false;
 			m_offset_ptr = m_start_ptr;
 
+			m_platform = nullptr;
+			m_page_size = m_committed_size = m_retained_size = 0;
+
 			MemorySet(m_start_ptr, 0, m_stats.m_total_size);
 		}
+		LinearAllocator::LinearAllocator(Platform::AbstractPlatform* platform, Size total_size, Size retained_size)
+			: AbstractAllocator(nullptr, total_size)
+		{
+			m_platform = platform;
+			m_page_size = platform->GetPageSize();
+
+			m_stats.m_total_size = (total_size + m_page_size - 1) & ~(m_page_size - 1);
+
+			m_start_ptr = m_platform->AllocatePages(m_stats.m_total_size / m_page_size, m_page_size);
+
+			if (!m_start_ptr)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "Failed to reserve the virtual memory range")
+			}
+
+			m_is_mem_owned = true;
+			m_offset_ptr = m_start_ptr;
+
+			m_committed_size = 0;
+			m_retained_size = retained_size;
+		}
 		
 		LinearAllocator::~LinearAllocator()
 		{
-			if (m_is_mem_owned)
+			if (m_platform)
+				m_platform->DeallocatePages(m_start_ptr);
+			else if (m_is_mem_owned)
 				free(m_start_ptr);
 			else
 				MemorySet(m_start_ptr, 0, m_stats.m_total_size);
 		}
 
+		Void LinearAllocator::CommitMemory(Size used_size)
+		{
+			if (used_size > m_stats.m_total_size)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "No sufficent space for required Size")
+			}
+
+			Size granularity = m_page_size > COMMIT_GRANULARITY ? m_page_size : COMMIT_GRANULARITY;
+			Size commit_size = (used_size + granularity - 1) & ~(granularity - 1);
+
+			if (commit_size > m_stats.m_total_size)
+				commit_size = m_stats.m_total_size;
+
+			if (!m_platform->CommitPages(AddAddress(m_start_ptr, m_committed_size), (commit_size - m_committed_size) / m_page_size, m_page_size))
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "Failed to commit virtual memory pages")
+			}
+
+			m_committed_size = commit_size;
+		}
+		Void LinearAllocator::DecommitMemory(Void)
+		{
+			Size retained_size = (m_retained_size + m_page_size - 1) & ~(m_page_size - 1);
+
+			if (m_committed_size <= retained_size)
+				return;
+
+			m_platform->DecommitPages(AddAddress(m_start_ptr, retained_size), (m_committed_size - retained_size) / m_page_size, m_page_size);
+
+			m_committed_size = retained_size;
+		}
+
 		VoidPtr LinearAllocator::Allocate(Size size, Byte alignment)
 		{
 			Byte adjustment = AlignAddressUpwardAdjustment(m_offset_ptr, alignment);
 
 			if ((m_stats.m_used_memory + size + adjustment) > m_stats.m_total_size)
 			{
-				/*FORGE_EXCEPT(Debug::Exception::ERR_BAD_ALLOCATION_EXCEPTION, "No sufficent space for required Size")*/
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "No sufficent space for required Size")
 			}
 
+			if (m_platform && (m_stats.m_used_memory + size + adjustment) > m_committed_size)
+				CommitMemory(m_stats.m_used_memory + size + adjustment);
+
 			VoidPtr aligned_address = AddAddress(m_offset_ptr, adjustment);
 			m_offset_ptr = AddAddress(aligned_address, size);
 
-			if (m_stats.m_peak_size < size) { m_stats.m_peak_size = size; }
-
 			m_stats.m_used_memory += size + adjustment;
 			m_stats.m_num_of_allocs++;
 
+			if (m_stats.m_peak_size < m_stats.m_used_memory) { m_stats.m_peak_size = m_stats.m_used_memory; }
+
 			return aligned_address;
 		}
 		VoidPtr LinearAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
@@ -62,13 +137,25 @@ namespace Forge {
 
 		Void LinearAllocator::Reset(void)
 		{
+			Size dirty_size = m_platform ? m_stats.m_used_memory : m_stats.m_total_size;
+
 			m_offset_ptr = m_start_ptr;
 
-			m_stats.m_peak_size = 0;
 			m_stats.m_used_memory = 0;
 			m_stats.m_num_of_allocs = 0;
+			m_stats.m_num_of_deallocs = 0;
 
-			MemorySet(m_start_ptr, 0, m_stats.m_total_size);
+			/// Decommitted pages are zeroed by the platform when committed
+			/// again, so only the retained part has to be cleared.
+			if (m_platform)
+			{
+				DecommitMemory();
+
+				if (dirty_size > m_committed_size)
+					dirty_size = m_committed_size;
+			}
+
+			MemorySet(m_start_ptr, 0, dirty_size);
 		}
 	}
 }
\ No newline at end of file
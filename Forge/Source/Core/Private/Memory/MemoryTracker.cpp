@@ -0,0 +1,388 @@
+#include <mutex>
+#include <atomic>
+
+#include "Core/Public/Algorithm/BitUtilities.h"
+
+#include "Core/Public/Memory/MemoryTracker.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		namespace
+		{
+			constexpr Size NUM_OF_TAGS = static_cast<Size>(MemoryTag::MAX);
+			constexpr Size NUM_OF_SIZE_BUCKETS = MemoryTracker::NUM_OF_SIZE_BUCKETS;
+			constexpr Size MAX_NUM_OF_CALL_SITES = MemoryTracker::MAX_NUM_OF_CALL_SITES;
+
+			/**
+			 * The number of call-sites listed by the human readable report.
+			 */
+			constexpr Size NUM_OF_REPORTED_CALL_SITES = 16;
+
+			ConstCharPtr TAG_NAMES[NUM_OF_TAGS] =
+			{
+				"Untagged",
+				"Core",
+				"Containers",
+				"Strings",
+				"RTTI",
+				"Platform",
+				"GraphicsDevice",
+				"Rendering",
+				"Physics",
+				"Audio",
+				"Gameplay"
+			};
+
+			/**
+			 * Counters of a single thread. Only the owning thread writes them,
+			 * so a relaxed load-store pair avoids a locked instruction, while
+			 * the atomics keep concurrent snapshots well-defined.
+			 */
+			struct ThreadCounters
+			{
+				std::atomic<Size> m_num_of_allocs[NUM_OF_TAGS];
+				std::atomic<Size> m_num_of_deallocs[NUM_OF_TAGS];
+				std::atomic<Size> m_total_bytes[NUM_OF_TAGS];
+				std::atomic<Size> m_histogram[NUM_OF_TAGS][NUM_OF_SIZE_BUCKETS];
+
+				ThreadCounters* m_next;
+			};
+
+			/**
+			 * Live bytes move between threads whenever memory is freed by a
+			 * thread other than the one that allocated it, so they are shared
+			 * per tag, each on its own cache line.
+			 */
+			struct alignas(64) TagCounters
+			{
+				std::atomic<I64>  m_live_bytes;
+				std::atomic<Size> m_peak_bytes;
+			};
+
+			struct CallSite
+			{
+				std::atomic<U64>          m_key;
+				std::atomic<ConstCharPtr> m_file;
+
+				U32       m_line;
+				MemoryTag m_tag;
+
+				std::atomic<I64>  m_live_bytes;
+				std::atomic<Size> m_num_of_allocs;
+			};
+
+			/**
+			 * Counters of exited threads are kept, so that their allocations
+			 * still show up in the totals.
+			 */
+			std::mutex      s_thread_mutex;
+			ThreadCounters* s_thread_counters = nullptr;
+
+			TagCounters s_tag_counters[NUM_OF_TAGS];
+			CallSite    s_call_sites[MAX_NUM_OF_CALL_SITES];
+
+			thread_local ThreadCounters* t_thread_counters = nullptr;
+
+			thread_local MemoryTag t_scope_tag = MemoryTag::FORGE_UNTAGGED;
+			thread_local U32       t_scope_call_site = 0;
+
+			FORGE_FORCE_INLINE Void IncrementCounter(std::atomic<Size>& counter, Size value)
+			{
+				counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+			}
+
+			ThreadCounters* GetThreadCounters(Void)
+			{
+				if (t_thread_counters)
+					return t_thread_counters;
+
+				ThreadCounters* counters = new ThreadCounters();
+
+				for (Size i = 0; i < NUM_OF_TAGS; i++)
+				{
+					counters->m_num_of_allocs[i].store(0, std::memory_order_relaxed);
+					counters->m_num_of_deallocs[i].store(0, std::memory_order_relaxed);
+					counters->m_total_bytes[i].store(0, std::memory_order_relaxed);
+
+					for (Size j = 0; j < NUM_OF_SIZE_BUCKETS; j++)
+						counters->m_histogram[i][j].store(0, std::memory_order_relaxed);
+				}
+
+				std::lock_guard<std::mutex> lock(s_thread_mutex);
+
+				counters->m_next = s_thread_counters;
+				s_thread_counters = counters;
+
+				return t_thread_counters = counters;
+			}
+
+			Void WriteJsonString(FILE* stream, ConstCharPtr string)
+			{
+				fputc('"', stream);
+
+				for (; *string; string++)
+				{
+					if (*string == '"' || *string == '\\')
+						fputc('\\', stream);
+
+					fputc(*string, stream);
+				}
+
+				fputc('"', stream);
+			}
+		}
+
+		ConstCharPtr MemoryTracker::GetTagName(MemoryTag tag)
+		{
+			return static_cast<Size>(tag) < NUM_OF_TAGS ? TAG_NAMES[static_cast<Size>(tag)] : "Unknown";
+		}
+		U32 MemoryTracker::GetSizeBucket(Size size)
+		{
+			if (size <= 16)
+				return 0;
+
+			/// Bucket i holds sizes in (8 << i, 16 << i].
+			U32 bucket = Algorithm::HighestSetBitIndex(size - 1) - 3;
+
+			return bucket < NUM_OF_SIZE_BUCKETS ? bucket : NUM_OF_SIZE_BUCKETS - 1;
+		}
+
+		U32 MemoryTracker::RegisterCallSite(MemoryTag tag, ConstCharPtr file, U32 line)
+		{
+			/// Call-sites are keyed by the address of the file literal and the
+			/// line, which is unique for every scope in the program.
+			U64 key = (reinterpret_cast<U64>(file) * 0x9E3779B97F4A7C15ull) ^ line;
+
+			if (!key)
+				key = 1;
+
+			for (Size probe = 0; probe < MAX_NUM_OF_CALL_SITES; probe++)
+			{
+				Size index = (key + probe) & (MAX_NUM_OF_CALL_SITES - 1);
+				CallSite& call_site = s_call_sites[index];
+
+				U64 current_key = call_site.m_key.load(std::memory_order_acquire);
+
+				if (!current_key)
+				{
+					if (call_site.m_key.compare_exchange_strong(current_key, key, std::memory_order_acq_rel))
+					{
+						call_site.m_line = line;
+						call_site.m_tag = tag;
+
+						/// The file is published last, readers skip entries
+						/// whose file is not set yet.
+						call_site.m_file.store(file, std::memory_order_release);
+
+						return static_cast<U32>(index + 1);
+					}
+				}
+
+				if (current_key == key)
+					return static_cast<U32>(index + 1);
+			}
+
+			return 0;
+		}
+
+		MemoryTag MemoryTracker::GetScopeTag(Void)
+		{
+			return t_scope_tag;
+		}
+		U32 MemoryTracker::GetScopeCallSite(Void)
+		{
+			return t_scope_call_site;
+		}
+
+		Void MemoryTracker::TrackAllocation(MemoryTag tag, U32 call_site, Size size)
+		{
+			ThreadCounters* counters = GetThreadCounters();
+			Size tag_index = static_cast<Size>(tag);
+
+			IncrementCounter(counters->m_num_of_allocs[tag_index], 1);
+			IncrementCounter(counters->m_total_bytes[tag_index], size);
+			IncrementCounter(counters->m_histogram[tag_index][GetSizeBucket(size)], 1);
+
+			TagCounters& tag_counters = s_tag_counters[tag_index];
+
+			I64  live_bytes = tag_counters.m_live_bytes.fetch_add(static_cast<I64>(size), std::memory_order_relaxed) + static_cast<I64>(size);
+			Size peak_bytes = tag_counters.m_peak_bytes.load(std::memory_order_relaxed);
+
+			while (live_bytes > static_cast<I64>(peak_bytes) && !tag_counters.m_peak_bytes.compare_exchange_weak(peak_bytes, static_cast<Size>(live_bytes), std::memory_order_relaxed));
+
+			if (call_site)
+			{
+				s_call_sites[call_site - 1].m_live_bytes.fetch_add(static_cast<I64>(size), std::memory_order_relaxed);
+				s_call_sites[call_site - 1].m_num_of_allocs.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+		Void MemoryTracker::TrackDeallocation(MemoryTag tag, U32 call_site, Size size)
+		{
+			ThreadCounters* counters = GetThreadCounters();
+			Size tag_index = static_cast<Size>(tag);
+
+			IncrementCounter(counters->m_num_of_deallocs[tag_index], 1);
+
+			s_tag_counters[tag_index].m_live_bytes.fetch_sub(static_cast<I64>(size), std::memory_order_relaxed);
+
+			if (call_site)
+				s_call_sites[call_site - 1].m_live_bytes.fetch_sub(static_cast<I64>(size), std::memory_order_relaxed);
+		}
+
+		MemoryTracker::TagStats MemoryTracker::GetTagStats(MemoryTag tag)
+		{
+			Size tag_index = static_cast<Size>(tag);
+
+			TagStats stats = {};
+
+			{
+				std::lock_guard<std::mutex> lock(s_thread_mutex);
+
+				for (ThreadCounters* counters = s_thread_counters; counters; counters = counters->m_next)
+				{
+					stats.m_num_of_allocs += counters->m_num_of_allocs[tag_index].load(std::memory_order_relaxed);
+					stats.m_num_of_deallocs += counters->m_num_of_deallocs[tag_index].load(std::memory_order_relaxed);
+					stats.m_total_bytes += counters->m_total_bytes[tag_index].load(std::memory_order_relaxed);
+
+					for (Size i = 0; i < NUM_OF_SIZE_BUCKETS; i++)
+						stats.m_histogram[i] += counters->m_histogram[tag_index][i].load(std::memory_order_relaxed);
+				}
+			}
+
+			I64 live_bytes = s_tag_counters[tag_index].m_live_bytes.load(std::memory_order_relaxed);
+
+			stats.m_live_bytes = live_bytes > 0 ? static_cast<Size>(live_bytes) : 0;
+			stats.m_peak_bytes = s_tag_counters[tag_index].m_peak_bytes.load(std::memory_order_relaxed);
+
+			return stats;
+		}
+
+		Void MemoryTracker::DumpReport(FILE* stream)
+		{
+			fprintf(stream, "%-16s %14s %14s %14s %12s %12s\n", "tag", "live", "peak", "total", "allocs", "deallocs");
+
+			for (Size i = 0; i < NUM_OF_TAGS; i++)
+			{
+				TagStats stats = GetTagStats(static_cast<MemoryTag>(i));
+
+				if (!stats.m_num_of_allocs)
+					continue;
+
+				fprintf(stream, "%-16s %14llu %14llu %14llu %12llu %12llu\n", TAG_NAMES[i],
+					stats.m_live_bytes, stats.m_peak_bytes, stats.m_total_bytes, stats.m_num_of_allocs, stats.m_num_of_deallocs);
+			}
+
+			/// Select the call-sites holding the most live memory, the table
+			/// is small enough that a repeated linear scan is fine here.
+			Size reported[NUM_OF_REPORTED_CALL_SITES];
+			Size num_of_reported = 0;
+
+			for (; num_of_reported < NUM_OF_REPORTED_CALL_SITES; num_of_reported++)
+			{
+				Size best_index = MAX_NUM_OF_CALL_SITES;
+				I64  best_live_bytes = 0;
+
+				for (Size i = 0; i < MAX_NUM_OF_CALL_SITES; i++)
+				{
+					I64 live_bytes = s_call_sites[i].m_live_bytes.load(std::memory_order_relaxed);
+
+					if (live_bytes <= best_live_bytes || !s_call_sites[i].m_file.load(std::memory_order_acquire))
+						continue;
+
+					Bool is_reported = FORGE_FALSE;
+
+					for (Size j = 0; j < num_of_reported; j++)
+						is_reported |= reported[j] == i;
+
+					if (!is_reported)
+					{
+						best_index = i;
+						best_live_bytes = live_bytes;
+					}
+				}
+
+				if (best_index == MAX_NUM_OF_CALL_SITES)
+					break;
+
+				reported[num_of_reported] = best_index;
+			}
+
+			if (!num_of_reported)
+				return;
+
+			fprintf(stream, "\n%-16s %14s %12s    %s\n", "tag", "live", "allocs", "call-site");
+
+			for (Size i = 0; i < num_of_reported; i++)
+			{
+				CallSite& call_site = s_call_sites[reported[i]];
+
+				fprintf(stream, "%-16s %14lld %12llu    %s:%u\n", GetTagName(call_site.m_tag),
+					call_site.m_live_bytes.load(std::memory_order_relaxed), call_site.m_num_of_allocs.load(std::memory_order_relaxed),
+					call_site.m_file.load(std::memory_order_relaxed), call_site.m_line);
+			}
+		}
+		Void MemoryTracker::DumpJson(FILE* stream)
+		{
+			fprintf(stream, "{\n\t\"tags\": [");
+
+			for (Size i = 0; i < NUM_OF_TAGS; i++)
+			{
+				TagStats stats = GetTagStats(static_cast<MemoryTag>(i));
+
+				fprintf(stream, "%s\n\t\t{ \"name\": \"%s\", \"live_bytes\": %llu, \"peak_bytes\": %llu, \"total_bytes\": %llu, \"num_of_allocs\": %llu, \"num_of_deallocs\": %llu, \"histogram\": [",
+					i ? "," : "", TAG_NAMES[i], stats.m_live_bytes, stats.m_peak_bytes, stats.m_total_bytes, stats.m_num_of_allocs, stats.m_num_of_deallocs);
+
+				for (Size j = 0; j < NUM_OF_SIZE_BUCKETS; j++)
+					fprintf(stream, "%s%llu", j ? ", " : "", stats.m_histogram[j]);
+
+				fprintf(stream, "] }");
+			}
+
+			fprintf(stream, "\n\t],\n\t\"call_sites\": [");
+
+			Bool is_first = FORGE_TRUE;
+
+			for (Size i = 0; i < MAX_NUM_OF_CALL_SITES; i++)
+			{
+				CallSite& call_site = s_call_sites[i];
+				ConstCharPtr file = call_site.m_file.load(std::memory_order_acquire);
+
+				if (!file)
+					continue;
+
+				fprintf(stream, "%s\n\t\t{ \"file\": ", is_first ? "" : ",");
+				WriteJsonString(stream, file);
+				fprintf(stream, ", \"line\": %u, \"tag\": \"%s\", \"live_bytes\": %lld, \"num_of_allocs\": %llu }", call_site.m_line, GetTagName(call_site.m_tag),
+					call_site.m_live_bytes.load(std::memory_order_relaxed), call_site.m_num_of_allocs.load(std::memory_order_relaxed));
+
+				is_first = FORGE_FALSE;
+			}
+
+			fprintf(stream, "\n\t]\n}\n");
+		}
+
+		MemoryScope::MemoryScope(MemoryTag tag)
+		{
+			m_prev_tag = t_scope_tag;
+			m_prev_call_site = t_scope_call_site;
+
+			t_scope_tag = tag;
+			t_scope_call_site = 0;
+		}
+		MemoryScope::MemoryScope(MemoryTag tag, U32 call_site)
+		{
+			m_prev_tag = t_scope_tag;
+			m_prev_call_site = t_scope_call_site;
+
+			t_scope_tag = tag;
+			t_scope_call_site = call_site;
+		}
+
+		MemoryScope::~MemoryScope()
+		{
+			t_scope_tag = m_prev_tag;
+			t_scope_call_site = m_prev_call_site;
+		}
+	}
+}
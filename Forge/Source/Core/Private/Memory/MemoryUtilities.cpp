@@ -0,0 +1,659 @@
+#include <mutex>
+#include <intrin.h>
+#include <immintrin.h>
+
+#include "Core/Public/Debug/Debug.h"
+#include "Core/Public/Memory/MemoryUtilities.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		namespace
+		{
+			/**
+			 * Copies larger than this bypass the cache with non-temporal stores,
+			 * as the destination would evict the whole working set anyway.
+			 */
+			constexpr Size NON_TEMPORAL_THRESHOLD = 4 * 1024 * 1024;
+
+			FORGE_FORCE_INLINE U64 LoadU64(ConstBytePtr src) { return *reinterpret_cast<const __unaligned U64*>(src); }
+			FORGE_FORCE_INLINE U32 LoadU32(ConstBytePtr src) { return *reinterpret_cast<const __unaligned U32*>(src); }
+			FORGE_FORCE_INLINE U16 LoadU16(ConstBytePtr src) { return *reinterpret_cast<const __unaligned U16*>(src); }
+
+			FORGE_FORCE_INLINE Void StoreU64(BytePtr dst, U64 value) { *reinterpret_cast<__unaligned U64*>(dst) = value; }
+			FORGE_FORCE_INLINE Void StoreU32(BytePtr dst, U32 value) { *reinterpret_cast<__unaligned U32*>(dst) = value; }
+			FORGE_FORCE_INLINE Void StoreU16(BytePtr dst, U16 value) { *reinterpret_cast<__unaligned U16*>(dst) = value; }
+
+			/**
+			 * Copies up to 16 bytes using two overlapping loads and stores of
+			 * the widest scalar width that fits, so no byte loop is needed.
+			 */
+			FORGE_FORCE_INLINE Void CopySmall(BytePtr dst, ConstBytePtr src, Size bytes)
+			{
+				if (bytes >= 8)
+				{
+					U64 head = LoadU64(src);
+					U64 tail = LoadU64(src + bytes - 8);
+					StoreU64(dst, head);
+					StoreU64(dst + bytes - 8, tail);
+				}
+				else if (bytes >= 4)
+				{
+					U32 head = LoadU32(src);
+					U32 tail = LoadU32(src + bytes - 4);
+					StoreU32(dst, head);
+					StoreU32(dst + bytes - 4, tail);
+				}
+				else if (bytes >= 2)
+				{
+					U16 head = LoadU16(src);
+					U16 tail = LoadU16(src + bytes - 2);
+					StoreU16(dst, head);
+					StoreU16(dst + bytes - 2, tail);
+				}
+				else if (bytes)
+					*dst = *src;
+			}
+
+			FORGE_FORCE_INLINE Void SetSmall(BytePtr dst, U64 pattern, Size bytes)
+			{
+				if (bytes >= 8)
+				{
+					StoreU64(dst, pattern);
+					StoreU64(dst + bytes - 8, pattern);
+				}
+				else if (bytes >= 4)
+				{
+					StoreU32(dst, static_cast<U32>(pattern));
+					StoreU32(dst + bytes - 4, static_cast<U32>(pattern));
+				}
+				else if (bytes >= 2)
+				{
+					StoreU16(dst, static_cast<U16>(pattern));
+					StoreU16(dst + bytes - 2, static_cast<U16>(pattern));
+				}
+				else if (bytes)
+					*dst = static_cast<Byte>(pattern);
+			}
+
+			FORGE_FORCE_INLINE Bool CompareSmall(ConstBytePtr lhs, ConstBytePtr rhs, Size bytes)
+			{
+				if (bytes >= 8)
+					return ((LoadU64(lhs) ^ LoadU64(rhs)) | (LoadU64(lhs + bytes - 8) ^ LoadU64(rhs + bytes - 8))) == 0;
+				if (bytes >= 4)
+					return ((LoadU32(lhs) ^ LoadU32(rhs)) | (LoadU32(lhs + bytes - 4) ^ LoadU32(rhs + bytes - 4))) == 0;
+				if (bytes >= 2)
+					return ((LoadU16(lhs) ^ LoadU16(rhs)) | (LoadU16(lhs + bytes - 2) ^ LoadU16(rhs + bytes - 2))) == 0;
+				if (bytes)
+					return *lhs == *rhs;
+
+				return FORGE_TRUE;
+			}
+
+			/// Scalar routines.
+
+			Void ScalarMemoryCopy(VoidPtr dst, ConstVoidPtr src, Size bytes)
+			{
+				BytePtr temp_dst = reinterpret_cast<BytePtr>(dst);
+				ConstBytePtr temp_src = reinterpret_cast<ConstBytePtr>(src);
+
+				if (bytes <= 16)
+					return CopySmall(temp_dst, temp_src, bytes);
+
+				U64 tail = LoadU64(temp_src + bytes - 8);
+
+				for (Size i = 0; i < bytes - 8; i += 8)
+					StoreU64(temp_dst + i, LoadU64(temp_src + i));
+
+				StoreU64(temp_dst + bytes - 8, tail);
+			}
+
+			Void ScalarMemorySet(VoidPtr dst, Byte value, Size bytes)
+			{
+				BytePtr temp_dst = reinterpret_cast<BytePtr>(dst);
+				U64 pattern = 0x0101010101010101ull * value;
+
+				if (bytes <= 16)
+					return SetSmall(temp_dst, pattern, bytes);
+
+				for (Size i = 0; i < bytes - 8; i += 8)
+					StoreU64(temp_dst + i, pattern);
+
+				StoreU64(temp_dst + bytes - 8, pattern);
+			}
+
+			Bool ScalarMemoryCompare(ConstVoidPtr lh_address, ConstVoidPtr rh_address, Size bytes)
+			{
+				ConstBytePtr temp_lh = reinterpret_cast<ConstBytePtr>(lh_address);
+				ConstBytePtr temp_rh = reinterpret_cast<ConstBytePtr>(rh_address);
+
+				if (bytes <= 16)
+					return CompareSmall(temp_lh, temp_rh, bytes);
+
+				for (Size i = 0; i < bytes - 8; i += 8)
+					if (LoadU64(temp_lh + i) != LoadU64(temp_rh + i))
+						return FORGE_FALSE;
+
+				return LoadU64(temp_lh + bytes - 8) == LoadU64(temp_rh + bytes - 8);
+			}
+
+			/// SSE2 routines.
+
+			Void SSE2MemoryCopy(VoidPtr dst, ConstVoidPtr src, Size bytes)
+			{
+				BytePtr temp_dst = reinterpret_cast<BytePtr>(dst);
+				ConstBytePtr temp_src = reinterpret_cast<ConstBytePtr>(src);
+
+				if (bytes <= 16)
+					return CopySmall(temp_dst, temp_src, bytes);
+
+				if (bytes <= 32)
+				{
+					__m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_src));
+					__m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_src + bytes - 16));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(temp_dst), head);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(temp_dst + bytes - 16), tail);
+					return;
+				}
+
+				/// The unaligned head and tail are stored last so the body can
+				/// run on an aligned destination and overlap them freely.
+				__m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_src));
+				__m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_src + bytes - 16));
+
+				Size offset = 16 - (reinterpret_cast<U64>(temp_dst) & 15);
+				Size body_end = bytes - 16;
+
+				for (; offset + 64 <= body_end; offset += 64)
+				{
+					__m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_src + offset));
+					__m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_src + offset + 16));
+					__m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_src + offset + 32));
+					__m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_src + offset + 48));
+					_mm_store_si128(reinterpret_cast<__m128i*>(temp_dst + offset), v0);
+					_mm_store_si128(reinterpret_cast<__m128i*>(temp_dst + offset + 16), v1);
+					_mm_store_si128(reinterpret_cast<__m128i*>(temp_dst + offset + 32), v2);
+					_mm_store_si128(reinterpret_cast<__m128i*>(temp_dst + offset + 48), v3);
+				}
+
+				for (; offset < body_end; offset += 16)
+					_mm_store_si128(reinterpret_cast<__m128i*>(temp_dst + offset), _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_src + offset)));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(temp_dst), head);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(temp_dst + bytes - 16), tail);
+			}
+
+			Void SSE2MemorySet(VoidPtr dst, Byte value, Size bytes)
+			{
+				BytePtr temp_dst = reinterpret_cast<BytePtr>(dst);
+
+				if (bytes <= 16)
+					return SetSmall(temp_dst, 0x0101010101010101ull * value, bytes);
+
+				__m128i pattern = _mm_set1_epi8(static_cast<Char>(value));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(temp_dst), pattern);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(temp_dst + bytes - 16), pattern);
+
+				Size offset = 16 - (reinterpret_cast<U64>(temp_dst) & 15);
+				Size body_end = bytes - 16;
+
+				for (; offset + 64 <= body_end; offset += 64)
+				{
+					_mm_store_si128(reinterpret_cast<__m128i*>(temp_dst + offset), pattern);
+					_mm_store_si128(reinterpret_cast<__m128i*>(temp_dst + offset + 16), pattern);
+					_mm_store_si128(reinterpret_cast<__m128i*>(temp_dst + offset + 32), pattern);
+					_mm_store_si128(reinterpret_cast<__m128i*>(temp_dst + offset + 48), pattern);
+				}
+
+				for (; offset < body_end; offset += 16)
+					_mm_store_si128(reinterpret_cast<__m128i*>(temp_dst + offset), pattern);
+			}
+
+			Bool SSE2MemoryCompare(ConstVoidPtr lh_address, ConstVoidPtr rh_address, Size bytes)
+			{
+				ConstBytePtr temp_lh = reinterpret_cast<ConstBytePtr>(lh_address);
+				ConstBytePtr temp_rh = reinterpret_cast<ConstBytePtr>(rh_address);
+
+				if (bytes <= 16)
+					return CompareSmall(temp_lh, temp_rh, bytes);
+
+				Size offset = 0;
+
+				for (; offset + 64 <= bytes; offset += 64)
+				{
+					__m128i e0 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_lh + offset)),      _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_rh + offset)));
+					__m128i e1 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_lh + offset + 16)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_rh + offset + 16)));
+					__m128i e2 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_lh + offset + 32)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_rh + offset + 32)));
+					__m128i e3 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_lh + offset + 48)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_rh + offset + 48)));
+
+					if (_mm_movemask_epi8(_mm_and_si128(_mm_and_si128(e0, e1), _mm_and_si128(e2, e3))) != 0xFFFF)
+						return FORGE_FALSE;
+				}
+
+				for (; offset + 16 <= bytes; offset += 16)
+				{
+					__m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_lh + offset)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_rh + offset)));
+
+					if (_mm_movemask_epi8(eq) != 0xFFFF)
+						return FORGE_FALSE;
+				}
+
+				__m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_lh + bytes - 16)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp_rh + bytes - 16)));
+
+				return _mm_movemask_epi8(eq) == 0xFFFF;
+			}
+
+			/// AVX2 routines.
+
+			Void AVX2MemoryCopy(VoidPtr dst, ConstVoidPtr src, Size bytes)
+			{
+				BytePtr temp_dst = reinterpret_cast<BytePtr>(dst);
+				ConstBytePtr temp_src = reinterpret_cast<ConstBytePtr>(src);
+
+				if (bytes <= 32)
+					return SSE2MemoryCopy(dst, src, bytes);
+
+				if (bytes <= 64)
+				{
+					__m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src));
+					__m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src + bytes - 32));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(temp_dst), head);
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(temp_dst + bytes - 32), tail);
+					_mm256_zeroupper();
+					return;
+				}
+
+				__m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src));
+				__m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src + bytes - 32));
+
+				Size offset = 32 - (reinterpret_cast<U64>(temp_dst) & 31);
+				Size body_end = bytes - 32;
+
+				if (bytes >= NON_TEMPORAL_THRESHOLD)
+				{
+					for (; offset + 128 <= body_end; offset += 128)
+					{
+						__m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src + offset));
+						__m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src + offset + 32));
+						__m256i v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src + offset + 64));
+						__m256i v3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src + offset + 96));
+						_mm256_stream_si256(reinterpret_cast<__m256i*>(temp_dst + offset), v0);
+						_mm256_stream_si256(reinterpret_cast<__m256i*>(temp_dst + offset + 32), v1);
+						_mm256_stream_si256(reinterpret_cast<__m256i*>(temp_dst + offset + 64), v2);
+						_mm256_stream_si256(reinterpret_cast<__m256i*>(temp_dst + offset + 96), v3);
+					}
+
+					_mm_sfence();
+				}
+
+				for (; offset + 128 <= body_end; offset += 128)
+				{
+					__m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src + offset));
+					__m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src + offset + 32));
+					__m256i v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src + offset + 64));
+					__m256i v3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src + offset + 96));
+					_mm256_store_si256(reinterpret_cast<__m256i*>(temp_dst + offset), v0);
+					_mm256_store_si256(reinterpret_cast<__m256i*>(temp_dst + offset + 32), v1);
+					_mm256_store_si256(reinterpret_cast<__m256i*>(temp_dst + offset + 64), v2);
+					_mm256_store_si256(reinterpret_cast<__m256i*>(temp_dst + offset + 96), v3);
+				}
+
+				for (; offset < body_end; offset += 32)
+					_mm256_store_si256(reinterpret_cast<__m256i*>(temp_dst + offset), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_src + offset)));
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(temp_dst), head);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(temp_dst + bytes - 32), tail);
+				_mm256_zeroupper();
+			}
+
+			Void AVX2MemorySet(VoidPtr dst, Byte value, Size bytes)
+			{
+				BytePtr temp_dst = reinterpret_cast<BytePtr>(dst);
+
+				if (bytes <= 32)
+					return SSE2MemorySet(dst, value, bytes);
+
+				__m256i pattern = _mm256_set1_epi8(static_cast<Char>(value));
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(temp_dst), pattern);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(temp_dst + bytes - 32), pattern);
+
+				Size offset = 32 - (reinterpret_cast<U64>(temp_dst) & 31);
+				Size body_end = bytes - 32;
+
+				if (bytes >= NON_TEMPORAL_THRESHOLD)
+				{
+					for (; offset + 128 <= body_end; offset += 128)
+					{
+						_mm256_stream_si256(reinterpret_cast<__m256i*>(temp_dst + offset), pattern);
+						_mm256_stream_si256(reinterpret_cast<__m256i*>(temp_dst + offset + 32), pattern);
+						_mm256_stream_si256(reinterpret_cast<__m256i*>(temp_dst + offset + 64), pattern);
+						_mm256_stream_si256(reinterpret_cast<__m256i*>(temp_dst + offset + 96), pattern);
+					}
+
+					_mm_sfence();
+				}
+
+				for (; offset + 128 <= body_end; offset += 128)
+				{
+					_mm256_store_si256(reinterpret_cast<__m256i*>(temp_dst + offset), pattern);
+					_mm256_store_si256(reinterpret_cast<__m256i*>(temp_dst + offset + 32), pattern);
+					_mm256_store_si256(reinterpret_cast<__m256i*>(temp_dst + offset + 64), pattern);
+					_mm256_store_si256(reinterpret_cast<__m256i*>(temp_dst + offset + 96), pattern);
+				}
+
+				for (; offset < body_end; offset += 32)
+					_mm256_store_si256(reinterpret_cast<__m256i*>(temp_dst + offset), pattern);
+
+				_mm256_zeroupper();
+			}
+
+			Bool AVX2MemoryCompare(ConstVoidPtr lh_address, ConstVoidPtr rh_address, Size bytes)
+			{
+				ConstBytePtr temp_lh = reinterpret_cast<ConstBytePtr>(lh_address);
+				ConstBytePtr temp_rh = reinterpret_cast<ConstBytePtr>(rh_address);
+
+				if (bytes <= 32)
+					return SSE2MemoryCompare(lh_address, rh_address, bytes);
+
+				Bool result = FORGE_TRUE;
+				Size offset = 0;
+
+				for (; offset + 128 <= bytes && result; offset += 128)
+				{
+					__m256i x0 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_lh + offset)),      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_rh + offset)));
+					__m256i x1 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_lh + offset + 32)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_rh + offset + 32)));
+					__m256i x2 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_lh + offset + 64)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_rh + offset + 64)));
+					__m256i x3 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_lh + offset + 96)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_rh + offset + 96)));
+					__m256i diff = _mm256_or_si256(_mm256_or_si256(x0, x1), _mm256_or_si256(x2, x3));
+
+					result = _mm256_testz_si256(diff, diff);
+				}
+
+				for (; offset + 32 <= bytes && result; offset += 32)
+				{
+					__m256i diff = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_lh + offset)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_rh + offset)));
+
+					result = _mm256_testz_si256(diff, diff);
+				}
+
+				if (result)
+				{
+					__m256i diff = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_lh + bytes - 32)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(temp_rh + bytes - 32)));
+
+					result = _mm256_testz_si256(diff, diff);
+				}
+
+				_mm256_zeroupper();
+
+				return result;
+			}
+
+			/// AVX-512 routines, the head and tail are handled with byte masks
+			/// instead of overlapping accesses.
+
+			Void AVX512MemoryCopy(VoidPtr dst, ConstVoidPtr src, Size bytes)
+			{
+				BytePtr temp_dst = reinterpret_cast<BytePtr>(dst);
+				ConstBytePtr temp_src = reinterpret_cast<ConstBytePtr>(src);
+
+				if (bytes <= 64)
+				{
+					__mmask64 mask = _bzhi_u64(~0ull, static_cast<U32>(bytes));
+					_mm512_mask_storeu_epi8(temp_dst, mask, _mm512_maskz_loadu_epi8(mask, temp_src));
+					_mm256_zeroupper();
+					return;
+				}
+
+				Size head = (64 - (reinterpret_cast<U64>(temp_dst) & 63)) & 63;
+				__mmask64 head_mask = _bzhi_u64(~0ull, static_cast<U32>(head));
+
+				_mm512_mask_storeu_epi8(temp_dst, head_mask, _mm512_maskz_loadu_epi8(head_mask, temp_src));
+
+				Size offset = head;
+
+				if (bytes >= NON_TEMPORAL_THRESHOLD)
+				{
+					for (; offset + 256 <= bytes; offset += 256)
+					{
+						__m512i v0 = _mm512_loadu_si512(temp_src + offset);
+						__m512i v1 = _mm512_loadu_si512(temp_src + offset + 64);
+						__m512i v2 = _mm512_loadu_si512(temp_src + offset + 128);
+						__m512i v3 = _mm512_loadu_si512(temp_src + offset + 192);
+						_mm512_stream_si512(reinterpret_cast<__m512i*>(temp_dst + offset), v0);
+						_mm512_stream_si512(reinterpret_cast<__m512i*>(temp_dst + offset + 64), v1);
+						_mm512_stream_si512(reinterpret_cast<__m512i*>(temp_dst + offset + 128), v2);
+						_mm512_stream_si512(reinterpret_cast<__m512i*>(temp_dst + offset + 192), v3);
+					}
+
+					_mm_sfence();
+				}
+
+				for (; offset + 256 <= bytes; offset += 256)
+				{
+					__m512i v0 = _mm512_loadu_si512(temp_src + offset);
+					__m512i v1 = _mm512_loadu_si512(temp_src + offset + 64);
+					__m512i v2 = _mm512_loadu_si512(temp_src + offset + 128);
+					__m512i v3 = _mm512_loadu_si512(temp_src + offset + 192);
+					_mm512_store_si512(temp_dst + offset, v0);
+					_mm512_store_si512(temp_dst + offset + 64, v1);
+					_mm512_store_si512(temp_dst + offset + 128, v2);
+					_mm512_store_si512(temp_dst + offset + 192, v3);
+				}
+
+				for (; offset + 64 <= bytes; offset += 64)
+					_mm512_store_si512(temp_dst + offset, _mm512_loadu_si512(temp_src + offset));
+
+				__mmask64 tail_mask = _bzhi_u64(~0ull, static_cast<U32>(bytes - offset));
+
+				_mm512_mask_storeu_epi8(temp_dst + offset, tail_mask, _mm512_maskz_loadu_epi8(tail_mask, temp_src + offset));
+				_mm256_zeroupper();
+			}
+
+			Void AVX512MemorySet(VoidPtr dst, Byte value, Size bytes)
+			{
+				BytePtr temp_dst = reinterpret_cast<BytePtr>(dst);
+				__m512i pattern = _mm512_set1_epi8(static_cast<Char>(value));
+
+				if (bytes <= 64)
+				{
+					_mm512_mask_storeu_epi8(temp_dst, _bzhi_u64(~0ull, static_cast<U32>(bytes)), pattern);
+					_mm256_zeroupper();
+					return;
+				}
+
+				Size head = (64 - (reinterpret_cast<U64>(temp_dst) & 63)) & 63;
+
+				_mm512_mask_storeu_epi8(temp_dst, _bzhi_u64(~0ull, static_cast<U32>(head)), pattern);
+
+				Size offset = head;
+
+				if (bytes >= NON_TEMPORAL_THRESHOLD)
+				{
+					for (; offset + 256 <= bytes; offset += 256)
+					{
+						_mm512_stream_si512(reinterpret_cast<__m512i*>(temp_dst + offset), pattern);
+						_mm512_stream_si512(reinterpret_cast<__m512i*>(temp_dst + offset + 64), pattern);
+						_mm512_stream_si512(reinterpret_cast<__m512i*>(temp_dst + offset + 128), pattern);
+						_mm512_stream_si512(reinterpret_cast<__m512i*>(temp_dst + offset + 192), pattern);
+					}
+
+					_mm_sfence();
+				}
+
+				for (; offset + 256 <= bytes; offset += 256)
+				{
+					_mm512_store_si512(temp_dst + offset, pattern);
+					_mm512_store_si512(temp_dst + offset + 64, pattern);
+					_mm512_store_si512(temp_dst + offset + 128, pattern);
+					_mm512_store_si512(temp_dst + offset + 192, pattern);
+				}
+
+				for (; offset + 64 <= bytes; offset += 64)
+					_mm512_store_si512(temp_dst + offset, pattern);
+
+				_mm512_mask_storeu_epi8(temp_dst + offset, _bzhi_u64(~0ull, static_cast<U32>(bytes - offset)), pattern);
+				_mm256_zeroupper();
+			}
+
+			Bool AVX512MemoryCompare(ConstVoidPtr lh_address, ConstVoidPtr rh_address, Size bytes)
+			{
+				ConstBytePtr temp_lh = reinterpret_cast<ConstBytePtr>(lh_address);
+				ConstBytePtr temp_rh = reinterpret_cast<ConstBytePtr>(rh_address);
+
+				Bool result = FORGE_TRUE;
+				Size offset = 0;
+
+				for (; offset + 256 <= bytes && result; offset += 256)
+				{
+					__mmask64 m0 = _mm512_cmpneq_epi8_mask(_mm512_loadu_si512(temp_lh + offset),       _mm512_loadu_si512(temp_rh + offset));
+					__mmask64 m1 = _mm512_cmpneq_epi8_mask(_mm512_loadu_si512(temp_lh + offset + 64),  _mm512_loadu_si512(temp_rh + offset + 64));
+					__mmask64 m2 = _mm512_cmpneq_epi8_mask(_mm512_loadu_si512(temp_lh + offset + 128), _mm512_loadu_si512(temp_rh + offset + 128));
+					__mmask64 m3 = _mm512_cmpneq_epi8_mask(_mm512_loadu_si512(temp_lh + offset + 192), _mm512_loadu_si512(temp_rh + offset + 192));
+
+					result = (m0 | m1 | m2 | m3) == 0;
+				}
+
+				for (; offset + 64 <= bytes && result; offset += 64)
+					result = _mm512_cmpneq_epi8_mask(_mm512_loadu_si512(temp_lh + offset), _mm512_loadu_si512(temp_rh + offset)) == 0;
+
+				if (result && offset < bytes)
+				{
+					__mmask64 tail_mask = _bzhi_u64(~0ull, static_cast<U32>(bytes - offset));
+
+					result = _mm512_mask_cmpneq_epi8_mask(tail_mask, _mm512_maskz_loadu_epi8(tail_mask, temp_lh + offset), _mm512_maskz_loadu_epi8(tail_mask, temp_rh + offset)) == 0;
+				}
+
+				_mm256_zeroupper();
+
+				return result;
+			}
+
+			/// Routine selection.
+
+			const MemoryRoutineTable routine_tables[static_cast<Byte>(MemoryRoutineSet::MAX)] =
+			{
+				{ ScalarMemoryCopy, ScalarMemorySet, ScalarMemoryCompare },
+				{ SSE2MemoryCopy,   SSE2MemorySet,   SSE2MemoryCompare   },
+				{ AVX2MemoryCopy,   AVX2MemorySet,   AVX2MemoryCompare   },
+				{ AVX512MemoryCopy, AVX512MemorySet, AVX512MemoryCompare },
+			};
+
+			MemoryRoutineSet active_routine_set = MemoryRoutineSet::FORGE_SCALAR;
+
+			std::once_flag detected_routines_flag;
+
+			Void InstallMemoryRoutines(MemoryRoutineSet routine_set)
+			{
+				active_routine_set = routine_set;
+				g_memory_routine_table = routine_tables[static_cast<Byte>(routine_set)];
+			}
+
+			/// Installs the detected routine set exactly once, callers racing
+			/// on the first memory routine call wait for the installation
+			/// instead of writing the table concurrently.
+			Void InstallDetectedMemoryRoutines(Void)
+			{
+				std::call_once(detected_routines_flag, []() { InstallMemoryRoutines(DetectMemoryRoutineSet()); });
+			}
+
+			Void ResolveMemoryCopy(VoidPtr dst, ConstVoidPtr src, Size bytes)
+			{
+				InstallDetectedMemoryRoutines();
+				g_memory_routine_table.m_copy(dst, src, bytes);
+			}
+
+			Void ResolveMemorySet(VoidPtr dst, Byte value, Size bytes)
+			{
+				InstallDetectedMemoryRoutines();
+				g_memory_routine_table.m_set(dst, value, bytes);
+			}
+
+			Bool ResolveMemoryCompare(ConstVoidPtr lh_address, ConstVoidPtr rh_address, Size bytes)
+			{
+				InstallDetectedMemoryRoutines();
+				return g_memory_routine_table.m_compare(lh_address, rh_address, bytes);
+			}
+		}
+
+		/// Constant-initialized, so allocators constructed during static
+		/// initialization of other translation units resolve safely.
+		MemoryRoutineTable g_memory_routine_table = { ResolveMemoryCopy, ResolveMemorySet, ResolveMemoryCompare };
+
+		namespace
+		{
+			/// Installs the routines during static initialization, before any
+			/// thread but the main thread can call them.
+			const Bool routines_installed = (InstallDetectedMemoryRoutines(), FORGE_TRUE);
+		}
+
+		MemoryRoutineSet DetectMemoryRoutineSet(Void)
+		{
+			I32 registers[4];
+
+			__cpuid(registers, 0);
+
+			I32 max_leaf = registers[0];
+
+			__cpuid(registers, 1);
+
+			Bool has_sse2    = (registers[3] & FORGE_BIT(26)) != 0;
+			Bool has_osxsave = (registers[2] & FORGE_BIT(27)) != 0;
+			Bool has_avx     = (registers[2] & FORGE_BIT(28)) != 0;
+
+			if (!has_sse2)
+				return MemoryRoutineSet::FORGE_SCALAR;
+
+			if (!has_osxsave || !has_avx || max_leaf < 7)
+				return MemoryRoutineSet::FORGE_SSE2;
+
+			/// The operating system must save the upper register state on
+			/// context switches, XMM/YMM for AVX and opmask/ZMM for AVX-512.
+			U64 xcr0 = _xgetbv(0);
+
+			if ((xcr0 & 0x6) != 0x6)
+				return MemoryRoutineSet::FORGE_SSE2;
+
+			__cpuidex(registers, 7, 0);
+
+			Bool has_avx2     = (registers[1] & FORGE_BIT(5))  != 0;
+			Bool has_bmi2     = (registers[1] & FORGE_BIT(8))  != 0;
+			Bool has_avx512f  = (registers[1] & FORGE_BIT(16)) != 0;
+			Bool has_avx512bw = (registers[1] & FORGE_BIT(30)) != 0;
+
+			if (has_avx512f && has_avx512bw && has_bmi2 && (xcr0 & 0xE6) == 0xE6)
+				return MemoryRoutineSet::FORGE_AVX512;
+
+			if (has_avx2)
+				return MemoryRoutineSet::FORGE_AVX2;
+
+			return MemoryRoutineSet::FORGE_SSE2;
+		}
+
+		MemoryRoutineSet GetActiveMemoryRoutineSet(Void)
+		{
+			InstallDetectedMemoryRoutines();
+
+			return active_routine_set;
+		}
+
+		MemoryRoutineTable GetMemoryRoutineTable(MemoryRoutineSet routine_set)
+		{
+			if (routine_set >= MemoryRoutineSet::MAX || routine_set > DetectMemoryRoutineSet())
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Memory routine set is not supported by the processor")
+
+			return routine_tables[static_cast<Byte>(routine_set)];
+		}
+
+		Void SetActiveMemoryRoutineSet(MemoryRoutineSet routine_set)
+		{
+			if (routine_set >= MemoryRoutineSet::MAX || routine_set > DetectMemoryRoutineSet())
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Memory routine set is not supported by the processor")
+
+			/// Detection must not run later and override the requested set.
+			InstallDetectedMemoryRoutines();
+			InstallMemoryRoutines(routine_set);
+		}
+	}
+}
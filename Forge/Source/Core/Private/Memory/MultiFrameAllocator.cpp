@@ -0,0 +1,178 @@
+#include <thread>
+
+#include "Core/Public/Memory/MultiFrameAllocator.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		MultiFrameAllocator::MultiFrameAllocator(Size frame_size, U32 num_of_frames)
+			: AbstractAllocator(nullptr, frame_size * num_of_frames)
+		{
+			if (!num_of_frames || num_of_frames > MAX_NUM_OF_FRAMES)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Number of frames must be between one and MAX_NUM_OF_FRAMES")
+			}
+
+			m_frames = static_cast<LinearAllocator*>(malloc(sizeof(LinearAllocator) * num_of_frames));
+
+			for (U32 i = 0; i < num_of_frames; i++)
+			{
+				new (m_frames + i) LinearAllocator(frame_size);
+
+				m_frame_indices[i] = 0;
+			}
+
+			m_is_mem_owned = true;
+			m_num_of_frames = num_of_frames;
+			m_frame_size = frame_size;
+			m_current_frame = 0;
+
+			m_retired_frame.store(0, std::memory_order_relaxed);
+		}
+		MultiFrameAllocator::MultiFrameAllocator(Platform::AbstractPlatform* platform, Size frame_size, U32 num_of_frames, Size retained_size)
+			: AbstractAllocator(nullptr, frame_size * num_of_frames)
+		{
+			if (!num_of_frames || num_of_frames > MAX_NUM_OF_FRAMES)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Number of frames must be between one and MAX_NUM_OF_FRAMES")
+			}
+
+			m_frames = static_cast<LinearAllocator*>(malloc(sizeof(LinearAllocator) * num_of_frames));
+
+			for (U32 i = 0; i < num_of_frames; i++)
+			{
+				new (m_frames + i) LinearAllocator(platform, frame_size, retained_size);
+
+				m_frame_indices[i] = 0;
+			}
+
+			m_is_mem_owned = true;
+			m_num_of_frames = num_of_frames;
+			m_frame_size = m_frames[0].GetTotalSize();
+			m_current_frame = 0;
+
+			m_stats.m_total_size = m_frame_size * num_of_frames;
+
+			m_retired_frame.store(0, std::memory_order_relaxed);
+		}
+
+		MultiFrameAllocator::~MultiFrameAllocator()
+		{
+			for (U32 i = 0; i < m_num_of_frames; i++)
+				m_frames[i].~LinearAllocator();
+
+			free(m_frames);
+		}
+
+		MultiFrameAllocator::FrameStats MultiFrameAllocator::GetFrameStats(U64 frame_index)
+		{
+			U32 slot = GetFrameSlot(frame_index);
+
+			if (!frame_index || m_frame_indices[slot] != frame_index)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS, "Frame is not held by the ring")
+			}
+
+			FrameStats stats;
+
+			stats.m_frame_index = frame_index;
+			stats.m_used_memory = m_frames[slot].GetUsedMemory();
+			stats.m_committed_size = m_frames[slot].GetCommittedSize();
+			stats.m_num_of_allocs = m_frames[slot].GetNumOfAllocs();
+			stats.m_is_retired = frame_index <= m_retired_frame.load(std::memory_order_acquire);
+
+			return stats;
+		}
+
+		Size MultiFrameAllocator::GetUsedMemory(Void)
+		{
+			Size used_memory = 0;
+
+			for (U32 i = 0; i < m_num_of_frames; i++)
+				used_memory += m_frames[i].GetUsedMemory();
+
+			return used_memory;
+		}
+
+		Bool MultiFrameAllocator::CanBeginFrame(Void)
+		{
+			U64 next_frame = m_current_frame + 1;
+
+			/// The slot was last used by the frame one full ring earlier, which
+			/// does not exist during the first trip around the ring.
+			return next_frame <= m_num_of_frames || next_frame - m_num_of_frames <= m_retired_frame.load(std::memory_order_acquire);
+		}
+		U64  MultiFrameAllocator::BeginFrame(Void)
+		{
+			if (m_current_frame)
+			{
+				Size used_memory = m_frames[GetFrameSlot(m_current_frame)].GetUsedMemory();
+
+				if (m_stats.m_peak_size < used_memory) { m_stats.m_peak_size = used_memory; }
+			}
+
+			while (!CanBeginFrame())
+				std::this_thread::yield();
+
+			U64 next_frame = m_current_frame + 1;
+			U32 slot = GetFrameSlot(next_frame);
+
+			if (m_frame_indices[slot])
+				m_frames[slot].Reset();
+
+			m_frame_indices[slot] = next_frame;
+			m_current_frame = next_frame;
+
+			return next_frame;
+		}
+		Void MultiFrameAllocator::RetireFrame(U64 frame_index)
+		{
+			U64 retired_frame = m_retired_frame.load(std::memory_order_relaxed);
+
+			/// Retirement is cumulative, a late signal for an older frame must
+			/// not move the retired frame backwards.
+			while (retired_frame < frame_index && !m_retired_frame.compare_exchange_weak(retired_frame, frame_index, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		VoidPtr MultiFrameAllocator::Allocate(Size size, Byte alignment)
+		{
+			if (!m_current_frame)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "A frame must begin before allocating from the multi-frame allocator")
+			}
+
+			VoidPtr address = m_frames[GetFrameSlot(m_current_frame)].Allocate(size, alignment);
+
+			m_stats.m_num_of_allocs++;
+
+			return address;
+		}
+		VoidPtr MultiFrameAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
+		{
+			FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Multi-frame allocator does not support reallocation of memory addresses")
+
+			return nullptr;
+		}
+		Void    MultiFrameAllocator::Deallocate(VoidPtr address)
+		{
+			FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Multi-frame allocator does not support deallocation of memory addresses")
+		}
+
+		Void MultiFrameAllocator::Reset(Void)
+		{
+			for (U32 i = 0; i < m_num_of_frames; i++)
+			{
+				m_frames[i].Reset();
+
+				m_frame_indices[i] = 0;
+			}
+
+			m_current_frame = 0;
+
+			m_stats.m_peak_size = 0;
+			m_stats.m_num_of_allocs = 0;
+
+			m_retired_frame.store(0, std::memory_order_release);
+		}
+	}
+}
@@ -83,11 +83,11 @@ namespace Forge {
 			VoidPtr address = m_head;
 			m_head = reinterpret_cast<VoidPtr*>(*m_head);
 
-			if (m_stats.m_peak_size < size) { m_stats.m_peak_size = size; }
-
 			m_stats.m_used_memory += m_chunk_size;
 			m_stats.m_num_of_allocs++;
 
+			if (m_stats.m_peak_size < m_stats.m_used_memory) { m_stats.m_peak_size = m_stats.m_used_memory; }
+
 			return address;
 		}
 		VoidPtr PoolAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
@@ -107,7 +107,7 @@ namespace Forge {
 			m_head = reinterpret_cast<VoidPtr*>(address);
 
 			m_stats.m_used_memory -= m_chunk_size;
-			m_stats.m_num_of_allocs--;
+			m_stats.m_num_of_deallocs++;
 		}
 
 		Void PoolAllocator::Reset(void)
@@ -128,6 +128,7 @@ namespace Forge {
 
 			m_stats.m_used_memory = 0;
 			m_stats.m_num_of_allocs = 0;
+			m_stats.m_num_of_deallocs = 0;
 		}
 	}
 }
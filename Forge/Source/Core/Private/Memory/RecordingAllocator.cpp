@@ -0,0 +1,140 @@
+#include <atomic>
+
+#include "Core/Public/Memory/RecordingAllocator.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		namespace
+		{
+			/**
+			 * Threads are numbered in the order they first record a call, which
+			 * keeps thread identifiers small and stable across recorders.
+			 */
+			std::atomic<U32> s_next_thread_index(1);
+
+			thread_local U32 t_thread_index = 0;
+
+			FORGE_FORCE_INLINE U32 GetThreadIndex(Void)
+			{
+				if (!t_thread_index)
+					t_thread_index = s_next_thread_index.fetch_add(1, std::memory_order_relaxed);
+
+				return t_thread_index;
+			}
+		}
+
+		RecordingAllocator::RecordingAllocator(AbstractAllocator* backing_allocator, ConstCharPtr path)
+			: AbstractAllocator(nullptr, 0)
+		{
+			m_is_mem_owned = false;
+			m_backing_allocator = backing_allocator;
+			m_buffer_count = 0;
+			m_num_of_records = 0;
+
+			if (fopen_s(&m_file, path, "wb") != 0)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_IO, "Failed to create the allocation trace file")
+			}
+
+			/// The record count is only known once recording stops, and is
+			/// patched into the header by the destructor.
+			AllocationTraceHeader header = { TRACE_MAGIC, TRACE_VERSION, 0 };
+			fwrite(&header, sizeof(AllocationTraceHeader), 1, m_file);
+
+			m_start_time = std::chrono::steady_clock::now();
+		}
+
+		RecordingAllocator::~RecordingAllocator()
+		{
+			FlushBuffer();
+
+			AllocationTraceHeader header = { TRACE_MAGIC, TRACE_VERSION, m_num_of_records };
+
+			fseek(m_file, 0, SEEK_SET);
+			fwrite(&header, sizeof(AllocationTraceHeader), 1, m_file);
+			fclose(m_file);
+		}
+
+		Size RecordingAllocator::GetNumOfRecords(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			return m_num_of_records;
+		}
+
+		Void RecordingAllocator::Record(AllocationTraceOp op, VoidPtr address, VoidPtr new_address, Size size, Byte alignment)
+		{
+			if (m_buffer_count == BUFFER_SIZE)
+				FlushBuffer();
+
+			AllocationTraceRecord& record = m_buffer[m_buffer_count++];
+
+			record.m_timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start_time).count();
+			record.m_address = reinterpret_cast<U64>(address);
+			record.m_new_address = reinterpret_cast<U64>(new_address);
+			record.m_size = size;
+			record.m_thread = GetThreadIndex();
+			record.m_op = op;
+			record.m_alignment = alignment;
+			record.m_reserved = 0;
+
+			m_num_of_records++;
+		}
+		Void RecordingAllocator::FlushBuffer(Void)
+		{
+			fwrite(m_buffer, sizeof(AllocationTraceRecord), m_buffer_count, m_file);
+
+			m_buffer_count = 0;
+		}
+
+		/// The lock is held across the call to the backing allocator, so that
+		/// an address freed by one thread can not be handed out and recorded
+		/// by another before the free itself is recorded.
+		VoidPtr RecordingAllocator::Allocate(Size size, Byte alignment)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			VoidPtr address = m_backing_allocator->Allocate(size, alignment);
+
+			Record(AllocationTraceOp::FORGE_ALLOCATE, address, nullptr, size, alignment);
+
+			return address;
+		}
+		VoidPtr RecordingAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			VoidPtr new_address = m_backing_allocator->Reallocate(address, size, alignment);
+
+			Record(AllocationTraceOp::FORGE_REALLOCATE, address, new_address, size, alignment);
+
+			return new_address;
+		}
+		Void    RecordingAllocator::Deallocate(VoidPtr address)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			m_backing_allocator->Deallocate(address);
+
+			Record(AllocationTraceOp::FORGE_DEALLOCATE, address, nullptr, 0, 0);
+		}
+
+		Void RecordingAllocator::Flush(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			FlushBuffer();
+			fflush(m_file);
+		}
+
+		Void RecordingAllocator::Reset(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			m_backing_allocator->Reset();
+
+			Record(AllocationTraceOp::FORGE_RESET, nullptr, nullptr, 0, 0);
+		}
+	}
+}
@@ -1,8 +1,19 @@
 #include "Core/Public/Memory/StackAllocator.h"
 
+#include "Platform/Public/Base/AbstractPlatform.h"
+
 namespace Forge {
 	namespace Memory
 	{
+		namespace
+		{
+			/**
+			 * Pages are committed in steps of at least this size, so that a run
+			 * of small allocations does not turn into a system call per page.
+			 */
+			constexpr Size COMMIT_GRANULARITY = 64 * 1024;
+		}
+
 		StackAllocator::StackAllocator(Size total_size)
 			: AbstractAllocator(nullptr, total_size)
 		{
@@ -12,6 +23,9 @@ namespace Forge {
 			m_prev_address = nullptr;
 			m_offset_ptr = m_start_ptr;
 
+			m_platform = nullptr;
+			m_page_size = m_committed_size = m_retained_size = 0;
+
 			MemorySet(m_start_ptr, 0, m_stats.m_total_size);
 		}
 		StackAllocator::StackAllocator(VoidPtr start, Size total_size)
@@ -21,27 +35,92 @@ namespace Forge {
 			m_prev_address = nullptr;
 			m_offset_ptr = m_start_ptr;
 
+			m_platform = nullptr;
+			m_page_size = m_committed_size = m_retained_size = 0;
+
 			MemorySet(m_start_ptr, 0, m_stats.m_total_size);
 		}
+		StackAllocator::StackAllocator(Platform::AbstractPlatform* platform, Size total_size, Size retained_size)
+			: AbstractAllocator(nullptr, total_size)
+		{
+			m_platform = platform;
+			m_page_size = platform->GetPageSize();
+
+			m_stats.m_total_size = (total_size + m_page_size - 1) & ~(m_page_size - 1);
+
+			m_start_ptr = m_platform->AllocatePages(m_stats.m_total_size / m_page_size, m_page_size);
+
+			if (!m_start_ptr)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "Failed to reserve the virtual memory range")
+			}
+
+			m_is_mem_owned = true;
+			m_prev_address = nullptr;
+			m_offset_ptr = m_start_ptr;
+
+			m_committed_size = 0;
+			m_retained_size = retained_size;
+		}
 		
 		StackAllocator::~StackAllocator()
 		{
-			if (m_is_mem_owned)
+			if (m_platform)
+				m_platform->DeallocatePages(m_start_ptr);
+			else if (m_is_mem_owned)
 				free(m_start_ptr);
 			else
 				MemorySet(m_start_ptr, 0, m_stats.m_total_size);
 		}
 
+		Void StackAllocator::CommitMemory(Size used_size)
+		{
+			if (used_size > m_stats.m_total_size)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "No sufficent space for required Size")
+			}
+
+			Size granularity = m_page_size > COMMIT_GRANULARITY ? m_page_size : COMMIT_GRANULARITY;
+			Size commit_size = (used_size + granularity - 1) & ~(granularity - 1);
+
+			if (commit_size > m_stats.m_total_size)
+				commit_size = m_stats.m_total_size;
+
+			if (!m_platform->CommitPages(AddAddress(m_start_ptr, m_committed_size), (commit_size - m_committed_size) / m_page_size, m_page_size))
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "Failed to commit virtual memory pages")
+			}
+
+			m_committed_size = commit_size;
+		}
+		Void StackAllocator::DecommitMemory(Void)
+		{
+			Size retained_size = (m_retained_size + m_page_size - 1) & ~(m_page_size - 1);
+
+			if (m_committed_size <= retained_size)
+				return;
+
+			m_platform->DecommitPages(AddAddress(m_start_ptr, retained_size), (m_committed_size - retained_size) / m_page_size, m_page_size);
+
+			m_committed_size = retained_size;
+		}
+
 		VoidPtr StackAllocator::Allocate(Size size, Byte alignment)
 		{
 			Size header_size = sizeof(AllocationHeader);
-			Byte adjustment = AlignAddressUpwardAdjustment(m_offset_ptr, alignment);
+
+			/// The header sits right before the returned address, so it is the
+			/// address past the header that has to be aligned.
+			Byte adjustment = static_cast<Byte>(AlignAddressUpwardAdjustment(AddAddress(m_offset_ptr, header_size), alignment));
 
 			if ((m_stats.m_used_memory + size + adjustment + header_size) > m_stats.m_total_size)
 			{
 				/*FORGE_EXCEPT(Debug::Exception::ERR_BAD_ALLOCATION_EXCEPTION, "No sufficent space for required Size")*/
 			}
 
+			if (m_platform && (m_stats.m_used_memory + size + adjustment + header_size) > m_committed_size)
+				CommitMemory(m_stats.m_used_memory + size + adjustment + header_size);
+
 			VoidPtr aligned_address = AddAddress(m_offset_ptr, adjustment);
 
 			AllocationHeader* header = (AllocationHeader*)aligned_address;
@@ -51,11 +130,11 @@ namespace Forge {
 
 			m_offset_ptr = AddAddress(m_prev_address, size);
 
-			if (m_stats.m_peak_size < size) { m_stats.m_peak_size = size; }
-
 			m_stats.m_used_memory += size + adjustment + header_size;
 			m_stats.m_num_of_allocs++;
 
+			if (m_stats.m_peak_size < m_stats.m_used_memory) { m_stats.m_peak_size = m_stats.m_used_memory; }
+
 			return m_prev_address;
 		}
 		VoidPtr StackAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
@@ -75,11 +154,23 @@ namespace Forge {
 				/*FORGE_EXCEPT(Debug::Exception::ERR_INVALID_OPERATION_EXCEPTION, "Stack allocator only supports reallocation of the most recently allocated memroy")*/
 			}
 
-			Size amt_to_shift = size - (U64)SubAddress(m_offset_ptr, address);
+			Size curr_size = (U64)SubAddress(m_offset_ptr, address);
+			Size amt_to_shift = size - curr_size;
+
+			/// Deallocations clear their chunks, so does shrinking for the tail
+			/// it gives back.
+			if (size < curr_size)
+				MemorySet(AddAddress(address, size), 0, curr_size - size);
+
+			if (m_platform && (m_stats.m_used_memory + amt_to_shift) > m_committed_size)
+				CommitMemory(m_stats.m_used_memory + amt_to_shift);
+
 			m_offset_ptr = AddAddress(m_offset_ptr, amt_to_shift);
 
 			m_stats.m_used_memory += amt_to_shift;
 
+			if (m_stats.m_peak_size < m_stats.m_used_memory) { m_stats.m_peak_size = m_stats.m_used_memory; }
+
 			return address;
 		}
 		Void    StackAllocator::Deallocate(VoidPtr address)
@@ -109,18 +200,31 @@ namespace Forge {
 			MemorySet(m_offset_ptr, 0, dealloc_size);
 		
 			m_stats.m_used_memory -= dealloc_size;
-			m_stats.m_num_of_allocs--;
+			m_stats.m_num_of_deallocs++;
 		}
 
 		Void StackAllocator::Reset(void)
 		{
+			Size dirty_size = m_platform ? m_stats.m_used_memory : m_stats.m_total_size;
+
 			m_offset_ptr = m_start_ptr;
 
-			m_stats.m_peak_size = 0;
 			m_stats.m_used_memory = 0;
 			m_stats.m_num_of_allocs = 0;
+			m_stats.m_num_of_deallocs = 0;
+
+			/// Deallocations already clear their chunks, and decommitted pages
+			/// are zeroed by the platform when committed again, so only the live
+			/// part of the retained memory has to be cleared.
+			if (m_platform)
+			{
+				DecommitMemory();
+
+				if (dirty_size > m_committed_size)
+					dirty_size = m_committed_size;
+			}
 		
-			MemorySet(m_start_ptr, 0, m_stats.m_total_size);
+			MemorySet(m_start_ptr, 0, dirty_size);
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,490 @@
+#include <stddef.h>
+
+#include "Core/Public/Algorithm/BitUtilities.h"
+
+#include "Core/Public/Memory/TLSFAllocator.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		namespace
+		{
+			/**
+			 * The two lowest bits of the block size are always zero as sizes are
+			 * multiples of ALIGN_SIZE, so they are used to store the block state.
+			 */
+			constexpr Size BLOCK_FREE_BIT      = FORGE_BIT(0);
+			constexpr Size BLOCK_PREV_FREE_BIT = FORGE_BIT(1);
+
+			/**
+			 * Only the size field of a used block is overhead, the previous
+			 * physical pointer is stored in the tail of the previous block and
+			 * the free list links overlap the user payload.
+			 */
+			constexpr Size BLOCK_HEADER_OVERHEAD = sizeof(Size);
+			constexpr Size BLOCK_START_OFFSET    = sizeof(VoidPtr) + sizeof(Size);
+			constexpr Size BLOCK_SIZE_MIN        = sizeof(VoidPtr) * 2 + sizeof(Size);
+			constexpr Size BLOCK_SIZE_MAX        = static_cast<Size>(1) << 38;
+		}
+
+		FORGE_FORCE_INLINE Size TLSFAllocator::BlockHeader::GetSize(Void) const
+		{
+			return m_size & ~(BLOCK_FREE_BIT | BLOCK_PREV_FREE_BIT);
+		}
+		FORGE_FORCE_INLINE Void TLSFAllocator::BlockHeader::SetSize(Size size)
+		{
+			m_size = size | (m_size & (BLOCK_FREE_BIT | BLOCK_PREV_FREE_BIT));
+		}
+
+		FORGE_FORCE_INLINE Bool TLSFAllocator::BlockHeader::IsFree(Void) const
+		{
+			return (m_size & BLOCK_FREE_BIT) != 0;
+		}
+		FORGE_FORCE_INLINE Bool TLSFAllocator::BlockHeader::IsPrevFree(Void) const
+		{
+			return (m_size & BLOCK_PREV_FREE_BIT) != 0;
+		}
+
+		FORGE_FORCE_INLINE Void TLSFAllocator::BlockHeader::SetFree(Bool is_free)
+		{
+			m_size = is_free ? m_size | BLOCK_FREE_BIT : m_size & ~BLOCK_FREE_BIT;
+		}
+		FORGE_FORCE_INLINE Void TLSFAllocator::BlockHeader::SetPrevFree(Bool is_free)
+		{
+			m_size = is_free ? m_size | BLOCK_PREV_FREE_BIT : m_size & ~BLOCK_PREV_FREE_BIT;
+		}
+
+		FORGE_FORCE_INLINE VoidPtr TLSFAllocator::BlockHeader::ToAddress(Void)
+		{
+			return AddAddress(this, BLOCK_START_OFFSET);
+		}
+		FORGE_FORCE_INLINE TLSFAllocator::BlockHeader* TLSFAllocator::BlockHeader::FromAddress(VoidPtr address)
+		{
+			return reinterpret_cast<BlockHeader*>(SubAddress(address, BLOCK_START_OFFSET));
+		}
+
+		FORGE_FORCE_INLINE TLSFAllocator::BlockHeader* TLSFAllocator::BlockHeader::GetNext(Void)
+		{
+			return reinterpret_cast<BlockHeader*>(AddAddress(ToAddress(), GetSize() - BLOCK_HEADER_OVERHEAD));
+		}
+		FORGE_FORCE_INLINE TLSFAllocator::BlockHeader* TLSFAllocator::BlockHeader::LinkNext(Void)
+		{
+			BlockHeader* next = GetNext();
+			next->m_prev_physical = this;
+
+			return next;
+		}
+
+		FORGE_FORCE_INLINE Void TLSFAllocator::BlockHeader::MarkAsFree(Void)
+		{
+			LinkNext()->SetPrevFree(FORGE_TRUE);
+			SetFree(FORGE_TRUE);
+		}
+		FORGE_FORCE_INLINE Void TLSFAllocator::BlockHeader::MarkAsUsed(Void)
+		{
+			GetNext()->SetPrevFree(FORGE_FALSE);
+			SetFree(FORGE_FALSE);
+		}
+
+		TLSFAllocator::TLSFAllocator(Size capacity)
+			: AbstractAllocator(nullptr, capacity)
+		{
+			m_is_mem_owned = true;
+
+			m_start_ptr = malloc(this->m_stats.m_total_size);
+
+			InitializePool();
+		}
+		TLSFAllocator::TLSFAllocator(VoidPtr start, Size capacity)
+			: AbstractAllocator(start, capacity)
+		{
+			m_is_mem_owned = false;
+
+			InitializePool();
+		}
+
+		TLSFAllocator::~TLSFAllocator()
+		{
+			if (m_is_mem_owned)
+				free(m_start_ptr);
+		}
+
+		Void TLSFAllocator::MappingInsert(Size size, I32& fl_index, I32& sl_index)
+		{
+			if (size < SMALL_BLOCK_SIZE)
+			{
+				fl_index = 0;
+				sl_index = static_cast<I32>(size) / (SMALL_BLOCK_SIZE / SL_INDEX_COUNT);
+			}
+			else
+			{
+				fl_index = static_cast<I32>(Algorithm::HighestSetBitIndex(size));
+				sl_index = static_cast<I32>(size >> (fl_index - SL_INDEX_COUNT_LOG2)) ^ SL_INDEX_COUNT;
+				fl_index -= FL_INDEX_SHIFT - 1;
+			}
+		}
+		Void TLSFAllocator::MappingSearch(Size size, I32& fl_index, I32& sl_index)
+		{
+			/// Round up to the next second level list so that any block found
+			/// in it is large enough, rather than searching within a list.
+			if (size >= SMALL_BLOCK_SIZE)
+				size += (static_cast<Size>(1) << (Algorithm::HighestSetBitIndex(size) - SL_INDEX_COUNT_LOG2)) - 1;
+
+			MappingInsert(size, fl_index, sl_index);
+		}
+		Size TLSFAllocator::AdjustRequestSize(Size size, Size alignment)
+		{
+			Size aligned_size = (size + (alignment - 1)) & ~(alignment - 1);
+
+			return aligned_size < BLOCK_SIZE_MIN ? BLOCK_SIZE_MIN : aligned_size;
+		}
+
+		Void TLSFAllocator::InitializePool(Void)
+		{
+			m_fl_bitmap = 0;
+
+			for (I32 i = 0; i < FL_INDEX_COUNT; i++)
+			{
+				m_sl_bitmap[i] = 0;
+
+				for (I32 j = 0; j < SL_INDEX_COUNT; j++)
+					m_free_lists[i][j] = nullptr;
+			}
+
+			Size adjustment = AlignAddressUpwardAdjustment(m_start_ptr, ALIGN_SIZE);
+			Size pool_size = (this->m_stats.m_total_size - adjustment) & ~static_cast<Size>(ALIGN_SIZE - 1);
+
+			if (pool_size < BLOCK_SIZE_MIN + BLOCK_HEADER_OVERHEAD * 2)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "Memory pool is too small to be managed")
+			}
+
+			pool_size -= BLOCK_HEADER_OVERHEAD * 2;
+
+			if (pool_size >= BLOCK_SIZE_MAX)
+				pool_size = BLOCK_SIZE_MAX - ALIGN_SIZE;
+
+			/// The first block has no previous physical block, so it starts one
+			/// pointer before the pool and its size field lies at the pool start.
+			BlockHeader* block = reinterpret_cast<BlockHeader*>(SubAddress(AddAddress(m_start_ptr, adjustment), sizeof(VoidPtr)));
+			block->m_size = pool_size;
+			block->SetFree(FORGE_TRUE);
+			block->SetPrevFree(FORGE_FALSE);
+
+			InsertFreeBlock(block);
+
+			/// A zero-sized used sentinel terminates the pool so that merging
+			/// never walks past its end.
+			BlockHeader* sentinel = block->LinkNext();
+			sentinel->m_size = 0;
+			sentinel->SetFree(FORGE_FALSE);
+			sentinel->SetPrevFree(FORGE_TRUE);
+
+			this->m_stats.m_used_memory = 0;
+		}
+
+		Void TLSFAllocator::InsertFreeBlock(BlockHeader* block)
+		{
+			I32 fl_index, sl_index;
+			MappingInsert(block->GetSize(), fl_index, sl_index);
+
+			InsertFreeBlock(block, fl_index, sl_index);
+		}
+		Void TLSFAllocator::InsertFreeBlock(BlockHeader* block, I32 fl_index, I32 sl_index)
+		{
+			BlockHeader* head = m_free_lists[fl_index][sl_index];
+
+			block->m_next_free = head;
+			block->m_prev_free = nullptr;
+
+			if (head)
+				head->m_prev_free = block;
+
+			m_free_lists[fl_index][sl_index] = block;
+
+			m_fl_bitmap |= static_cast<U64>(1) << fl_index;
+			m_sl_bitmap[fl_index] |= static_cast<U32>(1) << sl_index;
+		}
+		Void TLSFAllocator::RemoveFreeBlock(BlockHeader* block)
+		{
+			I32 fl_index, sl_index;
+			MappingInsert(block->GetSize(), fl_index, sl_index);
+
+			RemoveFreeBlock(block, fl_index, sl_index);
+		}
+		Void TLSFAllocator::RemoveFreeBlock(BlockHeader* block, I32 fl_index, I32 sl_index)
+		{
+			BlockHeader* prev = block->m_prev_free;
+			BlockHeader* next = block->m_next_free;
+
+			if (next)
+				next->m_prev_free = prev;
+
+			if (prev)
+			{
+				prev->m_next_free = next;
+				return;
+			}
+
+			m_free_lists[fl_index][sl_index] = next;
+
+			if (!next)
+			{
+				m_sl_bitmap[fl_index] &= ~(static_cast<U32>(1) << sl_index);
+
+				if (!m_sl_bitmap[fl_index])
+					m_fl_bitmap &= ~(static_cast<U64>(1) << fl_index);
+			}
+		}
+		TLSFAllocator::BlockHeader* TLSFAllocator::LocateFreeBlock(Size size)
+		{
+			I32 fl_index, sl_index;
+			MappingSearch(size, fl_index, sl_index);
+
+			if (fl_index >= FL_INDEX_COUNT)
+				return nullptr;
+
+			U32 sl_bitmap = m_sl_bitmap[fl_index] & (~static_cast<U32>(0) << sl_index);
+
+			if (!sl_bitmap)
+			{
+				U64 fl_bitmap = fl_index + 1 < 64 ? m_fl_bitmap & (~static_cast<U64>(0) << (fl_index + 1)) : 0;
+
+				if (!fl_bitmap)
+					return nullptr;
+
+				fl_index = static_cast<I32>(Algorithm::LowestSetBitIndex(fl_bitmap));
+				sl_bitmap = m_sl_bitmap[fl_index];
+			}
+
+			sl_index = static_cast<I32>(Algorithm::LowestSetBitIndex(sl_bitmap));
+
+			BlockHeader* block = m_free_lists[fl_index][sl_index];
+
+			RemoveFreeBlock(block, fl_index, sl_index);
+
+			return block;
+		}
+
+		TLSFAllocator::BlockHeader* TLSFAllocator::SplitBlock(BlockHeader* block, Size size)
+		{
+			BlockHeader* remaining = reinterpret_cast<BlockHeader*>(AddAddress(block->ToAddress(), size - BLOCK_HEADER_OVERHEAD));
+			Size remaining_size = block->GetSize() - (size + BLOCK_HEADER_OVERHEAD);
+
+			remaining->m_size = remaining_size;
+			remaining->SetFree(FORGE_FALSE);
+			remaining->SetPrevFree(FORGE_FALSE);
+
+			block->SetSize(size);
+			remaining->MarkAsFree();
+
+			return remaining;
+		}
+		TLSFAllocator::BlockHeader* TLSFAllocator::AbsorbBlock(BlockHeader* prev, BlockHeader* block)
+		{
+			prev->SetSize(prev->GetSize() + block->GetSize() + BLOCK_HEADER_OVERHEAD);
+			prev->LinkNext();
+
+			return prev;
+		}
+		TLSFAllocator::BlockHeader* TLSFAllocator::MergePrevBlock(BlockHeader* block)
+		{
+			if (block->IsPrevFree())
+			{
+				BlockHeader* prev = block->m_prev_physical;
+
+				RemoveFreeBlock(prev);
+				block = AbsorbBlock(prev, block);
+			}
+
+			return block;
+		}
+		TLSFAllocator::BlockHeader* TLSFAllocator::MergeNextBlock(BlockHeader* block)
+		{
+			BlockHeader* next = block->GetNext();
+
+			if (next->IsFree())
+			{
+				RemoveFreeBlock(next);
+				block = AbsorbBlock(block, next);
+			}
+
+			return block;
+		}
+
+		Void TLSFAllocator::TrimFreeBlock(BlockHeader* block, Size size)
+		{
+			if (block->GetSize() >= size + sizeof(BlockHeader))
+			{
+				BlockHeader* remaining = SplitBlock(block, size);
+
+				block->LinkNext();
+				remaining->SetPrevFree(FORGE_TRUE);
+
+				InsertFreeBlock(remaining);
+			}
+		}
+		Void TLSFAllocator::TrimUsedBlock(BlockHeader* block, Size size)
+		{
+			if (block->GetSize() >= size + sizeof(BlockHeader))
+			{
+				BlockHeader* remaining = SplitBlock(block, size);
+				remaining->SetPrevFree(FORGE_FALSE);
+
+				remaining = MergeNextBlock(remaining);
+				InsertFreeBlock(remaining);
+			}
+		}
+		TLSFAllocator::BlockHeader* TLSFAllocator::TrimFreeLeadingBlock(BlockHeader* block, Size size)
+		{
+			BlockHeader* remaining = block;
+
+			if (block->GetSize() >= size + sizeof(BlockHeader))
+			{
+				remaining = SplitBlock(block, size - BLOCK_HEADER_OVERHEAD);
+				remaining->SetPrevFree(FORGE_TRUE);
+
+				block->LinkNext();
+				InsertFreeBlock(block);
+			}
+
+			return remaining;
+		}
+
+		VoidPtr TLSFAllocator::Allocate(Size size, Byte alignment)
+		{
+			if (!size)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "Allocation size must be larger than zero")
+			}
+
+			Size adjusted_size = AdjustRequestSize(size, ALIGN_SIZE);
+
+			/// Over-aligned requests reserve enough room to carve a minimum
+			/// sized free block off the front of the found block.
+			Size search_size = adjusted_size;
+
+			if (alignment > ALIGN_SIZE)
+				search_size = AdjustRequestSize(adjusted_size + alignment + sizeof(BlockHeader), ALIGN_SIZE);
+
+			if (search_size > BLOCK_SIZE_MAX)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "Size requested is larger than the memory pool")
+			}
+
+			BlockHeader* block = LocateFreeBlock(search_size);
+
+			if (!block)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "No free block large enough is available in the memory pool")
+			}
+
+			if (alignment > ALIGN_SIZE)
+			{
+				VoidPtr address = block->ToAddress();
+				Size gap = AlignAddressUpwardAdjustment(address, alignment);
+
+				/// The leading gap must itself be able to form a free block, so
+				/// push the address forward to the next suitable alignment.
+				if (gap && gap < sizeof(BlockHeader))
+				{
+					Size gap_remaining = sizeof(BlockHeader) - gap;
+
+					gap += gap_remaining > alignment ? gap_remaining : alignment;
+					gap += AlignAddressUpwardAdjustment(AddAddress(address, gap), alignment);
+				}
+
+				if (gap)
+					block = TrimFreeLeadingBlock(block, gap);
+			}
+
+			TrimFreeBlock(block, adjusted_size);
+			block->MarkAsUsed();
+
+			this->m_stats.m_used_memory += block->GetSize() + BLOCK_HEADER_OVERHEAD;
+			this->m_stats.m_num_of_allocs++;
+
+			if (this->m_stats.m_peak_size < this->m_stats.m_used_memory)
+				this->m_stats.m_peak_size = this->m_stats.m_used_memory;
+
+			return block->ToAddress();
+		}
+		VoidPtr TLSFAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
+		{
+			if (!address)
+				return Allocate(size, alignment);
+
+			if (!WithinAddressBounds(this->m_start_ptr, address, this->m_stats.m_total_size))
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS, "Address is out of the memory pool bounds")
+			}
+
+			if (!size)
+			{
+				Deallocate(address);
+				return nullptr;
+			}
+
+			BlockHeader* block = BlockHeader::FromAddress(address);
+			BlockHeader* next = block->GetNext();
+
+			Size curr_size = block->GetSize();
+			Size combined_size = curr_size + next->GetSize() + BLOCK_HEADER_OVERHEAD;
+			Size adjusted_size = AdjustRequestSize(size, ALIGN_SIZE);
+
+			/// A block resized in place keeps its address, so a larger alignment
+			/// than the block has is only honoured by moving it.
+			if (!IsAddressAligned(address, alignment) || (adjusted_size > curr_size && (!next->IsFree() || adjusted_size > combined_size)))
+			{
+				VoidPtr new_address = Allocate(size, alignment);
+
+				MemoryCopy(new_address, address, curr_size < size ? curr_size : size);
+				Deallocate(address);
+
+				return new_address;
+			}
+
+			if (adjusted_size > curr_size)
+			{
+				MergeNextBlock(block);
+				block->MarkAsUsed();
+			}
+
+			TrimUsedBlock(block, adjusted_size);
+
+			this->m_stats.m_used_memory += block->GetSize();
+			this->m_stats.m_used_memory -= curr_size;
+
+			if (this->m_stats.m_peak_size < this->m_stats.m_used_memory)
+				this->m_stats.m_peak_size = this->m_stats.m_used_memory;
+
+			return address;
+		}
+		Void    TLSFAllocator::Deallocate(VoidPtr address)
+		{
+			if (!address)
+				return;
+
+			if (!WithinAddressBounds(this->m_start_ptr, address, this->m_stats.m_total_size))
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS, "Address is out of the memory pool bounds")
+			}
+
+			BlockHeader* block = BlockHeader::FromAddress(address);
+
+			this->m_stats.m_used_memory -= block->GetSize() + BLOCK_HEADER_OVERHEAD;
+			this->m_stats.m_num_of_deallocs++;
+
+			block->MarkAsFree();
+			block = MergePrevBlock(block);
+			block = MergeNextBlock(block);
+
+			InsertFreeBlock(block);
+		}
+
+		Void TLSFAllocator::Reset(Void)
+		{
+			InitializePool();
+		}
+	}
+}
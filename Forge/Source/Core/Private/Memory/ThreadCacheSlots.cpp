@@ -0,0 +1,21 @@
+#include "Core/Public/Memory/ThreadCacheSlots.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		namespace Internal
+		{
+			namespace
+			{
+				std::atomic<U64> s_next_owner_id(1);
+			}
+
+			thread_local ThreadCacheSlot t_thread_cache_slots[THREAD_CACHE_SET_COUNT][THREAD_CACHE_WAY_COUNT];
+
+			U64 AcquireThreadCacheOwnerId(Void)
+			{
+				return s_next_owner_id.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+	}
+}
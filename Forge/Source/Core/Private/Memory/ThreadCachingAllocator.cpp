@@ -0,0 +1,451 @@
+#include "Core/Public/Memory/ThreadCachingAllocator.h"
+#include "Core/Public/Memory/ThreadCacheSlots.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		namespace
+		{
+			constexpr U32 SIZE_CLASS_SIZES[] =
+			{
+				  16,   32,   48,   64,   80,   96,  112,  128,
+				 256,  384,  512,  640,  768,  896, 1024,
+				1536, 2048, 2560, 3072, 3584, 4096
+			};
+		}
+
+		ThreadCachingAllocator::ThreadCachingAllocator(AbstractAllocator* central_allocator)
+			: AbstractAllocator(central_allocator->GetStartAddress(), central_allocator->GetTotalSize())
+		{
+			static_assert(sizeof(SIZE_CLASS_SIZES) / sizeof(U32) == NUM_OF_SIZE_CLASSES, "Size class table does not match the number of size classes");
+			static_assert(sizeof(BlockHeader) == MAX_SMALL_ALIGNMENT, "Block header must preserve the small chunk alignment");
+
+			m_is_mem_owned = false;
+
+			m_central_allocator = central_allocator;
+			m_thread_caches = nullptr;
+
+			m_id = Internal::AcquireThreadCacheOwnerId();
+		}
+
+		ThreadCachingAllocator::~ThreadCachingAllocator()
+		{
+			std::lock_guard<std::mutex> lock(m_central_mutex);
+
+			while (m_thread_caches)
+			{
+				ThreadCache* cache = m_thread_caches;
+				m_thread_caches = cache->m_next;
+
+				ReleaseThreadCache(cache);
+
+				delete cache;
+			}
+		}
+
+		U32  ThreadCachingAllocator::GetSizeClass(Size size)
+		{
+			if (size <= 128)
+				return static_cast<U32>((size + 15) / 16) - 1;
+
+			if (size <= 1024)
+				return 8 + static_cast<U32>((size - 129) / 128);
+
+			return 15 + static_cast<U32>((size - 1025) / 512);
+		}
+		Size ThreadCachingAllocator::GetSizeClassSize(U32 size_class)
+		{
+			return SIZE_CLASS_SIZES[size_class];
+		}
+
+		ThreadCachingAllocator::ThreadCache* ThreadCachingAllocator::GetThreadCache(Void)
+		{
+			ThreadCache* cache = static_cast<ThreadCache*>(Internal::FindThreadCacheSlot(m_id));
+
+			if (cache)
+				return cache;
+
+			cache = CreateThreadCache();
+
+			Internal::StoreThreadCacheSlot(m_id, cache);
+
+			return cache;
+		}
+		ThreadCachingAllocator::ThreadCache* ThreadCachingAllocator::FindThreadCache(Void)
+		{
+			return static_cast<ThreadCache*>(Internal::FindThreadCacheSlot(m_id));
+		}
+		ThreadCachingAllocator::ThreadCache* ThreadCachingAllocator::CreateThreadCache(Void)
+		{
+			std::thread::id thread_id = std::this_thread::get_id();
+
+			std::lock_guard<std::mutex> lock(m_central_mutex);
+
+			/// The slot may have been evicted by another allocator, in which
+			/// case this thread already has a registered cache.
+			for (ThreadCache* cache = m_thread_caches; cache; cache = cache->m_next)
+				if (cache->m_thread_id == thread_id)
+					return cache;
+
+			ThreadCache* cache = new ThreadCache();
+
+			cache->m_thread_id = thread_id;
+
+			for (U32 i = 0; i < NUM_OF_SIZE_CLASSES; i++)
+			{
+				Size capacity = MAGAZINE_BYTES / GetSizeClassSize(i);
+
+				cache->m_magazines[i].m_head = nullptr;
+				cache->m_magazines[i].m_count = 0;
+				cache->m_magazines[i].m_capacity = static_cast<U32>(capacity > MAX_MAGAZINE_SIZE ? MAX_MAGAZINE_SIZE :
+																	capacity < MIN_MAGAZINE_SIZE ? MIN_MAGAZINE_SIZE : capacity);
+			}
+
+			cache->m_num_of_allocs.store(0, std::memory_order_relaxed);
+			cache->m_num_of_deallocs.store(0, std::memory_order_relaxed);
+			cache->m_remote_frees.store(nullptr, std::memory_order_relaxed);
+
+			cache->m_next = m_thread_caches;
+			m_thread_caches = cache;
+
+			return cache;
+		}
+
+		Void ThreadCachingAllocator::RefillMagazine(ThreadCache* cache, U32 size_class)
+		{
+			Magazine& magazine = cache->m_magazines[size_class];
+
+			DrainRemoteFrees(cache);
+
+			if (magazine.m_head)
+				return;
+
+			Size block_size = sizeof(BlockHeader) + GetSizeClassSize(size_class);
+			U32 batch_size = magazine.m_capacity / 2;
+
+			std::lock_guard<std::mutex> lock(m_central_mutex);
+
+			for (U32 i = 0; i < batch_size; i++)
+			{
+				BlockHeader* header;
+
+				/// A partially filled batch is fine, only fail if the central
+				/// allocator cannot provide a single chunk.
+				try
+				{
+					header = static_cast<BlockHeader*>(m_central_allocator->Allocate(block_size, MAX_SMALL_ALIGNMENT));
+				}
+				catch (...)
+				{
+					if (magazine.m_head)
+						break;
+
+					throw;
+				}
+
+				header->m_owner = cache;
+				header->m_size_class = size_class;
+				header->m_offset = sizeof(BlockHeader);
+
+				FreeNode* node = reinterpret_cast<FreeNode*>(header + 1);
+				node->m_next = magazine.m_head;
+
+				magazine.m_head = node;
+				magazine.m_count++;
+
+				this->m_stats.m_used_memory += block_size;
+			}
+
+			if (this->m_stats.m_peak_size < this->m_stats.m_used_memory)
+				this->m_stats.m_peak_size = this->m_stats.m_used_memory;
+		}
+		Void ThreadCachingAllocator::FlushMagazine(ThreadCache* cache, U32 size_class, U32 count)
+		{
+			Magazine& magazine = cache->m_magazines[size_class];
+
+			Size block_size = sizeof(BlockHeader) + GetSizeClassSize(size_class);
+
+			std::lock_guard<std::mutex> lock(m_central_mutex);
+
+			for (U32 i = 0; i < count && magazine.m_head; i++)
+			{
+				FreeNode* node = magazine.m_head;
+
+				magazine.m_head = node->m_next;
+				magazine.m_count--;
+
+				m_central_allocator->Deallocate(reinterpret_cast<BlockHeader*>(node) - 1);
+
+				this->m_stats.m_used_memory -= block_size;
+			}
+		}
+		Void ThreadCachingAllocator::DrainRemoteFrees(ThreadCache* cache)
+		{
+			if (!cache->m_remote_frees.load(std::memory_order_relaxed))
+				return;
+
+			FreeNode* node = cache->m_remote_frees.exchange(nullptr, std::memory_order_acquire);
+			Size num_of_deallocs = 0;
+
+			while (node)
+			{
+				FreeNode* next = node->m_next;
+
+				U32 size_class = (reinterpret_cast<BlockHeader*>(node) - 1)->m_size_class;
+				Magazine& magazine = cache->m_magazines[size_class];
+
+				node->m_next = magazine.m_head;
+
+				magazine.m_head = node;
+				magazine.m_count++;
+
+				if (magazine.m_count > magazine.m_capacity)
+					FlushMagazine(cache, size_class, magazine.m_capacity / 2);
+
+				node = next;
+				num_of_deallocs++;
+			}
+
+			cache->m_num_of_deallocs.store(cache->m_num_of_deallocs.load(std::memory_order_relaxed) + num_of_deallocs, std::memory_order_relaxed);
+		}
+		Void ThreadCachingAllocator::ReleaseThreadCache(ThreadCache* cache)
+		{
+			FreeNode* node = cache->m_remote_frees.exchange(nullptr, std::memory_order_acquire);
+
+			while (node)
+			{
+				FreeNode* next = node->m_next;
+				BlockHeader* header = reinterpret_cast<BlockHeader*>(node) - 1;
+
+				this->m_stats.m_used_memory -= sizeof(BlockHeader) + GetSizeClassSize(header->m_size_class);
+
+				m_central_allocator->Deallocate(header);
+
+				node = next;
+				cache->m_num_of_deallocs.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			for (U32 i = 0; i < NUM_OF_SIZE_CLASSES; i++)
+			{
+				Magazine& magazine = cache->m_magazines[i];
+
+				while (magazine.m_head)
+				{
+					FreeNode* next = magazine.m_head->m_next;
+
+					m_central_allocator->Deallocate(reinterpret_cast<BlockHeader*>(magazine.m_head) - 1);
+
+					this->m_stats.m_used_memory -= sizeof(BlockHeader) + GetSizeClassSize(i);
+
+					magazine.m_head = next;
+				}
+
+				magazine.m_count = 0;
+			}
+		}
+
+		VoidPtr ThreadCachingAllocator::AllocateLarge(Size size, Byte alignment)
+		{
+			if (alignment < MAX_SMALL_ALIGNMENT)
+				alignment = MAX_SMALL_ALIGNMENT;
+
+			std::lock_guard<std::mutex> lock(m_central_mutex);
+
+			VoidPtr block = m_central_allocator->Allocate(size + alignment + sizeof(BlockHeader), MAX_SMALL_ALIGNMENT);
+
+			VoidPtr address = AddAddress(block, sizeof(BlockHeader));
+			address = AddAddress(address, AlignAddressUpwardAdjustment(address, alignment));
+
+			BlockHeader* header = reinterpret_cast<BlockHeader*>(address) - 1;
+
+			header->m_size = size;
+			header->m_size_class = LARGE_SIZE_CLASS;
+			header->m_offset = static_cast<U32>(reinterpret_cast<U64>(address) - reinterpret_cast<U64>(block));
+
+			this->m_stats.m_used_memory += header->m_offset + size;
+
+			if (this->m_stats.m_peak_size < this->m_stats.m_used_memory)
+				this->m_stats.m_peak_size = this->m_stats.m_used_memory;
+
+			return address;
+		}
+		Void    ThreadCachingAllocator::DeallocateLarge(BlockHeader* header)
+		{
+			std::lock_guard<std::mutex> lock(m_central_mutex);
+
+			this->m_stats.m_used_memory -= header->m_offset + header->m_size;
+
+			m_central_allocator->Deallocate(SubAddress(header + 1, header->m_offset));
+		}
+
+		Size ThreadCachingAllocator::GetNumOfAllocs(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_central_mutex);
+
+			Size num_of_allocs = 0;
+
+			for (ThreadCache* cache = m_thread_caches; cache; cache = cache->m_next)
+				num_of_allocs += cache->m_num_of_allocs.load(std::memory_order_relaxed);
+
+			return num_of_allocs;
+		}
+		Size ThreadCachingAllocator::GetNumOfDeallocs(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_central_mutex);
+
+			Size num_of_deallocs = 0;
+
+			for (ThreadCache* cache = m_thread_caches; cache; cache = cache->m_next)
+				num_of_deallocs += cache->m_num_of_deallocs.load(std::memory_order_relaxed);
+
+			return num_of_deallocs;
+		}
+
+		VoidPtr ThreadCachingAllocator::Allocate(Size size, Byte alignment)
+		{
+			if (!size)
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "Allocation size must be larger than zero")
+			}
+
+			ThreadCache* cache = GetThreadCache();
+
+			/// Only the owning thread writes its counters, so a relaxed
+			/// load-store pair avoids a locked instruction on the fast path.
+			cache->m_num_of_allocs.store(cache->m_num_of_allocs.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+			if (size > MAX_SMALL_SIZE || alignment > MAX_SMALL_ALIGNMENT)
+				return AllocateLarge(size, alignment);
+
+			U32 size_class = GetSizeClass(size);
+			Magazine& magazine = cache->m_magazines[size_class];
+
+			if (!magazine.m_head)
+				RefillMagazine(cache, size_class);
+
+			FreeNode* node = magazine.m_head;
+
+			magazine.m_head = node->m_next;
+			magazine.m_count--;
+
+			return node;
+		}
+		VoidPtr ThreadCachingAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
+		{
+			if (!address)
+				return Allocate(size, alignment);
+
+			if (!WithinAddressBounds(this->m_start_ptr, address, this->m_stats.m_total_size))
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS, "Address is out of the memory pool bounds")
+			}
+
+			if (!size)
+			{
+				Deallocate(address);
+				return nullptr;
+			}
+
+			BlockHeader* header = reinterpret_cast<BlockHeader*>(address) - 1;
+
+			Size curr_size = header->m_size_class == LARGE_SIZE_CLASS ? header->m_size : GetSizeClassSize(header->m_size_class);
+
+			if (size <= curr_size && AlignAddressUpwardAdjustment(address, alignment) == 0)
+			{
+				if (header->m_size_class != LARGE_SIZE_CLASS || size > curr_size / 2)
+					return address;
+			}
+
+			VoidPtr new_address = Allocate(size, alignment);
+
+			MemoryCopy(new_address, address, size < curr_size ? size : curr_size);
+			Deallocate(address);
+
+			return new_address;
+		}
+		Void    ThreadCachingAllocator::Deallocate(VoidPtr address)
+		{
+			if (!address)
+				return;
+
+			if (!WithinAddressBounds(this->m_start_ptr, address, this->m_stats.m_total_size))
+			{
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS, "Address is out of the memory pool bounds")
+			}
+
+			BlockHeader* header = reinterpret_cast<BlockHeader*>(address) - 1;
+			ThreadCache* cache = FindThreadCache();
+
+			if (header->m_size_class == LARGE_SIZE_CLASS)
+			{
+				cache = GetThreadCache();
+				cache->m_num_of_deallocs.store(cache->m_num_of_deallocs.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+				DeallocateLarge(header);
+				return;
+			}
+
+			FreeNode* node = static_cast<FreeNode*>(address);
+			ThreadCache* owner = header->m_owner;
+
+			/// Chunks owned by another thread, or freed by a thread whose slot
+			/// was evicted, go through the owner's remote-free list.
+			if (cache != owner)
+			{
+				FreeNode* head = owner->m_remote_frees.load(std::memory_order_relaxed);
+
+				do
+				{
+					node->m_next = head;
+				} while (!owner->m_remote_frees.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+
+				return;
+			}
+
+			Magazine& magazine = cache->m_magazines[header->m_size_class];
+
+			node->m_next = magazine.m_head;
+
+			magazine.m_head = node;
+			magazine.m_count++;
+
+			cache->m_num_of_deallocs.store(cache->m_num_of_deallocs.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+			if (magazine.m_count > magazine.m_capacity)
+				FlushMagazine(cache, header->m_size_class, magazine.m_capacity / 2);
+		}
+
+		Void ThreadCachingAllocator::FlushThreadCache(Void)
+		{
+			std::thread::id thread_id = std::this_thread::get_id();
+
+			std::lock_guard<std::mutex> lock(m_central_mutex);
+
+			/// Looked up by thread rather than through the slot table, so that
+			/// a cache whose slot was evicted is flushed as well.
+			for (ThreadCache* cache = m_thread_caches; cache; cache = cache->m_next)
+				if (cache->m_thread_id == thread_id)
+					ReleaseThreadCache(cache);
+		}
+
+		Void ThreadCachingAllocator::Reset(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_central_mutex);
+
+			for (ThreadCache* cache = m_thread_caches; cache; cache = cache->m_next)
+			{
+				cache->m_remote_frees.store(nullptr, std::memory_order_relaxed);
+
+				for (U32 i = 0; i < NUM_OF_SIZE_CLASSES; i++)
+				{
+					cache->m_magazines[i].m_head = nullptr;
+					cache->m_magazines[i].m_count = 0;
+				}
+			}
+
+			m_central_allocator->Reset();
+
+			this->m_stats.m_used_memory = 0;
+		}
+	}
+}
@@ -0,0 +1,117 @@
+#include "Core/Public/Memory/TrackingAllocator.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		TrackingAllocator::TrackingAllocator(AbstractAllocator* backing_allocator, MemoryTag default_tag)
+			: AbstractAllocator(nullptr, 0)
+		{
+			m_is_mem_owned = false;
+			m_backing_allocator = backing_allocator;
+			m_default_tag = default_tag;
+		}
+
+#if defined(FORGE_ENABLE_MEMORY_TRACKING)
+		VoidPtr TrackingAllocator::Allocate(Size size, Byte alignment)
+		{
+			/// The backing allocator aligns the start of the chunk, so placing
+			/// the header at an offset of the alignment keeps the returned
+			/// address aligned as well.
+			Size offset = alignment > sizeof(AllocationHeader) ? alignment : sizeof(AllocationHeader);
+
+			VoidPtr chunk = m_backing_allocator->Allocate(size + offset, alignment);
+
+			if (!chunk)
+				return nullptr;
+
+			VoidPtr address = AddAddress(chunk, offset);
+
+			MemoryTag tag = MemoryTracker::GetScopeTag();
+
+			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubAddress(address, sizeof(AllocationHeader)));
+			header->m_size = size;
+			header->m_call_site = MemoryTracker::GetScopeCallSite();
+			header->m_tag = tag != MemoryTag::FORGE_UNTAGGED ? tag : m_default_tag;
+			header->m_offset = static_cast<Byte>(offset);
+
+			MemoryTracker::TrackAllocation(header->m_tag, header->m_call_site, size);
+
+			return address;
+		}
+		VoidPtr TrackingAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
+		{
+			if (!address)
+				return Allocate(size, alignment);
+
+			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubAddress(address, sizeof(AllocationHeader)));
+
+			Size      offset = header->m_offset;
+			Size      prev_size = header->m_size;
+			MemoryTag tag = header->m_tag;
+			U32       call_site = header->m_call_site;
+
+			/// A different alignment may need a different header offset, and a
+			/// chunk resized in place keeps its possibly less aligned address,
+			/// so in either case the content is moved to a new chunk.
+			if (offset != (alignment > sizeof(AllocationHeader) ? alignment : sizeof(AllocationHeader)) || !IsAddressAligned(address, alignment))
+			{
+				VoidPtr new_address = Allocate(size, alignment);
+
+				if (!new_address)
+					return nullptr;
+
+				MemoryCopy(new_address, address, prev_size < size ? prev_size : size);
+
+				Deallocate(address);
+
+				return new_address;
+			}
+
+			/// The header moves along with the content of the chunk.
+			VoidPtr chunk = m_backing_allocator->Reallocate(SubAddress(address, offset), size + offset, alignment);
+
+			if (!chunk)
+				return nullptr;
+
+			VoidPtr new_address = AddAddress(chunk, offset);
+
+			header = reinterpret_cast<AllocationHeader*>(SubAddress(new_address, sizeof(AllocationHeader)));
+			header->m_size = size;
+
+			MemoryTracker::TrackDeallocation(tag, call_site, prev_size);
+			MemoryTracker::TrackAllocation(tag, call_site, size);
+
+			return new_address;
+		}
+		Void    TrackingAllocator::Deallocate(VoidPtr address)
+		{
+			if (!address)
+				return;
+
+			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubAddress(address, sizeof(AllocationHeader)));
+
+			MemoryTracker::TrackDeallocation(header->m_tag, header->m_call_site, header->m_size);
+
+			m_backing_allocator->Deallocate(SubAddress(address, header->m_offset));
+		}
+#else
+		VoidPtr TrackingAllocator::Allocate(Size size, Byte alignment)
+		{
+			return m_backing_allocator->Allocate(size, alignment);
+		}
+		VoidPtr TrackingAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
+		{
+			return m_backing_allocator->Reallocate(address, size, alignment);
+		}
+		Void    TrackingAllocator::Deallocate(VoidPtr address)
+		{
+			m_backing_allocator->Deallocate(address);
+		}
+#endif
+
+		Void TrackingAllocator::Reset(Void)
+		{
+			m_backing_allocator->Reset();
+		}
+	}
+}
@@ -8,14 +8,18 @@ namespace Forge {
 			static TypeInfo static_type_info("Object", sizeof(Object), nullptr);
 			return &static_type_info;
 		}
+		ConstTypeInfoPtr Object::GetInstanceTypeInfo(void) const
+		{
+			return GetTypeInfo();
+		}
 
-		Bool Object::IsInstanceOf(ConstStringHash type_id) const
+		Bool Object::IsInstanceOf(Type::ConstStringHash type_id) const
 		{
-			return GetTypeInfo()->IsDerivedFrom(type_id);
+			return GetInstanceTypeInfo()->IsDerivedFrom(type_id);
 		}
 		Bool Object::IsInstanceOf(ConstTypeInfoPtr type_info) const
 		{
-			return GetTypeInfo()->IsDerivedFrom(type_info);
+			return GetInstanceTypeInfo()->IsDerivedFrom(type_info);
 		}
 	}
 }
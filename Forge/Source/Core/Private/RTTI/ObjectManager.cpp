@@ -0,0 +1,38 @@
+#include "Core/Public/RTTI/ObjectManager.h"
+
+namespace Forge {
+	namespace RTTI
+	{
+		ObjectManager::ObjectManager(Void)
+		{
+		}
+
+		ObjectManager::~ObjectManager(Void)
+		{
+			for (Size i = 0; i < m_pools.GetCount(); i++)
+				delete m_pools[i];
+		}
+
+		Size ObjectManager::GetCount(Void) const
+		{
+			Size num_of_objects = 0;
+
+			for (Size i = 0; i < m_pools.GetCount(); i++)
+			{
+				if (m_pools[i])
+					num_of_objects += m_pools[i]->GetCount();
+			}
+
+			return num_of_objects;
+		}
+
+		Void ObjectManager::Clear(Void)
+		{
+			for (Size i = 0; i < m_pools.GetCount(); i++)
+			{
+				if (m_pools[i])
+					m_pools[i]->Clear();
+			}
+		}
+	}
+}
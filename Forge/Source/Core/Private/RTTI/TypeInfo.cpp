@@ -1,36 +1,35 @@
 #include "Core/Public/RTTI/TypeInfo.h"
+#include "Core/Public/RTTI/TypeRegistry.h"
 
 namespace Forge {
 	namespace RTTI
 	{
+		std::atomic<U32> TypeInfo::s_numbering_version(0);
+
 		TypeInfo::TypeInfo(ConstCharPtr type_name, ConstSize type_size, ConstTypeInfoPtr base_type_info)
-			: m_type_name(m_type_name), m_type_size(type_size), m_base_type_info(base_type_info)
+			: m_type_size(type_size), m_type_name(type_name), m_type_hash_id(type_name), m_base_type_info(base_type_info),
+			  m_pre_order(0), m_post_order(0), m_type_index(0),
+			  m_first_derived_type_info(nullptr), m_next_sibling_type_info(nullptr)
 		{
-			/// Compute type ID
+			TypeRegistry::Register(this);
 		}
 
-		Bool TypeInfo::IsSameAs(ConstStringHash& type_id) const
-		{
-			return false;
-		}
-		Bool TypeInfo::IsDerivedFrom(ConstStringHash& type_id) const
+		TypeInfo::~TypeInfo()
 		{
-			return false;
+			TypeRegistry::Unregister(this);
 		}
-		Bool TypeInfo::IsSameAs(ConstTypeInfoPtr type_info) const
+
+		Bool TypeInfo::IsSameAs(const Type::ConstStringHash& type_id) const
 		{
-			return this == type_info;
+			return m_type_hash_id == type_id;
 		}
-		Bool TypeInfo::IsDerivedFrom(ConstTypeInfoPtr type_info) const
+		Bool TypeInfo::IsDerivedFrom(const Type::ConstStringHash& type_id) const
 		{
-			if (!type_info)
-				return false;
-
 			ConstTypeInfoPtr current = this;
-			
+
 			while (current)
 			{
-				if (current == type_info)
+				if (current->m_type_hash_id == type_id)
 					return true;
 
 				current = current->m_base_type_info;
@@ -38,5 +37,10 @@ namespace Forge {
 
 			return false;
 		}
+
+		Void TypeInfo::NumberTypes(Void)
+		{
+			TypeRegistry::NumberTypes();
+		}
 	}
 }
@@ -0,0 +1,186 @@
+#include <mutex>
+
+#include "Core/Public/RTTI/TypeRegistry.h"
+
+#include "Core/Public/Containers/TDynamicArray.h"
+#include "Core/Public/Containers/TFlatHashMap.h"
+
+namespace Forge {
+	namespace RTTI
+	{
+		namespace
+		{
+			struct RegistryState
+			{
+				std::mutex m_mutex;
+
+				/// Type infos by type index, removed types leave a null entry.
+				Containers::TDynamicArray<TypeInfoPtr> m_type_infos;
+
+				Containers::TFlatHashMap<Type::ConstStringHash, TypeInfoPtr> m_type_infos_by_name;
+			};
+
+			/**
+			 * The state is created by the first registration, so that types
+			 * registered during static initialization of any translation unit
+			 * find it constructed, and destroyed after every type info.
+			 */
+			RegistryState& GetState(Void)
+			{
+				static RegistryState s_state;
+
+				return s_state;
+			}
+		}
+
+		/**
+		 * Numbers every type of the hierarchy rooted at a type in
+		 * depth-first order, walking derived and sibling links instead of
+		 * keeping a stack.
+		 */
+		Void TypeRegistry::NumberHierarchy(TypeInfoPtr root, U32& counter)
+		{
+			TypeInfoPtr current = root;
+
+			current->m_pre_order.store(counter++, std::memory_order_relaxed);
+
+			while (true)
+			{
+				if (current->m_first_derived_type_info)
+				{
+					current = current->m_first_derived_type_info;
+					current->m_pre_order.store(counter++, std::memory_order_relaxed);
+
+					continue;
+				}
+
+				/// Leaves the finished subtrees up to the first ancestor
+				/// with a sibling left to visit.
+				while (true)
+				{
+					current->m_post_order.store(counter++, std::memory_order_relaxed);
+
+					if (current == root)
+						return;
+
+					if (current->m_next_sibling_type_info)
+					{
+						current = current->m_next_sibling_type_info;
+						current->m_pre_order.store(counter++, std::memory_order_relaxed);
+
+						break;
+					}
+
+					current = const_cast<TypeInfoPtr>(current->m_base_type_info);
+				}
+			}
+		}
+
+		Void TypeRegistry::Register(TypeInfoPtr type_info)
+		{
+			RegistryState& state = GetState();
+
+			std::lock_guard<std::mutex> lock(state.m_mutex);
+
+			type_info->m_type_index = static_cast<U32>(state.m_type_infos.GetCount());
+
+			state.m_type_infos.PushBack(type_info);
+			state.m_type_infos_by_name.Insert(type_info->m_type_hash_id, type_info);
+
+			if (type_info->m_base_type_info)
+			{
+				TypeInfoPtr base_type_info = const_cast<TypeInfoPtr>(type_info->m_base_type_info);
+
+				type_info->m_next_sibling_type_info = base_type_info->m_first_derived_type_info;
+				base_type_info->m_first_derived_type_info = type_info;
+			}
+
+			/// Marks the numbers as stale before any of them is written, the
+			/// hierarchy is numbered again by the next derivation check.
+			U32 version = TypeInfo::s_numbering_version.load(std::memory_order_relaxed);
+
+			if (!(version & 1))
+			{
+				TypeInfo::s_numbering_version.store(version + 1, std::memory_order_relaxed);
+
+				std::atomic_thread_fence(std::memory_order_release);
+			}
+		}
+		Void TypeRegistry::NumberTypes(Void)
+		{
+			RegistryState& state = GetState();
+
+			std::lock_guard<std::mutex> lock(state.m_mutex);
+
+			U32 version = TypeInfo::s_numbering_version.load(std::memory_order_relaxed);
+
+			if (!(version & 1))
+				return;
+
+			U32 counter = 0;
+
+			for (Size i = 0; i < state.m_type_infos.GetCount(); i++)
+			{
+				TypeInfoPtr root = state.m_type_infos[i];
+
+				if (root && !root->m_base_type_info)
+					NumberHierarchy(root, counter);
+			}
+
+			TypeInfo::s_numbering_version.store(version + 1, std::memory_order_release);
+		}
+
+		Void TypeRegistry::Unregister(TypeInfoPtr type_info)
+		{
+			RegistryState& state = GetState();
+
+			std::lock_guard<std::mutex> lock(state.m_mutex);
+
+			state.m_type_infos[type_info->m_type_index] = nullptr;
+
+			TypeInfoPtr* stored_type_info = state.m_type_infos_by_name.FindValue(type_info->m_type_hash_id);
+
+			if (stored_type_info && *stored_type_info == type_info)
+				state.m_type_infos_by_name.Remove(type_info->m_type_hash_id);
+
+			/// Removing a leaf leaves the numbers of every other type valid,
+			/// so the hierarchy is not numbered again.
+			if (type_info->m_base_type_info)
+			{
+				TypeInfoPtr* link = &const_cast<TypeInfoPtr>(type_info->m_base_type_info)->m_first_derived_type_info;
+
+				while (*link != type_info)
+					link = &(*link)->m_next_sibling_type_info;
+
+				*link = type_info->m_next_sibling_type_info;
+			}
+		}
+
+		U32 TypeRegistry::GetNumOfTypes(Void)
+		{
+			RegistryState& state = GetState();
+
+			std::lock_guard<std::mutex> lock(state.m_mutex);
+
+			return static_cast<U32>(state.m_type_infos.GetCount());
+		}
+		ConstTypeInfoPtr TypeRegistry::GetTypeInfo(U32 type_index)
+		{
+			RegistryState& state = GetState();
+
+			std::lock_guard<std::mutex> lock(state.m_mutex);
+
+			return type_index < state.m_type_infos.GetCount() ? state.m_type_infos[type_index] : nullptr;
+		}
+		ConstTypeInfoPtr TypeRegistry::FindTypeInfo(const Type::ConstStringHash& type_id)
+		{
+			RegistryState& state = GetState();
+
+			std::lock_guard<std::mutex> lock(state.m_mutex);
+
+			TypeInfoPtr* type_info = state.m_type_infos_by_name.FindValue(type_id);
+
+			return type_info ? *type_info : nullptr;
+		}
+	}
+}
@@ -0,0 +1,292 @@
+#include <new>
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+
+#include "Core/Public/Debug/Debug.h"
+#include "Core/Public/Memory/MemoryUtilities.h"
+#include "Core/Public/Types/String/StringTable.h"
+
+namespace Forge {
+	namespace Type
+	{
+		namespace
+		{
+			constexpr Size PAGE_SIZE = StringTable::PAGE_SIZE;
+			constexpr Size MAX_NUM_OF_PAGES = StringTable::MAX_NUM_OF_PAGES;
+			constexpr Size MAX_NUM_OF_STRINGS = StringTable::MAX_NUM_OF_STRINGS;
+
+			constexpr Size CHUNK_SIZE = 64 * 1024;
+			constexpr Size INITIAL_INDEX_CAPACITY = 1024;
+
+			/**
+			 * Strings larger than this get a block of their own rather than
+			 * wasting the rest of the current chunk.
+			 */
+			constexpr Size MAX_CHUNK_STRING_SIZE = CHUNK_SIZE / 4;
+
+			constexpr U64 SLOT_TAG_MASK = 0xFFFFFFFF00000000ull;
+
+			struct StringEntry
+			{
+				U64  m_hash;
+				Size m_count;
+
+				/// Null-terminated text, allocated past the end of the entry.
+				Char m_data[1];
+			};
+
+			/**
+			 * Open addressing index from hashes to identifiers. Every slot packs
+			 * the high half of the hash with the identifier, so most mismatches
+			 * are rejected without touching the entry.
+			 */
+			struct StringIndex
+			{
+				Size         m_capacity;
+				StringIndex* m_retired;
+
+				std::atomic<U64> m_slots[1];
+			};
+
+			using StringPage = std::atomic<StringEntry*>;
+
+			StringEntry s_empty_entry = { Algorithm::HashFnv1a64("", 0), 0, { 0 } };
+
+			std::atomic<StringPage*>  s_pages[MAX_NUM_OF_PAGES];
+			std::atomic<StringIndex*> s_index(nullptr);
+			std::atomic<U32>          s_num_of_strings(1);
+			std::atomic<Size>         s_used_memory(0);
+
+			/// Indices replaced by a larger one are kept, since readers may
+			/// still be probing them. They add up to less than the current one.
+			StringIndex* s_retired_index = nullptr;
+
+			/// Interning new strings and the arena are guarded by the writer
+			/// mutex, lookups never take it.
+			std::mutex s_writer_mutex;
+
+			BytePtr s_chunk_ptr = nullptr;
+			BytePtr s_chunk_end = nullptr;
+
+			StringEntry* GetEntry(U32 id)
+			{
+				if (!id)
+					return &s_empty_entry;
+
+				if (id >= s_num_of_strings.load(std::memory_order_acquire))
+					return nullptr;
+
+				StringPage* page = s_pages[id / PAGE_SIZE].load(std::memory_order_acquire);
+
+				return page[id % PAGE_SIZE].load(std::memory_order_acquire);
+			}
+
+			U32 FindInIndex(const StringIndex* index, ConstCharPtr str, Size count, U64 hash)
+			{
+				Size mask = index->m_capacity - 1;
+				U64 tag = hash & SLOT_TAG_MASK;
+
+				for (Size i = hash & mask;; i = (i + 1) & mask)
+				{
+					U64 slot = index->m_slots[i].load(std::memory_order_acquire);
+
+					if (!slot)
+						return StringTable::INVALID_ID;
+
+					if ((slot & SLOT_TAG_MASK) == tag)
+					{
+						U32 id = static_cast<U32>(slot);
+						StringEntry* entry = GetEntry(id);
+
+						if (entry->m_hash == hash && entry->m_count == count && Memory::MemoryCompare(entry->m_data, str, count))
+							return id;
+					}
+				}
+			}
+
+			Void InsertIntoIndex(StringIndex* index, U32 id, U64 hash)
+			{
+				Size mask = index->m_capacity - 1;
+				Size i = hash & mask;
+
+				while (index->m_slots[i].load(std::memory_order_relaxed))
+					i = (i + 1) & mask;
+
+				index->m_slots[i].store((hash & SLOT_TAG_MASK) | id, std::memory_order_release);
+			}
+
+			StringIndex* CreateIndex(Size capacity)
+			{
+				Size size = offsetof(StringIndex, m_slots) + (capacity * sizeof(std::atomic<U64>));
+
+				StringIndex* index = reinterpret_cast<StringIndex*>(new Byte[size]);
+
+				index->m_capacity = capacity;
+				index->m_retired = nullptr;
+
+				for (Size i = 0; i < capacity; i++)
+					new (&index->m_slots[i]) std::atomic<U64>(0);
+
+				s_used_memory.fetch_add(size, std::memory_order_relaxed);
+
+				return index;
+			}
+
+			/**
+			 * Gets an index with room for one more string, doubling it once it
+			 * would be more than half full. Must be called under the writer
+			 * mutex.
+			 */
+			StringIndex* ReserveIndex(Size num_of_strings)
+			{
+				StringIndex* index = s_index.load(std::memory_order_relaxed);
+
+				if (index && ((num_of_strings + 1) * 2) <= index->m_capacity)
+					return index;
+
+				StringIndex* new_index = CreateIndex(index ? index->m_capacity * 2 : INITIAL_INDEX_CAPACITY);
+
+				for (U32 id = 1; id < num_of_strings; id++)
+					InsertIntoIndex(new_index, id, GetEntry(id)->m_hash);
+
+				if (index)
+				{
+					index->m_retired = s_retired_index;
+					s_retired_index = index;
+				}
+
+				s_index.store(new_index, std::memory_order_release);
+
+				return new_index;
+			}
+
+			/**
+			 * Copies a string into the arena. Must be called under the writer
+			 * mutex.
+			 */
+			StringEntry* CreateEntry(ConstCharPtr str, Size count, U64 hash)
+			{
+				Size size = (offsetof(StringEntry, m_data) + count + 1 + 7) & ~static_cast<Size>(7);
+
+				BytePtr address;
+
+				if (size > MAX_CHUNK_STRING_SIZE)
+				{
+					address = new Byte[size];
+
+					s_used_memory.fetch_add(size, std::memory_order_relaxed);
+				}
+				else
+				{
+					if (static_cast<Size>(s_chunk_end - s_chunk_ptr) < size)
+					{
+						s_chunk_ptr = new Byte[CHUNK_SIZE];
+						s_chunk_end = s_chunk_ptr + CHUNK_SIZE;
+
+						s_used_memory.fetch_add(CHUNK_SIZE, std::memory_order_relaxed);
+					}
+
+					address = s_chunk_ptr;
+					s_chunk_ptr += size;
+				}
+
+				StringEntry* entry = reinterpret_cast<StringEntry*>(address);
+
+				entry->m_hash = hash;
+				entry->m_count = count;
+
+				Memory::MemoryCopy(entry->m_data, str, count);
+				entry->m_data[count] = '\0';
+
+				return entry;
+			}
+		}
+
+		U32 StringTable::Intern(ConstCharPtr str, Size count, U64 hash)
+		{
+			if (!count)
+				return 0;
+
+			U32 id = Find(str, count, hash);
+
+			if (id != INVALID_ID)
+				return id;
+
+			std::lock_guard<std::mutex> lock(s_writer_mutex);
+
+			/// Another writer may have interned the string since the lookup.
+			StringIndex* index = s_index.load(std::memory_order_relaxed);
+
+			if (index && (id = FindInIndex(index, str, count, hash)) != INVALID_ID)
+				return id;
+
+			id = s_num_of_strings.load(std::memory_order_relaxed);
+
+			if (id >= MAX_NUM_OF_STRINGS)
+				FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "String table is full")
+
+			StringPage* page = s_pages[id / PAGE_SIZE].load(std::memory_order_relaxed);
+
+			if (!page)
+			{
+				page = new StringPage[PAGE_SIZE];
+
+				for (Size i = 0; i < PAGE_SIZE; i++)
+					page[i].store(nullptr, std::memory_order_relaxed);
+
+				s_used_memory.fetch_add(PAGE_SIZE * sizeof(StringPage), std::memory_order_relaxed);
+				s_pages[id / PAGE_SIZE].store(page, std::memory_order_release);
+			}
+
+			index = ReserveIndex(id);
+
+			page[id % PAGE_SIZE].store(CreateEntry(str, count, hash), std::memory_order_release);
+
+			/// The identifier is counted before it is published in the index,
+			/// so readers finding it can always resolve it.
+			s_num_of_strings.store(id + 1, std::memory_order_release);
+
+			InsertIntoIndex(index, id, hash);
+
+			return id;
+		}
+		U32 StringTable::Find(ConstCharPtr str, Size count, U64 hash)
+		{
+			if (!count)
+				return 0;
+
+			StringIndex* index = s_index.load(std::memory_order_acquire);
+
+			return index ? FindInIndex(index, str, count, hash) : INVALID_ID;
+		}
+
+		ConstCharPtr StringTable::GetString(U32 id)
+		{
+			StringEntry* entry = GetEntry(id);
+
+			return entry ? entry->m_data : nullptr;
+		}
+		Size StringTable::GetCount(U32 id)
+		{
+			StringEntry* entry = GetEntry(id);
+
+			return entry ? entry->m_count : 0;
+		}
+		U64 StringTable::GetHash(U32 id)
+		{
+			StringEntry* entry = GetEntry(id);
+
+			return entry ? entry->m_hash : 0;
+		}
+
+		Size StringTable::GetNumOfStrings(Void)
+		{
+			return s_num_of_strings.load(std::memory_order_acquire);
+		}
+		Size StringTable::GetUsedMemory(Void)
+		{
+			return s_used_memory.load(std::memory_order_relaxed);
+		}
+	}
+}
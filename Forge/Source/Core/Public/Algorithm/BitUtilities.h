@@ -0,0 +1,78 @@
+#ifndef BIT_UTILITIES_H
+#define BIT_UTILITIES_H
+
+#include <intrin.h>
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Algorithm
+	{
+		/**
+		 * @brief Returns the index of the lowest set bit in a mask.
+		 *
+		 * @param mask The mask to scan, must not be zero.
+		 *
+		 * @return Index of the lowest set bit.
+		 */
+		FORGE_FORCE_INLINE U32 LowestSetBitIndex(U32 mask)
+		{
+			unsigned long index;
+
+			_BitScanForward(&index, mask);
+
+			return static_cast<U32>(index);
+		}
+
+		/**
+		 * @brief Returns the index of the lowest set bit in a mask.
+		 *
+		 * @param mask The mask to scan, must not be zero.
+		 *
+		 * @return Index of the lowest set bit.
+		 */
+		FORGE_FORCE_INLINE U32 LowestSetBitIndex(U64 mask)
+		{
+			unsigned long index;
+
+			_BitScanForward64(&index, mask);
+
+			return static_cast<U32>(index);
+		}
+
+		/**
+		 * @brief Returns the index of the highest set bit in a mask.
+		 *
+		 * @param mask The mask to scan, must not be zero.
+		 *
+		 * @return Index of the highest set bit.
+		 */
+		FORGE_FORCE_INLINE U32 HighestSetBitIndex(U32 mask)
+		{
+			unsigned long index;
+
+			_BitScanReverse(&index, mask);
+
+			return static_cast<U32>(index);
+		}
+
+		/**
+		 * @brief Returns the index of the highest set bit in a mask.
+		 *
+		 * @param mask The mask to scan, must not be zero.
+		 *
+		 * @return Index of the highest set bit.
+		 */
+		FORGE_FORCE_INLINE U32 HighestSetBitIndex(U64 mask)
+		{
+			unsigned long index;
+
+			_BitScanReverse64(&index, mask);
+
+			return static_cast<U32>(index);
+		}
+	}
+}
+
+#endif // BIT_UTILITIES_H
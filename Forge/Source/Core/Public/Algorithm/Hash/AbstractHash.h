@@ -1,16 +1,67 @@
 #ifndef ABSTRACT_HASH_H
 #define ABSTRACT_HASH_H
 
+#include "HashResult.h"
+
+#include "Core/Public/Common/Compiler.h"
 #include "Core/Public/Common/TypeDefinitions.h"
 
 namespace Forge {
-	namespace Algorithms
+	namespace Algorithm
 	{
-		class AbstractHash
+		/**
+		 * @brief Interface of hash functions computing the hash of data fed
+		 * incrementally.
+		 *
+		 * Feeding data in several updates produces the same hash as feeding it
+		 * at once, so large buffers like asset files can be hashed while they
+		 * are streamed without holding them in memory.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API AbstractHash
 		{
+		public:
+			/**
+			 * @brief Default destructor.
+			 */
+			virtual ~AbstractHash() = default;
+
+		public:
+			/**
+			 * @brief Discards the data fed so far and starts a new hash.
+			 *
+			 * @param[in] seed The seed of the new hash, hashes of the same data
+			 * with different seeds are unrelated.
+			 */
+			virtual Void Reset(U64 seed = 0) = 0;
+
+			/**
+			 * @brief Feeds the next part of the data to hash.
+			 *
+			 * @param[in] data The address of the data.
+			 * @param[in] size The size of the data in bytes.
+			 */
+			virtual Void Update(ConstVoidPtr data, Size size) = 0;
+
+		public:
+			/**
+			 * @brief Gets the 64-bit hash of the data fed so far, more data can
+			 * still be fed afterwards.
+			 *
+			 * @return U64 storing the hash.
+			 */
+			virtual U64 GetHash64(Void) const = 0;
 
+			/**
+			 * @brief Gets the 128-bit hash of the data fed so far, more data can
+			 * still be fed afterwards.
+			 *
+			 * @return HashResult128 storing the hash.
+			 */
+			virtual HashResult128 GetHash128(Void) const = 0;
 		};
 	}
 }
 
-#endif
+#endif // ABSTRACT_HASH_H
@@ -0,0 +1,86 @@
+#ifndef CONST_HASH_H
+#define CONST_HASH_H
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Algorithm
+	{
+		constexpr U64 FNV1A_OFFSET_BASIS = 0xCBF29CE484222325ull;
+		constexpr U64 FNV1A_PRIME        = 0x00000100000001B3ull;
+
+		/**
+		 * @brief Computes the 64-bit FNV-1a hash of a string at compile time.
+		 *
+		 * FNV-1a is much slower than HashBytes on long inputs, it is meant for
+		 * names written in code, like literals naming events or properties,
+		 * whose hash becomes a constant and can be used as a case label.
+		 *
+		 * @param[in] str The characters of the string.
+		 * @param[in] count The number of characters of the string.
+		 *
+		 * @return U64 storing the hash.
+		 */
+		constexpr U64 HashFnv1a64(ConstCharPtr str, Size count)
+		{
+			U64 hash = FNV1A_OFFSET_BASIS;
+
+			for (Size i = 0; i < count; i++)
+			{
+				hash ^= static_cast<U8>(str[i]);
+				hash *= FNV1A_PRIME;
+			}
+
+			return hash;
+		}
+
+		/**
+		 * @brief Computes the 64-bit FNV-1a hash of a null-terminated string
+		 * at compile time.
+		 *
+		 * @param[in] str The null-terminated string.
+		 *
+		 * @return U64 storing the hash.
+		 */
+		constexpr U64 HashFnv1a64(ConstCharPtr str)
+		{
+			U64 hash = FNV1A_OFFSET_BASIS;
+
+			for (; *str; str++)
+			{
+				hash ^= static_cast<U8>(*str);
+				hash *= FNV1A_PRIME;
+			}
+
+			return hash;
+		}
+
+		/**
+		 * @brief Forces the hash of a string to be computed at compile time,
+		 * even where the result is not used in a constant expression.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<U64 InHash>
+		struct TConstHash
+		{
+			enum : U64 { Value = InHash };
+		};
+
+		namespace Literals
+		{
+			/**
+			 * @brief Computes the hash of a string literal, "position"_hash.
+			 */
+			constexpr U64 operator ""_hash(ConstCharPtr str, Size count)
+			{
+				return HashFnv1a64(str, count);
+			}
+		}
+	}
+}
+
+#define FORGE_CONST_HASH(__STR__) (Forge::Algorithm::TConstHash<Forge::Algorithm::HashFnv1a64(__STR__)>::Value)
+
+#endif // CONST_HASH_H
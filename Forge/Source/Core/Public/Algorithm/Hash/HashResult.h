@@ -1,11 +1,36 @@
 #ifndef HASH_RESULT_H
 #define HASH_RESULT_H
 
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
 namespace Forge {
-	namespace Algorithms
+	namespace Algorithm
 	{
+		/**
+		 * @brief Stores a 128-bit hash, used where 64 bits leave a collision
+		 * probability too high to skip comparing contents, like content
+		 * addressing of assets.
+		 *
+		 * @author Karim Hisham
+		 */
+		struct HashResult128
+		{
+		public:
+			U64 m_low;
+			U64 m_high;
 
+		public:
+			Bool operator ==(const HashResult128& other) const
+			{
+				return m_low == other.m_low && m_high == other.m_high;
+			}
+			Bool operator !=(const HashResult128& other) const
+			{
+				return m_low != other.m_low || m_high != other.m_high;
+			}
+		};
 	}
 }
 
-#endif
+#endif // HASH_RESULT_H
@@ -0,0 +1,120 @@
+#ifndef T_HASH_H
+#define T_HASH_H
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Algorithm
+	{
+		/**
+		 * @brief Scrambles the bits of a 64-bit value so that every input bit
+		 * affects every output bit.
+		 *
+		 * Hash containers split the hash into a probe position and a tag, so
+		 * both its low and high bits must be well distributed even for keys
+		 * like sequential integers or aligned pointers.
+		 *
+		 * @param[in] value The value to scramble.
+		 *
+		 * @return U64 storing the scrambled value.
+		 */
+		FORGE_FORCE_INLINE U64 HashMix64(U64 value)
+		{
+			value ^= value >> 30;
+			value *= 0xBF58476D1CE4E5B9ull;
+			value ^= value >> 27;
+			value *= 0x94D049BB133111EBull;
+			value ^= value >> 31;
+
+			return value;
+		}
+
+		/**
+		 * @brief Combines the hash of a member into the hash of an aggregate,
+		 * the result depends on the order the members are combined in.
+		 *
+		 * @param[in] seed The hash of the members combined so far.
+		 * @param[in] hash The hash of the next member.
+		 *
+		 * @return U64 storing the combined hash.
+		 */
+		FORGE_FORCE_INLINE U64 HashCombine(U64 seed, U64 hash)
+		{
+			return HashMix64(seed ^ (hash + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2)));
+		}
+
+		/**
+		 * @brief Function object computing the hash of a key for hash
+		 * containers.
+		 *
+		 * Types are hashable once they specialize this template next to their
+		 * declaration. The call operator may be overloaded for other types that
+		 * compare equal to the key, which enables heterogeneous lookups.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InType>
+		struct THash;
+
+		template<typename InType>
+		struct THash<InType*>
+		{
+			U64 operator ()(const InType* value) const { return HashMix64(reinterpret_cast<U64>(value)); }
+		};
+
+#define FORGE_HASH_INTEGRAL_DECL(__TYPE__)                                                          \
+		template<>                                                                                  \
+		struct THash<__TYPE__>                                                                      \
+		{                                                                                           \
+			U64 operator ()(__TYPE__ value) const { return HashMix64(static_cast<U64>(value)); }    \
+		};
+
+		FORGE_HASH_INTEGRAL_DECL(Bool)
+		FORGE_HASH_INTEGRAL_DECL(Char)
+		FORGE_HASH_INTEGRAL_DECL(I8)
+		FORGE_HASH_INTEGRAL_DECL(I16)
+		FORGE_HASH_INTEGRAL_DECL(I32)
+		FORGE_HASH_INTEGRAL_DECL(I64)
+		FORGE_HASH_INTEGRAL_DECL(U8)
+		FORGE_HASH_INTEGRAL_DECL(U16)
+		FORGE_HASH_INTEGRAL_DECL(U32)
+		FORGE_HASH_INTEGRAL_DECL(U64)
+
+#undef FORGE_HASH_INTEGRAL_DECL
+
+		/**
+		 * @brief Floating point keys hash their bit pattern, with both zeros
+		 * hashing alike since they compare equal.
+		 */
+		template<>
+		struct THash<F32>
+		{
+			U64 operator ()(F32 value) const
+			{
+				U32 bits = 0;
+
+				if (value != 0.0f)
+					bits = *reinterpret_cast<U32*>(&value);
+
+				return HashMix64(bits);
+			}
+		};
+
+		template<>
+		struct THash<F64>
+		{
+			U64 operator ()(F64 value) const
+			{
+				U64 bits = 0;
+
+				if (value != 0.0)
+					bits = *reinterpret_cast<U64*>(&value);
+
+				return HashMix64(bits);
+			}
+		};
+	}
+}
+
+#endif // T_HASH_H
@@ -0,0 +1,120 @@
+#ifndef XX_HASH_3_H
+#define XX_HASH_3_H
+
+#include "HashResult.h"
+#include "AbstractHash.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Algorithm
+	{
+		/**
+		 * @brief Non-cryptographic 64 and 128-bit hash function producing the
+		 * same hashes as the XXH3 algorithm of xxHash 0.8.
+		 *
+		 * Inputs up to 240 bytes are hashed by a few multiply and fold steps
+		 * over overlapping loads, so short keys cost a handful of cycles.
+		 * Longer inputs are consumed in 64-byte stripes by eight independent
+		 * accumulators, which are updated with SSE2 or AVX2 when the processor
+		 * supports them.
+		 *
+		 * Hashes are not suitable for security purposes, but are stable across
+		 * platforms and runs, so they can be stored for content addressing.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API XXHash3 final : public AbstractHash
+		{
+		public:
+			enum
+			{
+				SECRET_SIZE = 192,
+				STRIPE_SIZE = 64,
+				BUFFER_SIZE = 256,
+
+				NUM_OF_ACCUMULATORS = 8
+			};
+
+		private:
+			FORGE_ALIGN(64) U64  m_accumulators[NUM_OF_ACCUMULATORS];
+			FORGE_ALIGN(64) Byte m_secret[SECRET_SIZE];
+			FORGE_ALIGN(64) Byte m_buffer[BUFFER_SIZE];
+
+		private:
+			Size m_buffer_size;
+			Size m_num_of_stripes;
+
+		private:
+			U64 m_total_size;
+			U64 m_seed;
+
+		public:
+			/**
+			 * @brief Constructs a streaming hash object.
+			 *
+			 * @param[in] seed The seed of the hash.
+			 */
+			XXHash3(U64 seed = 0);
+
+		public:
+			/**
+			 * @brief Default destructor.
+			 */
+		   ~XXHash3() = default;
+
+		public:
+			/**
+			 * @brief Computes the 64-bit hash of a buffer at once.
+			 *
+			 * @param[in] data The address of the buffer.
+			 * @param[in] size The size of the buffer in bytes.
+			 * @param[in] seed The seed of the hash.
+			 *
+			 * @return U64 storing the hash.
+			 */
+			static U64 Hash64(ConstVoidPtr data, Size size, U64 seed = 0);
+
+			/**
+			 * @brief Computes the 128-bit hash of a buffer at once.
+			 *
+			 * @param[in] data The address of the buffer.
+			 * @param[in] size The size of the buffer in bytes.
+			 * @param[in] seed The seed of the hash.
+			 *
+			 * @return HashResult128 storing the hash.
+			 */
+			static HashResult128 Hash128(ConstVoidPtr data, Size size, U64 seed = 0);
+
+		private:
+			Void ConsumeStripes(ConstBytePtr data, Size num_of_stripes);
+			Void DigestLong(U64* accumulators) const;
+
+		public:
+			Void Reset(U64 seed = 0) override;
+			Void Update(ConstVoidPtr data, Size size) override;
+
+		public:
+			U64           GetHash64(Void) const override;
+			HashResult128 GetHash128(Void) const override;
+		};
+
+		/**
+		 * @brief Computes the 64-bit hash of a buffer, the hash of contents
+		 * that hash containers and caches are keyed by.
+		 *
+		 * @param[in] data The address of the buffer.
+		 * @param[in] size The size of the buffer in bytes.
+		 * @param[in] seed The seed of the hash.
+		 *
+		 * @return U64 storing the hash.
+		 */
+		FORGE_FORCE_INLINE U64 HashBytes(ConstVoidPtr data, Size size, U64 seed = 0)
+		{
+			return XXHash3::Hash64(data, size, seed);
+		}
+	}
+}
+
+#endif // XX_HASH_3_H
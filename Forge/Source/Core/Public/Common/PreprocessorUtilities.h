@@ -28,6 +28,12 @@
 #define FORGE_CONCATENATE_COMMA_VARIADIC(s, ...) IMPL_FORGE_CONCATENATE_COMMA_VARIADIC(s, ...)
 
 #define FORGE_FUNC_LITERAL __FUNCTION__
+
+#if defined(FORGE_COMPILER_MSVC)
+	#define FORGE_FUNC_SIGNATURE_LITERAL __FUNCSIG__
+#else
+	#define FORGE_FUNC_SIGNATURE_LITERAL __PRETTY_FUNCTION__
+#endif
 #define FORGE_LINE_LITERAL FORGE_STRINGIZE(__LINE__)
 #define FORGE_FILE_LITERAL FORGE_STRINGIZE(__FILE__)
 
@@ -85,7 +91,7 @@
 			= 1 / (int) (!!(__EXPR__))           \
 	};
 #else
-	#define FORGE_ASSERT(__EXPR__)
+	#define FORGE_ASSERT(__EXPR__, __MSG__)
 	#define FORGE_STATIC_ASSERT(__EXPR__)
 #endif
 
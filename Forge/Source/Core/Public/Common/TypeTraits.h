@@ -55,6 +55,21 @@ namespace Forge {
 		template<typename InType>
 		struct TIsTriviallyCopyAssignable { enum { Value = __has_trivial_assign(InType) }; };
 
+		/**
+		 * @brief Tests if a type can be relocated by copying its bytes to a new
+		 * address and forgetting the old object without destructing it.
+		 *
+		 * Trivially copyable types are relocatable. Types that own resources
+		 * but hold no pointers into themselves, such as smart pointers and
+		 * dynamic containers, opt in by specializing this trait next to their
+		 * declaration.
+		 */
+		template<typename InType>
+		struct TIsTriviallyRelocatable { enum { Value = std::is_trivially_copyable<InType>::value }; };
+
+		template<typename InType>
+		struct TIsTriviallyRelocatable<const InType> { enum { Value = TIsTriviallyRelocatable<InType>::Value }; };
+
 		/**
 		 * @brief Tests whether two typenames are the same.
 		 */
@@ -97,6 +112,15 @@ namespace Forge {
 		template<typename InType>
 		struct TIsPointer<InType*> { enum { Value = true }; };
 
+		/**
+		 * @brief Tests whether a type is an array of known size.
+		 */
+		template<typename InType>
+		struct TIsArray { enum { Value = false }; };
+
+		template<typename InType, Size InSize>
+		struct TIsArray<InType[InSize]> { enum { Value = true }; };
+
 		/**
 		 * @brief Tests whether a type is l-value reference.
 		 */
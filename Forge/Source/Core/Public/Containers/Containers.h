@@ -9,4 +9,14 @@
 #include <Core/Public/Containers/TDynamicStack.h>
 #include <Core/Public/Containers/TDynamicQueue.h>
 
+#include <Core/Public/Containers/TInlineArray.h>
+#include <Core/Public/Containers/TSoAArray.h>
+#include <Core/Public/Containers/TChunkedArray.h>
+
+#include <Core/Public/Containers/TDeque.h>
+#include <Core/Public/Containers/TIntrusiveList.h>
+
+#include <Core/Public/Containers/TFlatHashMap.h>
+#include <Core/Public/Containers/TFlatHashSet.h>
+
 #endif // CONTAINERS_H
@@ -0,0 +1,571 @@
+#ifndef T_CHUNKED_ARRAY_H
+#define T_CHUNKED_ARRAY_H
+
+#include <new>
+#include <utility>
+
+#include <Core/Public/Common/Common.h>
+
+#include "Core/Public/Algorithm/BitUtilities.h"
+
+#include "Core/Public/Debug/Debug.h"
+#include "Core/Public/Memory/AllocatorPolicy.h"
+#include "Core/Public/Memory/MemoryUtilities.h"
+
+#include "Core/Public/Types/TMemoryRegion.h"
+
+#include "Core/Public/Containers/TDynamicArray.h"
+
+namespace Forge {
+	namespace Containers
+	{
+		namespace Internal
+		{
+			constexpr Size ChunkedArrayLog2(Size value)
+			{
+				return value > 1 ? 1 + ChunkedArrayLog2(value >> 1) : 0;
+			}
+		}
+
+		/**
+		 * @brief Array storing its elements in fixed size chunks, whose
+		 * elements never move.
+		 *
+		 * Growing the array allocates another chunk and leaves the existing
+		 * ones in place, so pointers and references to elements stay valid
+		 * until the element is removed, unlike TDynamicArray which moves every
+		 * element when it grows. An index is split by a shift and a mask into
+		 * the chunk and the position in the chunk, so indexing is O(1), and
+		 * the elements of a chunk are contiguous.
+		 *
+		 * Removing an element leaves a hole at its index, which keeps the
+		 * indices of the other elements valid, and the next element added
+		 * fills the most recently freed hole. Iterators skip the holes, and
+		 * stay valid when the element they point to is removed, but adding or
+		 * removing other elements while iterating invalidates them.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InElementType, Size InChunkSize = 64, typename InAllocatorPolicy = Memory::DefaultAllocatorPolicy>
+		class TChunkedArray final : private InAllocatorPolicy
+		{
+		FORGE_CLASS_NONCOPYABLE(TChunkedArray)
+
+			static_assert(InChunkSize && !(InChunkSize & (InChunkSize - 1)), "Chunk size must be a power of two");
+
+		public:
+			using AllocatorType = InAllocatorPolicy;
+
+		public:
+			using ElementType         = InElementType;
+			using ElementTypePtr      = InElementType*;
+			using ElementTypeRef      = InElementType&;
+			using ElementTypeMoveRef  = InElementType&&;
+			using ConstElementType    = const InElementType;
+			using ConstElementTypePtr = const InElementType*;
+			using ConstElementTypeRef = const InElementType&;
+
+		private:
+			using SelfType = TChunkedArray<ElementType, InChunkSize, AllocatorType>;
+
+		public:
+			static constexpr Size CHUNK_SIZE  = InChunkSize;
+			static constexpr Size CHUNK_SHIFT = Internal::ChunkedArrayLog2(InChunkSize);
+			static constexpr Size CHUNK_MASK  = InChunkSize - 1;
+
+		public:
+			struct Iterator
+			{
+			private:
+				SelfType* m_array;
+				Size      m_index;
+
+				/// Elements after m_index in its word of the allocated bits, so
+				/// advancing within a word does not read the bits again.
+				U64 m_next_bits;
+
+			public:
+				Iterator(Void)
+					: m_array(nullptr), m_index(0), m_next_bits(0) {}
+
+				Iterator(SelfType* array, Size index)
+					: m_array(array), m_index(index), m_next_bits(array->GetNextBits(index)) {}
+
+			public:
+				Iterator operator ++(I32)
+				{
+					Iterator temp(*this);
+
+					this->m_array->Advance(this->m_index, this->m_next_bits);
+
+					return temp;
+				}
+				Iterator operator ++(Void)
+				{
+					this->m_array->Advance(this->m_index, this->m_next_bits);
+
+					return *this;
+				}
+
+			public:
+				Bool operator ==(const Iterator& other)
+				{
+					return this->m_index == other.m_index;
+				}
+				Bool operator !=(const Iterator& other)
+				{
+					return this->m_index != other.m_index;
+				}
+
+			public:
+				ElementTypeRef operator *()
+				{
+					return *this->m_array->GetSlot(this->m_index);
+				}
+				ElementTypePtr operator ->()
+				{
+					return this->m_array->GetSlot(this->m_index);
+				}
+
+			public:
+				Size GetIndex(Void) const
+				{
+					return this->m_index;
+				}
+			};
+			struct ConstIterator
+			{
+			private:
+				const SelfType* m_array;
+				Size            m_index;
+
+				/// Elements after m_index in its word of the allocated bits.
+				U64 m_next_bits;
+
+			public:
+				ConstIterator(Void)
+					: m_array(nullptr), m_index(0), m_next_bits(0) {}
+
+				ConstIterator(const SelfType* array, Size index)
+					: m_array(array), m_index(index), m_next_bits(array->GetNextBits(index)) {}
+
+			public:
+				ConstIterator operator ++(I32)
+				{
+					ConstIterator temp(*this);
+
+					this->m_array->Advance(this->m_index, this->m_next_bits);
+
+					return temp;
+				}
+				ConstIterator operator ++(Void)
+				{
+					this->m_array->Advance(this->m_index, this->m_next_bits);
+
+					return *this;
+				}
+
+			public:
+				Bool operator ==(const ConstIterator& other)
+				{
+					return this->m_index == other.m_index;
+				}
+				Bool operator !=(const ConstIterator& other)
+				{
+					return this->m_index != other.m_index;
+				}
+
+			public:
+				ConstElementTypeRef operator *()
+				{
+					return *this->m_array->GetSlot(this->m_index);
+				}
+				ConstElementTypePtr operator ->()
+				{
+					return this->m_array->GetSlot(this->m_index);
+				}
+
+			public:
+				Size GetIndex(Void) const
+				{
+					return this->m_index;
+				}
+			};
+
+		private:
+			TDynamicArray<ElementTypePtr, AllocatorType> m_chunks;
+
+			/// One bit per slot, set while the slot holds an element.
+			TDynamicArray<U64, AllocatorType> m_allocated_bits;
+
+			/// Holes left by removed elements, the last one is filled first.
+			TDynamicArray<Size, AllocatorType> m_free_slots;
+
+		private:
+			Size m_count;
+
+			/// Number of slots ever used, elements and holes.
+			Size m_slot_count;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Constructs an empty chunked array allocating through an allocator.
+			 */
+			explicit TChunkedArray(const AllocatorType& allocator = AllocatorType())
+				: m_chunks(allocator), m_allocated_bits(allocator), m_free_slots(allocator), m_count(0), m_slot_count(0), AllocatorType(allocator) {}
+
+		public:
+			/**
+			 * @brief Destructor.
+			 *
+			 * Destroys every element and frees every chunk.
+			 */
+			~TChunkedArray()
+			{
+				this->Clear();
+
+				for (Size i = 0; i < this->m_chunks.GetCount(); i++)
+					this->GetAllocator().Deallocate(this->m_chunks[i]);
+			}
+
+		private:
+			Void AllocateChunk(Void)
+			{
+				this->m_chunks.PushBack(reinterpret_cast<ElementTypePtr>(this->GetAllocator().Allocate(CHUNK_SIZE * sizeof(ElementType), alignof(ElementType))));
+
+				while (this->m_allocated_bits.GetCount() * 64 < this->GetCapacity())
+					this->m_allocated_bits.PushBack(0);
+			}
+
+			ElementTypePtr GetSlot(Size index) const
+			{
+				return this->m_chunks[index >> CHUNK_SHIFT] + (index & CHUNK_MASK);
+			}
+
+			/// Returns the first slot holding an element at or after index, or
+			/// the slot count if there is none.
+			Size FindAllocated(Size index) const
+			{
+				if (index >= this->m_slot_count)
+					return this->m_slot_count;
+
+				Size word_index = index >> 6;
+
+				U64 word = this->m_allocated_bits[word_index] & (~static_cast<U64>(0) << (index & 63));
+
+				while (!word)
+				{
+					if (++word_index << 6 >= this->m_slot_count)
+						return this->m_slot_count;
+
+					word = this->m_allocated_bits[word_index];
+				}
+
+				return (word_index << 6) + Algorithm::LowestSetBitIndex(word);
+			}
+
+			/// Returns the allocated bits of the slots after index in its word.
+			U64 GetNextBits(Size index) const
+			{
+				if (index >= this->m_slot_count)
+					return 0;
+
+				return this->m_allocated_bits[index >> 6] & ~((static_cast<U64>(2) << (index & 63)) - 1);
+			}
+
+			/// Moves an iterator position to the next element, from the cached
+			/// bits while the next element is in the same word.
+			Void Advance(Size& index, U64& next_bits) const
+			{
+				if (next_bits)
+				{
+					index = (index & ~static_cast<Size>(63)) + Algorithm::LowestSetBitIndex(next_bits);
+					next_bits &= next_bits - 1;
+				}
+				else
+				{
+					index = this->FindAllocated(((index >> 6) + 1) << 6);
+					next_bits = this->GetNextBits(index);
+				}
+			}
+
+		public:
+			/**
+			 * @brief Gets the allocator policy the chunks are allocated through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			AllocatorType& GetAllocator(Void)
+			{
+				return static_cast<AllocatorType&>(*this);
+			}
+
+			/**
+			 * @brief Gets the allocator policy the chunks are allocated through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			const AllocatorType& GetAllocator(Void) const
+			{
+				return static_cast<const AllocatorType&>(*this);
+			}
+
+		public:
+			/**
+			 * @brief Gets the number of elements in this array.
+			 *
+			 * @return Size storing the number of elements.
+			 */
+			Size GetCount(Void) const
+			{
+				return this->m_count;
+			}
+
+			/**
+			 * @brief Gets the number of slots used so far, elements and holes,
+			 * every index of an element is below it.
+			 *
+			 * @return Size storing the number of slots.
+			 */
+			Size GetSlotCount(Void) const
+			{
+				return this->m_slot_count;
+			}
+
+			/**
+			 * @brief Gets the number of slots of the allocated chunks.
+			 *
+			 * @return Size storing the capacity of this array.
+			 */
+			Size GetCapacity(Void) const
+			{
+				return this->m_chunks.GetCount() * CHUNK_SIZE;
+			}
+
+			/**
+			 * @brief Gets the number of allocated chunks.
+			 *
+			 * @return Size storing the number of chunks.
+			 */
+			Size GetChunkCount(Void) const
+			{
+				return this->m_chunks.GetCount();
+			}
+
+			/**
+			 * @brief Checks whether this array is empty.
+			 *
+			 * @return Bool true if this array is empty.
+			 */
+			Bool IsEmpty(Void) const
+			{
+				return this->m_count == 0;
+			}
+
+			/**
+			 * @brief Checks whether an index refers to an element, rather than
+			 * a hole or a slot past the end.
+			 *
+			 * @param[in] index The index to check.
+			 *
+			 * @return Bool true if the slot at index holds an element.
+			 */
+			Bool IsAllocated(Size index) const
+			{
+				return index < this->m_slot_count && (this->m_allocated_bits[index >> 6] >> (index & 63)) & 1;
+			}
+
+		public:
+			/**
+			 * @brief Element Accessor.
+			 *
+			 * @return ElementTypeRef storing the element at index.
+			 */
+			ElementTypeRef operator [](Size index)
+			{
+				FORGE_ASSERT(this->IsAllocated(index), "Index does not refer to an element.")
+
+				return *this->GetSlot(index);
+			}
+
+			/**
+			 * @brief Element Accessor.
+			 *
+			 * @return ConstElementTypeRef storing the element at index.
+			 */
+			ConstElementTypeRef operator [](Size index) const
+			{
+				FORGE_ASSERT(this->IsAllocated(index), "Index does not refer to an element.")
+
+				return *this->GetSlot(index);
+			}
+
+			/**
+			 * @brief Gets the used slots of a chunk, contiguous in memory.
+			 *
+			 * Every slot holds an element as long as no element is removed, or
+			 * GetCount() equals GetSlotCount(), otherwise the holes must be
+			 * skipped using IsAllocated.
+			 *
+			 * @param[in] chunk_index The index of the chunk.
+			 *
+			 * @return TMemoryRegion spanning the used slots of the chunk.
+			 */
+			Common::TMemoryRegion<ElementType> GetChunk(Size chunk_index)
+			{
+				FORGE_ASSERT(chunk_index < this->m_chunks.GetCount(), "Chunk index is out of range.")
+
+				Size first = chunk_index << CHUNK_SHIFT;
+				Size count = this->m_slot_count > first ? this->m_slot_count - first : 0;
+
+				return Common::TMemoryRegion<ElementType>(this->m_chunks[chunk_index], count < CHUNK_SIZE ? count : CHUNK_SIZE);
+			}
+
+			/**
+			 * @brief Gets the used slots of a chunk, contiguous in memory.
+			 *
+			 * @param[in] chunk_index The index of the chunk.
+			 *
+			 * @return TMemoryRegion spanning the used slots of the chunk.
+			 */
+			Common::TMemoryRegion<ConstElementType> GetChunk(Size chunk_index) const
+			{
+				FORGE_ASSERT(chunk_index < this->m_chunks.GetCount(), "Chunk index is out of range.")
+
+				Size first = chunk_index << CHUNK_SHIFT;
+				Size count = this->m_slot_count > first ? this->m_slot_count - first : 0;
+
+				return Common::TMemoryRegion<ConstElementType>(this->m_chunks[chunk_index], count < CHUNK_SIZE ? count : CHUNK_SIZE);
+			}
+
+		public:
+			/**
+			 * @brief Returns an iterator pointing to the first element.
+			 *
+			 * @return Iterator pointing to the first element.
+			 */
+			Iterator GetStartItr(Void)
+			{
+				return Iterator(this, this->FindAllocated(0));
+			}
+
+			/**
+			 * @brief Returns an iterator pointing past the last element.
+			 *
+			 * @return Iterator pointing past the last element.
+			 */
+			Iterator GetEndItr(Void)
+			{
+				return Iterator(this, this->m_slot_count);
+			}
+
+			/**
+			 * @brief Returns a const iterator pointing to the first element.
+			 *
+			 * @return ConstIterator pointing to the first element.
+			 */
+			ConstIterator GetStartConstItr(Void) const
+			{
+				return ConstIterator(this, this->FindAllocated(0));
+			}
+
+			/**
+			 * @brief Returns a const iterator pointing past the last element.
+			 *
+			 * @return ConstIterator pointing past the last element.
+			 */
+			ConstIterator GetEndConstItr(Void) const
+			{
+				return ConstIterator(this, this->m_slot_count);
+			}
+
+		public:
+			/**
+			 * @brief Allocates chunks until this array can hold the specified
+			 * number of slots.
+			 *
+			 * @param[in] capacity The minimum capacity of the array.
+			 */
+			Void ReserveCapacity(Size capacity)
+			{
+				while (this->GetCapacity() < capacity)
+					this->AllocateChunk();
+			}
+
+		public:
+			/**
+			 * @brief Constructs an element in the most recently freed hole, or
+			 * past the last slot if there is none.
+			 *
+			 * @param[in] args The arguments to construct the element with.
+			 *
+			 * @return Size storing the index of the element.
+			 */
+			template<typename... InArgs>
+			Size Add(InArgs&&... args)
+			{
+				Bool is_hole = this->m_free_slots.GetCount() > 0;
+
+				if (!is_hole && this->m_slot_count == this->GetCapacity())
+					this->AllocateChunk();
+
+				Size index = is_hole ? this->m_free_slots[this->m_free_slots.GetCount() - 1] : this->m_slot_count;
+
+				/// The slot is only taken once the element is constructed, so a
+				/// throwing constructor leaves the hole or the end slot free.
+				new (this->GetSlot(index)) ElementType(std::forward<InArgs>(args)...);
+
+				if (is_hole)
+					this->m_free_slots.PopBack();
+				else
+					this->m_slot_count++;
+
+				this->m_allocated_bits[index >> 6] |= static_cast<U64>(1) << (index & 63);
+				this->m_count++;
+
+				return index;
+			}
+
+			/**
+			 * @brief Destroys an element, leaving a hole at its index to be
+			 * filled by a later Add.
+			 *
+			 * @param[in] index The index of the element.
+			 *
+			 * @throw IndexOutOfRangeException if index does not refer to an
+			 * element.
+			 */
+			Void RemoveAt(Size index)
+			{
+				if (!this->IsAllocated(index))
+					FORGE_EXCEPT(Debug::ExceptionType::FORGE_INDEX_OUT_RANGE)
+
+				Memory::Destruct(this->GetSlot(index), 1);
+
+				this->m_allocated_bits[index >> 6] &= ~(static_cast<U64>(1) << (index & 63));
+				this->m_free_slots.PushBack(index);
+				this->m_count--;
+			}
+
+			/**
+			 * @brief Destroys every element, the chunks are kept.
+			 */
+			Void Clear(Void)
+			{
+				for (Size i = this->FindAllocated(0); i < this->m_slot_count; i = this->FindAllocated(i + 1))
+					Memory::Destruct(this->GetSlot(i), 1);
+
+				for (Size i = 0; i < this->m_allocated_bits.GetCount(); i++)
+					this->m_allocated_bits[i] = 0;
+
+				this->m_free_slots.Clear();
+
+				this->m_count = this->m_slot_count = 0;
+			}
+		};
+	}
+}
+
+#endif // T_CHUNKED_ARRAY_H
@@ -0,0 +1,304 @@
+#ifndef T_CONCURRENT_QUEUE_H
+#define T_CONCURRENT_QUEUE_H
+
+#include <new>
+#include <atomic>
+#include <type_traits>
+
+#include <Core/Public/Common/Common.h>
+
+#include "Core/Public/Debug/Debug.h"
+#include "Core/Public/Memory/AllocatorPolicy.h"
+
+#include "Core/Public/Algorithm/GeneralUtilities.h"
+
+namespace Forge {
+	namespace Containers
+	{
+		/**
+		 * @brief Bounded first-in first-out queue that any number of threads
+		 * can enqueue into and dequeue from concurrently without locks.
+		 *
+		 * Elements are stored in a ring of cells allocated once at
+		 * construction. Every cell carries a sequence number telling whether
+		 * it is ready to be written or read in the current lap of the ring,
+		 * so a producer or consumer claims a cell with a single
+		 * compare-and-swap on the enqueue or dequeue position and never waits
+		 * on another thread, except for the one that claimed the same cell a
+		 * lap earlier.
+		 *
+		 * The queue never grows, enqueuing into a full queue fails instead.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InElementType, typename InAllocatorPolicy = Memory::DefaultAllocatorPolicy>
+		class TConcurrentQueue : private InAllocatorPolicy
+		{
+		FORGE_CLASS_NONCOPYABLE(TConcurrentQueue)
+
+		public:
+			using AllocatorType = InAllocatorPolicy;
+
+		public:
+			using ElementType         = InElementType;
+			using ElementTypePtr      = InElementType*;
+			using ElementTypeRef      = InElementType&;
+			using ElementTypeMoveRef  = InElementType&&;
+			using ConstElementType    = const InElementType;
+			using ConstElementTypePtr = const InElementType*;
+			using ConstElementTypeRef = const InElementType&;
+
+		private:
+			struct Cell
+			{
+				std::atomic<Size> m_sequence;
+
+				alignas(InElementType) Byte m_data[sizeof(InElementType)];
+			};
+
+		private:
+			Cell* m_cells;
+			Size  m_mask;
+
+		private:
+			/// Producers and consumers contend on different cache lines.
+			alignas(64) std::atomic<Size> m_enqueue_pos;
+			alignas(64) std::atomic<Size> m_dequeue_pos;
+
+		public:
+			/**
+			 * @brief Capacity constructor.
+			 *
+			 * Constructs an empty queue able to store the specified number of
+			 * elements, rounded up to a power of two.
+			 *
+			 * @throws InvalidOperationException if the capacity is zero.
+			 */
+			explicit TConcurrentQueue(Size capacity, const AllocatorType& allocator = AllocatorType())
+				: AllocatorType(allocator), m_enqueue_pos(0), m_dequeue_pos(0)
+			{
+				if (!capacity)
+					FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Queue capacity must not be zero")
+
+				Size rounded_capacity = 1;
+
+				while (rounded_capacity < capacity)
+					rounded_capacity <<= 1;
+
+				this->m_cells = static_cast<Cell*>(this->GetAllocator().Allocate(rounded_capacity * sizeof(Cell), alignof(Cell)));
+				this->m_mask = rounded_capacity - 1;
+
+				for (Size i = 0; i < rounded_capacity; i++)
+					new (&this->m_cells[i].m_sequence) std::atomic<Size>(i);
+			}
+
+		public:
+			/**
+			 * @brief Default destructor.
+			 *
+			 * Destroys the elements left in the queue, no other thread may use
+			 * the queue anymore.
+			 */
+			~TConcurrentQueue(Void)
+			{
+				Size dequeue_pos = this->m_dequeue_pos.load(std::memory_order_relaxed);
+				Size enqueue_pos = this->m_enqueue_pos.load(std::memory_order_relaxed);
+
+				for (Size pos = dequeue_pos; pos != enqueue_pos; pos++)
+					reinterpret_cast<ElementTypePtr>(this->m_cells[pos & this->m_mask].m_data)->~ElementType();
+
+				this->GetAllocator().Deallocate(this->m_cells);
+			}
+
+		private:
+			/// Claims the cell at the enqueue position and constructs the
+			/// element in it, the constructor must not throw as the cell cannot
+			/// be given back.
+			template<typename... InArgs>
+			Bool ClaimAndConstruct(InArgs&&... args)
+			{
+				Cell* cell;
+				Size pos = this->m_enqueue_pos.load(std::memory_order_relaxed);
+
+				while (true)
+				{
+					cell = &this->m_cells[pos & this->m_mask];
+
+					Size sequence = cell->m_sequence.load(std::memory_order_acquire);
+					I64 difference = static_cast<I64>(sequence) - static_cast<I64>(pos);
+
+					if (!difference)
+					{
+						if (this->m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+							break;
+					}
+					else if (difference < 0)
+						return false;
+					else
+						pos = this->m_enqueue_pos.load(std::memory_order_relaxed);
+				}
+
+				new (cell->m_data) ElementType(std::forward<InArgs>(args)...);
+
+				cell->m_sequence.store(pos + 1, std::memory_order_release);
+
+				return true;
+			}
+
+		public:
+			/**
+			 * @brief Gets the allocator policy this queue allocates through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			AllocatorType& GetAllocator(Void)
+			{
+				return static_cast<AllocatorType&>(*this);
+			}
+
+			/**
+			 * @brief Gets the allocator policy this queue allocates through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			const AllocatorType& GetAllocator(Void) const
+			{
+				return static_cast<const AllocatorType&>(*this);
+			}
+
+			/**
+			 * @brief Gets the number of elements the queue can store.
+			 *
+			 * @return Size storing the capacity.
+			 */
+			Size GetCapacity(Void) const
+			{
+				return this->m_mask + 1;
+			}
+
+			/**
+			 * @brief Gets the number of elements in the queue. Other threads may
+			 * change it before the function returns, so the count is only exact
+			 * while no other thread uses the queue.
+			 *
+			 * @return Size storing the approximate number of elements.
+			 */
+			Size GetCount(Void) const
+			{
+				Size dequeue_pos = this->m_dequeue_pos.load(std::memory_order_acquire);
+				Size enqueue_pos = this->m_enqueue_pos.load(std::memory_order_acquire);
+
+				return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+			}
+
+			/**
+			 * @brief Checks whether the queue is empty, subject to the same race
+			 * as GetCount.
+			 *
+			 * @return True if the queue is empty.
+			 */
+			Bool IsEmpty(Void) const
+			{
+				return !this->GetCount();
+			}
+
+		public:
+			/**
+			 * @brief Constructs an element at the back of the queue. Safe to call
+			 * from any thread.
+			 *
+			 * A cell cannot be given back once claimed, so an element whose
+			 * constructor may throw is constructed before claiming the cell and
+			 * moved into it, the move constructor of the element must not throw.
+			 *
+			 * @param[in] args The arguments to construct the element with.
+			 *
+			 * @return True if the element was enqueued, false if the queue is full.
+			 */
+			template<typename... InArgs>
+			Bool TryEmplace(InArgs&&... args)
+			{
+				if constexpr (!std::is_nothrow_constructible<ElementType, InArgs&&...>::value)
+				{
+					ElementType element(std::forward<InArgs>(args)...);
+
+					return this->ClaimAndConstruct(Algorithm::Move(element));
+				}
+				else
+					return this->ClaimAndConstruct(std::forward<InArgs>(args)...);
+			}
+
+			/**
+			 * @brief Copies an element to the back of the queue. Safe to call
+			 * from any thread.
+			 *
+			 * @param[in] element The element to enqueue.
+			 *
+			 * @return True if the element was enqueued, false if the queue is full.
+			 */
+			Bool TryEnqueue(ConstElementTypeRef element)
+			{
+				return this->TryEmplace(element);
+			}
+
+			/**
+			 * @brief Moves an element to the back of the queue. Safe to call
+			 * from any thread.
+			 *
+			 * @param[in] element The element to enqueue.
+			 *
+			 * @return True if the element was enqueued, false if the queue is full.
+			 */
+			Bool TryEnqueue(ElementTypeMoveRef element)
+			{
+				return this->TryEmplace(Algorithm::Move(element));
+			}
+
+			/**
+			 * @brief Moves the element at the front of the queue out of it. Safe
+			 * to call from any thread.
+			 *
+			 * @param[out] element The element dequeued.
+			 *
+			 * @return True if an element was dequeued, false if the queue is empty.
+			 */
+			Bool TryDequeue(ElementTypeRef element)
+			{
+				Cell* cell;
+				Size pos = this->m_dequeue_pos.load(std::memory_order_relaxed);
+
+				while (true)
+				{
+					cell = &this->m_cells[pos & this->m_mask];
+
+					Size sequence = cell->m_sequence.load(std::memory_order_acquire);
+					I64 difference = static_cast<I64>(sequence) - static_cast<I64>(pos + 1);
+
+					if (!difference)
+					{
+						if (this->m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+							break;
+					}
+					else if (difference < 0)
+						return false;
+					else
+						pos = this->m_dequeue_pos.load(std::memory_order_relaxed);
+				}
+
+				ElementTypePtr data = reinterpret_cast<ElementTypePtr>(cell->m_data);
+
+				element = Algorithm::Move(*data);
+				data->~ElementType();
+
+				/// The cell is written again one lap of the ring later.
+				cell->m_sequence.store(pos + this->m_mask + 1, std::memory_order_release);
+
+				return true;
+			}
+		};
+
+		FORGE_TYPEDEF_TEMPLATE_DECL(TConcurrentQueue)
+	}
+}
+
+#endif // T_CONCURRENT_QUEUE_H
@@ -0,0 +1,750 @@
+#ifndef T_DEQUE_H
+#define T_DEQUE_H
+
+#include <new>
+#include <utility>
+#include <type_traits>
+
+#include <Core/Public/Common/Common.h>
+
+#include "Core/Public/Debug/Debug.h"
+#include "Core/Public/Memory/AllocatorPolicy.h"
+#include "Core/Public/Memory/MemoryUtilities.h"
+
+#include "Core/Public/Algorithm/GeneralUtilities.h"
+
+namespace Forge {
+	namespace Containers
+	{
+		/**
+		 * @brief Double-ended queue storing its elements in fixed size blocks.
+		 *
+		 * Elements are stored in blocks of about 4 KB, so elements next to each
+		 * other in the deque are contiguous in memory within a block, and a
+		 * block is only allocated once every BLOCK_SIZE pushes. The blocks are
+		 * referenced by a ring of block pointers, so a block is added or
+		 * released at either end without moving any element, making pushing
+		 * and popping at both ends O(1). Growing the ring only copies the
+		 * block pointers.
+		 *
+		 * The last released block is kept aside and reused by the next block
+		 * allocation, so a queue whose size stays about the same allocates
+		 * nothing once it has warmed up.
+		 *
+		 * Pushing or popping an element never moves the other elements, but
+		 * invalidates iterators.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InElementType, typename InAllocatorPolicy = Memory::DefaultAllocatorPolicy>
+		class TDeque : private InAllocatorPolicy
+		{
+			/// The block map and the blocks are allocated at different sizes.
+			static_assert(!std::is_same<InAllocatorPolicy, Memory::NodePoolAllocatorPolicy>::value, "Node pools only serve node-based containers");
+
+		public:
+			using AllocatorType = InAllocatorPolicy;
+
+		public:
+			using ElementType         = InElementType;
+			using ElementTypePtr      = InElementType*;
+			using ElementTypeRef      = InElementType&;
+			using ElementTypeMoveRef  = InElementType&&;
+			using ConstElementType    = const InElementType;
+			using ConstElementTypePtr = const InElementType*;
+			using ConstElementTypeRef = const InElementType&;
+
+		private:
+			using SelfType         = TDeque<ElementType, AllocatorType>;
+			using SelfTypeRef      = TDeque<ElementType, AllocatorType>&;
+			using ConstSelfTypeRef = const TDeque<ElementType, AllocatorType>&;
+
+		private:
+			static constexpr Size RoundDownToPowerOfTwo(Size value, Size power = 1)
+			{
+				return power * 2 > value ? power : RoundDownToPowerOfTwo(value, power * 2);
+			}
+
+		public:
+			/// Number of elements per block, a power of two so that locating an
+			/// element only takes a shift and a mask.
+			static constexpr Size BLOCK_SIZE = sizeof(InElementType) * 4 > 4096 ? 4 : RoundDownToPowerOfTwo(4096 / sizeof(InElementType));
+
+		private:
+			static constexpr Size MIN_MAP_CAPACITY = 8;
+
+		private:
+			/// Ring of block pointers, its capacity is a power of two.
+			ElementTypePtr* m_map;
+			Size            m_map_capacity;
+
+			/// Position of the front block in the ring, and number of blocks.
+			Size m_first_block;
+			Size m_num_of_blocks;
+
+			/// Position of the front element in the front block.
+			Size m_front;
+			Size m_count;
+
+			/// Past-the-end of the last element and end of its block, so that
+			/// pushing and popping at the back within a block skip the ring.
+			ElementTypePtr m_back;
+			ElementTypePtr m_back_end;
+
+			ElementTypePtr m_spare_block;
+
+		public:
+			struct Iterator
+			{
+			private:
+				SelfType*      m_deque;
+				Size           m_index;
+				ElementTypePtr m_ptr;
+				ElementTypePtr m_block_end;
+
+			public:
+				Iterator(Void)
+					: m_deque(nullptr), m_index(0), m_ptr(nullptr), m_block_end(nullptr) {}
+
+				Iterator(SelfType* deque, Size index)
+					: m_deque(deque), m_index(index), m_ptr(nullptr), m_block_end(nullptr)
+				{
+					if (index < deque->m_count)
+						this->Load();
+				}
+
+			private:
+				Void Load(Void)
+				{
+					this->m_ptr = this->m_deque->GetElement(this->m_index);
+					this->m_block_end = this->m_deque->GetBlock((this->m_deque->m_front + this->m_index) / BLOCK_SIZE) + BLOCK_SIZE;
+				}
+
+			public:
+				Iterator operator ++(I32)
+				{
+					Iterator temp(*this);
+
+					++(*this);
+
+					return temp;
+				}
+				Iterator operator ++(Void)
+				{
+					this->m_index++;
+
+					if (++this->m_ptr == this->m_block_end && this->m_index < this->m_deque->m_count)
+						this->Load();
+
+					return *this;
+				}
+
+			public:
+				Bool operator ==(const Iterator& other)
+				{
+					return this->m_index == other.m_index;
+				}
+				Bool operator !=(const Iterator& other)
+				{
+					return this->m_index != other.m_index;
+				}
+
+			public:
+				ElementTypeRef operator *()
+				{
+					return *(this->m_ptr);
+				}
+
+			public:
+				ElementTypePtr operator ->()
+				{
+					return this->m_ptr;
+				}
+			};
+			struct ConstIterator
+			{
+			private:
+				const SelfType*     m_deque;
+				Size                m_index;
+				ConstElementTypePtr m_ptr;
+				ConstElementTypePtr m_block_end;
+
+			public:
+				ConstIterator(Void)
+					: m_deque(nullptr), m_index(0), m_ptr(nullptr), m_block_end(nullptr) {}
+
+				ConstIterator(const SelfType* deque, Size index)
+					: m_deque(deque), m_index(index), m_ptr(nullptr), m_block_end(nullptr)
+				{
+					if (index < deque->m_count)
+						this->Load();
+				}
+
+			private:
+				Void Load(Void)
+				{
+					this->m_ptr = this->m_deque->GetElement(this->m_index);
+					this->m_block_end = this->m_deque->GetBlock((this->m_deque->m_front + this->m_index) / BLOCK_SIZE) + BLOCK_SIZE;
+				}
+
+			public:
+				ConstIterator operator ++(I32)
+				{
+					ConstIterator temp(*this);
+
+					++(*this);
+
+					return temp;
+				}
+				ConstIterator operator ++(Void)
+				{
+					this->m_index++;
+
+					if (++this->m_ptr == this->m_block_end && this->m_index < this->m_deque->m_count)
+						this->Load();
+
+					return *this;
+				}
+
+			public:
+				Bool operator ==(const ConstIterator& other)
+				{
+					return this->m_index == other.m_index;
+				}
+				Bool operator !=(const ConstIterator& other)
+				{
+					return this->m_index != other.m_index;
+				}
+
+			public:
+				ConstElementTypeRef operator *()
+				{
+					return *(this->m_ptr);
+				}
+
+			public:
+				ConstElementTypePtr operator ->()
+				{
+					return this->m_ptr;
+				}
+			};
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Constructs an empty deque allocating its blocks through an
+			 * allocator, nothing is allocated until the first push.
+			 */
+			explicit TDeque(const AllocatorType& allocator = AllocatorType())
+				: AllocatorType(allocator), m_map(nullptr), m_map_capacity(0), m_first_block(0), m_num_of_blocks(0), m_front(0), m_count(0), m_back(nullptr), m_back_end(nullptr), m_spare_block(nullptr) {}
+
+		public:
+			/**
+			 * @brief Move constructor.
+			 */
+			TDeque(SelfType&& other)
+				: AllocatorType(other.GetAllocator()), m_map(nullptr), m_map_capacity(0), m_first_block(0), m_num_of_blocks(0), m_front(0), m_count(0), m_back(nullptr), m_back_end(nullptr), m_spare_block(nullptr)
+			{
+				*this = Algorithm::Move(other);
+			}
+
+			/**
+			 * @brief Copy constructor.
+			 *
+			 * The copy allocates through the allocator of the other deque.
+			 */
+			TDeque(ConstSelfTypeRef other)
+				: AllocatorType(other.GetAllocator()), m_map(nullptr), m_map_capacity(0), m_first_block(0), m_num_of_blocks(0), m_front(0), m_count(0), m_back(nullptr), m_back_end(nullptr), m_spare_block(nullptr)
+			{
+				*this = other;
+			}
+
+		public:
+			/**
+			 * @brief Default destructor.
+			 */
+			~TDeque(Void)
+			{
+				this->Release();
+			}
+
+		public:
+			/**
+			 * @brief Move assignment.
+			 */
+			SelfTypeRef operator =(SelfType&& other)
+			{
+				if (this == &other)
+					return *this;
+
+				this->Release();
+
+				this->GetAllocator() = Algorithm::Move(other.GetAllocator());
+
+				this->m_map = other.m_map;
+				this->m_map_capacity = other.m_map_capacity;
+				this->m_first_block = other.m_first_block;
+				this->m_num_of_blocks = other.m_num_of_blocks;
+				this->m_front = other.m_front;
+				this->m_count = other.m_count;
+				this->m_back = other.m_back;
+				this->m_back_end = other.m_back_end;
+				this->m_spare_block = other.m_spare_block;
+
+				other.m_map = nullptr;
+				other.m_map_capacity = other.m_first_block = other.m_num_of_blocks = 0;
+				other.m_front = other.m_count = 0;
+				other.m_back = other.m_back_end = nullptr;
+				other.m_spare_block = nullptr;
+
+				return *this;
+			}
+
+			/**
+			 * @brief Copy assignment.
+			 */
+			SelfTypeRef operator =(ConstSelfTypeRef other)
+			{
+				if (this == &other)
+					return *this;
+
+				this->Clear();
+
+				for (ConstIterator itr = other.GetStartConstItr(); itr != other.GetEndConstItr(); itr++)
+					this->PushBack(*itr);
+
+				return *this;
+			}
+
+		private:
+			ElementTypePtr GetBlock(Size block_index) const
+			{
+				return this->m_map[(this->m_first_block + block_index) & (this->m_map_capacity - 1)];
+			}
+
+			ElementTypePtr GetElement(Size index) const
+			{
+				Size position = this->m_front + index;
+
+				return this->GetBlock(position / BLOCK_SIZE) + (position & (BLOCK_SIZE - 1));
+			}
+
+		private:
+			ElementTypePtr AllocateBlock(Void)
+			{
+				ElementTypePtr block = this->m_spare_block;
+
+				if (block)
+					this->m_spare_block = nullptr;
+				else
+					block = static_cast<ElementTypePtr>(this->GetAllocator().Allocate(BLOCK_SIZE * sizeof(ElementType), alignof(ElementType)));
+
+				return block;
+			}
+
+			Void ReleaseBlock(ElementTypePtr block)
+			{
+				if (!this->m_spare_block)
+					this->m_spare_block = block;
+				else
+					this->GetAllocator().Deallocate(block);
+			}
+
+			Void GrowMap(Void)
+			{
+				Size new_capacity = this->m_map_capacity ? this->m_map_capacity * 2 : MIN_MAP_CAPACITY;
+
+				ElementTypePtr* new_map = static_cast<ElementTypePtr*>(this->GetAllocator().Allocate(new_capacity * sizeof(ElementTypePtr), alignof(ElementTypePtr)));
+
+				/// The ring is unrolled so the front block lands at the start of
+				/// the new ring.
+				for (Size i = 0; i < this->m_num_of_blocks; i++)
+					new_map[i] = this->GetBlock(i);
+
+				if (this->m_map)
+					this->GetAllocator().Deallocate(this->m_map);
+
+				this->m_map = new_map;
+				this->m_map_capacity = new_capacity;
+				this->m_first_block = 0;
+			}
+
+			Void Release(Void)
+			{
+				this->Clear();
+
+				if (this->m_spare_block)
+					this->GetAllocator().Deallocate(this->m_spare_block);
+
+				if (this->m_map)
+					this->GetAllocator().Deallocate(this->m_map);
+			}
+
+			Void ReleaseAllBlocks(Void)
+			{
+				for (Size i = 0; i < this->m_num_of_blocks; i++)
+					this->ReleaseBlock(this->GetBlock(i));
+
+				this->m_first_block = 0;
+				this->m_num_of_blocks = 0;
+				this->m_front = 0;
+
+				this->m_back = this->m_back_end = nullptr;
+			}
+
+			Void UpdateBack(Void)
+			{
+				Size position = this->m_front + this->m_count - 1;
+
+				this->m_back_end = this->GetBlock(position / BLOCK_SIZE) + BLOCK_SIZE;
+				this->m_back = this->m_back_end - BLOCK_SIZE + (position & (BLOCK_SIZE - 1)) + 1;
+			}
+
+		public:
+			/**
+			 * @brief Gets the allocator policy this deque allocates through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			AllocatorType& GetAllocator(Void)
+			{
+				return static_cast<AllocatorType&>(*this);
+			}
+
+			/**
+			 * @brief Gets the allocator policy this deque allocates through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			const AllocatorType& GetAllocator(Void) const
+			{
+				return static_cast<const AllocatorType&>(*this);
+			}
+
+		public:
+			/**
+			 * @brief Gets the number of elements in the deque.
+			 *
+			 * @return Size storing the number of elements.
+			 */
+			Size GetCount(Void) const
+			{
+				return this->m_count;
+			}
+
+			/**
+			 * @brief Checks whether the deque has no elements.
+			 *
+			 * @return True if the deque is empty.
+			 */
+			Bool IsEmpty(Void) const
+			{
+				return !this->m_count;
+			}
+
+		public:
+			/**
+			 * @brief Returns an iterator pointing to the first element in this
+			 * deque.
+			 *
+			 * @return Iterator pointing to the first element.
+			 */
+			Iterator GetStartItr(Void)
+			{
+				return Iterator(this, 0);
+			}
+
+			/**
+			 * @brief Returns an iterator pointing to the past-end element in this
+			 * deque.
+			 *
+			 * @return Iterator pointing to the past-end element.
+			 */
+			Iterator GetEndItr(Void)
+			{
+				return Iterator(this, this->m_count);
+			}
+
+			/**
+			 * @brief Returns a const iterator pointing to the first element in
+			 * this deque.
+			 *
+			 * @return ConstIterator pointing to the first element.
+			 */
+			ConstIterator GetStartConstItr(Void) const
+			{
+				return ConstIterator(this, 0);
+			}
+
+			/**
+			 * @brief Returns a const iterator pointing to the past-end element in
+			 * this deque.
+			 *
+			 * @return ConstIterator pointing to the past-end element.
+			 */
+			ConstIterator GetEndConstItr(Void) const
+			{
+				return ConstIterator(this, this->m_count);
+			}
+
+		public:
+			/**
+			 * @brief Element Accessor.
+			 */
+			ElementTypeRef operator [](Size index)
+			{
+				FORGE_ASSERT(index < this->m_count, "Index is out of range.")
+
+				return *this->GetElement(index);
+			}
+
+			/**
+			 * @brief Element Accessor.
+			 */
+			ConstElementTypeRef operator [](Size index) const
+			{
+				FORGE_ASSERT(index < this->m_count, "Index is out of range.")
+
+				return *this->GetElement(index);
+			}
+
+		public:
+			/**
+			 * @brief Retreives the first element in this deque.
+			 *
+			 * @return ElementTypeRef storing the first element.
+			 */
+			ElementTypeRef PeekFront(Void)
+			{
+				FORGE_ASSERT(this->m_count, "Deque is empty.")
+
+				return *this->GetElement(0);
+			}
+
+			/**
+			 * @brief Retreives the first element in this deque.
+			 *
+			 * @return ConstElementTypeRef storing the first element.
+			 */
+			ConstElementTypeRef PeekFront(Void) const
+			{
+				FORGE_ASSERT(this->m_count, "Deque is empty.")
+
+				return *this->GetElement(0);
+			}
+
+			/**
+			 * @brief Retreives the last element in this deque.
+			 *
+			 * @return ElementTypeRef storing the last element.
+			 */
+			ElementTypeRef PeekBack(Void)
+			{
+				FORGE_ASSERT(this->m_count, "Deque is empty.")
+
+				return *(this->m_back - 1);
+			}
+
+			/**
+			 * @brief Retreives the last element in this deque.
+			 *
+			 * @return ConstElementTypeRef storing the last element.
+			 */
+			ConstElementTypeRef PeekBack(Void) const
+			{
+				FORGE_ASSERT(this->m_count, "Deque is empty.")
+
+				return *(this->m_back - 1);
+			}
+
+		public:
+			/**
+			 * @brief Constructs a new element after the last element.
+			 *
+			 * @param[in] args The arguments to construct the element with.
+			 *
+			 * @return ElementTypeRef storing the new element.
+			 */
+			template<typename... InArgs>
+			ElementTypeRef EmplaceBack(InArgs&&... args)
+			{
+				if (this->m_back != this->m_back_end)
+				{
+					ElementTypePtr element = new (this->m_back) ElementType(std::forward<InArgs>(args)...);
+
+					this->m_back++;
+					this->m_count++;
+
+					return *element;
+				}
+
+				if (this->m_front + this->m_count == this->m_num_of_blocks * BLOCK_SIZE)
+				{
+					if (this->m_num_of_blocks == this->m_map_capacity)
+						this->GrowMap();
+
+					this->m_map[(this->m_first_block + this->m_num_of_blocks) & (this->m_map_capacity - 1)] = this->AllocateBlock();
+					this->m_num_of_blocks++;
+				}
+
+				ElementTypePtr element = new (this->GetElement(this->m_count)) ElementType(std::forward<InArgs>(args)...);
+
+				this->m_count++;
+
+				this->UpdateBack();
+
+				return *element;
+			}
+
+			/**
+			 * @brief Constructs a new element before the first element.
+			 *
+			 * @param[in] args The arguments to construct the element with.
+			 *
+			 * @return ElementTypeRef storing the new element.
+			 */
+			template<typename... InArgs>
+			ElementTypeRef EmplaceFront(InArgs&&... args)
+			{
+				if (!this->m_front)
+				{
+					if (this->m_num_of_blocks == this->m_map_capacity)
+						this->GrowMap();
+
+					this->m_first_block = (this->m_first_block - 1) & (this->m_map_capacity - 1);
+					this->m_map[this->m_first_block] = this->AllocateBlock();
+					this->m_num_of_blocks++;
+
+					this->m_front = BLOCK_SIZE;
+				}
+
+				ElementTypePtr element = new (this->GetBlock(0) + this->m_front - 1) ElementType(std::forward<InArgs>(args)...);
+
+				this->m_front--;
+				this->m_count++;
+
+				if (this->m_count == 1)
+					this->UpdateBack();
+
+				return *element;
+			}
+
+			/**
+			 * @brief Inserts an element after the last element.
+			 *
+			 * @param[in] element The element to insert.
+			 */
+			Void PushBack(ElementType&& element)
+			{
+				this->EmplaceBack(Algorithm::Move(element));
+			}
+
+			/**
+			 * @brief Inserts an element after the last element.
+			 *
+			 * @param[in] element The element to insert.
+			 */
+			Void PushBack(ConstElementTypeRef element)
+			{
+				this->EmplaceBack(element);
+			}
+
+			/**
+			 * @brief Inserts an element before the first element.
+			 *
+			 * @param[in] element The element to insert.
+			 */
+			Void PushFront(ElementType&& element)
+			{
+				this->EmplaceFront(Algorithm::Move(element));
+			}
+
+			/**
+			 * @brief Inserts an element before the first element.
+			 *
+			 * @param[in] element The element to insert.
+			 */
+			Void PushFront(ConstElementTypeRef element)
+			{
+				this->EmplaceFront(element);
+			}
+
+			/**
+			 * @brief Removes the first element.
+			 */
+			Void PopFront(Void)
+			{
+				FORGE_ASSERT(this->m_count, "Deque is empty.")
+
+				this->GetElement(0)->~ElementType();
+
+				this->m_front++;
+				this->m_count--;
+
+				if (!this->m_count)
+					this->ReleaseAllBlocks();
+				else if (this->m_front >= BLOCK_SIZE)
+				{
+					this->ReleaseBlock(this->GetBlock(0));
+
+					this->m_first_block = (this->m_first_block + 1) & (this->m_map_capacity - 1);
+					this->m_num_of_blocks--;
+
+					this->m_front -= BLOCK_SIZE;
+				}
+			}
+
+			/**
+			 * @brief Removes the last element.
+			 */
+			Void PopBack(Void)
+			{
+				FORGE_ASSERT(this->m_count, "Deque is empty.")
+
+				(--this->m_back)->~ElementType();
+
+				this->m_count--;
+
+				if (!this->m_count)
+					this->ReleaseAllBlocks();
+				else if (this->m_back == this->m_back_end - BLOCK_SIZE)
+				{
+					while ((this->m_num_of_blocks - 1) * BLOCK_SIZE >= this->m_front + this->m_count)
+					{
+						this->m_num_of_blocks--;
+
+						this->ReleaseBlock(this->GetBlock(this->m_num_of_blocks));
+					}
+
+					this->UpdateBack();
+				}
+			}
+
+		public:
+			/**
+			 * @brief Removes every element, releasing every block except one
+			 * spare block kept for the next push, and keeping the block map.
+			 */
+			Void Clear(Void)
+			{
+				for (Iterator itr = this->GetStartItr(); itr != this->GetEndItr(); itr++)
+					itr->~ElementType();
+
+				this->m_count = 0;
+
+				this->ReleaseAllBlocks();
+			}
+		};
+
+		FORGE_TYPEDEF_TEMPLATE_DECL(TDeque)
+	}
+
+	namespace Common
+	{
+		template<typename InElementType, typename InAllocatorPolicy>
+		struct TIsTriviallyRelocatable<Containers::TDeque<InElementType, InAllocatorPolicy>> { enum { Value = TIsTriviallyRelocatable<InAllocatorPolicy>::Value }; };
+	}
+}
+
+#endif // T_DEQUE_H
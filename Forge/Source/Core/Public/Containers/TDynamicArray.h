@@ -6,6 +6,8 @@
 
 #include <Core/Public/Containers/AbstractList.h>
 
+#include "Core/Public/Memory/AllocatorPolicy.h"
+
 namespace Forge {
 	namespace Containers
 	{
@@ -18,11 +20,17 @@ namespace Forge {
 		 * dynamically, with the storage being handled automatically by the
 		 * container.
 		 * 
+		 * The storage is allocated through the allocator policy, which defaults
+		 * to the heap.
+		 * 
 		 * @author Karim Hisham.
 		 */
-		template<typename InElementType>
-		class TDynamicArray final : public AbstractList<InElementType>
+		template<typename InElementType, typename InAllocatorPolicy = Memory::DefaultAllocatorPolicy>
+		class TDynamicArray final : public AbstractList<InElementType>, private InAllocatorPolicy
 		{
+		public:
+			using AllocatorType = InAllocatorPolicy;
+
 		public:
 			using ElementType         = InElementType;
 			using ElementTypePtr      = InElementType*;
@@ -33,13 +41,13 @@ namespace Forge {
 			using ConstElementTypeRef = const InElementType&;
 
 		private:
-			using SelfType         = TDynamicArray<ElementType>;
-			using SelfTypePtr      = TDynamicArray<ElementType>*;
-			using SelfTypeRef      = TDynamicArray<ElementType>&;
-			using SelfTypeMoveRef  = TDynamicArray<ElementType>&&;
-			using ConstSelfType    = const TDynamicArray<ElementType>;
-			using ConstSelfTypePtr = const TDynamicArray<ElementType>*;
-			using ConstSelfTypeRef = const TDynamicArray<ElementType>&;
+			using SelfType         = TDynamicArray<ElementType, AllocatorType>;
+			using SelfTypePtr      = TDynamicArray<ElementType, AllocatorType>*;
+			using SelfTypeRef      = TDynamicArray<ElementType, AllocatorType>&;
+			using SelfTypeMoveRef  = TDynamicArray<ElementType, AllocatorType>&&;
+			using ConstSelfType    = const TDynamicArray<ElementType, AllocatorType>;
+			using ConstSelfTypePtr = const TDynamicArray<ElementType, AllocatorType>*;
+			using ConstSelfTypeRef = const TDynamicArray<ElementType, AllocatorType>&;
 
 		private:
 			enum { CAPACITY_ALIGNMENT = 2 };
@@ -290,15 +298,23 @@ namespace Forge {
 			TDynamicArray(Void) 
 				: m_mem_block(nullptr), m_version(0), m_capacity(0), AbstractList<ElementType>(0, ~((Size)0)) {}
 
+			/**
+			 * @brief Allocator constructor.
+			 *
+			 * Constructs an empty dynamic array allocating through an allocator.
+			 */
+			explicit TDynamicArray(const AllocatorType& allocator)
+				: m_mem_block(nullptr), m_version(0), m_capacity(0), AbstractList<ElementType>(0, ~((Size)0)), AllocatorType(allocator) {}
+
 			/**
 			 * @brief Move element constructor.
 			 *
 			 * Constructs a dynamic array with a copy of an element.
 			 */
-			TDynamicArray(ElementTypeMoveRef element, Size count)
-				: m_mem_block(nullptr), m_version(0), m_capacity(count), AbstractList<ElementType>(count, ~((Size)0))
+			TDynamicArray(ElementTypeMoveRef element, Size count, const AllocatorType& allocator = AllocatorType())
+				: m_mem_block(nullptr), m_version(0), m_capacity(count), AbstractList<ElementType>(count, ~((Size)0)), AllocatorType(allocator)
 			{
-				this->m_mem_block = (ElementTypePtr)malloc(this->m_count * sizeof(ElementType));
+				this->m_mem_block = this->AllocateElements(this->m_count);
 
 				Memory::MoveConstruct(this->m_mem_block, Move(element), this->m_count);
 			}
@@ -308,10 +324,10 @@ namespace Forge {
 			 *
 			 * Constructs a dynamic array with a copy of an element.
 			 */
-			TDynamicArray(ConstElementTypeRef element, Size count)
-				: m_mem_block(nullptr), m_version(0), m_capacity(count), AbstractList<ElementType>(count, ~((Size)0))
+			TDynamicArray(ConstElementTypeRef element, Size count, const AllocatorType& allocator = AllocatorType())
+				: m_mem_block(nullptr), m_version(0), m_capacity(count), AbstractList<ElementType>(count, ~((Size)0)), AllocatorType(allocator)
 			{
-				this->m_mem_block = (ElementTypePtr)malloc(this->m_count * sizeof(ElementType));
+				this->m_mem_block = this->AllocateElements(this->m_count);
 
 				Memory::CopyConstruct(this->m_mem_block, element, this->m_count);
 			}
@@ -321,10 +337,10 @@ namespace Forge {
 			 *
 			 * Constructs a static array with an initializer list.
 			 */
-			TDynamicArray(std::initializer_list<ElementType> init_list)
-				: m_mem_block(nullptr), m_version(0), m_capacity(init_list.size()), AbstractList<ElementType>(init_list.size(), ~((Size)0))
+			TDynamicArray(std::initializer_list<ElementType> init_list, const AllocatorType& allocator = AllocatorType())
+				: m_mem_block(nullptr), m_version(0), m_capacity(init_list.size()), AbstractList<ElementType>(init_list.size(), ~((Size)0)), AllocatorType(allocator)
 			{
-				this->m_mem_block = (ElementTypePtr)malloc(this->m_count * sizeof(ElementType));
+				this->m_mem_block = this->AllocateElements(this->m_count);
 
 				Memory::CopyConstructArray(this->m_mem_block, const_cast<ElementTypePtr>(init_list.begin()), this->m_count);
 			}
@@ -341,9 +357,11 @@ namespace Forge {
 
 			/**
 			 * @brief Copy constructor.
+			 *
+			 * The copy allocates through the allocator of the other array.
 			 */
 			TDynamicArray(ConstSelfTypeRef other)
-				: m_mem_block(nullptr), m_version(0), m_capacity(0), AbstractList<ElementType>(0, ~((Size)0))
+				: m_mem_block(nullptr), m_version(0), m_capacity(0), AbstractList<ElementType>(0, ~((Size)0)), AllocatorType(other.GetAllocator())
 			{
 				*this = other;
 			}
@@ -357,16 +375,21 @@ namespace Forge {
 				this->Clear();
 
 				if(this->m_mem_block)
-					free(this->m_mem_block);
+					this->GetAllocator().Deallocate(this->m_mem_block);
 			}
 
 		public:
 			/**
 			 * @brief Move assignment.
+			 *
+			 * The allocator is moved along with the storage it allocated.
 			 */
 			SelfTypeRef operator =(SelfTypeMoveRef other)
 			{
 				this->Clear();
+
+				if (this->m_mem_block)
+					this->GetAllocator().Deallocate(this->m_mem_block);
 				
 				Memory::MemoryCopy(this, &other, sizeof(SelfType));
 
@@ -378,33 +401,80 @@ namespace Forge {
 
 			/**
 			 * @brief Copy assignment.
+			 *
+			 * The storage keeps being allocated through the allocator of this
+			 * array.
 			 */
 			SelfTypeRef operator =(ConstSelfTypeRef other)
 			{
-				ConstSize old_count = this->m_count;
-				ConstSize new_count = other.m_count;
+				if (this == &other)
+					return *this;
 
 				this->Clear();
 
-				if (new_count > old_count)
-				{
-					this->ReserveCapacity(new_count);
-
-					Memory::CopyArray(this->m_mem_block, other.m_mem_block, old_count);
-					Memory::CopyConstructArray(this->m_mem_block + old_count, other.m_mem_block + old_count, new_count - old_count);
-				}
-				else
-					Memory::CopyArray(this->m_mem_block, other.m_mem_block, new_count);
+				/// The cleared elements are destructed, so every element is
+				/// copy constructed rather than assigned.
+				this->ReserveCapacity(other.m_count);
 
+				Memory::CopyConstructArray(this->m_mem_block, other.m_mem_block, other.m_count);
 
 				this->m_count = other.m_count;
 				this->m_version = other.m_version;
-				this->m_capacity = other.m_capacity;
 				this->m_max_capacity = other.m_max_capacity;
 
 				return *this;
 			}
 		
+		private:
+			ElementTypePtr AllocateElements(Size count)
+			{
+				return reinterpret_cast<ElementTypePtr>(this->GetAllocator().Allocate(count * sizeof(ElementType), alignof(ElementType)));
+			}
+
+			/// Trivially relocatable elements are carried over by a single
+			/// reallocation, others are relocated one by one to a new block.
+			Void ReallocateElements(Size capacity)
+			{
+				this->ReallocateElementsImpl(capacity, Common::TTraitInt<Common::TIsTriviallyRelocatable<ElementType>::Value>());
+			}
+			Void ReallocateElementsImpl(Size capacity, Common::TypeIsPod)
+			{
+				this->m_mem_block = reinterpret_cast<ElementTypePtr>(this->GetAllocator().Reallocate(this->m_mem_block,
+					this->m_capacity * sizeof(ElementType), capacity * sizeof(ElementType), alignof(ElementType)));
+			}
+			Void ReallocateElementsImpl(Size capacity, Common::TypeIsClass)
+			{
+				ElementTypePtr new_elements = this->AllocateElements(capacity);
+
+				Memory::RelocateArray(new_elements, this->m_mem_block, this->m_count);
+
+				if (this->m_mem_block)
+					this->GetAllocator().Deallocate(this->m_mem_block);
+
+				this->m_mem_block = new_elements;
+			}
+
+		public:
+			/**
+			 * @brief Gets the allocator policy this array allocates through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			AllocatorType& GetAllocator(Void)
+			{
+				return static_cast<AllocatorType&>(*this);
+			}
+
+			/**
+			 * @brief Gets the allocator policy this array allocates through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			const AllocatorType& GetAllocator(Void) const
+			{
+				return static_cast<const AllocatorType&>(*this);
+			}
+
 		public:
 			/**
 			 * @brief Element Accessor.
@@ -416,6 +486,16 @@ namespace Forge {
 				return *(this->m_mem_block + index);
 			}
 
+			/**
+			 * @brief Element Accessor.
+			 */
+			ConstElementTypeRef operator [](Size index) const
+			{
+				FORGE_ASSERT(index >= 0 && index < this->m_count, "Index is out of range.")
+
+				return *(this->m_mem_block + index);
+			}
+
 		public:
 			/**
 			 * @brief Returns an iterator pointing to the first element in this
@@ -594,22 +674,36 @@ namespace Forge {
 
 				Size new_capacity;
 
-				ElementTypePtr old_elements, new_elements;
-
 				new_capacity = this->m_capacity + (this->m_capacity / 2);
 				new_capacity = new_capacity > capacity ? new_capacity : capacity;
 				new_capacity = new_capacity < this->m_max_capacity ? new_capacity : this->m_max_capacity;
 				new_capacity = (new_capacity + (CAPACITY_ALIGNMENT - 1)) & ~(CAPACITY_ALIGNMENT - 1);
 			
-				old_elements = this->m_mem_block;
-				new_elements = (ElementTypePtr)malloc(new_capacity * sizeof(ElementType));
+				this->ReallocateElements(new_capacity);
 
-				Memory::MoveConstructArray(new_elements, old_elements, this->m_count);
+				this->m_capacity = new_capacity;
+				this->m_version++;
+			}
 
-				free(old_elements);
+			/**
+			 * @brief Requests that this collection capacity is reduced to the
+			 * number of elements it contains.
+			 */
+			Void ShrinkToFit(Void)
+			{
+				if (this->m_capacity == this->m_count)
+					return;
 
-				this->m_mem_block = new_elements;
-				this->m_capacity = new_capacity;
+				if (!this->m_count)
+				{
+					this->GetAllocator().Deallocate(this->m_mem_block);
+
+					this->m_mem_block = nullptr;
+				}
+				else
+					this->ReallocateElements(this->m_count);
+
+				this->m_capacity = this->m_count;
 				this->m_version++;
 			}
 
@@ -689,7 +783,7 @@ namespace Forge {
 			 */
 			Void InsertAt(Size index, ElementTypeMoveRef element) override
 			{
-				if (index < 0 || index >= this->m_count)
+				if (index < 0 || index > this->m_count)
 					FORGE_EXCEPT(ExceptionType::FORGE_INDEX_OUT_RANGE)
 
 				if (this->m_count >= this->m_max_capacity)
@@ -697,20 +791,8 @@ namespace Forge {
 
 				this->ReserveCapacity(this->m_count + 1);
 
-				ElementType next, prev;
-
-				ElementTypePtr ptr = this->m_mem_block + index;
-
-				prev = *ptr;
-
-				for (I32 i = 0;  i < this->m_count - index; i++)
-				{
-					next = *(++ptr);
-					*ptr = prev;
-					prev = next;
-				}
-
-				Memory::Move(this->m_mem_block + index, Move(element), 1);
+				Memory::RelocateArray(this->m_mem_block + index + 1, this->m_mem_block + index, this->m_count - index);
+				Memory::MoveConstruct(this->m_mem_block + index, Move(element), 1);
 
 				this->m_count++;
 			}
@@ -734,31 +816,16 @@ namespace Forge {
 			 */
 			Void InsertAt(Size index, ConstElementTypeRef element) override
 			{
-				if (index < 0 || index >= this->m_count)
+				if (index < 0 || index > this->m_count)
 					FORGE_EXCEPT(ExceptionType::FORGE_INDEX_OUT_RANGE)
 
 				if (this->m_count >= this->m_max_capacity)
 					FORGE_EXCEPT(ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS)
 
-				if (this->m_count >= this->m_max_capacity)
-					return;
-
 				this->ReserveCapacity(this->m_count + 1);
-				
-				ElementType next, prev;
-
-				ElementTypePtr ptr = this->m_mem_block + index;
-				
-				prev = *ptr;
-				
-				for (I32 i = 0;  i < this->m_count - index; i++)
-				{
-					next = *(++ptr);
-					*ptr = prev;
-					prev = next;
-				}
 
-				Memory::Copy(this->m_mem_block + index, element, 1);
+				Memory::RelocateArray(this->m_mem_block + index + 1, this->m_mem_block + index, this->m_count - index);
+				Memory::CopyConstruct(this->m_mem_block + index, element, 1);
 
 				this->m_count++;
 			}
@@ -788,14 +855,9 @@ namespace Forge {
 				if (!this->m_count)
 					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 
-				ElementTypePtr slow_ptr = this->m_mem_block + index;
-				ElementTypePtr fast_ptr = this->m_mem_block + index + 1;
-
 				Memory::Destruct(this->m_mem_block + index, 1);
+				Memory::RelocateArray(this->m_mem_block + index, this->m_mem_block + index + 1, this->m_count - index - 1);
 
-				for (I32 i = 0; i < this->m_count - index; i++)
-					*(slow_ptr++) = *(fast_ptr++);
-				
 				this->m_count--;
 			}
 
@@ -816,6 +878,12 @@ namespace Forge {
 
 		FORGE_TYPEDEF_TEMPLATE_DECL(TDynamicArray)
 	}
+
+	namespace Common
+	{
+		template<typename InElementType, typename InAllocatorPolicy>
+		struct TIsTriviallyRelocatable<Containers::TDynamicArray<InElementType, InAllocatorPolicy>> { enum { Value = TIsTriviallyRelocatable<InAllocatorPolicy>::Value }; };
+	}
 }
 
 #endif // T_DYNAMIC_ARRAY_H
@@ -1,6 +1,7 @@
 #ifndef T_DYNAMIC_QUEUE_H
 #define T_DYNAMIC_QUEUE_H
 
+#include <new>
 #include <utility>
 #include <stdlib.h>
 #include <initializer_list>
@@ -12,13 +13,27 @@
 
 #include "Core/Public/Memory/PoolAllocator.h"
 #include "Core/Public/Memory/MemoryUtilities.h"
+#include "Core/Public/Memory/AllocatorPolicy.h"
+
+#include "Core/Public/Containers/TDeque.h"
 
 namespace Forge {
 	namespace Containers
 	{
-		template<typename InElementType>
+		/**
+		 * @brief First-in first-out queue growing as elements are pushed.
+		 *
+		 * Elements are stored in a TDeque, so pushing and popping are O(1) and
+		 * allocate once per block of elements instead of once per element.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InElementType, typename InAllocatorPolicy = Memory::DefaultAllocatorPolicy>
 		class TDynamicQueue : public AbstractList<InElementType>
 		{
+		public:
+			using AllocatorType = InAllocatorPolicy;
+
 		private:
 			using ElementType         = InElementType;
 			using ElementTypeRef      = InElementType&;
@@ -28,33 +43,15 @@ namespace Forge {
 			using ConstElementTypePtr = const InElementType*;
 
 		private:
-			using SelfType         = TDynamicQueue<ElementType>;
-			using SelfTypeRef      = TDynamicQueue<ElementType>&;
-			using SelfTypePtr      = TDynamicQueue<ElementType>*;
-			using ConstSelfType    = const TDynamicQueue<ElementType>;
-			using ConstSelfTypeRef = const TDynamicQueue<ElementType>&;
-			using ConstSelfTypePtr = const TDynamicQueue<ElementType>*;
+			using SelfType         = TDynamicQueue<ElementType, AllocatorType>;
+			using SelfTypeRef      = TDynamicQueue<ElementType, AllocatorType>&;
+			using SelfTypePtr      = TDynamicQueue<ElementType, AllocatorType>*;
+			using ConstSelfType    = const TDynamicQueue<ElementType, AllocatorType>;
+			using ConstSelfTypeRef = const TDynamicQueue<ElementType, AllocatorType>&;
+			using ConstSelfTypePtr = const TDynamicQueue<ElementType, AllocatorType>*;
 
 		private:
-			struct EntryNode
-			{
-			public:
-				ElementType m_data;
-
-			public:
-				EntryNode* m_prev;
-				EntryNode* m_next;
-
-			public:
-				EntryNode(ElementType&& data)
-					: m_data(std::move(data)), m_next(nullptr), m_prev(nullptr) {}
-				EntryNode(ConstElementTypeRef data)
-					: m_data(data), m_next(nullptr), m_prev(nullptr) {}
-			};
-
-		private:
-			EntryNode* m_head;
-			EntryNode* m_tail;
+			TDeque<ElementType, AllocatorType> m_deque;
 
 		public:
 			/**
@@ -63,15 +60,24 @@ namespace Forge {
 			 * Constructs an empty dynamic queue.
 			 */
 			TDynamicQueue(void)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0)) {}
+				: AbstractList<ElementType>(0, ~((Size)0)) {}
+
+			/**
+			 * @brief Allocator constructor.
+			 *
+			 * Constructs an empty dynamic queue allocating its blocks through an
+			 * allocator.
+			 */
+			explicit TDynamicQueue(const AllocatorType& allocator)
+				: AbstractList<ElementType>(0, ~((Size)0)), m_deque(allocator) {}
 
 			/**
 			 * @brief Move element constructor.
 			 *
 			 * Constructs a dynamic queue with a copy of an element.
 			 */
-			TDynamicQueue(ElementType&& element, Size count)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
+			TDynamicQueue(ElementType&& element, Size count, const AllocatorType& allocator = AllocatorType())
+				: AbstractList<ElementType>(0, ~((Size)0)), m_deque(allocator)
 			{
 				while (count > this->m_count)
 					this->Push(std::move(element));
@@ -82,8 +88,8 @@ namespace Forge {
 			 *
 			 * Constructs a dynamic queue with a copy of an element.
 			 */
-			TDynamicQueue(ConstElementTypeRef element, Size count)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
+			TDynamicQueue(ConstElementTypeRef element, Size count, const AllocatorType& allocator = AllocatorType())
+				: AbstractList<ElementType>(0, ~((Size)0)), m_deque(allocator)
 			{
 				while (count > this->m_count)
 					this->Push(element);
@@ -94,8 +100,8 @@ namespace Forge {
 			 *
 			 * Constructs a dynamic queue with an initializer list.
 			 */
-			TDynamicQueue(std::initializer_list<ElementType> init_list)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
+			TDynamicQueue(std::initializer_list<ElementType> init_list, const AllocatorType& allocator = AllocatorType())
+				: AbstractList<ElementType>(0, ~((Size)0)), m_deque(allocator)
 			{
 				ConstElementTypePtr ptr = init_list.begin();
 
@@ -108,19 +114,19 @@ namespace Forge {
 			 * @brief Move constructor.
 			 */
 			TDynamicQueue(SelfType&& other)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
+				: AbstractList<ElementType>(other.m_count, ~((Size)0)), m_deque(std::move(other.m_deque))
 			{
-				*this = std::move(other);
+				other.m_count = 0;
 			}
 
 			/**
 			 * @brief Copy constructor.
+			 *
+			 * The copy allocates its blocks through the allocator of the other
+			 * queue.
 			 */
 			TDynamicQueue(ConstSelfTypeRef other)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
-			{
-				*this = other;
-			}
+				: AbstractList<ElementType>(other.m_count, ~((Size)0)), m_deque(other.m_deque) {}
 
 		public:
 			/**
@@ -131,17 +137,38 @@ namespace Forge {
 				this->Clear();
 			}
 
+		public:
+			/**
+			 * @brief Gets the allocator policy this queue allocates its blocks
+			 * through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			AllocatorType& GetAllocator(void)
+			{
+				return this->m_deque.GetAllocator();
+			}
+
+			/**
+			 * @brief Gets the allocator policy this queue allocates its blocks
+			 * through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			const AllocatorType& GetAllocator(void) const
+			{
+				return this->m_deque.GetAllocator();
+			}
+
 		public:
 			/**
 			 * @brief Move constructor.
 			 */
 			SelfTypeRef operator =(SelfType&& other)
 			{
-				this->Clear();
+				this->m_deque = std::move(other.m_deque);
+				this->m_count = other.m_count;
 
-				Memory::MemoryCopy(this, &other, sizeof(SelfType));
-
-				other.m_head = other.m_tail = nullptr;
 				other.m_count = 0;
 
 				return *this;
@@ -152,10 +179,8 @@ namespace Forge {
 			 */
 			SelfTypeRef operator =(ConstSelfTypeRef other)
 			{
-				this->Clear();
-
-				for (EntryNode* curr_node = other.m_head; curr_node; curr_node = curr_node->m_next)
-					this->Push(curr_node->m_data);
+				this->m_deque = other.m_deque;
+				this->m_count = other.m_count;
 
 				return *this;
 			}
@@ -203,7 +228,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				return this->m_head->m_data;
+				return this->m_deque.PeekFront();
 			}
 
 		private:
@@ -223,16 +248,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* elem_node = new EntryNode(std::move(element));
-
-				if (!this->m_head || !this->m_tail)
-					this->m_head = this->m_tail = elem_node;
-				else
-				{
-					elem_node->m_prev = this->m_tail;
-					this->m_tail->m_next = elem_node;
-					this->m_tail = elem_node;
-				}
+				this->m_deque.PushBack(std::move(element));
 
 				this->m_count++;
 			}
@@ -264,16 +280,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* elem_node = new EntryNode(element);
-
-				if (!this->m_head || !this->m_tail)
-					this->m_head = this->m_tail = elem_node;
-				else
-				{
-					elem_node->m_prev = this->m_tail;
-					this->m_tail->m_next = elem_node;
-					this->m_tail = elem_node;
-				}
+				this->m_deque.PushBack(element);
 
 				this->m_count++;
 			}
@@ -313,17 +320,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* curr_node = this->m_head;
-
-				if (this->m_head == this->m_tail)
-					this->m_head = this->m_tail = nullptr;
-				else
-				{
-					this->m_head = this->m_head->m_next;
-					this->m_head->m_prev = nullptr;
-				}
-
-				free(curr_node);
+				this->m_deque.PopFront();
 
 				this->m_count--;
 			}
@@ -421,12 +418,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* curr_node = this->m_head;
-
-				while (curr_node->m_next && (index--) > 0)
-					curr_node = curr_node->m_next;
-
-				return curr_node->m_data;
+				return this->m_deque[index];
 			}
 
 		public:
@@ -452,8 +444,8 @@ namespace Forge {
 
 				I32 index = 0;
 
-				for (EntryNode* curr_node = this->m_head; curr_node; curr_node = curr_node->m_next, index++)
-					Memory::CopyConstruct(array_ptr + index, curr_node->m_data, 1);
+				for (auto itr = this->m_deque.GetStartConstItr(); itr != this->m_deque.GetEndConstItr(); itr++, index++)
+					Memory::CopyConstruct(array_ptr + index, *itr, 1);
 
 				return array_ptr;
 			}
@@ -480,8 +472,8 @@ namespace Forge {
 
 				I32 index = 0;
 
-				for (EntryNode* curr_node = this->m_head; curr_node; curr_node = curr_node->m_next, index++)
-					Memory::CopyConstruct(array_ptr + index, curr_node->m_data, 1);
+				for (auto itr = this->m_deque.GetStartConstItr(); itr != this->m_deque.GetEndConstItr(); itr++, index++)
+					Memory::CopyConstruct(array_ptr + index, *itr, 1);
 
 				return array_ptr;
 			}
@@ -504,8 +496,8 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				for (EntryNode* curr_node = this->m_head; curr_node; curr_node = curr_node->m_next)
-					function.Invoke(curr_node->m_data);
+				for (auto itr = this->m_deque.GetStartItr(); itr != this->m_deque.GetEndItr(); itr++)
+					function.Invoke(*itr);
 			}
 
 			/**
@@ -525,8 +517,8 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				for (EntryNode* curr_node = this->m_head; curr_node; curr_node = curr_node->m_next)
-					function.Invoke(curr_node->m_data);
+				for (auto itr = this->m_deque.GetStartConstItr(); itr != this->m_deque.GetEndConstItr(); itr++)
+					function.Invoke(*itr);
 			}
 
 		public:
@@ -548,14 +540,12 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* curr_node = this->m_head;
+				I64 index = 0;
 
-				for (I32 index = 0; curr_node; index++)
+				for (auto itr = this->m_deque.GetStartConstItr(); itr != this->m_deque.GetEndConstItr(); itr++, index++)
 				{
-					if (Memory::MemoryCompare(&curr_node->m_data, &element, sizeof(ElementType)))
+					if (Memory::MemoryCompare(&(*itr), &element, sizeof(ElementType)))
 						return index;
-
-					curr_node = curr_node->m_next;
 				}
 
 				return -1;
@@ -579,14 +569,10 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* curr_node = this->m_tail;
-
-				for (I32 index = this->m_count - 1; curr_node; index--)
+				for (I64 index = this->m_count - 1; index >= 0; index--)
 				{
-					if (Memory::MemoryCompare(&curr_node->m_data, &element, sizeof(ElementType)))
+					if (Memory::MemoryCompare(&this->m_deque[index], &element, sizeof(ElementType)))
 						return index;
-
-					curr_node = curr_node->m_prev;
 				}
 
 				return -1;
@@ -677,14 +663,18 @@ namespace Forge {
 			 */
 			Void Clear(void) override
 			{
-				if (this->IsEmpty())
-					return;
+				this->m_deque.Clear();
 
-				while (this->m_count > 0)
-					this->Pop();
+				this->m_count = 0;
 			}
 		};
 	}
+
+	namespace Common
+	{
+		template<typename InElementType, typename InAllocatorPolicy>
+		struct TIsTriviallyRelocatable<Containers::TDynamicQueue<InElementType, InAllocatorPolicy>> { enum { Value = TIsTriviallyRelocatable<InAllocatorPolicy>::Value }; };
+	}
 }
 
 #endif // T_DYNAMIC_QUEUE_H
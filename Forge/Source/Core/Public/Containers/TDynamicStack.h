@@ -1,6 +1,7 @@
 #ifndef T_DYNAMIC_STACK_H
 #define T_DYNAMIC_STACK_H
 
+#include <new>
 #include <utility>
 #include <stdlib.h>
 #include <initializer_list>
@@ -12,13 +13,29 @@
 
 #include "Core/Public/Memory/PoolAllocator.h"
 #include "Core/Public/Memory/MemoryUtilities.h"
+#include "Core/Public/Memory/AllocatorPolicy.h"
+
+#include "Core/Public/Containers/TDeque.h"
 
 namespace Forge {
 	namespace Containers
 	{
-		template<typename InElementType>
+		/**
+		 * @brief Last-in first-out stack growing as elements are pushed.
+		 *
+		 * Elements are stored bottom to top in a TDeque, so pushing and popping
+		 * are O(1), a block is allocated once every TDeque::BLOCK_SIZE pushes
+		 * and released blocks are reused, and an element keeps its address
+		 * until it is popped. Indices count from the top of the stack.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InElementType, typename InAllocatorPolicy = Memory::DefaultAllocatorPolicy>
 		class TDynamicStack : public AbstractList<InElementType>
 		{
+		public:
+			using AllocatorType = InAllocatorPolicy;
+
 		private:
 			using ElementType         = InElementType;
 			using ElementTypeRef      = InElementType&;
@@ -28,33 +45,16 @@ namespace Forge {
 			using ConstElementTypePtr = const InElementType*;
 
 		private:
-			using SelfType         = TDynamicStack<ElementType>;
-			using SelfTypeRef      = TDynamicStack<ElementType>&;
-			using SelfTypePtr      = TDynamicStack<ElementType>*;
-			using ConstSelfType    = const TDynamicStack<ElementType>;
-			using ConstSelfTypeRef = const TDynamicStack<ElementType>&;
-			using ConstSelfTypePtr = const TDynamicStack<ElementType>*;
-
-		private:
-			struct EntryNode
-			{
-			public:
-				ElementType m_data;
-
-			public:
-				EntryNode* m_prev;
-				EntryNode* m_next;
-
-			public:
-				EntryNode(ElementType&& data)
-					: m_data(std::move(data)), m_next(nullptr), m_prev(nullptr) {}
-				EntryNode(ConstElementTypeRef data)
-					: m_data(data), m_next(nullptr), m_prev(nullptr) {}
-			};
+			using SelfType         = TDynamicStack<ElementType, AllocatorType>;
+			using SelfTypeRef      = TDynamicStack<ElementType, AllocatorType>&;
+			using SelfTypePtr      = TDynamicStack<ElementType, AllocatorType>*;
+			using ConstSelfType    = const TDynamicStack<ElementType, AllocatorType>;
+			using ConstSelfTypeRef = const TDynamicStack<ElementType, AllocatorType>&;
+			using ConstSelfTypePtr = const TDynamicStack<ElementType, AllocatorType>*;
 
 		private:
-			EntryNode* m_head;
-			EntryNode* m_tail;
+			/// Elements from the bottom to the top of the stack.
+			TDeque<ElementType, AllocatorType> m_deque;
 
 		public:
 			/**
@@ -63,15 +63,24 @@ namespace Forge {
 			 * Constructs an empty dynamic stack.
 			 */
 			TDynamicStack(void)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0)) {}
+				: AbstractList<ElementType>(0, ~((Size)0)) {}
+
+			/**
+			 * @brief Allocator constructor.
+			 *
+			 * Constructs an empty dynamic stack allocating its blocks through an
+			 * allocator.
+			 */
+			explicit TDynamicStack(const AllocatorType& allocator)
+				: AbstractList<ElementType>(0, ~((Size)0)), m_deque(allocator) {}
 
 			/**
 			 * @brief Move element constructor.
 			 *
 			 * Constructs a dynamic stack with a copy of an element.
 			 */
-			TDynamicStack(ElementType&& element, Size count)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
+			TDynamicStack(ElementType&& element, Size count, const AllocatorType& allocator = AllocatorType())
+				: AbstractList<ElementType>(0, ~((Size)0)), m_deque(allocator)
 			{
 				while (count > this->m_count)
 					this->Push(std::move(element));
@@ -82,8 +91,8 @@ namespace Forge {
 			 *
 			 * Constructs a dynamic stack with a copy of an element.
 			 */
-			TDynamicStack(ConstElementTypeRef element, Size count)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
+			TDynamicStack(ConstElementTypeRef element, Size count, const AllocatorType& allocator = AllocatorType())
+				: AbstractList<ElementType>(0, ~((Size)0)), m_deque(allocator)
 			{
 				while (count > this->m_count)
 					this->Push(element);
@@ -94,8 +103,8 @@ namespace Forge {
 			 *
 			 * Constructs a dynamic stack with an initializer list.
 			 */
-			TDynamicStack(std::initializer_list<ElementType> init_list)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
+			TDynamicStack(std::initializer_list<ElementType> init_list, const AllocatorType& allocator = AllocatorType())
+				: AbstractList<ElementType>(0, ~((Size)0)), m_deque(allocator)
 			{
 				ConstElementTypePtr ptr = init_list.begin();
 
@@ -108,19 +117,19 @@ namespace Forge {
 			 * @brief Move constructor.
 			 */
 			TDynamicStack(SelfType&& other)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
+				: AbstractList<ElementType>(other.m_count, ~((Size)0)), m_deque(std::move(other.m_deque))
 			{
-				*this = std::move(other);
+				other.m_count = 0;
 			}
 
 			/**
 			 * @brief Copy constructor.
+			 *
+			 * The copy allocates its blocks through the allocator of the other
+			 * stack.
 			 */
 			TDynamicStack(ConstSelfTypeRef other)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
-			{
-				*this = other;
-			}
+				: AbstractList<ElementType>(other.m_count, ~((Size)0)), m_deque(other.m_deque) {}
 
 		public:
 			/**
@@ -131,17 +140,38 @@ namespace Forge {
 				this->Clear();
 			}
 
+		public:
+			/**
+			 * @brief Gets the allocator policy this stack allocates its blocks
+			 * through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			AllocatorType& GetAllocator(void)
+			{
+				return this->m_deque.GetAllocator();
+			}
+
+			/**
+			 * @brief Gets the allocator policy this stack allocates its blocks
+			 * through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			const AllocatorType& GetAllocator(void) const
+			{
+				return this->m_deque.GetAllocator();
+			}
+
 		public:
 			/**
 			 * @brief Move constructor.
 			 */
 			SelfTypeRef operator =(SelfType&& other)
 			{
-				this->Clear();
-
-				Memory::MemoryCopy(this, &other, sizeof(SelfType));
+				this->m_deque = std::move(other.m_deque);
+				this->m_count = other.m_count;
 
-				other.m_head = other.m_tail = nullptr;
 				other.m_count = 0;
 
 				return *this;
@@ -152,10 +182,8 @@ namespace Forge {
 			 */
 			SelfTypeRef operator =(ConstSelfTypeRef other)
 			{
-				this->Clear();
-
-				for (EntryNode* curr_node = other.m_head; curr_node; curr_node = curr_node->m_next)
-					this->Push(curr_node->m_data);
+				this->m_deque = other.m_deque;
+				this->m_count = other.m_count;
 
 				return *this;
 			}
@@ -203,7 +231,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				return this->m_head->m_data;
+				return this->m_deque.PeekBack();
 			}
 
 		private:
@@ -234,16 +262,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* elem_node = new EntryNode(std::move(element));
-
-				if (!this->m_head || !this->m_tail)
-					this->m_head = this->m_tail = elem_node;
-				else
-				{
-					elem_node->m_next = this->m_head;
-					this->m_head->m_prev = elem_node;
-					this->m_head = elem_node;
-				}
+				this->m_deque.PushBack(std::move(element));
 
 				this->m_count++;
 			}
@@ -275,16 +294,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* elem_node = new EntryNode(element);
-
-				if (!this->m_head || !this->m_tail)
-					this->m_head = this->m_tail = elem_node;
-				else
-				{
-					elem_node->m_next = this->m_head;
-					this->m_head->m_prev = elem_node;
-					this->m_head = elem_node;
-				}
+				this->m_deque.PushBack(element);
 
 				this->m_count++;
 			}
@@ -313,17 +323,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* curr_node = this->m_head;
-
-				if (this->m_head == this->m_tail)
-					this->m_head = this->m_tail = nullptr;
-				else
-				{
-					this->m_head = this->m_head->m_next;
-					this->m_head->m_prev = nullptr;
-				}
-
-				free(curr_node);
+				this->m_deque.PopBack();
 
 				this->m_count--;
 			}
@@ -421,12 +421,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* curr_node = this->m_head;
-
-				while (curr_node->m_next && (index--) > 0)
-					curr_node = curr_node->m_next;
-
-				return curr_node->m_data;
+				return this->m_deque[this->m_count - index - 1];
 			}
 
 		public:
@@ -450,10 +445,8 @@ namespace Forge {
 
 				ElementTypePtr array_ptr = (ElementTypePtr)malloc(this->m_count * sizeof(ElementType));
 
-				I32 index = 0;
-
-				for (EntryNode* curr_node = this->m_head; curr_node; curr_node = curr_node->m_next, index++)
-					Memory::CopyConstruct(array_ptr + index, curr_node->m_data, 1);
+				for (Size index = 0; index < this->m_count; index++)
+					Memory::CopyConstruct(array_ptr + index, this->m_deque[this->m_count - index - 1], 1);
 
 				return array_ptr;
 			}
@@ -478,10 +471,8 @@ namespace Forge {
 				if (this->IsEmpty())
 					return nullptr;
 
-				I32 index = 0;
-
-				for (EntryNode* curr_node = this->m_head; curr_node; curr_node = curr_node->m_next, index++)
-					Memory::CopyConstruct(array_ptr + index, curr_node->m_data, 1);
+				for (Size index = 0; index < this->m_count; index++)
+					Memory::CopyConstruct(array_ptr + index, this->m_deque[this->m_count - index - 1], 1);
 
 				return array_ptr;
 			}
@@ -506,8 +497,8 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				for (EntryNode* curr_node = this->m_head; curr_node; curr_node = curr_node->m_next)
-					function.Invoke(curr_node->m_data);
+				for (Size index = this->m_count; index > 0; index--)
+					function.Invoke(this->m_deque[index - 1]);
 			}
 
 			/**
@@ -529,8 +520,8 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				for (EntryNode* curr_node = this->m_head; curr_node; curr_node = curr_node->m_next)
-					function.Invoke(curr_node->m_data);
+				for (Size index = this->m_count; index > 0; index--)
+					function.Invoke(this->m_deque[index - 1]);
 			}
 
 		public:
@@ -554,14 +545,10 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* curr_node = this->m_head;
-
-				for (I32 index = 0; curr_node; index++)
+				for (I64 index = 0; index < static_cast<I64>(this->m_count); index++)
 				{
-					if (Memory::MemoryCompare(&curr_node->m_data, &element, sizeof(ElementType)))
+					if (Memory::MemoryCompare(&this->m_deque[this->m_count - index - 1], &element, sizeof(ElementType)))
 						return index;
-
-					curr_node = curr_node->m_next;
 				}
 
 				return -1;
@@ -587,14 +574,12 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* curr_node = this->m_tail;
+				I64 index = this->m_count - 1;
 
-				for (I32 index = this->m_count - 1; curr_node; index--)
+				for (auto itr = this->m_deque.GetStartConstItr(); itr != this->m_deque.GetEndConstItr(); itr++, index--)
 				{
-					if (Memory::MemoryCompare(&curr_node->m_data, &element, sizeof(ElementType)))
+					if (Memory::MemoryCompare(&(*itr), &element, sizeof(ElementType)))
 						return index;
-
-					curr_node = curr_node->m_prev;
 				}
 
 				return -1;
@@ -611,7 +596,7 @@ namespace Forge {
 			 */
 			ConstElementTypeRef Peek(void)
 			{
-				return this->PeekFront();
+				return SelfType::PeekFront();
 			}
 
 		public:
@@ -626,7 +611,7 @@ namespace Forge {
 			 */
 			Void Push(ElementType&& element)
 			{
-				this->PushFront(std::move(element));
+				SelfType::PushFront(std::move(element));
 			}
 			
 			/**
@@ -640,7 +625,7 @@ namespace Forge {
 			 */
 			Void Push(ConstElementTypeRef element)
 			{
-				this->PushFront(element);
+				SelfType::PushFront(element);
 			}
 
 			/**
@@ -651,7 +636,7 @@ namespace Forge {
 			 */
 			Void Pop(void)
 			{
-				this->PopFront();
+				SelfType::PopFront();
 			}
 
 		public:
@@ -690,14 +675,18 @@ namespace Forge {
 			 */
 			Void Clear(void) override
 			{
-				if (this->IsEmpty())
-					return;
+				this->m_deque.Clear();
 
-				while (this->m_count > 0)
-					this->Pop();
+				this->m_count = 0;
 			}
 		};
 	}
+
+	namespace Common
+	{
+		template<typename InElementType, typename InAllocatorPolicy>
+		struct TIsTriviallyRelocatable<Containers::TDynamicStack<InElementType, InAllocatorPolicy>> { enum { Value = TIsTriviallyRelocatable<InAllocatorPolicy>::Value }; };
+	}
 }
 
 #endif // T_DYNAMIC_STACK_H
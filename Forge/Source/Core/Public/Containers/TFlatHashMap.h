@@ -0,0 +1,236 @@
+#ifndef T_FLAT_HASH_MAP_H
+#define T_FLAT_HASH_MAP_H
+
+#include <Core/Public/Types/TPair.h>
+#include <Core/Public/Containers/TFlatHashTable.h>
+
+namespace Forge {
+	namespace Containers
+	{
+		/**
+		 * @brief An associative container mapping unique keys to values in an
+		 * open addressing hash table.
+		 *
+		 * Key-value pairs are stored inline in a single array of slots, so a
+		 * lookup costs a hash, a probe of a few control bytes and usually a
+		 * single key comparison, without chasing per-element nodes.
+		 *
+		 * Keys are hashed by the hasher, which defaults to THash, and compared
+		 * with operator ==. The key of an element must not be modified through
+		 * an iterator. Inserting an element may rehash the table, which
+		 * invalidates every iterator and element address.
+		 *
+		 * The storage is allocated through the allocator policy, which defaults
+		 * to the heap.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InKeyType, typename InValueType, typename InHasher = Algorithm::THash<InKeyType>, typename InAllocatorPolicy = Memory::DefaultAllocatorPolicy>
+		class TFlatHashMap final : public TFlatHashTable<Common::TPair<InKeyType, InValueType>, InKeyType, Internal::FlatHashMapKeyOf, InHasher, InAllocatorPolicy>
+		{
+		public:
+			using AllocatorType = InAllocatorPolicy;
+			using HasherType    = InHasher;
+
+		public:
+			using KeyType            = InKeyType;
+			using KeyTypeMoveRef     = InKeyType&&;
+			using ConstKeyTypeRef    = const InKeyType&;
+
+		public:
+			using ValueType          = InValueType;
+			using ValueTypePtr       = InValueType*;
+			using ValueTypeRef       = InValueType&;
+			using ValueTypeMoveRef   = InValueType&&;
+			using ConstValueTypePtr  = const InValueType*;
+			using ConstValueTypeRef  = const InValueType&;
+
+		public:
+			using ElementType    = Common::TPair<InKeyType, InValueType>;
+			using ElementTypePtr = Common::TPair<InKeyType, InValueType>*;
+
+		private:
+			using BaseType = TFlatHashTable<ElementType, InKeyType, Internal::FlatHashMapKeyOf, InHasher, InAllocatorPolicy>;
+
+		public:
+			using Iterator      = typename BaseType::Iterator;
+			using ConstIterator = typename BaseType::ConstIterator;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Constructs an empty hash map.
+			 */
+			TFlatHashMap(Void)
+				: BaseType() {}
+
+			/**
+			 * @brief Allocator constructor.
+			 *
+			 * Constructs an empty hash map allocating through an allocator.
+			 */
+			explicit TFlatHashMap(const AllocatorType& allocator, const HasherType& hasher = HasherType())
+				: BaseType(allocator, hasher) {}
+
+			/**
+			 * @brief Capacity constructor.
+			 *
+			 * Constructs an empty hash map able to store the specified number of
+			 * elements without rehashing.
+			 */
+			explicit TFlatHashMap(Size count, const AllocatorType& allocator = AllocatorType(), const HasherType& hasher = HasherType())
+				: BaseType(count, allocator, hasher) {}
+
+		public:
+			/**
+			 * @brief Inserts the specified key and value into this map, unless
+			 * the key is already stored.
+			 *
+			 * @param[in] key   The key of the element to insert.
+			 * @param[in] value The value of the element to insert.
+			 *
+			 * @return True if the element was inserted, false if the key was
+			 * already stored and its value left unchanged.
+			 */
+			Bool Insert(KeyTypeMoveRef key, ValueTypeMoveRef value)
+			{
+				if (this->FindIndex(key) != BaseType::INVALID_INDEX)
+					return false;
+
+				this->InsertNew(key, Move(key), Move(value));
+
+				return true;
+			}
+
+			/**
+			 * @brief Inserts the specified key and value into this map, unless
+			 * the key is already stored.
+			 *
+			 * @param[in] key   The key of the element to insert.
+			 * @param[in] value The value of the element to insert.
+			 *
+			 * @return True if the element was inserted, false if the key was
+			 * already stored and its value left unchanged.
+			 */
+			Bool Insert(ConstKeyTypeRef key, ConstValueTypeRef value)
+			{
+				if (this->FindIndex(key) != BaseType::INVALID_INDEX)
+					return false;
+
+				this->InsertNew(key, key, value);
+
+				return true;
+			}
+
+			/**
+			 * @brief Inserts the specified key and value into this map, or
+			 * assigns the value to the element of the key if already stored.
+			 *
+			 * @param[in] key   The key of the element to insert or assign.
+			 * @param[in] value The value to insert or assign.
+			 *
+			 * @return ValueTypeRef storing the value of the element.
+			 */
+			ValueTypeRef InsertOrAssign(ConstKeyTypeRef key, ValueTypeMoveRef value)
+			{
+				ValueTypePtr stored_value = this->FindValue(key);
+
+				if (stored_value)
+					return *stored_value = Move(value);
+
+				ElementTypePtr element = this->InsertNew(key, KeyType(key), Move(value));
+
+				return element->m_second;
+			}
+
+			/**
+			 * @brief Inserts the specified key and value into this map, or
+			 * assigns the value to the element of the key if already stored.
+			 *
+			 * @param[in] key   The key of the element to insert or assign.
+			 * @param[in] value The value to insert or assign.
+			 *
+			 * @return ValueTypeRef storing the value of the element.
+			 */
+			ValueTypeRef InsertOrAssign(ConstKeyTypeRef key, ConstValueTypeRef value)
+			{
+				ValueTypePtr stored_value = this->FindValue(key);
+
+				if (stored_value)
+					return *stored_value = value;
+
+				ElementTypePtr element = this->InsertNew(key, key, value);
+
+				return element->m_second;
+			}
+
+		public:
+			/**
+			 * @brief Value accessor, inserts a default constructed value if the
+			 * key is not stored yet.
+			 */
+			ValueTypeRef operator [](ConstKeyTypeRef key)
+			{
+				ValueTypePtr stored_value = this->FindValue(key);
+
+				if (stored_value)
+					return *stored_value;
+
+				ElementTypePtr element = this->InsertNew(key, KeyType(key), ValueType());
+
+				return element->m_second;
+			}
+
+		public:
+			/**
+			 * @brief Searches this map for the value of the specified key.
+			 *
+			 * @param[in] key The key to search for.
+			 *
+			 * @return ValueTypePtr storing the address of the value, or nullptr
+			 * if the key is not stored.
+			 */
+			template<typename InLookupType>
+			ValueTypePtr FindValue(const InLookupType& key)
+			{
+				Size index = this->FindIndex(key);
+
+				if (index == BaseType::INVALID_INDEX)
+					return nullptr;
+
+				return &(*this->GetItrAt(index)).m_second;
+			}
+
+			/**
+			 * @brief Searches this map for the value of the specified key.
+			 *
+			 * @param[in] key The key to search for.
+			 *
+			 * @return ConstValueTypePtr storing the address of the value, or
+			 * nullptr if the key is not stored.
+			 */
+			template<typename InLookupType>
+			ConstValueTypePtr FindValue(const InLookupType& key) const
+			{
+				Size index = this->FindIndex(key);
+
+				if (index == BaseType::INVALID_INDEX)
+					return nullptr;
+
+				return &(*this->GetConstItrAt(index)).m_second;
+			}
+		};
+	}
+
+	namespace Common
+	{
+		template<typename InKeyType, typename InValueType, typename InHasher, typename InAllocatorPolicy>
+		struct TIsTriviallyRelocatable<Containers::TFlatHashMap<InKeyType, InValueType, InHasher, InAllocatorPolicy>>
+		{
+			enum { Value = TIsTriviallyRelocatable<InHasher>::Value && TIsTriviallyRelocatable<InAllocatorPolicy>::Value };
+		};
+	}
+}
+
+#endif // T_FLAT_HASH_MAP_H
@@ -0,0 +1,123 @@
+#ifndef T_FLAT_HASH_SET_H
+#define T_FLAT_HASH_SET_H
+
+#include <Core/Public/Containers/TFlatHashTable.h>
+
+namespace Forge {
+	namespace Containers
+	{
+		/**
+		 * @brief An associative container storing unique keys in an open
+		 * addressing hash table.
+		 *
+		 * Keys are stored inline in a single array of slots, so a lookup costs
+		 * a hash, a probe of a few control bytes and usually a single key
+		 * comparison, without chasing per-element nodes.
+		 *
+		 * Keys are hashed by the hasher, which defaults to THash, and compared
+		 * with operator ==. Keys must not be modified through an iterator.
+		 * Inserting a key may rehash the table, which invalidates every
+		 * iterator and element address.
+		 *
+		 * The storage is allocated through the allocator policy, which defaults
+		 * to the heap.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InKeyType, typename InHasher = Algorithm::THash<InKeyType>, typename InAllocatorPolicy = Memory::DefaultAllocatorPolicy>
+		class TFlatHashSet final : public TFlatHashTable<InKeyType, InKeyType, Internal::FlatHashSetKeyOf, InHasher, InAllocatorPolicy>
+		{
+		public:
+			using AllocatorType = InAllocatorPolicy;
+			using HasherType    = InHasher;
+
+		public:
+			using KeyType         = InKeyType;
+			using KeyTypeMoveRef  = InKeyType&&;
+			using ConstKeyTypeRef = const InKeyType&;
+
+		private:
+			using BaseType = TFlatHashTable<InKeyType, InKeyType, Internal::FlatHashSetKeyOf, InHasher, InAllocatorPolicy>;
+
+		public:
+			using Iterator      = typename BaseType::Iterator;
+			using ConstIterator = typename BaseType::ConstIterator;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Constructs an empty hash set.
+			 */
+			TFlatHashSet(Void)
+				: BaseType() {}
+
+			/**
+			 * @brief Allocator constructor.
+			 *
+			 * Constructs an empty hash set allocating through an allocator.
+			 */
+			explicit TFlatHashSet(const AllocatorType& allocator, const HasherType& hasher = HasherType())
+				: BaseType(allocator, hasher) {}
+
+			/**
+			 * @brief Capacity constructor.
+			 *
+			 * Constructs an empty hash set able to store the specified number of
+			 * keys without rehashing.
+			 */
+			explicit TFlatHashSet(Size count, const AllocatorType& allocator = AllocatorType(), const HasherType& hasher = HasherType())
+				: BaseType(count, allocator, hasher) {}
+
+		public:
+			/**
+			 * @brief Inserts the specified key into this set, unless it is
+			 * already stored.
+			 *
+			 * @param[in] key The key to insert.
+			 *
+			 * @return True if the key was inserted, false if it was already
+			 * stored.
+			 */
+			Bool Insert(KeyTypeMoveRef key)
+			{
+				if (this->FindIndex(key) != BaseType::INVALID_INDEX)
+					return false;
+
+				this->InsertNew(key, Move(key));
+
+				return true;
+			}
+
+			/**
+			 * @brief Inserts the specified key into this set, unless it is
+			 * already stored.
+			 *
+			 * @param[in] key The key to insert.
+			 *
+			 * @return True if the key was inserted, false if it was already
+			 * stored.
+			 */
+			Bool Insert(ConstKeyTypeRef key)
+			{
+				if (this->FindIndex(key) != BaseType::INVALID_INDEX)
+					return false;
+
+				this->InsertNew(key, key);
+
+				return true;
+			}
+		};
+	}
+
+	namespace Common
+	{
+		template<typename InKeyType, typename InHasher, typename InAllocatorPolicy>
+		struct TIsTriviallyRelocatable<Containers::TFlatHashSet<InKeyType, InHasher, InAllocatorPolicy>>
+		{
+			enum { Value = TIsTriviallyRelocatable<InHasher>::Value && TIsTriviallyRelocatable<InAllocatorPolicy>::Value };
+		};
+	}
+}
+
+#endif // T_FLAT_HASH_SET_H
@@ -0,0 +1,958 @@
+#ifndef T_FLAT_HASH_TABLE_H
+#define T_FLAT_HASH_TABLE_H
+
+#include <utility>
+#include <type_traits>
+
+#if defined(FORGE_CPU_X86)
+	#include <emmintrin.h>
+#endif
+
+#include <Core/Public/Types/TDelegate.h>
+#include <Core/Public/Common/Common.h>
+
+#include "Core/Public/Memory/MemoryUtilities.h"
+#include "Core/Public/Memory/AllocatorPolicy.h"
+
+#include "Core/Public/Algorithm/BitUtilities.h"
+#include "Core/Public/Algorithm/Hash/THash.h"
+
+namespace Forge {
+	namespace Containers
+	{
+		namespace Internal
+		{
+			/**
+			 * @brief A group of control bytes probed at once.
+			 *
+			 * Every slot of a flat hash table has a control byte, which is
+			 * either empty or stores the 7 low bits of the hash of the key in
+			 * the slot. A lookup compares a whole group of control bytes against
+			 * the hash of its key in a few instructions and only compares the
+			 * keys of the slots that matched.
+			 */
+			struct FlatHashGroup
+			{
+			public:
+				enum : Byte { EMPTY = 0x80 };
+
+				enum { SIZE = 16 };
+
+			private:
+#if defined(FORGE_CPU_X86)
+				__m128i m_ctrl;
+#else
+				U64 m_ctrl[2];
+#endif
+
+			public:
+				FlatHashGroup(ConstBytePtr ctrl)
+				{
+#if defined(FORGE_CPU_X86)
+					m_ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+					Memory::MemoryCopy(m_ctrl, ctrl, SIZE);
+#endif
+				}
+
+			public:
+				/**
+				 * @brief Gets a bit mask of the slots whose control byte stores
+				 * the specified hash bits.
+				 */
+				U32 Match(Byte h2) const
+				{
+#if defined(FORGE_CPU_X86)
+					return static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<Char>(h2)), m_ctrl)));
+#else
+					U32 mask = 0;
+
+					for (U32 i = 0; i < SIZE; i++)
+						mask |= static_cast<U32>(reinterpret_cast<ConstBytePtr>(m_ctrl)[i] == h2) << i;
+
+					return mask;
+#endif
+				}
+
+				/**
+				 * @brief Gets a bit mask of the empty slots.
+				 */
+				U32 MatchEmpty(Void) const
+				{
+#if defined(FORGE_CPU_X86)
+					return static_cast<U32>(_mm_movemask_epi8(m_ctrl));
+#else
+					U32 mask = 0;
+
+					for (U32 i = 0; i < SIZE; i++)
+						mask |= static_cast<U32>(reinterpret_cast<ConstBytePtr>(m_ctrl)[i] >> 7) << i;
+
+					return mask;
+#endif
+				}
+			};
+
+			/**
+			 * @brief Gets the key of a slot storing the key itself.
+			 */
+			struct FlatHashSetKeyOf
+			{
+				template<typename InSlotType>
+				static const InSlotType& GetKey(const InSlotType& slot) { return slot; }
+			};
+
+			/**
+			 * @brief Gets the key of a slot storing a key-value pair.
+			 */
+			struct FlatHashMapKeyOf
+			{
+				template<typename InSlotType>
+				static const typename InSlotType::FirstType& GetKey(const InSlotType& slot) { return slot.m_first; }
+			};
+		}
+
+		/**
+		 * @brief Open addressing hash table shared by TFlatHashMap and
+		 * TFlatHashSet.
+		 *
+		 * Slots are stored in a single allocation next to a control byte per
+		 * slot and an overflow counter per group of slots. A key is probed
+		 * group by group starting from the group its hash maps to, and a
+		 * lookup stops at the first group that no key has probed past.
+		 *
+		 * Removal empties the slot and decrements the overflow counters of the
+		 * groups the key probed past when it was inserted, so removed slots
+		 * leave no tombstones behind and never slow down later lookups. The
+		 * counters saturate rather than wrap, a saturated counter is only
+		 * reset by the next rehash.
+		 *
+		 * Slots never move unless the table is rehashed, so removing a slot
+		 * does not invalidate iterators to other slots.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InSlotType, typename InKeyType, typename InKeyOf, typename InHasher, typename InAllocatorPolicy>
+		class TFlatHashTable : private InAllocatorPolicy
+		{
+			/// The table grows by allocating a larger table each time.
+			static_assert(!std::is_same<InAllocatorPolicy, Memory::NodePoolAllocatorPolicy>::value, "Node pools only serve node-based containers");
+
+		public:
+			using HasherType    = InHasher;
+			using AllocatorType = InAllocatorPolicy;
+
+		public:
+			using KeyType         = InKeyType;
+			using ConstKeyTypeRef = const InKeyType&;
+
+		public:
+			using ElementType         = InSlotType;
+			using ElementTypePtr      = InSlotType*;
+			using ElementTypeRef      = InSlotType&;
+			using ElementTypeMoveRef  = InSlotType&&;
+			using ConstElementType    = const InSlotType;
+			using ConstElementTypePtr = const InSlotType*;
+			using ConstElementTypeRef = const InSlotType&;
+
+		private:
+			using SelfType         = TFlatHashTable<InSlotType, InKeyType, InKeyOf, InHasher, InAllocatorPolicy>;
+			using SelfTypePtr      = TFlatHashTable<InSlotType, InKeyType, InKeyOf, InHasher, InAllocatorPolicy>*;
+			using SelfTypeRef      = TFlatHashTable<InSlotType, InKeyType, InKeyOf, InHasher, InAllocatorPolicy>&;
+			using SelfTypeMoveRef  = TFlatHashTable<InSlotType, InKeyType, InKeyOf, InHasher, InAllocatorPolicy>&&;
+			using ConstSelfType    = const TFlatHashTable<InSlotType, InKeyType, InKeyOf, InHasher, InAllocatorPolicy>;
+			using ConstSelfTypePtr = const TFlatHashTable<InSlotType, InKeyType, InKeyOf, InHasher, InAllocatorPolicy>*;
+			using ConstSelfTypeRef = const TFlatHashTable<InSlotType, InKeyType, InKeyOf, InHasher, InAllocatorPolicy>&;
+
+		private:
+			using Group = Internal::FlatHashGroup;
+
+		protected:
+			enum : Size { INVALID_INDEX = ~((Size)0) };
+
+		private:
+			enum : Byte { OVERFLOW_SATURATED = 0xFF };
+
+		private:
+			BytePtr        m_ctrl;
+			BytePtr        m_overflow;
+			ElementTypePtr m_slots;
+
+		private:
+			Size m_count;
+			Size m_capacity;
+
+		private:
+			HasherType m_hasher;
+
+		public:
+			struct Iterator
+			{
+			public:
+				using ElementType = InSlotType;
+
+			private:
+				ConstBytePtr   m_ctrl;
+				ConstBytePtr   m_ctrl_end;
+				ElementTypePtr m_ptr;
+
+			public:
+				Iterator(Void)
+					: m_ctrl(nullptr), m_ctrl_end(nullptr), m_ptr(nullptr) {}
+
+				Iterator(ConstBytePtr ctrl, ConstBytePtr ctrl_end, ElementTypePtr ptr)
+					: m_ctrl(ctrl), m_ctrl_end(ctrl_end), m_ptr(ptr) {}
+
+			public:
+				Iterator operator ++(I32)
+				{
+					Iterator temp(*this);
+
+					++(*this);
+
+					return temp;
+				}
+				Iterator operator ++(Void)
+				{
+					do
+					{
+						this->m_ctrl++;
+						this->m_ptr++;
+					} while (this->m_ctrl != this->m_ctrl_end && *this->m_ctrl == Group::EMPTY);
+
+					return *this;
+				}
+
+			public:
+				Bool operator ==(const Iterator& other)
+				{
+					return this->m_ptr == other.m_ptr;
+				}
+				Bool operator !=(const Iterator& other)
+				{
+					return this->m_ptr != other.m_ptr;
+				}
+
+			public:
+				ElementTypeRef operator *()
+				{
+					return *(this->m_ptr);
+				}
+
+			public:
+				ElementTypePtr operator ->()
+				{
+					return this->m_ptr;
+				}
+			};
+			struct ConstIterator
+			{
+			public:
+				using ElementType = InSlotType;
+
+			private:
+				ConstBytePtr        m_ctrl;
+				ConstBytePtr        m_ctrl_end;
+				ConstElementTypePtr m_ptr;
+
+			public:
+				ConstIterator(Void)
+					: m_ctrl(nullptr), m_ctrl_end(nullptr), m_ptr(nullptr) {}
+
+				ConstIterator(ConstBytePtr ctrl, ConstBytePtr ctrl_end, ConstElementTypePtr ptr)
+					: m_ctrl(ctrl), m_ctrl_end(ctrl_end), m_ptr(ptr) {}
+
+			public:
+				ConstIterator operator ++(I32)
+				{
+					ConstIterator temp(*this);
+
+					++(*this);
+
+					return temp;
+				}
+				ConstIterator operator ++(Void)
+				{
+					do
+					{
+						this->m_ctrl++;
+						this->m_ptr++;
+					} while (this->m_ctrl != this->m_ctrl_end && *this->m_ctrl == Group::EMPTY);
+
+					return *this;
+				}
+
+			public:
+				Bool operator ==(const ConstIterator& other)
+				{
+					return this->m_ptr == other.m_ptr;
+				}
+				Bool operator !=(const ConstIterator& other)
+				{
+					return this->m_ptr != other.m_ptr;
+				}
+
+			public:
+				ConstElementTypeRef operator *()
+				{
+					return *(this->m_ptr);
+				}
+
+			public:
+				ConstElementTypePtr operator ->()
+				{
+					return this->m_ptr;
+				}
+			};
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Constructs an empty hash table, no memory is allocated until the
+			 * first insertion.
+			 */
+			TFlatHashTable(Void)
+				: m_ctrl(nullptr), m_overflow(nullptr), m_slots(nullptr), m_count(0), m_capacity(0), m_hasher() {}
+
+			/**
+			 * @brief Allocator constructor.
+			 *
+			 * Constructs an empty hash table allocating through an allocator.
+			 */
+			explicit TFlatHashTable(const AllocatorType& allocator, const HasherType& hasher = HasherType())
+				: AllocatorType(allocator), m_ctrl(nullptr), m_overflow(nullptr), m_slots(nullptr), m_count(0), m_capacity(0), m_hasher(hasher) {}
+
+			/**
+			 * @brief Capacity constructor.
+			 *
+			 * Constructs an empty hash table able to store the specified number
+			 * of elements without rehashing.
+			 */
+			explicit TFlatHashTable(Size count, const AllocatorType& allocator = AllocatorType(), const HasherType& hasher = HasherType())
+				: AllocatorType(allocator), m_ctrl(nullptr), m_overflow(nullptr), m_slots(nullptr), m_count(0), m_capacity(0), m_hasher(hasher)
+			{
+				this->Reserve(count);
+			}
+
+		public:
+			/**
+			 * @brief Move constructor.
+			 */
+			TFlatHashTable(SelfTypeMoveRef other)
+				: AllocatorType(Move(other.GetAllocator())), m_ctrl(other.m_ctrl), m_overflow(other.m_overflow), m_slots(other.m_slots),
+				  m_count(other.m_count), m_capacity(other.m_capacity), m_hasher(other.m_hasher)
+			{
+				other.m_ctrl = other.m_overflow = nullptr;
+				other.m_slots = nullptr;
+				other.m_count = other.m_capacity = 0;
+			}
+
+			/**
+			 * @brief Copy constructor.
+			 *
+			 * The copy allocates through the allocator of the other table.
+			 */
+			TFlatHashTable(ConstSelfTypeRef other)
+				: AllocatorType(other.GetAllocator()), m_ctrl(nullptr), m_overflow(nullptr), m_slots(nullptr), m_count(0), m_capacity(0), m_hasher(other.m_hasher)
+			{
+				*this = other;
+			}
+
+		public:
+			/**
+			 * @brief Default destructor.
+			 */
+			~TFlatHashTable(Void)
+			{
+				this->Clear();
+
+				if (this->m_ctrl)
+					this->GetAllocator().Deallocate(this->m_ctrl);
+			}
+
+		public:
+			/**
+			 * @brief Move assignment.
+			 *
+			 * The allocator is moved along with the storage it allocated.
+			 */
+			SelfTypeRef operator =(SelfTypeMoveRef other)
+			{
+				if (this == &other)
+					return *this;
+
+				this->Clear();
+
+				if (this->m_ctrl)
+					this->GetAllocator().Deallocate(this->m_ctrl);
+
+				this->GetAllocator() = Move(other.GetAllocator());
+
+				this->m_ctrl = other.m_ctrl;
+				this->m_overflow = other.m_overflow;
+				this->m_slots = other.m_slots;
+				this->m_count = other.m_count;
+				this->m_capacity = other.m_capacity;
+				this->m_hasher = other.m_hasher;
+
+				other.m_ctrl = other.m_overflow = nullptr;
+				other.m_slots = nullptr;
+				other.m_count = other.m_capacity = 0;
+
+				return *this;
+			}
+
+			/**
+			 * @brief Copy assignment.
+			 *
+			 * The other table is copied slot by slot without rehashing, the
+			 * storage keeps being allocated through the allocator of this table.
+			 */
+			SelfTypeRef operator =(ConstSelfTypeRef other)
+			{
+				if (this == &other)
+					return *this;
+
+				this->Clear();
+
+				if (this->m_capacity != other.m_capacity)
+				{
+					if (this->m_ctrl)
+						this->GetAllocator().Deallocate(this->m_ctrl);
+
+					this->m_ctrl = this->m_overflow = nullptr;
+					this->m_slots = nullptr;
+					this->m_capacity = 0;
+
+					if (other.m_capacity)
+						this->AllocateTable(other.m_capacity);
+				}
+
+				if (!other.m_capacity)
+					return *this;
+
+				Memory::MemoryCopy(this->m_ctrl, other.m_ctrl, this->m_capacity + (this->m_capacity / Group::SIZE));
+
+				for (Size i = 0; i < this->m_capacity; i++)
+				{
+					if (this->m_ctrl[i] != Group::EMPTY)
+						Memory::CopyConstruct(this->m_slots + i, other.m_slots[i], 1);
+				}
+
+				this->m_count = other.m_count;
+				this->m_hasher = other.m_hasher;
+
+				return *this;
+			}
+
+		private:
+			/**
+			 * The control bytes come first so that they and the overflow
+			 * counters share the alignment of the allocation, the slots follow
+			 * them at their own alignment.
+			 */
+			static Size GetSlotsOffset(Size capacity)
+			{
+				Size offset = capacity + (capacity / Group::SIZE);
+
+				return (offset + alignof(ElementType) - 1) & ~(alignof(ElementType) - 1);
+			}
+
+			Void AllocateTable(Size capacity)
+			{
+				Size slots_offset = GetSlotsOffset(capacity);
+				Size alignment = alignof(ElementType) > Group::SIZE ? alignof(ElementType) : Group::SIZE;
+
+				this->m_ctrl = reinterpret_cast<BytePtr>(this->GetAllocator().Allocate(slots_offset + (capacity * sizeof(ElementType)), static_cast<Byte>(alignment)));
+				this->m_overflow = this->m_ctrl + capacity;
+				this->m_slots = reinterpret_cast<ElementTypePtr>(this->m_ctrl + slots_offset);
+				this->m_capacity = capacity;
+
+				Memory::MemorySet(this->m_ctrl, Group::EMPTY, capacity);
+				Memory::MemorySet(this->m_overflow, 0, capacity / Group::SIZE);
+			}
+
+			/**
+			 * Rehashes every element into a new table of the specified capacity,
+			 * elements are relocated rather than copied.
+			 */
+			Void Rehash(Size capacity)
+			{
+				BytePtr old_ctrl = this->m_ctrl;
+				ElementTypePtr old_slots = this->m_slots;
+				Size old_capacity = this->m_capacity;
+
+				this->AllocateTable(capacity);
+
+				for (Size i = 0; i < old_capacity; i++)
+				{
+					if (old_ctrl[i] == Group::EMPTY)
+						continue;
+
+					Size hash = this->m_hasher(InKeyOf::GetKey(old_slots[i]));
+					Size index = this->FindEmptySlot(hash);
+
+					this->ClaimSlot(index, hash);
+
+					Memory::RelocateArray(this->m_slots + index, old_slots + i, 1);
+				}
+
+				if (old_ctrl)
+					this->GetAllocator().Deallocate(old_ctrl);
+			}
+
+			/**
+			 * Finds the first empty slot on the probe sequence of the hash,
+			 * without claiming it.
+			 */
+			Size FindEmptySlot(Size hash) const
+			{
+				Size group_mask = (this->m_capacity / Group::SIZE) - 1;
+				Size group_index = (hash >> 7) & group_mask;
+
+				for (Size step = 1;; step++)
+				{
+					U32 empty_mask = Group(this->m_ctrl + (group_index * Group::SIZE)).MatchEmpty();
+
+					if (empty_mask)
+						return (group_index * Group::SIZE) + Algorithm::LowestSetBitIndex(empty_mask);
+
+					group_index = (group_index + step) & group_mask;
+				}
+			}
+
+			/**
+			 * Claims a slot found by FindEmptySlot, and counts the probe in
+			 * every full group passed on the way to it.
+			 */
+			Void ClaimSlot(Size index, Size hash)
+			{
+				Size group_mask = (this->m_capacity / Group::SIZE) - 1;
+				Size group_index = (hash >> 7) & group_mask;
+
+				for (Size step = 1; group_index != index / Group::SIZE; step++)
+				{
+					if (this->m_overflow[group_index] != OVERFLOW_SATURATED)
+						this->m_overflow[group_index]++;
+
+					group_index = (group_index + step) & group_mask;
+				}
+
+				this->m_ctrl[index] = static_cast<Byte>(hash & 0x7F);
+			}
+
+		protected:
+			/**
+			 * @brief Gets the index of the slot storing the specified key.
+			 *
+			 * @return Size storing the index of the slot, or INVALID_INDEX if
+			 * the key is not stored.
+			 */
+			template<typename InLookupType>
+			Size FindIndex(const InLookupType& key) const
+			{
+				if (!this->m_count)
+					return INVALID_INDEX;
+
+				Size hash = this->m_hasher(key);
+				Size num_of_groups = this->m_capacity / Group::SIZE;
+				Size group_index = (hash >> 7) & (num_of_groups - 1);
+
+				Byte h2 = static_cast<Byte>(hash & 0x7F);
+
+				/// Groups are visited by triangular steps, which visits every
+				/// group exactly once when their number is a power of two.
+				for (Size step = 1; step <= num_of_groups; step++)
+				{
+					ConstBytePtr group_ctrl = this->m_ctrl + (group_index * Group::SIZE);
+
+					for (U32 match_mask = Group(group_ctrl).Match(h2); match_mask; match_mask &= match_mask - 1)
+					{
+						Size index = (group_index * Group::SIZE) + Algorithm::LowestSetBitIndex(match_mask);
+
+						if (InKeyOf::GetKey(this->m_slots[index]) == key)
+							return index;
+					}
+
+					if (!this->m_overflow[group_index])
+						return INVALID_INDEX;
+
+					group_index = (group_index + step) & (num_of_groups - 1);
+				}
+
+				return INVALID_INDEX;
+			}
+
+			/**
+			 * @brief Constructs a new element for a key that is not stored yet,
+			 * growing the table if it is at maximum load.
+			 *
+			 * The slot is only claimed once the element is constructed, so a
+			 * throwing constructor leaves the table unchanged. The arguments
+			 * may refer to elements of this table, so when the table grows
+			 * the element is constructed before the elements are relocated.
+			 *
+			 * @param[in] key  The key of the element to insert.
+			 * @param[in] args The arguments to construct the element from.
+			 *
+			 * @return ElementTypePtr storing the address of the new element.
+			 */
+			template<typename... InArgs>
+			ElementTypePtr InsertNew(ConstKeyTypeRef key, InArgs&&... args)
+			{
+				Size hash = this->m_hasher(key);
+
+				if (this->m_count >= GetMaxLoad(this->m_capacity))
+				{
+					ElementType element(std::forward<InArgs>(args)...);
+
+					this->Rehash(this->m_capacity ? this->m_capacity * 2 : Group::SIZE);
+
+					return this->ConstructAt(hash, Move(element));
+				}
+
+				return this->ConstructAt(hash, std::forward<InArgs>(args)...);
+			}
+
+		private:
+			template<typename... InArgs>
+			ElementTypePtr ConstructAt(Size hash, InArgs&&... args)
+			{
+				Size index = this->FindEmptySlot(hash);
+
+				ElementTypePtr element = new (this->m_slots + index) ElementType(std::forward<InArgs>(args)...);
+
+				this->ClaimSlot(index, hash);
+				this->m_count++;
+
+				return element;
+			}
+
+		protected:
+			/**
+			 * @brief Destructs the element at the specified slot and releases
+			 * the probes it counted in the groups it probed past.
+			 */
+			Void RemoveIndex(Size index)
+			{
+				Size hash = this->m_hasher(InKeyOf::GetKey(this->m_slots[index]));
+				Size group_mask = (this->m_capacity / Group::SIZE) - 1;
+				Size group_index = (hash >> 7) & group_mask;
+
+				for (Size step = 1; group_index != index / Group::SIZE; step++)
+				{
+					if (this->m_overflow[group_index] != OVERFLOW_SATURATED)
+						this->m_overflow[group_index]--;
+
+					group_index = (group_index + step) & group_mask;
+				}
+
+				Memory::Destruct(this->m_slots + index, 1);
+
+				this->m_ctrl[index] = Group::EMPTY;
+				this->m_count--;
+			}
+
+			Iterator GetItrAt(Size index)
+			{
+				if (index == INVALID_INDEX)
+					return this->GetEndItr();
+
+				return Iterator(this->m_ctrl + index, this->m_ctrl + this->m_capacity, this->m_slots + index);
+			}
+
+			ConstIterator GetConstItrAt(Size index) const
+			{
+				if (index == INVALID_INDEX)
+					return this->GetEndConstItr();
+
+				return ConstIterator(this->m_ctrl + index, this->m_ctrl + this->m_capacity, this->m_slots + index);
+			}
+
+		private:
+			/// Tables are kept at most seven eighths full.
+			static Size GetMaxLoad(Size capacity)
+			{
+				return capacity - (capacity / 8);
+			}
+
+		public:
+			/**
+			 * @brief Gets the allocator policy this table allocates through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			AllocatorType& GetAllocator(Void)
+			{
+				return static_cast<AllocatorType&>(*this);
+			}
+
+			/**
+			 * @brief Gets the allocator policy this table allocates through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			const AllocatorType& GetAllocator(Void) const
+			{
+				return static_cast<const AllocatorType&>(*this);
+			}
+
+			/**
+			 * @brief Gets the hasher this table hashes keys with.
+			 *
+			 * @return HasherType storing the hasher.
+			 */
+			const HasherType& GetHasher(Void) const
+			{
+				return this->m_hasher;
+			}
+
+		public:
+			/**
+			 * @brief Checks whether this table is empty and not storing any
+			 * elements.
+			 *
+			 * @return True if this table is empty.
+			 */
+			Bool IsEmpty(Void) const
+			{
+				return this->m_count == 0;
+			}
+
+			/**
+			 * @brief Gets the number of elements stored in this table.
+			 *
+			 * @return Size storing the number of elements.
+			 */
+			Size GetCount(Void) const
+			{
+				return this->m_count;
+			}
+
+			/**
+			 * @brief Gets the number of slots of this table, up to seven eighths
+			 * of them can be used before the table grows.
+			 *
+			 * @return Size storing the number of slots.
+			 */
+			Size GetCapacity(Void) const
+			{
+				return this->m_capacity;
+			}
+
+		public:
+			/**
+			 * @brief Returns an iterator pointing to the first element in this
+			 * table.
+			 *
+			 * Elements are iterated in slot order, which is unrelated to the
+			 * order of insertion.
+			 *
+			 * @return Iterator pointing to the first element.
+			 */
+			Iterator GetStartItr(Void)
+			{
+				Size index = 0;
+
+				while (index < this->m_capacity && this->m_ctrl[index] == Group::EMPTY)
+					index++;
+
+				return Iterator(this->m_ctrl + index, this->m_ctrl + this->m_capacity, this->m_slots + index);
+			}
+
+			/**
+			 * @brief Returns an iterator pointing to the past-end element in this
+			 * table.
+			 *
+			 * @return Iterator pointing to the past-end element.
+			 */
+			Iterator GetEndItr(Void)
+			{
+				return Iterator(this->m_ctrl + this->m_capacity, this->m_ctrl + this->m_capacity, this->m_slots + this->m_capacity);
+			}
+
+			/**
+			 * @brief Returns a const iterator pointing to the first element in
+			 * this table.
+			 *
+			 * @return ConstIterator pointing to the first element.
+			 */
+			ConstIterator GetStartConstItr(Void) const
+			{
+				Size index = 0;
+
+				while (index < this->m_capacity && this->m_ctrl[index] == Group::EMPTY)
+					index++;
+
+				return ConstIterator(this->m_ctrl + index, this->m_ctrl + this->m_capacity, this->m_slots + index);
+			}
+
+			/**
+			 * @brief Returns a const iterator pointing to the past-end element in
+			 * this table.
+			 *
+			 * @return ConstIterator pointing to the past-end element.
+			 */
+			ConstIterator GetEndConstItr(Void) const
+			{
+				return ConstIterator(this->m_ctrl + this->m_capacity, this->m_ctrl + this->m_capacity, this->m_slots + this->m_capacity);
+			}
+
+		public:
+			/**
+			 * @brief Iterates through all the elements inside the table and
+			 * performs the operation provided on each element.
+			 *
+			 * @param[in] function The function to perform on each element.
+			 */
+			Void ForEach(TDelegate<Void(ElementTypeRef)> function)
+			{
+				for (Size i = 0; i < this->m_capacity; i++)
+				{
+					if (this->m_ctrl[i] != Group::EMPTY)
+						function.Invoke(this->m_slots[i]);
+				}
+			}
+
+			/**
+			 * @brief Iterates through all the elements inside the table and
+			 * performs the operation provided on each element.
+			 *
+			 * @param[in] function The function to perform on each element.
+			 */
+			Void ForEach(TDelegate<Void(ConstElementTypeRef)> function) const
+			{
+				for (Size i = 0; i < this->m_capacity; i++)
+				{
+					if (this->m_ctrl[i] != Group::EMPTY)
+						function.Invoke(this->m_slots[i]);
+				}
+			}
+
+		public:
+			/**
+			 * @brief Searches this table for the element with the specified key.
+			 *
+			 * The key can be of any type the hasher accepts and the stored keys
+			 * compare equal to, as long as equal keys hash alike.
+			 *
+			 * @param[in] key The key to search for.
+			 *
+			 * @return Iterator pointing to the element, or the past-end iterator
+			 * if the key is not stored.
+			 */
+			template<typename InLookupType>
+			Iterator Find(const InLookupType& key)
+			{
+				return this->GetItrAt(this->FindIndex(key));
+			}
+
+			/**
+			 * @brief Searches this table for the element with the specified key.
+			 *
+			 * @param[in] key The key to search for.
+			 *
+			 * @return ConstIterator pointing to the element, or the past-end
+			 * iterator if the key is not stored.
+			 */
+			template<typename InLookupType>
+			ConstIterator Find(const InLookupType& key) const
+			{
+				return this->GetConstItrAt(this->FindIndex(key));
+			}
+
+			/**
+			 * @brief Searches this table for the specified key.
+			 *
+			 * @param[in] key The key to search for.
+			 *
+			 * @return True if the key is stored in this table.
+			 */
+			template<typename InLookupType>
+			Bool Contains(const InLookupType& key) const
+			{
+				return this->FindIndex(key) != INVALID_INDEX;
+			}
+
+		public:
+			/**
+			 * @brief Removes the element with the specified key from this table.
+			 *
+			 * @param[in] key The key of the element to remove.
+			 *
+			 * @return True if the key was found and its element removed.
+			 */
+			template<typename InLookupType>
+			Bool Remove(const InLookupType& key)
+			{
+				Size index = this->FindIndex(key);
+
+				if (index == INVALID_INDEX)
+					return false;
+
+				this->RemoveIndex(index);
+
+				return true;
+			}
+
+			/**
+			 * @brief Removes the element the specified iterator points to.
+			 *
+			 * Iterators to other elements stay valid, so elements can be removed
+			 * while iterating by advancing the iterator before removing.
+			 *
+			 * @param[in] itr The iterator pointing to the element to remove.
+			 */
+			Void Remove(Iterator itr)
+			{
+				this->RemoveIndex(static_cast<Size>(&(*itr) - this->m_slots));
+			}
+
+		public:
+			/**
+			 * @brief Requests that this table is able to store the specified
+			 * number of elements without rehashing.
+			 *
+			 * @param[in] count The minimum number of elements to store.
+			 */
+			Void Reserve(Size count)
+			{
+				if (count <= GetMaxLoad(this->m_capacity))
+					return;
+
+				Size capacity = this->m_capacity ? this->m_capacity : Group::SIZE;
+
+				while (count > GetMaxLoad(capacity))
+					capacity *= 2;
+
+				this->Rehash(capacity);
+			}
+
+			/**
+			 * @brief Removes all the elements from this table, its capacity is
+			 * kept.
+			 */
+			Void Clear(Void)
+			{
+				if (!this->m_capacity)
+					return;
+
+				if (this->m_count)
+				{
+					for (Size i = 0; i < this->m_capacity; i++)
+					{
+						if (this->m_ctrl[i] != Group::EMPTY)
+							Memory::Destruct(this->m_slots + i, 1);
+					}
+				}
+
+				Memory::MemorySet(this->m_ctrl, Group::EMPTY, this->m_capacity);
+				Memory::MemorySet(this->m_overflow, 0, this->m_capacity / Group::SIZE);
+
+				this->m_count = 0;
+			}
+		};
+	}
+}
+
+#endif // T_FLAT_HASH_TABLE_H
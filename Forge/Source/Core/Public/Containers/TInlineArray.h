@@ -0,0 +1,949 @@
+#ifndef T_INLINE_ARRAY_H
+#define T_INLINE_ARRAY_H
+
+#include <stdlib.h>
+#include <initializer_list>
+
+#include <Core/Public/Containers/AbstractList.h>
+
+#include "Core/Public/Memory/AllocatorPolicy.h"
+
+namespace Forge {
+	namespace Containers
+	{
+		/**
+		 * @brief A list container representing arrays that can change in size,
+		 * storing up to a number of elements inside the array itself.
+		 *
+		 * TInlineArray has the interface of TDynamicArray. Its first
+		 * InInlineCapacity elements are stored in a buffer embedded in the
+		 * array, so a short array allocates nothing and its elements sit next
+		 * to the object owning it. Once it grows past the buffer, the elements
+		 * are moved to storage allocated through the allocator policy, and
+		 * grow from there like a dynamic array. Shrinking to fit moves them
+		 * back into the buffer once they fit in it again.
+		 *
+		 * The elements are contiguous in either case. Moving an array that
+		 * stores its elements inline moves the elements one by one, so the
+		 * inline capacity is best kept small.
+		 *
+		 * @author Karim Hisham.
+		 */
+		template<typename InElementType, Size InInlineCapacity, typename InAllocatorPolicy = Memory::DefaultAllocatorPolicy>
+		class TInlineArray final : public AbstractList<InElementType>, private InAllocatorPolicy
+		{
+			static_assert(InInlineCapacity > 0, "Inline capacity must be at least one element.");
+
+		public:
+			using AllocatorType = InAllocatorPolicy;
+
+		public:
+			using ElementType         = InElementType;
+			using ElementTypePtr      = InElementType*;
+			using ElementTypeRef      = InElementType&;
+			using ElementTypeMoveRef  = InElementType&&;
+			using ConstElementType    = const InElementType;
+			using ConstElementTypePtr = const InElementType*;
+			using ConstElementTypeRef = const InElementType&;
+
+		private:
+			using SelfType         = TInlineArray<ElementType, InInlineCapacity, AllocatorType>;
+			using SelfTypePtr      = TInlineArray<ElementType, InInlineCapacity, AllocatorType>*;
+			using SelfTypeRef      = TInlineArray<ElementType, InInlineCapacity, AllocatorType>&;
+			using SelfTypeMoveRef  = TInlineArray<ElementType, InInlineCapacity, AllocatorType>&&;
+			using ConstSelfType    = const TInlineArray<ElementType, InInlineCapacity, AllocatorType>;
+			using ConstSelfTypePtr = const TInlineArray<ElementType, InInlineCapacity, AllocatorType>*;
+			using ConstSelfTypeRef = const TInlineArray<ElementType, InInlineCapacity, AllocatorType>&;
+
+		public:
+			static constexpr Size INLINE_CAPACITY = InInlineCapacity;
+
+		private:
+			enum { CAPACITY_ALIGNMENT = 2 };
+
+		private:
+			/// Points to the inline buffer while the elements fit in it.
+			ElementTypePtr m_mem_block;
+
+		private:
+			Size m_capacity;
+
+		private:
+			alignas(ElementType) Byte m_inline_block[InInlineCapacity * sizeof(ElementType)];
+
+		public:
+			struct Iterator
+			{
+			public:
+				using ElementType = InElementType;
+
+			private:
+				ElementTypePtr m_ptr;
+
+			public:
+				Iterator(Void)
+					: m_ptr(nullptr) {}
+
+				Iterator(ElementTypePtr ptr)
+					: m_ptr(ptr) {}
+
+			public:
+				Iterator(Iterator&& other)
+				{
+					*this = Move(other);
+				}
+				Iterator(const Iterator& other)
+				{
+					*this = other;
+				}
+
+			public:
+				~Iterator() = default;
+
+			public:
+				Iterator& operator =(Iterator&& other)
+				{
+					Memory::MemoryCopy(this, &other, sizeof(Iterator));
+
+					other.m_ptr = nullptr;
+
+					return *this;
+				}
+				Iterator& operator =(const Iterator& other)
+				{
+					Memory::MemoryCopy(this, const_cast<Iterator*>(&other), sizeof(Iterator));
+
+					return *this;
+				}
+
+			public:
+				Iterator operator +(Size inc)
+				{
+					return Iterator(this->m_ptr + inc);
+				}
+				Iterator operator -(Size inc)
+				{
+					return Iterator(this->m_ptr - inc);
+				}
+
+			public:
+				Iterator operator --(I32)
+				{
+					Iterator temp(this->m_ptr);
+
+					this->m_ptr--;
+
+					return temp;
+				}
+				Iterator operator --(Void)
+				{
+					this->m_ptr--;
+
+					return *this;
+				}
+
+			public:
+				Iterator operator ++(I32)
+				{
+					Iterator temp(this->m_ptr);
+
+					this->m_ptr++;
+
+					return temp;
+				}
+				Iterator operator ++(Void)
+				{
+					this->m_ptr++;
+
+					return *this;
+				}
+
+			public:
+				Size operator -(const Iterator& other)
+				{
+					return ((reinterpret_cast<U64>(this->m_ptr) - reinterpret_cast<U64>(other.m_ptr)) / sizeof(ElementType)) + 1;
+				}
+
+			public:
+				Bool operator ==(const Iterator& other)
+				{
+					return this->m_ptr == other.m_ptr;
+				}
+				Bool operator !=(const Iterator& other)
+				{
+					return this->m_ptr != other.m_ptr;
+				}
+
+			public:
+				ElementTypeRef operator *()
+				{
+					return *(this->m_ptr);
+				}
+
+			public:
+				ElementTypePtr operator ->()
+				{
+					return this->m_ptr;
+				}
+			};
+			struct ConstIterator
+			{
+			public:
+				using ElementType = InElementType;
+
+			private:
+				ElementTypePtr m_ptr;
+
+			public:
+				ConstIterator(Void)
+					: m_ptr(nullptr) {}
+
+				ConstIterator(ElementTypePtr ptr)
+					: m_ptr(ptr) {}
+
+			public:
+				ConstIterator(ConstIterator&& other)
+				{
+					*this = Move(other);
+				}
+				ConstIterator(const ConstIterator& other)
+				{
+					*this = other;
+				}
+
+			public:
+				~ConstIterator() = default;
+
+			public:
+				ConstIterator& operator =(ConstIterator&& other)
+				{
+					Memory::MemoryCopy(this, &other, sizeof(ConstIterator));
+
+					other.m_ptr = nullptr;
+
+					return *this;
+				}
+				ConstIterator& operator =(const ConstIterator& other)
+				{
+					Memory::MemoryCopy(this, const_cast<ConstIterator*>(&other), sizeof(ConstIterator));
+
+					return *this;
+				}
+
+			public:
+				ConstIterator operator +(Size inc)
+				{
+					return ConstIterator(this->m_ptr + inc);
+				}
+				ConstIterator operator -(Size inc)
+				{
+					return ConstIterator(this->m_ptr - inc);
+				}
+
+			public:
+				ConstIterator operator --(I32)
+				{
+					ConstIterator temp(this->m_ptr);
+
+					this->m_ptr--;
+
+					return temp;
+				}
+				ConstIterator operator --(Void)
+				{
+					this->m_ptr--;
+
+					return *this;
+				}
+
+			public:
+				ConstIterator operator ++(I32)
+				{
+					ConstIterator temp(this->m_ptr);
+
+					this->m_ptr++;
+
+					return temp;
+				}
+				ConstIterator operator ++(Void)
+				{
+					this->m_ptr++;
+
+					return *this;
+				}
+
+			public:
+				Size operator -(const ConstIterator& other)
+				{
+					return ((reinterpret_cast<Size>(this->m_ptr) - reinterpret_cast<Size>(other.m_ptr)) / sizeof(ElementType)) + 1;
+				}
+
+			public:
+				Bool operator ==(const ConstIterator& other)
+				{
+					return this->m_ptr == other.m_ptr;
+				}
+				Bool operator !=(const ConstIterator& other)
+				{
+					return this->m_ptr != other.m_ptr;
+				}
+
+			public:
+				ConstElementTypeRef operator *()
+				{
+					return *(this->m_ptr);
+				}
+
+			public:
+				ConstElementTypePtr operator ->()
+				{
+					return this->m_ptr;
+				}
+			};
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Constructs an empty inline array.
+			 */
+			TInlineArray(Void) 
+				: m_mem_block(this->GetInlineBlock()), m_capacity(InInlineCapacity), AbstractList<ElementType>(0, ~((Size)0)) {}
+
+			/**
+			 * @brief Allocator constructor.
+			 *
+			 * Constructs an empty inline array allocating through an allocator
+			 * once it outgrows its inline buffer.
+			 */
+			explicit TInlineArray(const AllocatorType& allocator)
+				: m_mem_block(this->GetInlineBlock()), m_capacity(InInlineCapacity), AbstractList<ElementType>(0, ~((Size)0)), AllocatorType(allocator) {}
+
+			/**
+			 * @brief Move element constructor.
+			 *
+			 * Constructs an inline array with a copy of an element.
+			 */
+			TInlineArray(ElementTypeMoveRef element, Size count, const AllocatorType& allocator = AllocatorType())
+				: m_mem_block(this->GetInlineBlock()), m_capacity(InInlineCapacity), AbstractList<ElementType>(0, ~((Size)0)), AllocatorType(allocator)
+			{
+				this->ReserveCapacity(count);
+
+				Memory::MoveConstruct(this->m_mem_block, Move(element), count);
+
+				this->m_count = count;
+			}
+
+			/**
+			 * @brief Copy element constructor.
+			 *
+			 * Constructs an inline array with a copy of an element.
+			 */
+			TInlineArray(ConstElementTypeRef element, Size count, const AllocatorType& allocator = AllocatorType())
+				: m_mem_block(this->GetInlineBlock()), m_capacity(InInlineCapacity), AbstractList<ElementType>(0, ~((Size)0)), AllocatorType(allocator)
+			{
+				this->ReserveCapacity(count);
+
+				Memory::CopyConstruct(this->m_mem_block, element, count);
+
+				this->m_count = count;
+			}
+
+			/**
+			 * @brief Initializer list constructor.
+			 *
+			 * Constructs an inline array with an initializer list.
+			 */
+			TInlineArray(std::initializer_list<ElementType> init_list, const AllocatorType& allocator = AllocatorType())
+				: m_mem_block(this->GetInlineBlock()), m_capacity(InInlineCapacity), AbstractList<ElementType>(0, ~((Size)0)), AllocatorType(allocator)
+			{
+				this->ReserveCapacity(init_list.size());
+
+				Memory::CopyConstructArray(this->m_mem_block, const_cast<ElementTypePtr>(init_list.begin()), init_list.size());
+
+				this->m_count = init_list.size();
+			}
+
+		public:
+			/**
+			 * @brief Move constructor.
+			 */
+			TInlineArray(SelfTypeMoveRef other)
+				: m_mem_block(this->GetInlineBlock()), m_capacity(InInlineCapacity), AbstractList<ElementType>(0, ~((Size)0))
+			{
+				*this = Move(other);
+			}
+
+			/**
+			 * @brief Copy constructor.
+			 *
+			 * The copy allocates through the allocator of the other array.
+			 */
+			TInlineArray(ConstSelfTypeRef other)
+				: m_mem_block(this->GetInlineBlock()), m_capacity(InInlineCapacity), AbstractList<ElementType>(0, ~((Size)0)), AllocatorType(other.GetAllocator())
+			{
+				*this = other;
+			}
+
+		public:	
+			/**
+			 * @brief Destructor.
+			 */
+			~TInlineArray(Void)
+			{
+				this->Clear();
+
+				this->ReleaseElements();
+			}
+
+		public:
+			/**
+			 * @brief Move assignment.
+			 *
+			 * The allocator is moved along with the storage it allocated. The
+			 * elements of an array stored inline are moved one by one.
+			 */
+			SelfTypeRef operator =(SelfTypeMoveRef other)
+			{
+				if (this == &other)
+					return *this;
+
+				this->Clear();
+				this->ReleaseElements();
+
+				this->GetAllocator() = Move(other.GetAllocator());
+
+				if (other.IsInline())
+				{
+					Memory::RelocateArray(this->m_mem_block, other.m_mem_block, other.m_count);
+				}
+				else
+				{
+					this->m_mem_block = other.m_mem_block;
+					this->m_capacity = other.m_capacity;
+
+					other.m_mem_block = other.GetInlineBlock();
+					other.m_capacity = InInlineCapacity;
+				}
+
+				this->m_count = other.m_count;
+				this->m_max_capacity = other.m_max_capacity;
+
+				other.m_count = 0;
+
+				return *this;
+			}
+
+			/**
+			 * @brief Copy assignment.
+			 *
+			 * The storage keeps being allocated through the allocator of this
+			 * array.
+			 */
+			SelfTypeRef operator =(ConstSelfTypeRef other)
+			{
+				if (this == &other)
+					return *this;
+
+				this->Clear();
+
+				this->ReserveCapacity(other.m_count);
+
+				Memory::CopyConstructArray(this->m_mem_block, other.m_mem_block, other.m_count);
+
+				this->m_count = other.m_count;
+				this->m_max_capacity = other.m_max_capacity;
+
+				return *this;
+			}
+		
+		private:
+			ElementTypePtr GetInlineBlock(Void) const
+			{
+				return reinterpret_cast<ElementTypePtr>(const_cast<Byte*>(this->m_inline_block));
+			}
+
+			ElementTypePtr AllocateElements(Size count)
+			{
+				return reinterpret_cast<ElementTypePtr>(this->GetAllocator().Allocate(count * sizeof(ElementType), alignof(ElementType)));
+			}
+
+			/// Frees the allocated storage if there is any, the elements must
+			/// have been destructed or relocated already.
+			Void ReleaseElements(Void)
+			{
+				if (this->IsInline())
+					return;
+
+				this->GetAllocator().Deallocate(this->m_mem_block);
+
+				this->m_mem_block = this->GetInlineBlock();
+				this->m_capacity = InInlineCapacity;
+			}
+
+			/// Elements leaving or entering the inline buffer are relocated one
+			/// by one, allocated trivially relocatable elements are carried over
+			/// by a single reallocation.
+			Void ReallocateElements(Size capacity)
+			{
+				if (capacity <= InInlineCapacity)
+				{
+					ElementTypePtr old_elements = this->m_mem_block;
+
+					this->m_mem_block = this->GetInlineBlock();
+
+					Memory::RelocateArray(this->m_mem_block, old_elements, this->m_count);
+
+					this->GetAllocator().Deallocate(old_elements);
+				}
+				else if (this->IsInline())
+				{
+					ElementTypePtr new_elements = this->AllocateElements(capacity);
+
+					Memory::RelocateArray(new_elements, this->m_mem_block, this->m_count);
+
+					this->m_mem_block = new_elements;
+				}
+				else
+					this->ReallocateElementsImpl(capacity, Common::TTraitInt<Common::TIsTriviallyRelocatable<ElementType>::Value>());
+			}
+			Void ReallocateElementsImpl(Size capacity, Common::TypeIsPod)
+			{
+				this->m_mem_block = reinterpret_cast<ElementTypePtr>(this->GetAllocator().Reallocate(this->m_mem_block,
+					this->m_capacity * sizeof(ElementType), capacity * sizeof(ElementType), alignof(ElementType)));
+			}
+			Void ReallocateElementsImpl(Size capacity, Common::TypeIsClass)
+			{
+				ElementTypePtr new_elements = this->AllocateElements(capacity);
+
+				Memory::RelocateArray(new_elements, this->m_mem_block, this->m_count);
+
+				this->GetAllocator().Deallocate(this->m_mem_block);
+
+				this->m_mem_block = new_elements;
+			}
+
+		public:
+			/**
+			 * @brief Gets the allocator policy this array allocates through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			AllocatorType& GetAllocator(Void)
+			{
+				return static_cast<AllocatorType&>(*this);
+			}
+
+			/**
+			 * @brief Gets the allocator policy this array allocates through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			const AllocatorType& GetAllocator(Void) const
+			{
+				return static_cast<const AllocatorType&>(*this);
+			}
+
+		public:
+			/**
+			 * @brief Checks whether the elements are stored in the inline
+			 * buffer.
+			 *
+			 * @return Bool true if the elements are stored inline.
+			 */
+			Bool IsInline(Void) const
+			{
+				return this->m_mem_block == this->GetInlineBlock();
+			}
+
+			/**
+			 * @brief Gets the number of elements this array can store without
+			 * allocating.
+			 *
+			 * @return Size storing the capacity of this array.
+			 */
+			Size GetCapacity(Void) const
+			{
+				return this->m_capacity;
+			}
+
+		public:
+			/**
+			 * @brief Element Accessor.
+			 */
+			ElementTypeRef operator [](Size index)
+			{
+				FORGE_ASSERT(index >= 0 && index < this->m_count, "Index is out of range.")
+
+				return *(this->m_mem_block + index);
+			}
+
+			/**
+			 * @brief Element Accessor.
+			 */
+			ConstElementTypeRef operator [](Size index) const
+			{
+				FORGE_ASSERT(index >= 0 && index < this->m_count, "Index is out of range.")
+
+				return *(this->m_mem_block + index);
+			}
+
+		public:
+			/**
+			 * @brief Returns an iterator pointing to the first element in this
+			 * collection.
+			 *
+			 * @return Iterator pointing to the first element.
+			 */
+			Iterator GetStartItr(Void)
+			{
+				return Iterator(this->m_mem_block);
+			}
+
+			/**
+			 * @brief Returns an iterator pointing to the past-end element in this
+			 * collection.
+			 *
+			 * @return Iterator pointing to the past-end element element.
+			 */
+			Iterator GetEndItr(Void)
+			{
+				return Iterator(this->m_mem_block + this->m_count);
+			}
+
+			/**
+			 * @brief Returns a const iterator pointing to the first element in this
+			 * collection.
+			 *
+			 * @return ConstIterator pointing to the first element.
+			 */
+			ConstIterator GetStartConstItr(Void) const
+			{
+				return ConstIterator(this->m_mem_block);
+			}
+
+			/**
+			 * @brief Returns a const iterator pointing to the past-end element in
+			 * this collection.
+			 *
+			 * @return ConstIterator pointing to the past-end element element.
+			 */
+			ConstIterator GetEndConstItr(Void) const
+			{
+				return ConstIterator(this->m_mem_block + this->m_count);
+			}
+
+		public:
+			/**
+			 * @brief Gets a direct pointer to the memory array managed by this
+			 * collection.
+			 *
+			 * Elements in the memory array are guranteed to be stored in contiguous
+			 * memory locations. This allows the pointer to be offsetted to access
+			 * different elements.
+			 *
+			 * @return ConstElementTypePtr storing address of the memory array.
+			 */
+			ConstElementTypePtr GetRawData() const override
+			{
+				return this->m_mem_block;
+			}
+
+			/**
+			 * @brief Retreives a reference to the element stored in the collection
+			 * at the specified index.
+			 *
+			 * @param[in] index The index to retreive the element stored at.
+			 *
+			 * @return ConstElementTypeRef storting the element stored at the
+			 * specified index.
+			 *
+			 * @throws IndexOutOfRangeExceotion if index is out of range.
+			 */
+			ConstElementTypeRef GetByIndex(Size index) const override
+			{
+				if (index >= this->m_count)
+					FORGE_EXCEPT(ExceptionType::FORGE_INDEX_OUT_RANGE)
+
+				return *(this->m_mem_block + index);
+			}
+
+		public:
+			/**
+			 * @brief Returns an array containing all the elements returned by this
+			 * collection's iterator.
+			 *
+			 * The length of the array is equal to the number of elements returned
+			 * by the iterator. If this collection makes any guarantees as to what
+			 * order its elements are returned by its iterator, this method must
+			 * return the elements in the same order. The returned array contains
+			 * deep copies of the elements.
+			 *
+			 * @return ElementTypePtr storing the address of the array or
+			 * nullptr if collection is empty.
+			 */
+			ElementTypePtr ToArray(Void) const override
+			{
+				if (!this->m_count)
+					return nullptr;
+
+				ElementTypePtr array_ptr = (ElementTypePtr)malloc(this->m_count * sizeof(ElementType));
+
+				Memory::CopyConstructArray(array_ptr, this->m_mem_block, this->m_count);
+
+				return array_ptr;
+			}
+
+			/**
+			 * @brief Returns an array containing all the elements returned by this
+			 * collection's iterator.
+			 *
+			 * The length of the array is equal to the number of elements returned
+			 * by the iterator. If this collection makes any guarantees as to what
+			 * order its elements are returned by its iterator, this method must
+			 * return the elements in the same order. The returned array contains
+			 * deep copies of the elements.
+			 *
+			 * @param[out] array_ptr The array to store this collection's elements.
+			 *
+			 * @return ElementTypePtr storing the address of the array or
+			 * nullptr if collection is empty.
+			 */
+			ElementTypePtr ToArray(ElementTypePtr array_ptr) const override
+			{
+				Memory::CopyConstructArray(array_ptr, this->m_mem_block, this->m_count);
+
+				return array_ptr;
+			}
+		
+		public:
+			/**
+			 * @brief Iterates through all the elements inside the collection and
+			 * performs the operation provided on each element.
+			 *
+			 * The operation is performed in the order of iteration, and is performed
+			 * until all elements have been processed or the operation throws an
+			 * exception.
+			 *
+			 * @param[in] function The function to perform on each element.
+			 */
+			Void ForEach(TDelegate<Void(ElementTypeRef)> function) override
+			{
+				for (Size i = 0; i < this->m_count; i++)
+					function.Invoke(*(this->m_mem_block + i));
+			}
+
+			/**
+			 * @brief Iterates through all the elements inside the collection and
+			 * performs the operation provided on each element.
+			 *
+			 * The operation is performed in the order of iteration, and is performed
+			 * until all elements have been processed or the operation throws an
+			 * exception.
+			 *
+			 * @param[in] function The function to perform on each element.
+			 */
+			Void ForEach(TDelegate<Void(ConstElementTypeRef)> function) const override
+			{
+				for (Size i = 0; i < this->m_count; i++)
+					function.Invoke(*(this->m_mem_block + i));
+			}
+
+		public:
+			/**
+			 * @brief Requests that this collection capacity is large enough
+			 * to contain the specified number of elements.
+			 * 
+			 * @param[in] capacity The minimum capacity of the inline array.
+			 */
+			Void ReserveCapacity(Size capacity)
+			{
+				if (capacity <= this->m_capacity)
+					return;
+
+				Size new_capacity;
+
+				new_capacity = this->m_capacity + (this->m_capacity / 2);
+				new_capacity = new_capacity > capacity ? new_capacity : capacity;
+				new_capacity = new_capacity < this->m_max_capacity ? new_capacity : this->m_max_capacity;
+				new_capacity = (new_capacity + (CAPACITY_ALIGNMENT - 1)) & ~(CAPACITY_ALIGNMENT - 1);
+			
+				this->ReallocateElements(new_capacity);
+
+				this->m_capacity = new_capacity;
+			}
+
+			/**
+			 * @brief Requests that this collection capacity is reduced to the
+			 * number of elements it contains, moving the elements back into the
+			 * inline buffer if they fit in it.
+			 */
+			Void ShrinkToFit(Void)
+			{
+				if (this->IsInline() || this->m_capacity == this->m_count)
+					return;
+
+				Size new_capacity = this->m_count > InInlineCapacity ? this->m_count : InInlineCapacity;
+
+				this->ReallocateElements(new_capacity);
+
+				this->m_capacity = new_capacity;
+			}
+
+		public:
+			/**
+			 * @brief Returns the index of the first occurence of the specified
+			 * element in this collection, or -1 if it does not contain the
+			 * element or it is empty.
+			 *
+			 * @param[in] element The element to search for the first occurence.
+			 *
+			 * @return Size storing the index of the first occurrence of the
+			 * specified element, or -1 if this collection does not contain the
+			 * element or it is empty.
+			 */
+			I64 FirstIndexOf(ConstElementTypeRef value) const override
+			{
+				for (Size i = 0; i < this->m_count; i++)
+				{
+					if (Memory::MemoryCompare(this->m_mem_block + i, &value, sizeof(ElementType)))
+						return i;
+				}
+
+				return -1;
+			}
+
+			/**
+			 * @brief Returns the index of the last occurence of the specified
+			 * element in this collection, or -1 if it does not contain the
+			 * element or it is empty.
+			 *
+			 * @param[in] element The element to search for the last occurence.
+			 *
+			 * @return Size storing the index of the last occurrence of the
+			 * specified element, or -1 if this collection does not contain the
+			 * element or it is empty.
+			 */
+			I64 LastIndexOf(ConstElementTypeRef value) const override
+			{
+				for (Size i = this->m_count; i > 0; i--)
+				{
+					if (Memory::MemoryCompare(this->m_mem_block + i - 1, &value, sizeof(ElementType)))
+						return i - 1;
+				}
+
+				return -1;
+			}
+
+		public:
+			/**
+			 * @brief Inserts the specified element in the specified index in this
+			 * collection.
+			 *
+			 * This function will increase this collection's count size by one and
+			 * shift all elements that preceed the newly inserted element.
+			 *
+			 * @param[in] index   The index to insert the element at.
+			 * @param[in] element The element to insert in this collection.
+			 *
+			 * @throw IndexOutOfRangeException if index to insert element is out
+			 * of range.
+			 *
+			 * @throw MemoryOutOfBoundsException if this collection's max capacity
+			 * has been reached.
+			 */
+			Void InsertAt(Size index, ElementTypeMoveRef element) override
+			{
+				if (index > this->m_count)
+					FORGE_EXCEPT(ExceptionType::FORGE_INDEX_OUT_RANGE)
+
+				if (this->m_count >= this->m_max_capacity)
+					FORGE_EXCEPT(ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS)
+
+				this->ReserveCapacity(this->m_count + 1);
+
+				Memory::RelocateArray(this->m_mem_block + index + 1, this->m_mem_block + index, this->m_count - index);
+				Memory::MoveConstruct(this->m_mem_block + index, Move(element), 1);
+
+				this->m_count++;
+			}
+
+			/**
+			 * @brief Inserts the specified element in the specified index in this
+			 * collection.
+			 *
+			 * This function will increase this collection's count size by one and
+			 * shift all elements that preceed the newly inserted element to the
+			 * right.
+			 *
+			 * @param[in] index   The index to insert the element at.
+			 * @param[in] element The element to insert in this collection.
+			 *
+			 * @throw IndexOutOfRangeException if index to insert element is out
+			 * of range.
+			 *
+			 * @throw MemoryOutOfBoundsException if this collection's max capacity
+			 * has been reached.
+			 */
+			Void InsertAt(Size index, ConstElementTypeRef element) override
+			{
+				if (index > this->m_count)
+					FORGE_EXCEPT(ExceptionType::FORGE_INDEX_OUT_RANGE)
+
+				if (this->m_count >= this->m_max_capacity)
+					FORGE_EXCEPT(ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS)
+
+				this->ReserveCapacity(this->m_count + 1);
+
+				Memory::RelocateArray(this->m_mem_block + index + 1, this->m_mem_block + index, this->m_count - index);
+				Memory::CopyConstruct(this->m_mem_block + index, element, 1);
+
+				this->m_count++;
+			}
+
+			/**
+			 * @brief Removes the specified element after the element in the
+			 * specified index in this collection.
+			 *
+			 * This function will decreases this collection's count by one and shift
+			 * all elements that preceed the removed element to the left.
+			 *
+			 * This function explicitly calls the destructor of the element
+			 * but does not deallocate the memory it was stored at.
+			 *
+			 * @param[in] index The numerical index to remove the element at.
+			 *
+			 * @throw IndexOutOfRangeException if index to insert element is out
+			 * of range.
+			 */
+			Void RemoveAt(Size index) override
+			{
+				if (index >= this->m_count)
+					FORGE_EXCEPT(ExceptionType::FORGE_INDEX_OUT_RANGE)
+
+				Memory::Destruct(this->m_mem_block + index, 1);
+				Memory::RelocateArray(this->m_mem_block + index, this->m_mem_block + index + 1, this->m_count - index - 1);
+
+				this->m_count--;
+			}
+
+		public:
+			/**
+			 * @brief Removes all the elements from this collection.
+			 *
+			 * The storage is kept, call ShrinkToFit to move back to the inline
+			 * buffer.
+			 */
+			Void Clear(Void) override
+			{
+				if (!this->m_count)
+					return;
+
+				Memory::Destruct(this->m_mem_block, this->m_count);
+
+				this->m_count = 0;
+			}
+		};
+	}
+}
+
+#endif // T_INLINE_ARRAY_H
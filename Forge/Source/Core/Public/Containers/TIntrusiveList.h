@@ -0,0 +1,605 @@
+#ifndef T_INTRUSIVE_LIST_H
+#define T_INTRUSIVE_LIST_H
+
+#include <utility>
+
+#include <Core/Public/Common/Common.h>
+
+#include "Core/Public/Debug/Debug.h"
+
+namespace Forge {
+	namespace Containers
+	{
+		/**
+		 * @brief Links embedded in an object so that it can be put in a
+		 * TIntrusiveList.
+		 *
+		 * An object has one hook per list it can be a member of at the same
+		 * time. Copying an object does not copy its memberships, the copy
+		 * starts unlinked. An object must be removed from its list before it is
+		 * destroyed.
+		 *
+		 * @author Karim Hisham
+		 */
+		class IntrusiveListHook
+		{
+		template<typename InElementType, IntrusiveListHook InElementType::*InHook>
+		friend class TIntrusiveList;
+
+		private:
+			IntrusiveListHook* m_prev;
+			IntrusiveListHook* m_next;
+
+		public:
+			IntrusiveListHook(Void)
+				: m_prev(nullptr), m_next(nullptr) {}
+
+			IntrusiveListHook(const IntrusiveListHook& other)
+				: m_prev(nullptr), m_next(nullptr) {}
+
+		public:
+			~IntrusiveListHook()
+			{
+				FORGE_ASSERT(!this->IsLinked(), "Object is destroyed while still in a list.")
+			}
+
+		public:
+			IntrusiveListHook& operator =(const IntrusiveListHook& other)
+			{
+				return *this;
+			}
+
+		public:
+			/**
+			 * @brief Checks whether the object is in a list through this hook.
+			 *
+			 * @return Bool true if the object is in a list.
+			 */
+			Bool IsLinked(Void) const;
+		};
+
+		FORGE_FORCE_INLINE Bool IntrusiveListHook::IsLinked(Void) const { return m_next != nullptr; }
+
+		/**
+		 * @brief Doubly linked list of objects that embed their own links.
+		 *
+		 * The list does not own nor allocate anything, the links are an
+		 * IntrusiveListHook member of the objects selected by InHook. Inserting
+		 * and removing an object is O(1) and never allocates, and an object is
+		 * removed from its list given only a reference to it, without searching
+		 * for it. An object with several hooks can be in several lists at once
+		 * at no extra cost, which suits least recently used lists, dirty object
+		 * lists and free lists.
+		 *
+		 * An object can only be in one list per hook at a time, and must stay
+		 * at the same address while in a list.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InElementType, IntrusiveListHook InElementType::*InHook>
+		class TIntrusiveList
+		{
+		public:
+			using ElementType         = InElementType;
+			using ElementTypePtr      = InElementType*;
+			using ElementTypeRef      = InElementType&;
+			using ConstElementType    = const InElementType;
+			using ConstElementTypePtr = const InElementType*;
+			using ConstElementTypeRef = const InElementType&;
+
+		private:
+			using SelfType         = TIntrusiveList<ElementType, InHook>;
+			using SelfTypeRef      = TIntrusiveList<ElementType, InHook>&;
+			using ConstSelfTypeRef = const TIntrusiveList<ElementType, InHook>&;
+
+		public:
+			struct Iterator
+			{
+			private:
+				IntrusiveListHook* m_hook;
+
+			public:
+				Iterator(Void)
+					: m_hook(nullptr) {}
+
+				Iterator(IntrusiveListHook* hook)
+					: m_hook(hook) {}
+
+			public:
+				Iterator operator --(I32)
+				{
+					Iterator temp(this->m_hook);
+
+					this->m_hook = this->m_hook->m_prev;
+
+					return temp;
+				}
+				Iterator operator --(Void)
+				{
+					this->m_hook = this->m_hook->m_prev;
+
+					return *this;
+				}
+
+			public:
+				Iterator operator ++(I32)
+				{
+					Iterator temp(this->m_hook);
+
+					this->m_hook = this->m_hook->m_next;
+
+					return temp;
+				}
+				Iterator operator ++(Void)
+				{
+					this->m_hook = this->m_hook->m_next;
+
+					return *this;
+				}
+
+			public:
+				Bool operator ==(const Iterator& other)
+				{
+					return this->m_hook == other.m_hook;
+				}
+				Bool operator !=(const Iterator& other)
+				{
+					return this->m_hook != other.m_hook;
+				}
+
+			public:
+				ElementTypeRef operator *()
+				{
+					return *SelfType::GetElement(this->m_hook);
+				}
+
+			public:
+				ElementTypePtr operator ->()
+				{
+					return SelfType::GetElement(this->m_hook);
+				}
+			};
+			struct ConstIterator
+			{
+			private:
+				const IntrusiveListHook* m_hook;
+
+			public:
+				ConstIterator(Void)
+					: m_hook(nullptr) {}
+
+				ConstIterator(const IntrusiveListHook* hook)
+					: m_hook(hook) {}
+
+			public:
+				ConstIterator operator --(I32)
+				{
+					ConstIterator temp(this->m_hook);
+
+					this->m_hook = this->m_hook->m_prev;
+
+					return temp;
+				}
+				ConstIterator operator --(Void)
+				{
+					this->m_hook = this->m_hook->m_prev;
+
+					return *this;
+				}
+
+			public:
+				ConstIterator operator ++(I32)
+				{
+					ConstIterator temp(this->m_hook);
+
+					this->m_hook = this->m_hook->m_next;
+
+					return temp;
+				}
+				ConstIterator operator ++(Void)
+				{
+					this->m_hook = this->m_hook->m_next;
+
+					return *this;
+				}
+
+			public:
+				Bool operator ==(const ConstIterator& other)
+				{
+					return this->m_hook == other.m_hook;
+				}
+				Bool operator !=(const ConstIterator& other)
+				{
+					return this->m_hook != other.m_hook;
+				}
+
+			public:
+				ConstElementTypeRef operator *()
+				{
+					return *SelfType::GetElement(const_cast<IntrusiveListHook*>(this->m_hook));
+				}
+
+			public:
+				ConstElementTypePtr operator ->()
+				{
+					return SelfType::GetElement(const_cast<IntrusiveListHook*>(this->m_hook));
+				}
+			};
+
+		private:
+			/// Sentinel of the circular chain of hooks, its next hook is the
+			/// front of the list and its previous hook the back.
+			IntrusiveListHook m_root;
+
+			Size m_count;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Constructs an empty intrusive list.
+			 */
+			TIntrusiveList(Void)
+				: m_count(0)
+			{
+				this->m_root.m_prev = this->m_root.m_next = &this->m_root;
+			}
+
+			/**
+			 * @brief Move constructor.
+			 *
+			 * The objects of the other list are moved to this list.
+			 */
+			TIntrusiveList(SelfType&& other)
+				: m_count(0)
+			{
+				this->m_root.m_prev = this->m_root.m_next = &this->m_root;
+
+				*this = std::move(other);
+			}
+
+			TIntrusiveList(ConstSelfTypeRef other) = delete;
+
+		public:
+			/**
+			 * @brief Destructor.
+			 *
+			 * Unlinks the objects in the list, the objects themselves are left
+			 * untouched.
+			 */
+			~TIntrusiveList()
+			{
+				this->Clear();
+
+				this->m_root.m_prev = this->m_root.m_next = nullptr;
+			}
+
+		public:
+			/**
+			 * @brief Move assignment operator.
+			 *
+			 * Unlinks the objects in this list and moves the objects of the
+			 * other list to it.
+			 */
+			SelfTypeRef operator =(SelfType&& other)
+			{
+				if (this == &other)
+					return *this;
+
+				this->Clear();
+
+				if (other.IsEmpty())
+					return *this;
+
+				this->m_root.m_next = other.m_root.m_next;
+				this->m_root.m_prev = other.m_root.m_prev;
+				this->m_root.m_next->m_prev = this->m_root.m_prev->m_next = &this->m_root;
+				this->m_count = other.m_count;
+
+				other.m_root.m_prev = other.m_root.m_next = &other.m_root;
+				other.m_count = 0;
+
+				return *this;
+			}
+
+			SelfTypeRef operator =(ConstSelfTypeRef other) = delete;
+
+		private:
+			static IntrusiveListHook* GetHook(ElementTypeRef element)
+			{
+				return &(element.*InHook);
+			}
+
+			static ElementTypePtr GetElement(IntrusiveListHook* hook)
+			{
+				// The offset of the hook is taken on a dummy address that is
+				// suitably aligned, the object at it is never accessed.
+				ElementTypePtr dummy = reinterpret_cast<ElementTypePtr>(alignof(ElementType) * 16);
+				Size offset = reinterpret_cast<Byte*>(&(dummy->*InHook)) - reinterpret_cast<Byte*>(dummy);
+
+				return reinterpret_cast<ElementTypePtr>(reinterpret_cast<Byte*>(hook) - offset);
+			}
+
+			Void Link(IntrusiveListHook* hook, IntrusiveListHook* next_hook)
+			{
+				FORGE_ASSERT(!hook->IsLinked(), "Object is already in a list.")
+
+				hook->m_next = next_hook;
+				hook->m_prev = next_hook->m_prev;
+				next_hook->m_prev->m_next = hook;
+				next_hook->m_prev = hook;
+
+				this->m_count++;
+			}
+
+			Void Unlink(IntrusiveListHook* hook)
+			{
+				FORGE_ASSERT(hook->IsLinked(), "Object is not in a list.")
+
+				hook->m_prev->m_next = hook->m_next;
+				hook->m_next->m_prev = hook->m_prev;
+				hook->m_prev = hook->m_next = nullptr;
+
+				this->m_count--;
+			}
+
+		public:
+			/**
+			 * @brief Gets the number of objects in this list.
+			 *
+			 * @return Size storing the number of objects.
+			 */
+			Size GetCount(Void) const
+			{
+				return this->m_count;
+			}
+
+			/**
+			 * @brief Checks whether this list is empty.
+			 *
+			 * @return Bool true if this list is empty.
+			 */
+			Bool IsEmpty(Void) const
+			{
+				return this->m_count == 0;
+			}
+
+			/**
+			 * @brief Checks whether an object is in a list through the hook of
+			 * this list type.
+			 *
+			 * @param[in] element The object to check.
+			 *
+			 * @return Bool true if the object is in a list.
+			 */
+			static Bool IsLinked(ConstElementTypeRef element)
+			{
+				return (element.*InHook).IsLinked();
+			}
+
+		public:
+			/**
+			 * @brief Returns an iterator pointing to the first object in this
+			 * list.
+			 *
+			 * @return Iterator pointing to the first object.
+			 */
+			Iterator GetStartItr(Void)
+			{
+				return Iterator(this->m_root.m_next);
+			}
+
+			/**
+			 * @brief Returns an iterator pointing past the last object in this
+			 * list.
+			 *
+			 * @return Iterator pointing past the last object.
+			 */
+			Iterator GetEndItr(Void)
+			{
+				return Iterator(&this->m_root);
+			}
+
+			/**
+			 * @brief Returns a const iterator pointing to the first object in
+			 * this list.
+			 *
+			 * @return ConstIterator pointing to the first object.
+			 */
+			ConstIterator GetStartConstItr(Void) const
+			{
+				return ConstIterator(this->m_root.m_next);
+			}
+
+			/**
+			 * @brief Returns a const iterator pointing past the last object in
+			 * this list.
+			 *
+			 * @return ConstIterator pointing past the last object.
+			 */
+			ConstIterator GetEndConstItr(Void) const
+			{
+				return ConstIterator(&this->m_root);
+			}
+
+		public:
+			/**
+			 * @brief Gets the first object in this list.
+			 *
+			 * @return ElementTypeRef storing the first object.
+			 */
+			ElementTypeRef PeekFront(Void)
+			{
+				FORGE_ASSERT(this->m_count, "Intrusive list is empty.")
+
+				return *GetElement(this->m_root.m_next);
+			}
+
+			/**
+			 * @brief Gets the last object in this list.
+			 *
+			 * @return ElementTypeRef storing the last object.
+			 */
+			ElementTypeRef PeekBack(Void)
+			{
+				FORGE_ASSERT(this->m_count, "Intrusive list is empty.")
+
+				return *GetElement(this->m_root.m_prev);
+			}
+
+			/**
+			 * @brief Gets the object after an object in this list.
+			 *
+			 * @param[in] element The object in this list.
+			 *
+			 * @return ElementTypePtr storing the next object, or nullptr if the
+			 * object is the last one.
+			 */
+			ElementTypePtr GetNext(ElementTypeRef element)
+			{
+				IntrusiveListHook* next_hook = GetHook(element)->m_next;
+
+				return next_hook == &this->m_root ? nullptr : GetElement(next_hook);
+			}
+
+			/**
+			 * @brief Gets the object before an object in this list.
+			 *
+			 * @param[in] element The object in this list.
+			 *
+			 * @return ElementTypePtr storing the previous object, or nullptr if
+			 * the object is the first one.
+			 */
+			ElementTypePtr GetPrev(ElementTypeRef element)
+			{
+				IntrusiveListHook* prev_hook = GetHook(element)->m_prev;
+
+				return prev_hook == &this->m_root ? nullptr : GetElement(prev_hook);
+			}
+
+		public:
+			/**
+			 * @brief Inserts an object at the back of this list.
+			 *
+			 * @param[in] element The object to insert, not in a list.
+			 */
+			Void PushBack(ElementTypeRef element)
+			{
+				this->Link(GetHook(element), &this->m_root);
+			}
+
+			/**
+			 * @brief Inserts an object at the front of this list.
+			 *
+			 * @param[in] element The object to insert, not in a list.
+			 */
+			Void PushFront(ElementTypeRef element)
+			{
+				this->Link(GetHook(element), this->m_root.m_next);
+			}
+
+			/**
+			 * @brief Inserts an object before an object in this list.
+			 *
+			 * @param[in] position The object in this list to insert before.
+			 * @param[in] element  The object to insert, not in a list.
+			 */
+			Void InsertBefore(ElementTypeRef position, ElementTypeRef element)
+			{
+				this->Link(GetHook(element), GetHook(position));
+			}
+
+			/**
+			 * @brief Inserts an object after an object in this list.
+			 *
+			 * @param[in] position The object in this list to insert after.
+			 * @param[in] element  The object to insert, not in a list.
+			 */
+			Void InsertAfter(ElementTypeRef position, ElementTypeRef element)
+			{
+				this->Link(GetHook(element), GetHook(position)->m_next);
+			}
+
+		public:
+			/**
+			 * @brief Removes the first object from this list.
+			 */
+			Void PopFront(Void)
+			{
+				FORGE_ASSERT(this->m_count, "Intrusive list is empty.")
+
+				this->Unlink(this->m_root.m_next);
+			}
+
+			/**
+			 * @brief Removes the last object from this list.
+			 */
+			Void PopBack(Void)
+			{
+				FORGE_ASSERT(this->m_count, "Intrusive list is empty.")
+
+				this->Unlink(this->m_root.m_prev);
+			}
+
+			/**
+			 * @brief Removes an object from this list.
+			 *
+			 * @param[in] element The object to remove, must be in this list.
+			 */
+			Void Remove(ElementTypeRef element)
+			{
+				this->Unlink(GetHook(element));
+			}
+
+		public:
+			/**
+			 * @brief Moves an object in this list to its front, like touching an
+			 * entry of a least recently used list.
+			 *
+			 * @param[in] element The object to move, must be in this list.
+			 */
+			Void MoveToFront(ElementTypeRef element)
+			{
+				IntrusiveListHook* hook = GetHook(element);
+
+				this->Unlink(hook);
+				this->Link(hook, this->m_root.m_next);
+			}
+
+			/**
+			 * @brief Moves an object in this list to its back.
+			 *
+			 * @param[in] element The object to move, must be in this list.
+			 */
+			Void MoveToBack(ElementTypeRef element)
+			{
+				IntrusiveListHook* hook = GetHook(element);
+
+				this->Unlink(hook);
+				this->Link(hook, &this->m_root);
+			}
+
+		public:
+			/**
+			 * @brief Removes all the objects from this list.
+			 */
+			Void Clear(Void)
+			{
+				IntrusiveListHook* hook = this->m_root.m_next;
+
+				while (hook != &this->m_root)
+				{
+					IntrusiveListHook* next_hook = hook->m_next;
+
+					hook->m_prev = hook->m_next = nullptr;
+					hook = next_hook;
+				}
+
+				this->m_root.m_prev = this->m_root.m_next = &this->m_root;
+				this->m_count = 0;
+			}
+		};
+	}
+}
+
+#endif // T_INTRUSIVE_LIST_H
@@ -1,6 +1,7 @@
 #ifndef T_LINKED_LIST_H
 #define T_LINKED_LIST_H
 
+#include <new>
 #include <utility>
 #include <stdlib.h>
 #include <initializer_list>
@@ -11,13 +12,17 @@
 #include "Core/Public/Common/PreprocessorUtilities.h"
 
 #include "Core/Public/Memory/MemoryUtilities.h"
+#include "Core/Public/Memory/AllocatorPolicy.h"
 
 namespace Forge {
 	namespace Containers
 	{
-		template<typename InElementType>
-		class TLinkedList : public AbstractList<InElementType>
+		template<typename InElementType, typename InAllocatorPolicy = Memory::DefaultAllocatorPolicy>
+		class TLinkedList : public AbstractList<InElementType>, private InAllocatorPolicy
 		{
+		public:
+			using AllocatorType = InAllocatorPolicy;
+
 		private:
 			using ElementType         = InElementType;
 			using ElementTypeRef      = InElementType&;
@@ -27,12 +32,12 @@ namespace Forge {
 			using ConstElementTypePtr = const InElementType*;
 
 		private:
-			using SelfType         = TLinkedList<ElementType>;
-			using SelfTypeRef      = TLinkedList<ElementType>&;
-			using SelfTypePtr      = TLinkedList<ElementType>*;
-			using ConstSelfType    = const TLinkedList<ElementType>;
-			using ConstSelfTypeRef = const TLinkedList<ElementType>&;
-			using ConstSelfTypePtr = const TLinkedList<ElementType>*;
+			using SelfType         = TLinkedList<ElementType, AllocatorType>;
+			using SelfTypeRef      = TLinkedList<ElementType, AllocatorType>&;
+			using SelfTypePtr      = TLinkedList<ElementType, AllocatorType>*;
+			using ConstSelfType    = const TLinkedList<ElementType, AllocatorType>;
+			using ConstSelfTypeRef = const TLinkedList<ElementType, AllocatorType>&;
+			using ConstSelfTypePtr = const TLinkedList<ElementType, AllocatorType>*;
 
 		private:
 			struct EntryNode
@@ -256,13 +261,22 @@ namespace Forge {
 			TLinkedList(void)
 				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0)) {}
 
+			/**
+			 * @brief Allocator constructor.
+			 *
+			 * Constructs an empty linked list allocating its nodes through an
+			 * allocator.
+			 */
+			explicit TLinkedList(const AllocatorType& allocator)
+				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0)), AllocatorType(allocator) {}
+
 			/**
 			 * @brief Move element constructor.
 			 *
 			 * Constructs a linked list with a copy of an element.
 			 */
-			TLinkedList(ElementType&& element, Size count)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
+			TLinkedList(ElementType&& element, Size count, const AllocatorType& allocator = AllocatorType())
+				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0)), AllocatorType(allocator)
 			{
 				while (count > this->m_count)
 					this->PushBack(std::move(element));
@@ -273,8 +287,8 @@ namespace Forge {
 			 *
 			 * Constructs a linked list with a copy of an element.
 			 */
-			TLinkedList(ConstElementTypeRef element, Size count)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
+			TLinkedList(ConstElementTypeRef element, Size count, const AllocatorType& allocator = AllocatorType())
+				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0)), AllocatorType(allocator)
 			{
 				while (count > this->m_count)
 					this->PushBack(element);
@@ -285,8 +299,8 @@ namespace Forge {
 			 *
 			 * Constructs a linked list with an initializer list.
 			 */
-			TLinkedList(std::initializer_list<ElementType> init_list)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
+			TLinkedList(std::initializer_list<ElementType> init_list, const AllocatorType& allocator = AllocatorType())
+				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0)), AllocatorType(allocator)
 			{
 				ConstElementTypePtr ptr = init_list.begin();
 
@@ -306,9 +320,12 @@ namespace Forge {
 
 			/**
 			 * @brief Copy constructor.
+			 *
+			 * The copy allocates its nodes through the allocator of the other
+			 * list.
 			 */
 			TLinkedList(ConstSelfTypeRef other)
-				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0))
+				: m_head(nullptr), m_tail(nullptr), AbstractList<ElementType>(0, ~((Size)0)), AllocatorType(other.GetAllocator())
 			{
 				*this = other;
 			}
@@ -322,15 +339,85 @@ namespace Forge {
 				this->Clear();
 			}
 
+		private:
+			template<typename... InArgs>
+			EntryNode* AllocateNode(InArgs&&... args)
+			{
+				return new (this->GetAllocator().Allocate(sizeof(EntryNode), alignof(EntryNode))) EntryNode(std::forward<InArgs>(args)...);
+			}
+
+			Void DeallocateNode(EntryNode* node)
+			{
+				node->~EntryNode();
+
+				this->GetAllocator().Deallocate(node);
+			}
+
+			/**
+			 * @brief Gets the node at an index, walking from whichever end of
+			 * the list is closer.
+			 */
+			EntryNode* GetNode(Size index) const
+			{
+				EntryNode* curr_node;
+
+				if (index < this->m_count / 2)
+				{
+					curr_node = this->m_head;
+
+					while (index-- > 0)
+						curr_node = curr_node->m_next;
+				}
+				else
+				{
+					curr_node = this->m_tail;
+
+					for (Size i = this->m_count - 1; i > index; i--)
+						curr_node = curr_node->m_prev;
+				}
+
+				return curr_node;
+			}
+
+		public:
+			/**
+			 * @brief Gets the allocator policy this list allocates its nodes
+			 * through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			AllocatorType& GetAllocator(void)
+			{
+				return static_cast<AllocatorType&>(*this);
+			}
+
+			/**
+			 * @brief Gets the allocator policy this list allocates its nodes
+			 * through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			const AllocatorType& GetAllocator(void) const
+			{
+				return static_cast<const AllocatorType&>(*this);
+			}
+
 		public:
 			/**
 			 * @brief Move assignment operator.
 			 */
 			SelfTypeRef operator =(SelfType&& other)
 			{
+				if (this == &other)
+					return *this;
+
 				this->Clear();
 
-				Memory::MemoryCopy(this, &other, sizeof(SelfType));
+				this->GetAllocator() = std::move(other.GetAllocator());
+
+				this->m_head = other.m_head;
+				this->m_tail = other.m_tail;
+				this->m_count = other.m_count;
 
 				other.m_head = other.m_tail = nullptr;
 				other.m_count = 0;
@@ -385,7 +472,7 @@ namespace Forge {
 			 */
 			Iterator GetEndItr(void)
 			{
-				return Iterator(this->m_tail->m_next);
+				return Iterator(nullptr);
 			}
 
 			/**
@@ -407,7 +494,7 @@ namespace Forge {
 			 */
 			ConstIterator GetEndConstItr(void) const
 			{
-				return ConstIterator(this->m_tail->m_next);
+				return ConstIterator(nullptr);
 			}
 
 		public:
@@ -432,12 +519,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* curr_node = this->m_head;
-
-				while (curr_node->m_next && (index--) > 0)
-					curr_node = curr_node->m_next;
-
-				return curr_node->m_data;
+				return this->GetNode(index)->m_data;
 			}
 	 
 		public:
@@ -640,7 +722,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* elem_node = new EntryNode(std::move(element));
+				EntryNode* elem_node = this->AllocateNode(std::move(element));
 
 				if (!this->m_head || !this->m_tail)
 				{
@@ -660,10 +742,7 @@ namespace Forge {
 				}
 				else
 				{
-					EntryNode* next_node = this->m_head;
-
-					while (next_node->m_next && (index--) > 0)
-						next_node = next_node->m_next;
+					EntryNode* next_node = this->GetNode(index);
 
 					EntryNode* prev_node = next_node->m_prev;
 
@@ -705,7 +784,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* elem_node = new EntryNode(std::move(element));
+				EntryNode* elem_node = this->AllocateNode(std::move(element));
 
 				if (!this->m_head || !this->m_tail)
 				{
@@ -725,10 +804,7 @@ namespace Forge {
 				}
 				else
 				{
-					EntryNode* next_node = this->m_head;
-
-					while (next_node->m_next && (index--) > 0)
-						next_node = next_node->m_next;
+					EntryNode* next_node = this->GetNode(index);
 
 					EntryNode* prev_node = next_node->m_prev;
 
@@ -770,11 +846,7 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* curr_node = this->m_head;
-
-				while (curr_node->m_next && (index--) > 0)
-					curr_node = curr_node->m_next;
-
+				EntryNode* curr_node = this->GetNode(index);
 				EntryNode* next_node = curr_node->m_next;
 				EntryNode* prev_node = curr_node->m_prev;
 
@@ -798,7 +870,7 @@ namespace Forge {
 					next_node->m_prev = prev_node;
 				}
 
-				free(curr_node);
+				this->DeallocateNode(curr_node);
 
 				this->m_count--;
 			}
@@ -817,6 +889,12 @@ namespace Forge {
 			}
 		};
 	}
+
+	namespace Common
+	{
+		template<typename InElementType, typename InAllocatorPolicy>
+		struct TIsTriviallyRelocatable<Containers::TLinkedList<InElementType, InAllocatorPolicy>> { enum { Value = TIsTriviallyRelocatable<InAllocatorPolicy>::Value }; };
+	}
 }
 
 #endif // T_LINKED_LIST_H
@@ -0,0 +1,367 @@
+#ifndef T_OBJECT_POOL_H
+#define T_OBJECT_POOL_H
+
+#include <utility>
+
+#include <Core/Public/Common/Common.h>
+
+#include "Core/Public/Debug/Debug.h"
+#include "Core/Public/Memory/AllocatorPolicy.h"
+
+#include "Core/Public/Algorithm/GeneralUtilities.h"
+
+#include "Core/Public/Containers/TDynamicArray.h"
+
+namespace Forge {
+	namespace Containers
+	{
+		/**
+		 * @brief Refers to an object of a TObjectPool by the index of its slot
+		 * and the generation of the slot when the object was created.
+		 *
+		 * A 64-bit handle splits into a 32-bit index and generation, a 32-bit
+		 * handle into a 20-bit index and a 12-bit generation. The value zero
+		 * is never handed out and is the null handle. Handles are plain
+		 * integers, so they can be copied, compared, hashed and serialized
+		 * freely.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InType, typename InHandleType = U64>
+		struct TObjectHandle
+		{
+			static_assert(sizeof(InHandleType) == 4 || sizeof(InHandleType) == 8, "Handles must be 32 or 64 bit wide");
+
+		public:
+			using ObjectType = InType;
+			using HandleType = InHandleType;
+
+		public:
+			enum : U32
+			{
+				INDEX_BITS      = sizeof(InHandleType) == 4 ? 20 : 32,
+				GENERATION_BITS = sizeof(InHandleType) * 8 - INDEX_BITS
+			};
+
+			static constexpr InHandleType INDEX_MASK      = (static_cast<InHandleType>(1) << INDEX_BITS) - 1;
+			static constexpr InHandleType GENERATION_MASK = static_cast<InHandleType>(~static_cast<InHandleType>(0)) >> INDEX_BITS;
+
+		public:
+			InHandleType m_value;
+
+		public:
+			constexpr TObjectHandle(Void)
+				: m_value(0) {}
+
+			constexpr explicit TObjectHandle(InHandleType value)
+				: m_value(value) {}
+
+			constexpr TObjectHandle(U32 index, U32 generation)
+				: m_value((static_cast<InHandleType>(generation) << INDEX_BITS) | static_cast<InHandleType>(index)) {}
+
+		public:
+			constexpr U32 GetIndex(Void) const { return static_cast<U32>(m_value & INDEX_MASK); }
+			constexpr U32 GetGeneration(Void) const { return static_cast<U32>(m_value >> INDEX_BITS); }
+
+			constexpr Bool IsNull(Void) const { return !m_value; }
+
+		public:
+			constexpr Bool operator ==(const TObjectHandle& other) const { return m_value == other.m_value; }
+			constexpr Bool operator !=(const TObjectHandle& other) const { return m_value != other.m_value; }
+		};
+
+		/**
+		 * @brief Owns objects of a type and hands out generational handles to
+		 * them instead of pointers.
+		 *
+		 * The objects are packed in a single contiguous array, so systems can
+		 * iterate every live object densely through GetData and GetCount.
+		 * Handles index a separate array of slots, each storing the position
+		 * of its object in the packed array and a generation that is bumped
+		 * whenever an object is created or destroyed in it, so it is odd
+		 * while the slot is in use. Resolving a handle therefore costs
+		 * two array lookups and a comparison, and a handle to a destroyed
+		 * object is detected instead of dangling. Slots of destroyed objects
+		 * are reused in last-in first-out order.
+		 *
+		 * Destroying an object moves the last object of the packed array into
+		 * its place, so pointers and references to objects are invalidated by
+		 * creating or destroying any object and must not be kept, keep the
+		 * handle instead. Once the generation of a slot wraps around a very
+		 * old handle could resolve again, after 2048 reuses of the slot for
+		 * 32-bit handles and 2^31 for 64-bit handles.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InElementType, typename InHandleType = U64, typename InAllocatorPolicy = Memory::DefaultAllocatorPolicy>
+		class TObjectPool
+		{
+		FORGE_CLASS_NONCOPYABLE(TObjectPool)
+
+		public:
+			using AllocatorType = InAllocatorPolicy;
+			using HandleType    = TObjectHandle<InElementType, InHandleType>;
+
+		public:
+			using ElementType         = InElementType;
+			using ElementTypePtr      = InElementType*;
+			using ElementTypeRef      = InElementType&;
+			using ElementTypeMoveRef  = InElementType&&;
+			using ConstElementType    = const InElementType;
+			using ConstElementTypePtr = const InElementType*;
+			using ConstElementTypeRef = const InElementType&;
+
+		private:
+			enum : U32 { INVALID_INDEX = ~static_cast<U32>(0) };
+
+		private:
+			struct Slot
+			{
+				/// Position of the object in the packed array, or the next free
+				/// slot while the slot is free.
+				U32 m_index;
+				U32 m_generation;
+			};
+
+		private:
+			TDynamicArray<ElementType, AllocatorType> m_objects;
+
+			/// Slot of every object of the packed array.
+			TDynamicArray<U32, AllocatorType> m_object_slots;
+
+			TDynamicArray<Slot, AllocatorType> m_slots;
+
+		private:
+			U32 m_free_slot;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Constructs an empty pool allocating through an allocator.
+			 */
+			explicit TObjectPool(const AllocatorType& allocator = AllocatorType())
+				: m_objects(allocator), m_object_slots(allocator), m_slots(allocator), m_free_slot(INVALID_INDEX) {}
+
+		private:
+			const Slot* FindSlot(HandleType handle) const
+			{
+				U32 index = handle.GetIndex();
+
+				if (index >= this->m_slots.GetCount())
+					return nullptr;
+
+				const Slot& slot = this->m_slots[index];
+
+				/// The generation is odd while the slot holds an object, a null
+				/// handle or a handle to a destroyed object never matches.
+				if (slot.m_generation != handle.GetGeneration() || !(slot.m_generation & 1))
+					return nullptr;
+
+				return &slot;
+			}
+
+		public:
+			/**
+			 * @brief Constructs an object in the pool.
+			 *
+			 * @param[in] args The arguments to construct the object with.
+			 *
+			 * @return HandleType storing the handle to the object.
+			 *
+			 * @throws InvalidOperationException if the pool has as many objects
+			 * as its handles can index.
+			 */
+			template<typename... InArgs>
+			HandleType Create(InArgs&&... args)
+			{
+				U32 slot_index = this->m_free_slot;
+
+				if (slot_index == INVALID_INDEX && this->m_slots.GetCount() > HandleType::INDEX_MASK)
+					FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Object pool is out of handles")
+
+				/// The bookkeeping arrays grow before the object is constructed, so
+				/// a throwing allocation or constructor leaves the pool unchanged
+				/// and nothing can throw once the object is in.
+				if (slot_index == INVALID_INDEX)
+					this->m_slots.ReserveCapacity(this->m_slots.GetCount() + 1);
+
+				this->m_object_slots.ReserveCapacity(this->m_object_slots.GetCount() + 1);
+
+				this->m_objects.PushBack(ElementType(std::forward<InArgs>(args)...));
+
+				if (slot_index == INVALID_INDEX)
+				{
+					slot_index = static_cast<U32>(this->m_slots.GetCount());
+
+					this->m_slots.PushBack(Slot{ INVALID_INDEX, 0 });
+				}
+
+				this->m_object_slots.PushBack(slot_index);
+
+				Slot& slot = this->m_slots[slot_index];
+
+				this->m_free_slot = slot.m_index;
+
+				slot.m_index = static_cast<U32>(this->m_objects.GetCount() - 1);
+				slot.m_generation = (slot.m_generation + 1) & HandleType::GENERATION_MASK;
+
+				return HandleType(slot_index, slot.m_generation);
+			}
+
+			/**
+			 * @brief Destroys the object of a handle, invalidating every handle
+			 * to it.
+			 *
+			 * @param[in] handle The handle to the object.
+			 *
+			 * @return True if the object was destroyed, false if the handle was
+			 * null or stale.
+			 */
+			Bool Destroy(HandleType handle)
+			{
+				if (!this->FindSlot(handle))
+					return false;
+
+				Slot& slot = this->m_slots[handle.GetIndex()];
+
+				U32 index = slot.m_index;
+				U32 last_index = static_cast<U32>(this->m_objects.GetCount() - 1);
+
+				/// The last object fills the hole, keeping the array packed.
+				if (index != last_index)
+				{
+					this->m_objects[index] = Algorithm::Move(this->m_objects[last_index]);
+					this->m_object_slots[index] = this->m_object_slots[last_index];
+
+					this->m_slots[this->m_object_slots[index]].m_index = index;
+				}
+
+				this->m_objects.PopBack();
+				this->m_object_slots.PopBack();
+
+				slot.m_generation = (slot.m_generation + 1) & HandleType::GENERATION_MASK;
+				slot.m_index = this->m_free_slot;
+
+				this->m_free_slot = handle.GetIndex();
+
+				return true;
+			}
+
+			/**
+			 * @brief Destroys every object, invalidating every handle.
+			 */
+			Void Clear(Void)
+			{
+				for (Size i = 0; i < this->m_object_slots.GetCount(); i++)
+				{
+					U32 slot_index = this->m_object_slots[i];
+
+					Slot& slot = this->m_slots[slot_index];
+
+					slot.m_generation = (slot.m_generation + 1) & HandleType::GENERATION_MASK;
+					slot.m_index = this->m_free_slot;
+
+					this->m_free_slot = slot_index;
+				}
+
+				this->m_objects.Clear();
+				this->m_object_slots.Clear();
+			}
+
+		public:
+			/**
+			 * @brief Checks whether a handle refers to a live object.
+			 *
+			 * @param[in] handle The handle to check.
+			 *
+			 * @return True if the object of the handle was not destroyed.
+			 */
+			Bool IsValid(HandleType handle) const
+			{
+				return this->FindSlot(handle) != nullptr;
+			}
+
+			/**
+			 * @brief Gets the object of a handle.
+			 *
+			 * @param[in] handle The handle to the object.
+			 *
+			 * @return ElementTypePtr storing the address of the object, or
+			 * nullptr if the handle is null or stale.
+			 */
+			ElementTypePtr Get(HandleType handle)
+			{
+				const Slot* slot = this->FindSlot(handle);
+
+				return slot ? &this->m_objects[slot->m_index] : nullptr;
+			}
+
+			/**
+			 * @brief Gets the object of a handle.
+			 *
+			 * @param[in] handle The handle to the object.
+			 *
+			 * @return ConstElementTypePtr storing the address of the object, or
+			 * nullptr if the handle is null or stale.
+			 */
+			ConstElementTypePtr Get(HandleType handle) const
+			{
+				const Slot* slot = this->FindSlot(handle);
+
+				return slot ? &this->m_objects[slot->m_index] : nullptr;
+			}
+
+		public:
+			/**
+			 * @brief Gets the number of live objects.
+			 *
+			 * @return Size storing the number of objects.
+			 */
+			Size GetCount(Void) const
+			{
+				return this->m_objects.GetCount();
+			}
+
+			/**
+			 * @brief Gets the packed array of live objects, in no particular
+			 * order.
+			 *
+			 * @return ElementTypePtr storing the address of the first object.
+			 */
+			ElementTypePtr GetData(Void)
+			{
+				return this->m_objects.GetCount() ? &this->m_objects[0] : nullptr;
+			}
+
+			/**
+			 * @brief Gets the packed array of live objects, in no particular
+			 * order.
+			 *
+			 * @return ConstElementTypePtr storing the address of the first object.
+			 */
+			ConstElementTypePtr GetData(Void) const
+			{
+				return this->m_objects.GetCount() ? &this->m_objects[0] : nullptr;
+			}
+
+			/**
+			 * @brief Gets the handle of an object of the packed array.
+			 *
+			 * @param[in] index The position of the object in the packed array.
+			 *
+			 * @return HandleType storing the handle to the object.
+			 */
+			HandleType GetHandle(Size index) const
+			{
+				U32 slot_index = this->m_object_slots[index];
+
+				return HandleType(slot_index, this->m_slots[slot_index].m_generation);
+			}
+		};
+
+		FORGE_TYPEDEF_TEMPLATE_DECL(TObjectPool)
+	}
+}
+
+#endif // T_OBJECT_POOL_H
@@ -0,0 +1,744 @@
+#ifndef T_SOA_ARRAY_H
+#define T_SOA_ARRAY_H
+
+#include <new>
+#include <utility>
+#include <type_traits>
+
+#include <Core/Public/Common/Common.h>
+
+#include "Core/Public/Debug/Debug.h"
+#include "Core/Public/Memory/AllocatorPolicy.h"
+#include "Core/Public/Memory/MemoryUtilities.h"
+
+#include "Core/Public/Types/TTuple.h"
+#include "Core/Public/Types/TMemoryRegion.h"
+
+#include "Core/Public/Algorithm/GeneralUtilities.h"
+
+namespace Forge {
+	namespace Containers
+	{
+		/**
+		 * @brief Array of records storing each field of the records in its own
+		 * contiguous column, a structure of arrays.
+		 *
+		 * A loop touching one field of every record only reads the column of
+		 * that field, rather than every field of every record as an array of
+		 * structs would. Each column starts on a COLUMN_ALIGNMENT boundary, so
+		 * it can be processed with aligned vector loads. All columns are kept
+		 * in a single allocation and grow together.
+		 *
+		 * Records are added, removed and swapped in every column in lockstep.
+		 * Accessing a whole record yields a tuple of references to its fields,
+		 * which is what the iterators point to as well.
+		 *
+		 * Growing the array moves the records and invalidates pointers and
+		 * iterators to them.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InAllocatorPolicy, typename... InTypes>
+		class TSoAArrayBase : private InAllocatorPolicy
+		{
+			static_assert(sizeof...(InTypes) > 0, "Structure of arrays needs at least one column.");
+
+			/// The block holding the columns grows with the capacity.
+			static_assert(!std::is_same<InAllocatorPolicy, Memory::NodePoolAllocatorPolicy>::value, "Node pools only serve node-based containers");
+
+		public:
+			using AllocatorType = InAllocatorPolicy;
+
+		public:
+			using ElementType         = TTuple<InTypes...>;
+			using ElementTypeRef      = TTuple<InTypes&...>;
+			using ConstElementTypeRef = TTuple<const InTypes&...>;
+
+		private:
+			using SelfType         = TSoAArrayBase<AllocatorType, InTypes...>;
+			using SelfTypeRef      = TSoAArrayBase<AllocatorType, InTypes...>&;
+			using ConstSelfTypeRef = const TSoAArrayBase<AllocatorType, InTypes...>&;
+
+			using ColumnsType = TTuple<InTypes*...>;
+			using Indices     = std::index_sequence_for<InTypes...>;
+
+		public:
+			/// Alignment of the start of every column, a cache line.
+			static constexpr Size COLUMN_ALIGNMENT = 64;
+
+			/// Number of columns, one per field.
+			static constexpr Size NUM_OF_COLUMNS = sizeof...(InTypes);
+
+		private:
+			enum { CAPACITY_ALIGNMENT = 2 };
+
+		public:
+			struct Iterator
+			{
+			private:
+				SelfType* m_array;
+				Size      m_index;
+
+			public:
+				Iterator(Void)
+					: m_array(nullptr), m_index(0) {}
+
+				Iterator(SelfType* array, Size index)
+					: m_array(array), m_index(index) {}
+
+			public:
+				Iterator operator --(I32)
+				{
+					Iterator temp(*this);
+
+					this->m_index--;
+
+					return temp;
+				}
+				Iterator operator --(Void)
+				{
+					this->m_index--;
+
+					return *this;
+				}
+
+			public:
+				Iterator operator ++(I32)
+				{
+					Iterator temp(*this);
+
+					this->m_index++;
+
+					return temp;
+				}
+				Iterator operator ++(Void)
+				{
+					this->m_index++;
+
+					return *this;
+				}
+
+			public:
+				Bool operator ==(const Iterator& other)
+				{
+					return this->m_index == other.m_index;
+				}
+				Bool operator !=(const Iterator& other)
+				{
+					return this->m_index != other.m_index;
+				}
+
+			public:
+				/// Returns a tuple of references to the fields of the record.
+				ElementTypeRef operator *()
+				{
+					return (*this->m_array)[this->m_index];
+				}
+
+			public:
+				Size GetIndex(Void) const
+				{
+					return this->m_index;
+				}
+			};
+			struct ConstIterator
+			{
+			private:
+				const SelfType* m_array;
+				Size            m_index;
+
+			public:
+				ConstIterator(Void)
+					: m_array(nullptr), m_index(0) {}
+
+				ConstIterator(const SelfType* array, Size index)
+					: m_array(array), m_index(index) {}
+
+			public:
+				ConstIterator operator --(I32)
+				{
+					ConstIterator temp(*this);
+
+					this->m_index--;
+
+					return temp;
+				}
+				ConstIterator operator --(Void)
+				{
+					this->m_index--;
+
+					return *this;
+				}
+
+			public:
+				ConstIterator operator ++(I32)
+				{
+					ConstIterator temp(*this);
+
+					this->m_index++;
+
+					return temp;
+				}
+				ConstIterator operator ++(Void)
+				{
+					this->m_index++;
+
+					return *this;
+				}
+
+			public:
+				Bool operator ==(const ConstIterator& other)
+				{
+					return this->m_index == other.m_index;
+				}
+				Bool operator !=(const ConstIterator& other)
+				{
+					return this->m_index != other.m_index;
+				}
+
+			public:
+				/// Returns a tuple of const references to the fields of the record.
+				ConstElementTypeRef operator *()
+				{
+					return (*this->m_array)[this->m_index];
+				}
+
+			public:
+				Size GetIndex(Void) const
+				{
+					return this->m_index;
+				}
+			};
+
+		private:
+			/// Start of each column inside the memory block.
+			ColumnsType m_columns;
+
+			/// The allocation holding every column, it is not aligned itself.
+			VoidPtr m_mem_block;
+
+		private:
+			Size m_count;
+			Size m_capacity;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Constructs an empty structure of arrays.
+			 */
+			TSoAArrayBase(Void)
+				: m_mem_block(nullptr), m_count(0), m_capacity(0) {}
+
+			/**
+			 * @brief Allocator constructor.
+			 *
+			 * Constructs an empty structure of arrays allocating through an
+			 * allocator.
+			 */
+			explicit TSoAArrayBase(const AllocatorType& allocator)
+				: m_mem_block(nullptr), m_count(0), m_capacity(0), AllocatorType(allocator) {}
+
+		public:
+			/**
+			 * @brief Move constructor.
+			 */
+			TSoAArrayBase(SelfType&& other)
+				: m_mem_block(nullptr), m_count(0), m_capacity(0)
+			{
+				*this = std::move(other);
+			}
+
+			/**
+			 * @brief Copy constructor.
+			 *
+			 * The copy allocates through the allocator of the other array.
+			 */
+			TSoAArrayBase(ConstSelfTypeRef other)
+				: m_mem_block(nullptr), m_count(0), m_capacity(0), AllocatorType(other.GetAllocator())
+			{
+				*this = other;
+			}
+
+		public:
+			/**
+			 * @brief Destructor.
+			 */
+			~TSoAArrayBase()
+			{
+				this->Clear();
+
+				if (this->m_mem_block)
+					this->GetAllocator().Deallocate(this->m_mem_block);
+			}
+
+		public:
+			/**
+			 * @brief Move assignment.
+			 *
+			 * The allocator is moved along with the storage it allocated.
+			 */
+			SelfTypeRef operator =(SelfType&& other)
+			{
+				if (this == &other)
+					return *this;
+
+				this->Clear();
+
+				if (this->m_mem_block)
+					this->GetAllocator().Deallocate(this->m_mem_block);
+
+				this->GetAllocator() = std::move(other.GetAllocator());
+
+				this->m_columns = other.m_columns;
+				this->m_mem_block = other.m_mem_block;
+				this->m_count = other.m_count;
+				this->m_capacity = other.m_capacity;
+
+				other.m_columns = ColumnsType();
+				other.m_mem_block = nullptr;
+				other.m_count = other.m_capacity = 0;
+
+				return *this;
+			}
+
+			/**
+			 * @brief Copy assignment.
+			 *
+			 * The storage keeps being allocated through the allocator of this
+			 * array.
+			 */
+			SelfTypeRef operator =(ConstSelfTypeRef other)
+			{
+				if (this == &other)
+					return *this;
+
+				this->Clear();
+				this->ReserveCapacity(other.m_count);
+
+				this->CopyColumns(other, Indices());
+
+				this->m_count = other.m_count;
+
+				return *this;
+			}
+
+		private:
+			template<typename InType>
+			static constexpr Size GetColumnSize(Size capacity)
+			{
+				return (capacity * sizeof(InType) + COLUMN_ALIGNMENT - 1) & ~(COLUMN_ALIGNMENT - 1);
+			}
+
+			template<Size... InIndices>
+			Void ReallocateColumns(Size capacity, std::index_sequence<InIndices...>)
+			{
+				static_assert(((alignof(InTypes) <= COLUMN_ALIGNMENT) && ...), "Field alignment is stricter than the column alignment.");
+
+				Size block_size = (GetColumnSize<InTypes>(capacity) + ...);
+
+				VoidPtr mem_block = this->GetAllocator().Allocate(block_size + COLUMN_ALIGNMENT, COLUMN_ALIGNMENT);
+
+				Byte* column = reinterpret_cast<Byte*>(Memory::AddAddress(mem_block, Memory::AlignAddressUpwardAdjustment(mem_block, COLUMN_ALIGNMENT)));
+
+				ColumnsType columns;
+
+				((columns.template Get<InIndices>() = reinterpret_cast<InTypes*>(column), column += GetColumnSize<InTypes>(capacity)), ...);
+
+				(Memory::RelocateArray(columns.template Get<InIndices>(), this->m_columns.template Get<InIndices>(), this->m_count), ...);
+
+				if (this->m_mem_block)
+					this->GetAllocator().Deallocate(this->m_mem_block);
+
+				this->m_columns = columns;
+				this->m_mem_block = mem_block;
+			}
+
+			template<Size... InIndices>
+			Void CopyColumns(ConstSelfTypeRef other, std::index_sequence<InIndices...>)
+			{
+				(Memory::CopyConstructArray(this->m_columns.template Get<InIndices>(), other.m_columns.template Get<InIndices>(), other.m_count), ...);
+			}
+
+			template<Size... InIndices, typename... InArgs>
+			Void ConstructRecord(Size index, std::index_sequence<InIndices...>, InArgs&&... args)
+			{
+				(new (this->m_columns.template Get<InIndices>() + index) InTypes(std::forward<InArgs>(args)), ...);
+			}
+
+			template<Size... InIndices>
+			Void DestructRecords(Size index, Size count, std::index_sequence<InIndices...>)
+			{
+				(Memory::Destruct(this->m_columns.template Get<InIndices>() + index, count), ...);
+			}
+
+			template<Size... InIndices>
+			Void RelocateRecords(Size dst_index, Size src_index, Size count, std::index_sequence<InIndices...>)
+			{
+				(Memory::RelocateArray(this->m_columns.template Get<InIndices>() + dst_index, this->m_columns.template Get<InIndices>() + src_index, count), ...);
+			}
+
+			template<Size... InIndices>
+			Void SwapRecords(Size lhs_index, Size rhs_index, std::index_sequence<InIndices...>)
+			{
+				(Algorithm::Swap(this->m_columns.template Get<InIndices>()[lhs_index], this->m_columns.template Get<InIndices>()[rhs_index]), ...);
+			}
+
+			template<Size... InIndices>
+			ElementTypeRef GetRecord(Size index, std::index_sequence<InIndices...>)
+			{
+				return ElementTypeRef(this->m_columns.template Get<InIndices>()[index]...);
+			}
+
+			template<Size... InIndices>
+			ConstElementTypeRef GetRecord(Size index, std::index_sequence<InIndices...>) const
+			{
+				return ConstElementTypeRef(this->m_columns.template Get<InIndices>()[index]...);
+			}
+
+			template<Size... InIndices>
+			Void PushBackRecord(const ElementType& element, std::index_sequence<InIndices...>)
+			{
+				this->PushBack(element.template Get<InIndices>()...);
+			}
+
+			template<Size... InIndices>
+			Void PushBackRecord(ElementType&& element, std::index_sequence<InIndices...>)
+			{
+				this->PushBack(std::move(element.template Get<InIndices>())...);
+			}
+
+		public:
+			/**
+			 * @brief Gets the allocator policy this array allocates through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			AllocatorType& GetAllocator(Void)
+			{
+				return static_cast<AllocatorType&>(*this);
+			}
+
+			/**
+			 * @brief Gets the allocator policy this array allocates through.
+			 *
+			 * @return AllocatorType storing the allocator policy.
+			 */
+			const AllocatorType& GetAllocator(Void) const
+			{
+				return static_cast<const AllocatorType&>(*this);
+			}
+
+		public:
+			/**
+			 * @brief Gets the number of records in this array.
+			 *
+			 * @return Size storing the number of records.
+			 */
+			Size GetCount(Void) const
+			{
+				return this->m_count;
+			}
+
+			/**
+			 * @brief Gets the number of records this array can store without
+			 * growing.
+			 *
+			 * @return Size storing the capacity of this array.
+			 */
+			Size GetCapacity(Void) const
+			{
+				return this->m_capacity;
+			}
+
+			/**
+			 * @brief Checks whether this array is empty.
+			 *
+			 * @return Bool true if this array is empty.
+			 */
+			Bool IsEmpty(Void) const
+			{
+				return this->m_count == 0;
+			}
+
+		public:
+			/**
+			 * @brief Record Accessor.
+			 *
+			 * @return ElementTypeRef storing a tuple of references to the fields
+			 * of the record.
+			 */
+			ElementTypeRef operator [](Size index)
+			{
+				FORGE_ASSERT(index < this->m_count, "Index is out of range.")
+
+				return this->GetRecord(index, Indices());
+			}
+
+			/**
+			 * @brief Record Accessor.
+			 *
+			 * @return ConstElementTypeRef storing a tuple of const references to
+			 * the fields of the record.
+			 */
+			ConstElementTypeRef operator [](Size index) const
+			{
+				FORGE_ASSERT(index < this->m_count, "Index is out of range.")
+
+				return this->GetRecord(index, Indices());
+			}
+
+			/**
+			 * @brief Gets a field of a record.
+			 *
+			 * @param[in] index The index of the record.
+			 *
+			 * @return Reference to the field in the column InColumn.
+			 */
+			template<Size InColumn>
+			typename TTupleElementType<InColumn, ElementType>::Type& Get(Size index)
+			{
+				FORGE_ASSERT(index < this->m_count, "Index is out of range.")
+
+				return this->m_columns.template Get<InColumn>()[index];
+			}
+
+			/**
+			 * @brief Gets a field of a record.
+			 *
+			 * @param[in] index The index of the record.
+			 *
+			 * @return Const reference to the field in the column InColumn.
+			 */
+			template<Size InColumn>
+			const typename TTupleElementType<InColumn, ElementType>::Type& Get(Size index) const
+			{
+				FORGE_ASSERT(index < this->m_count, "Index is out of range.")
+
+				return this->m_columns.template Get<InColumn>()[index];
+			}
+
+			/**
+			 * @brief Gets a column, the fields of every record contiguous in
+			 * memory and starting on a COLUMN_ALIGNMENT boundary.
+			 *
+			 * @return TMemoryRegion spanning the column.
+			 */
+			template<Size InColumn>
+			Common::TMemoryRegion<typename TTupleElementType<InColumn, ElementType>::Type> GetColumn(Void)
+			{
+				return Common::TMemoryRegion<typename TTupleElementType<InColumn, ElementType>::Type>(this->m_columns.template Get<InColumn>(), this->m_count);
+			}
+
+			/**
+			 * @brief Gets a column, the fields of every record contiguous in
+			 * memory and starting on a COLUMN_ALIGNMENT boundary.
+			 *
+			 * @return TMemoryRegion spanning the column.
+			 */
+			template<Size InColumn>
+			Common::TMemoryRegion<const typename TTupleElementType<InColumn, ElementType>::Type> GetColumn(Void) const
+			{
+				return Common::TMemoryRegion<const typename TTupleElementType<InColumn, ElementType>::Type>(this->m_columns.template Get<InColumn>(), this->m_count);
+			}
+
+		public:
+			/**
+			 * @brief Returns an iterator pointing to the first record.
+			 *
+			 * @return Iterator pointing to the first record.
+			 */
+			Iterator GetStartItr(Void)
+			{
+				return Iterator(this, 0);
+			}
+
+			/**
+			 * @brief Returns an iterator pointing past the last record.
+			 *
+			 * @return Iterator pointing past the last record.
+			 */
+			Iterator GetEndItr(Void)
+			{
+				return Iterator(this, this->m_count);
+			}
+
+			/**
+			 * @brief Returns a const iterator pointing to the first record.
+			 *
+			 * @return ConstIterator pointing to the first record.
+			 */
+			ConstIterator GetStartConstItr(Void) const
+			{
+				return ConstIterator(this, 0);
+			}
+
+			/**
+			 * @brief Returns a const iterator pointing past the last record.
+			 *
+			 * @return ConstIterator pointing past the last record.
+			 */
+			ConstIterator GetEndConstItr(Void) const
+			{
+				return ConstIterator(this, this->m_count);
+			}
+
+		public:
+			/**
+			 * @brief Requests that this array capacity is large enough to
+			 * contain the specified number of records.
+			 *
+			 * @param[in] capacity The minimum capacity of the array.
+			 */
+			Void ReserveCapacity(Size capacity)
+			{
+				if (capacity <= this->m_capacity)
+					return;
+
+				Size new_capacity;
+
+				new_capacity = this->m_capacity + (this->m_capacity / 2);
+				new_capacity = new_capacity > capacity ? new_capacity : capacity;
+				new_capacity = (new_capacity + (CAPACITY_ALIGNMENT - 1)) & ~(CAPACITY_ALIGNMENT - 1);
+
+				this->ReallocateColumns(new_capacity, Indices());
+
+				this->m_capacity = new_capacity;
+			}
+
+		public:
+			/**
+			 * @brief Appends a record, constructing each field from the argument
+			 * of the same index.
+			 *
+			 * @param[in] args One argument per column.
+			 */
+			template<typename... InArgs, typename = typename Common::TEnableIf<sizeof...(InArgs) == NUM_OF_COLUMNS && !Internal::TIsSingleTuple<InArgs...>::Value, Void>::Type>
+			Void PushBack(InArgs&&... args)
+			{
+				this->ReserveCapacity(this->m_count + 1);
+
+				this->ConstructRecord(this->m_count, Indices(), std::forward<InArgs>(args)...);
+
+				this->m_count++;
+			}
+
+			/**
+			 * @brief Appends a record copied from a tuple of its fields, records
+			 * of this or another array convert to it.
+			 *
+			 * @param[in] element The fields of the record.
+			 */
+			Void PushBack(const ElementType& element)
+			{
+				this->PushBackRecord(element, Indices());
+			}
+
+			/**
+			 * @brief Appends a record moved from a tuple of its fields.
+			 *
+			 * @param[in] element The fields of the record.
+			 */
+			Void PushBack(ElementType&& element)
+			{
+				this->PushBackRecord(std::move(element), Indices());
+			}
+
+			/**
+			 * @brief Removes the last record.
+			 */
+			Void PopBack(Void)
+			{
+				FORGE_ASSERT(this->m_count, "Structure of arrays is empty.")
+
+				this->m_count--;
+
+				this->DestructRecords(this->m_count, 1, Indices());
+			}
+
+		public:
+			/**
+			 * @brief Removes a record, shifting the records after it to keep
+			 * their order.
+			 *
+			 * @param[in] index The index of the record to remove.
+			 *
+			 * @throw IndexOutOfRangeException if index is out of range.
+			 */
+			Void RemoveAt(Size index)
+			{
+				if (index >= this->m_count)
+					FORGE_EXCEPT(Debug::ExceptionType::FORGE_INDEX_OUT_RANGE)
+
+				this->DestructRecords(index, 1, Indices());
+				this->RelocateRecords(index, index + 1, this->m_count - index - 1, Indices());
+
+				this->m_count--;
+			}
+
+			/**
+			 * @brief Removes a record in O(1) by moving the last record in its
+			 * place, which does not keep the order of the records.
+			 *
+			 * @param[in] index The index of the record to remove.
+			 *
+			 * @throw IndexOutOfRangeException if index is out of range.
+			 */
+			Void RemoveAtSwap(Size index)
+			{
+				if (index >= this->m_count)
+					FORGE_EXCEPT(Debug::ExceptionType::FORGE_INDEX_OUT_RANGE)
+
+				this->m_count--;
+
+				this->DestructRecords(index, 1, Indices());
+
+				if (index != this->m_count)
+					this->RelocateRecords(index, this->m_count, 1, Indices());
+			}
+
+			/**
+			 * @brief Swaps two records in every column.
+			 *
+			 * @param[in] lhs_index The index of the first record.
+			 * @param[in] rhs_index The index of the second record.
+			 */
+			Void Swap(Size lhs_index, Size rhs_index)
+			{
+				FORGE_ASSERT(lhs_index < this->m_count && rhs_index < this->m_count, "Index is out of range.")
+
+				if (lhs_index != rhs_index)
+					this->SwapRecords(lhs_index, rhs_index, Indices());
+			}
+
+		public:
+			/**
+			 * @brief Removes all the records, the storage is kept.
+			 */
+			Void Clear(Void)
+			{
+				if (!this->m_count)
+					return;
+
+				this->DestructRecords(0, this->m_count, Indices());
+
+				this->m_count = 0;
+			}
+		};
+
+		/**
+		 * @brief Structure of arrays allocating from the heap, with one column
+		 * per type.
+		 */
+		template<typename... InTypes>
+		using TSoAArray = TSoAArrayBase<Memory::DefaultAllocatorPolicy, InTypes...>;
+	}
+
+	namespace Common
+	{
+		template<typename InAllocatorPolicy, typename... InTypes>
+		struct TIsTriviallyRelocatable<Containers::TSoAArrayBase<InAllocatorPolicy, InTypes...>> { enum { Value = TIsTriviallyRelocatable<InAllocatorPolicy>::Value }; };
+	}
+}
+
+#endif // T_SOA_ARRAY_H
@@ -1,6 +1,7 @@
 #ifndef T_STATIC_QUEUE_H
 #define T_STATIC_QUEUE_H
 
+#include <new>
 #include <utility>
 #include <stdlib.h>
 #include <initializer_list>
@@ -10,15 +11,27 @@
 #include "Core/Public/Common/TypeDefinitions.h"
 #include "Core/Public/Common/PreprocessorUtilities.h"
 
-#include "Core/Public/Memory/PoolAllocator.h"
 #include "Core/Public/Memory/MemoryUtilities.h"
 
 namespace Forge {
 	namespace Containers
 	{
+		/**
+		 * @brief First-in first-out queue of a fixed maximum size.
+		 *
+		 * Elements are stored in a circular buffer inside the queue, the front
+		 * element is at the head index and the following elements wrap around
+		 * the end of the buffer. Pushing and popping only move the head and the
+		 * count, no element is ever shifted, and storage is only constructed
+		 * for elements actually in the queue.
+		 *
+		 * @author Karim Hisham
+		 */
 		template<typename InElementType, Size InMaxSize>
 		class TStaticQueue : public AbstractList<InElementType>
 		{
+			static_assert(InMaxSize != 0, "Queue size must not be zero");
+
 		private:
 			using ElementType         = InElementType;
 			using ElementTypeRef      = InElementType&;
@@ -26,7 +39,7 @@ namespace Forge {
 			using ConstElementType    = const InElementType;
 			using ConstElementTypeRef = const InElementType&;
 			using ConstElementTypePtr = const InElementType*;
-		
+
 		private:
 			using SelfType         = TStaticQueue<ElementType, InMaxSize>;
 			using SelfTypeRef      = TStaticQueue<ElementType, InMaxSize>&;
@@ -36,78 +49,38 @@ namespace Forge {
 			using ConstSelfTypePtr = const TStaticQueue<ElementType, InMaxSize>*;
 
 		private:
-			ElementType m_mem_block[InMaxSize];
+			alignas(InElementType) Byte m_mem_block[InMaxSize * sizeof(InElementType)];
+
+			/// Position of the front element in the buffer.
+			Size m_head;
 
 		public:
 			struct Iterator
 			{
 			private:
-				ElementTypePtr m_ptr;
+				ElementTypePtr m_buffer;
+				Size           m_head;
+				Size           m_index;
 
 			public:
 				Iterator(void)
-					: m_ptr(nullptr) {}
-
-				Iterator(ElementTypePtr ptr)
-					: m_ptr(ptr) {}
-
-			public:
-				Iterator(Iterator&& other)
-				{
-					*this = std::move(other);
-				}
-				Iterator(const Iterator& other)
-				{
-					*this = other;
-				}
+					: m_buffer(nullptr), m_head(0), m_index(0) {}
 
-			public:
-				~Iterator() = default;
-
-			public:
-				Iterator operator =(Iterator&& other)
-				{
-					Memory::MemoryCopy(this, &other, sizeof(Iterator));
-
-					other.m_ptr = nullptr;
-
-					return *this;
-				}
-				Iterator operator =(const Iterator& other)
-				{
-					Memory::MemoryCopy(this, const_cast<Iterator*>(&other), sizeof(Iterator));
-
-					return *this;
-				}
-
-			public:
-				Iterator operator --(I32)
-				{
-					Iterator temp(this->m_ptr);
-
-					this->m_ptr++;
-
-					return temp;
-				}
-				Iterator operator --(void)
-				{
-					this->m_ptr++;
-
-					return *this;
-				}
+				Iterator(ElementTypePtr buffer, Size head, Size index)
+					: m_buffer(buffer), m_head(head), m_index(index) {}
 
 			public:
 				Iterator operator ++(I32)
 				{
-					Iterator temp(this->m_ptr);
+					Iterator temp(*this);
 
-					this->m_ptr++;
+					this->m_index++;
 
 					return temp;
 				}
 				Iterator operator ++(void)
 				{
-					this->m_ptr++;
+					this->m_index++;
 
 					return *this;
 				}
@@ -115,94 +88,51 @@ namespace Forge {
 			public:
 				Bool operator ==(const Iterator& other)
 				{
-					return this->m_ptr == other.m_ptr;
+					return this->m_index == other.m_index;
 				}
 				Bool operator !=(const Iterator& other)
 				{
-					return this->m_ptr != other.m_ptr;
+					return this->m_index != other.m_index;
 				}
 
 			public:
 				ElementTypeRef operator *()
 				{
-					return *(this->m_ptr);
+					return *(this->m_buffer + SelfType::Wrap(this->m_head + this->m_index));
 				}
 
 			public:
 				ElementTypePtr operator ->()
 				{
-					return this->m_ptr;
+					return this->m_buffer + SelfType::Wrap(this->m_head + this->m_index);
 				}
 			};
 			struct ConstIterator
 			{
 			private:
-				ElementTypePtr m_ptr;
+				ConstElementTypePtr m_buffer;
+				Size                m_head;
+				Size                m_index;
 
 			public:
 				ConstIterator(void)
-					: m_ptr(nullptr) {}
+					: m_buffer(nullptr), m_head(0), m_index(0) {}
 
-				ConstIterator(ElementTypePtr ptr)
-					: m_ptr(ptr) {}
-
-			public:
-				ConstIterator(ConstIterator&& other)
-				{
-					*this = std::move(other);
-				}
-				ConstIterator(const ConstIterator& other)
-				{
-					*this = other;
-				}
-
-			public:
-				~ConstIterator() = default;
-
-			public:
-				ConstIterator operator =(ConstIterator&& other)
-				{
-					Memory::MemoryCopy(this, &other, sizeof(Iterator));
-
-					other.m_ptr = nullptr;
-
-					return *this;
-				}
-				ConstIterator operator =(const ConstIterator& other)
-				{
-					Memory::MemoryCopy(this, const_cast<ConstIterator*>(&other), sizeof(Iterator));
-
-					return *this;
-				}
-
-			public:
-				ConstIterator operator --(I32)
-				{
-					ConstIterator temp(this->m_ptr);
-
-					this->m_ptr++;
-
-					return temp;
-				}
-				ConstIterator operator --(void)
-				{
-					this->m_ptr++;
-
-					return *this;
-				}
+				ConstIterator(ConstElementTypePtr buffer, Size head, Size index)
+					: m_buffer(buffer), m_head(head), m_index(index) {}
 
 			public:
 				ConstIterator operator ++(I32)
 				{
-					ConstIterator temp(this->m_ptr);
+					ConstIterator temp(*this);
 
-					this->m_ptr++;
+					this->m_index++;
 
 					return temp;
 				}
 				ConstIterator operator ++(void)
 				{
-					this->m_ptr++;
+					this->m_index++;
 
 					return *this;
 				}
@@ -210,23 +140,23 @@ namespace Forge {
 			public:
 				Bool operator ==(const ConstIterator& other)
 				{
-					return this->m_ptr == other.m_ptr;
+					return this->m_index == other.m_index;
 				}
 				Bool operator !=(const ConstIterator& other)
 				{
-					return this->m_ptr != other.m_ptr;
+					return this->m_index != other.m_index;
 				}
 
 			public:
 				ConstElementTypeRef operator *()
 				{
-					return *(this->m_ptr);
+					return *(this->m_buffer + SelfType::Wrap(this->m_head + this->m_index));
 				}
 
 			public:
 				ConstElementTypePtr operator ->()
 				{
-					return this->m_ptr;
+					return this->m_buffer + SelfType::Wrap(this->m_head + this->m_index);
 				}
 			};
 
@@ -237,10 +167,7 @@ namespace Forge {
 			 * Constructs an empty static queue.
 			 */
 			TStaticQueue(void)
-				: AbstractList<ElementType>(0, InMaxSize)
-			{
-				FORGE_ASSERT(this->m_max_capacity != 0 && this->m_count < this->m_max_capacity, "Array size is not large enough to store the data.")
-			}
+				: AbstractList<ElementType>(0, InMaxSize), m_head(0) {}
 
 			/**
 			 * @brief Move element constructor.
@@ -248,11 +175,11 @@ namespace Forge {
 			 * Constructs a static queue with a copy of an element.
 			 */
 			TStaticQueue(ElementType&& element, Size count)
-				: AbstractList<ElementType>(count, InMaxSize)
+				: AbstractList<ElementType>(count, InMaxSize), m_head(0)
 			{
-				FORGE_ASSERT(this->m_max_capacity != 0 && this->m_count < this->m_max_capacity, "Array size is not large enough to store the data.")
+				FORGE_ASSERT(this->m_count <= this->m_max_capacity, "Array size is not large enough to store the data.")
 
-				Memory::MoveConstruct(m_mem_block, std::move(element), this->m_count);
+				Memory::CopyConstruct(this->GetBuffer(), element, this->m_count);
 			}
 
 			/**
@@ -261,11 +188,11 @@ namespace Forge {
 			 * Constructs a static queue with a copy of an element.
 			 */
 			TStaticQueue(ConstElementTypeRef element, Size count)
-				: AbstractList<ElementType>(count, InMaxSize)
+				: AbstractList<ElementType>(count, InMaxSize), m_head(0)
 			{
-				FORGE_ASSERT(this->m_max_capacity != 0 && this->m_count < this->m_max_capacity, "Array size is not large enough to store the data.")
+				FORGE_ASSERT(this->m_count <= this->m_max_capacity, "Array size is not large enough to store the data.")
 
-				Memory::CopyConstruct(m_mem_block, element, this->m_count);
+				Memory::CopyConstruct(this->GetBuffer(), element, this->m_count);
 			}
 
 			/**
@@ -274,11 +201,11 @@ namespace Forge {
 			 * Constructs a static queue with an initializer list.
 			 */
 			TStaticQueue(std::initializer_list<ElementType> init_list)
-				: AbstractList<ElementType>(init_list.size(), InMaxSize)
+				: AbstractList<ElementType>(init_list.size(), InMaxSize), m_head(0)
 			{
-				FORGE_ASSERT(this->m_max_capacity != 0 && this->m_count < this->m_max_capacity, "Array size is not large enough to store the data.")
+				FORGE_ASSERT(this->m_count <= this->m_max_capacity, "Array size is not large enough to store the data.")
 
-				Memory::MoveConstructArray(this->m_mem_block, const_cast<ElementTypePtr>(init_list.begin()), this->m_count);
+				Memory::CopyConstructArray(this->GetBuffer(), const_cast<ElementTypePtr>(init_list.begin()), this->m_count);
 			}
 
 		public:
@@ -286,6 +213,7 @@ namespace Forge {
 			 * @brief Move constructor.
 			 */
 			TStaticQueue(SelfType&& other)
+				: AbstractList<ElementType>(0, InMaxSize), m_head(0)
 			{
 				*this = std::move(other);
 			}
@@ -294,6 +222,7 @@ namespace Forge {
 			 * @brief Copy constructor.
 			 */
 			TStaticQueue(ConstSelfTypeRef other)
+				: AbstractList<ElementType>(0, InMaxSize), m_head(0)
 			{
 				*this = other;
 			}
@@ -307,32 +236,71 @@ namespace Forge {
 		public:
 			/**
 			 * @brief Move assignment.
+			 *
+			 * The elements are moved to the start of this queue's buffer.
 			 */
 			SelfTypeRef operator =(SelfType&& other)
 			{
+				if (this == &other)
+					return *this;
+
 				this->Clear();
 
-				Memory::MemoryCopy(this, &other, sizeof(SelfType));
+				for (Size i = 0; i < other.m_count; i++)
+					new (this->GetBuffer() + i) ElementType(std::move(*other.GetElement(i)));
 
-				other.m_mem_block = nullptr;
-				other.m_count = 0;
+				this->m_count = other.m_count;
+
+				other.Clear();
 
 				return *this;
 			}
 
 			/**
 			 * @brief Copy assignment.
+			 *
+			 * The elements are copied to the start of this queue's buffer.
 			 */
 			SelfTypeRef operator =(ConstSelfTypeRef other)
 			{
+				if (this == &other)
+					return *this;
+
 				this->Clear();
 
-				Memory::CopyArray(this->m_mem_block, other.m_mem_block, other.m_count);
+				for (Size i = 0; i < other.m_count; i++)
+					new (this->GetBuffer() + i) ElementType(*other.GetElement(i));
 
 				this->m_count = other.m_count;
 
 				return *this;
-			}			
+			}
+
+		private:
+			static Size Wrap(Size position)
+			{
+				return position >= InMaxSize ? position - InMaxSize : position;
+			}
+
+			ElementTypePtr GetBuffer(void)
+			{
+				return reinterpret_cast<ElementTypePtr>(this->m_mem_block);
+			}
+
+			ConstElementTypePtr GetBuffer(void) const
+			{
+				return reinterpret_cast<ConstElementTypePtr>(this->m_mem_block);
+			}
+
+			ElementTypePtr GetElement(Size index)
+			{
+				return this->GetBuffer() + Wrap(this->m_head + index);
+			}
+
+			ConstElementTypePtr GetElement(Size index) const
+			{
+				return this->GetBuffer() + Wrap(this->m_head + index);
+			}
 
 		public:
 			/**
@@ -343,7 +311,7 @@ namespace Forge {
 			 */
 			Iterator GetStartItr(void)
 			{
-				return Iterator(const_cast<ElementTypePtr>(this->m_mem_block));
+				return Iterator(this->GetBuffer(), this->m_head, 0);
 			}
 
 			/**
@@ -354,7 +322,7 @@ namespace Forge {
 			 */
 			Iterator GetEndItr(void)
 			{
-				return Iterator(const_cast<ElementTypePtr>(this->m_mem_block + this->m_count));
+				return Iterator(this->GetBuffer(), this->m_head, this->m_count);
 			}
 
 			/**
@@ -365,7 +333,7 @@ namespace Forge {
 			 */
 			ConstIterator GetStartConstItr(void) const
 			{
-				return ConstIterator(const_cast<ElementTypePtr>(this->m_mem_block));
+				return ConstIterator(this->GetBuffer(), this->m_head, 0);
 			}
 
 			/**
@@ -376,69 +344,43 @@ namespace Forge {
 			 */
 			ConstIterator GetEndConstItr(void) const
 			{
-				return ConstIterator(const_cast<ElementTypePtr>(this->m_mem_block + this->m_count));
+				return ConstIterator(this->GetBuffer(), this->m_head, this->m_count);
 			}
 
-		public:
+		private:
 			/**
-			 * @brief Gets a direct pointer to the memory array managed by this
-			 * collection.
-			 *
-			 * Elements in the memory array are guranteed to be stored in contiguous
-			 * memory locations. This allows the pointer to be offsetted to access
-			 * different elements.
+			 * @brief This function is not supported by this collection, the
+			 * elements wrap around the end of the buffer and are not guaranteed
+			 * to be contiguous.
 			 *
-			 * @return ConstElementTypePtr storing address of the memory array.
+			 * @throws InvalidOperationException if attempted to retrieve
+			 * this collection's raw pointer.
 			 */
-			ConstElementTypePtr GetRawData() const override
+			ConstElementTypePtr GetRawData(void) const override
 			{
-				return this->m_mem_block;
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
+
+				return nullptr;
 			}
 
 		public:
 			/**
-			 * @brief Checks whether this collection is equal to the specified
-			 * collection.
+			 * @brief Retreives a reference to the element stored in the collection
+			 * at the specified index, counting from the front.
 			 *
-			 * Equality between collections is governed by their size, the order
-			 * of the elements in the collection and the eqaulity of the elements
-			 * they store.
+			 * @param[in] index The index to retreive the element stored at.
 			 *
-			 * @param[in] collection The collection to be compared with this
-			 * collection.
+			 * @return ConstElementTypeRef storting the element stored at the
+			 * specified index.
 			 *
-			 * @return True if the specified collection is equal to this collection.
+			 * @throws IndexOutOfRangeException if index is out of range.
 			 */
-			Bool IsEqual(AbstractCollection<ElementType>& collection) const override
+			ConstElementTypeRef GetByIndex(Size index) const override
 			{
-				if (collection.IsEmpty())
-					return false;
-
-				if (this->m_count != collection.GetCount())
-					return false;
-
-				Bool return_value;
-
-				ConstIterator start_itr = this->GetStartConstItr();
-				ConstIterator end_itr = this->GetEndConstItr();
-
-				collection.ForEach([&return_value, &start_itr, end_itr](ElementTypeRef element) -> Void
-					{
-						if ((start_itr++) == end_itr)
-						{
-							return_value = true;
-							return;
-						}
-
-						if (!Memory::MemoryCompare(&(*start_itr), &element, sizeof(ElementType)))
-						{
-							return_value = false;
-							return;
-						}
-					}
-				);
+				if (index >= this->m_count)
+					FORGE_EXCEPT(ExceptionType::FORGE_INDEX_OUT_RANGE)
 
-				return return_value;
+				return *this->GetElement(index);
 			}
 
 		public:
@@ -462,9 +404,7 @@ namespace Forge {
 
 				ElementTypePtr array_ptr = (ElementTypePtr)malloc(this->m_count * sizeof(ElementType));
 
-				Memory::CopyConstructArray(array_ptr, const_cast<ElementTypePtr>(this->m_mem_block), this->m_count);
-
-				return array_ptr;
+				return this->ToArray(array_ptr);
 			}
 
 			/**
@@ -487,7 +427,12 @@ namespace Forge {
 				if (!this->m_count)
 					return nullptr;
 
-				Memory::CopyConstructArray(array_ptr, const_cast<ElementTypePtr>(this->m_mem_block), this->m_count);
+				/// The elements are copied in at most two runs, up to the end of
+				/// the buffer and then from its start.
+				Size first_run = InMaxSize - this->m_head < this->m_count ? InMaxSize - this->m_head : this->m_count;
+
+				Memory::CopyConstructArray(array_ptr, const_cast<ElementTypePtr>(this->GetElement(0)), first_run);
+				Memory::CopyConstructArray(array_ptr + first_run, const_cast<ElementTypePtr>(this->GetBuffer()), this->m_count - first_run);
 
 				return array_ptr;
 			}
@@ -505,8 +450,8 @@ namespace Forge {
 			 */
 			Void ForEach(Common::TDelegate<Void(ElementTypeRef)> function) override
 			{
-				for (I32 i = 0; i < this->m_count; i++)
-					function.Invoke(*(this->m_mem_block + i));
+				for (Size i = 0; i < this->m_count; i++)
+					function.Invoke(*this->GetElement(i));
 			}
 
 			/**
@@ -521,8 +466,8 @@ namespace Forge {
 			 */
 			Void ForEach(Common::TDelegate<Void(ConstElementTypeRef)> function) const override
 			{
-				for (I32 i = 0; i < this->m_count; i++)
-					function.Invoke(*(this->m_mem_block + i));
+				for (Size i = 0; i < this->m_count; i++)
+					function.Invoke(*this->GetElement(i));
 			}
 
 		public:
@@ -539,18 +484,12 @@ namespace Forge {
 			 */
 			I64 FirstIndexOf(ConstElementTypeRef element) const override
 			{
-				if (!this->m_count)
-					return -1;
-				
-				ConstElementTypePtr start = this->m_mem_block;
-				ConstElementTypePtr end = start + this->m_count;
-
-				for (ConstElementTypePtr ptr = start; ptr != end; ptr++)
+				for (Size i = 0; i < this->m_count; i++)
 				{
-					if (Memory::MemoryCompare(ptr, &element, sizeof(ElementType)))
-						return reinterpret_cast<I64>(Memory::SubAddress(ptr, start)) / sizeof(ElementType);
+					if (Memory::MemoryCompare(this->GetElement(i), &element, sizeof(ElementType)))
+						return i;
 				}
-				
+
 				return -1;
 			}
 
@@ -567,18 +506,12 @@ namespace Forge {
 			 */
 			I64 LastIndexOf(ConstElementTypeRef element) const override
 			{
-				if (!this->m_count)
-					return -1;
-				
-				ConstElementTypePtr start = this->m_mem_block - 1;
-				ConstElementTypePtr end = start + this->m_count;
-
-				for (ConstElementTypePtr ptr = end; ptr != end; ptr--)
+				for (I64 i = this->m_count - 1; i >= 0; i--)
 				{
-					if (Memory::MemoryCompare(ptr, &element, sizeof(ElementType)))
-						return reinterpret_cast<I64>(Memory::SubAddress(ptr, start + 1)) / sizeof(ElementType);
+					if (Memory::MemoryCompare(this->GetElement(i), &element, sizeof(ElementType)))
+						return i;
 				}
-				
+
 				return -1;
 			}
 
@@ -591,9 +524,9 @@ namespace Forge {
 			 */
 			ConstElementTypeRef PeekBack() const override
 			{
-				// Throw Exception
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 
-				return ElementType();
+				return *this->GetElement(0);
 			}
 
 			/**
@@ -607,11 +540,9 @@ namespace Forge {
 			ConstElementTypeRef PeekFront() const override
 			{
 				if (!this->m_count)
-				{
-					// Throw Exception
-				}
+					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 
-				return *(this->m_mem_block);
+				return *this->GetElement(0);
 			}
 
 		public:
@@ -623,12 +554,12 @@ namespace Forge {
 			 */
 			Void PushBack(ElementType&& element) override
 			{
-				// Throw Exception
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 			}
 
 			/**
-			 * @brief Inserts a new element at the front of this collection, before
-			 * its current first element.
+			 * @brief Enqueues a new element at the back of this collection, after
+			 * its current last element.
 			 *
 			 * @param[in] element The element to insert in this collection.
 			 *
@@ -638,11 +569,9 @@ namespace Forge {
 			Void PushFront(ElementType&& element) override
 			{
 				if (this->m_count >= this->m_max_capacity)
-				{
-					// Throw Exception
-				}
+					FORGE_EXCEPT(ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS)
 
-				Memory::Move(this->m_mem_block + this->m_count, std::move(element), 1);
+				new (this->GetElement(this->m_count)) ElementType(std::move(element));
 
 				this->m_count++;
 			}
@@ -655,12 +584,12 @@ namespace Forge {
 			 */
 			Void PushBack(ConstElementTypeRef element) override
 			{
-				// Throw Exception
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 			}
 
 			/**
-			 * @brief Inserts a new element at the front of this collection, before
-			 * its current first element.
+			 * @brief Enqueues a new element at the back of this collection, after
+			 * its current last element.
 			 *
 			 * @param[in] element The element to insert in this collection.
 			 *
@@ -670,11 +599,9 @@ namespace Forge {
 			Void PushFront(ConstElementTypeRef element) override
 			{
 				if (this->m_count >= this->m_max_capacity)
-				{
-					// Throw Exception
-				}
+					FORGE_EXCEPT(ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS)
 
-				Memory::Copy(this->m_mem_block + this->m_count, element, 1);
+				new (this->GetElement(this->m_count)) ElementType(element);
 
 				this->m_count++;
 			}
@@ -687,54 +614,62 @@ namespace Forge {
 			 */
 			Void PopBack(void) override
 			{
-				// Throw Exception
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 			}
 
 			/**
 			 * @brief Removes the element at the front of this collection, effectivly
 			 * reducing the collection count by one.
 			 *
-			 * This function has the same functionality as Pop
+			 * The head advances past the element, the remaining elements stay in
+			 * place.
 			 *
 			 * @Throws InvalidOperationException if this collection is empty.
 			 */
 			Void PopFront(void) override
 			{
 				if (!this->m_count)
-				{
-					// Throw Exception
-				}
-
-				ElementTypePtr slow_ptr = this->m_mem_block;
-				ElementTypePtr fast_ptr = this->m_mem_block + 1;
-
-				Memory::Destruct(this->m_mem_block, 1);
+					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 
-				for (I32 i = 0; i < this->m_count; i++)
-					*(slow_ptr++) = *(fast_ptr++);
+				Memory::Destruct(this->GetElement(0), 1);
 
+				this->m_head = Wrap(this->m_head + 1);
 				this->m_count--;
 			}
 
 		public:
 			/**
-			 * @brief Inserts a new element at the front of this collection.
+			 * @brief Retreives the front element in this collection.
+			 *
+			 * @return ConstElementTypeRef storing the front element in this
+			 * collection.
+			 *
+			 * @throws InvalidOperationException if this collection is empty.
+			 */
+			ConstElementTypeRef Peek(void) const
+			{
+				return this->PeekFront();
+			}
+
+		public:
+			/**
+			 * @brief Enqueues a new element at the back of this collection.
 			 *
-			 * This function has the same functionality as PushBack.
+			 * This function has the same functionality as PushFront.
 			 *
-			 * @param[in] element The element to insert at the front.
+			 * @param[in] element The element to enqueue.
 			 */
 			Void Push(ElementType&& element)
 			{
-				this->PushFront(element);
+				this->PushFront(std::move(element));
 			}
 
 			/**
-			 * @brief Inserts a new element at the front of this collection.
+			 * @brief Enqueues a new element at the back of this collection.
 			 *
-			 * This function has the same functionality as PushBack.
+			 * This function has the same functionality as PushFront.
 			 *
-			 * @param[in] element The element to insert at the front.
+			 * @param[in] element The element to enqueue.
 			 */
 			Void Push(ConstElementTypeRef element)
 			{
@@ -744,7 +679,7 @@ namespace Forge {
 			/**
 			 * @brief Removes the element at the front of this collection.
 			 *
-			 * This operation has the same functionality as PopBack.
+			 * This operation has the same functionality as PopFront.
 			 */
 			Void Pop(void)
 			{
@@ -761,7 +696,7 @@ namespace Forge {
 			 */
 			Void InsertAt(Size index, ElementType&& element) override
 			{
-				// Throw Exception
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 			}
 
 			/**
@@ -773,7 +708,7 @@ namespace Forge {
 			 */
 			Void InsertAt(Size index, ConstElementTypeRef element) override
 			{
-				// Throw Exception
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 			}
 
 			/**
@@ -784,7 +719,7 @@ namespace Forge {
 			 */
 			Void RemoveAt(Size index) override
 			{
-				// Throw Exception
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 			}
 
 		public:
@@ -797,7 +732,7 @@ namespace Forge {
 			 */
 			Bool Remove(ConstElementTypeRef element) override
 			{
-				// Throw Exception
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 
 				return false;
 			}
@@ -832,7 +767,7 @@ namespace Forge {
 				if (collection.IsEmpty())
 					return false;
 
-				if (this->m_max_capacity - collection.GetMaxCapacity() < 0)
+				if (this->m_max_capacity - this->m_count < collection.GetCount())
 					return false;
 
 				collection.ForEach([this](ElementTypeRef element) -> Void
@@ -853,51 +788,21 @@ namespace Forge {
 			 */
 			Bool RemoveAll(AbstractCollection<ElementType>& collection) override
 			{
-				// Throw Exception
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 
 				return false;
 			}
 
-			/**
-			 * @brief Searches for all the elements in the specified collection in
-			 * this collection.
-			 *
-			 * @param[in] collection The collection containing elements to be
-			 * search for in this collection.
-			 *
-			 * @return True if the specified elements were found and the collection
-			 * is not empty.
-			 */
-			Bool ContainsAll(AbstractCollection<ElementType>& collection) override
-			{
-				if (!this->m_count || collection.IsEmpty())
-					return false;
-
-				Bool return_value;
-
-				collection.ForEach([this, &return_value](ElementTypeRef element) -> Void
-					{
-						return_value = this->Contains(element);
-
-						if (!return_value)
-							return;
-					}
-				);
-
-				return return_value;
-			}
-
 		public:
 			/**
 			 * @brief Removes all the elements from this collection.
 			 */
 			Void Clear(void) override
 			{
-				if (!this->m_count)
-					return;
-
-				Memory::Destruct(this->m_mem_block, this->m_count);
+				for (Size i = 0; i < this->m_count; i++)
+					Memory::Destruct(this->GetElement(i), 1);
 
+				this->m_head = 0;
 				this->m_count = 0;
 			}
 		};
@@ -22,13 +22,9 @@ namespace Forge {
 		class AbstractObjectFactory;
 
 		class TypeInfo;
-		class RefCounted;
 
 		template<typename T>
-		class TSharedPtr;
-
-		template<typename T>
-		class TWeakPtr;
+		class TRefPtr;
 	}
 }
 
@@ -0,0 +1,437 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <atomic>
+#include <type_traits>
+
+#include <Core/Public/Types/TDelegate.h>
+#include <Core/Public/Common/Common.h>
+
+#include "Core/Public/Debug/Debug.h"
+#include "Core/Public/Memory/MemoryUtilities.h"
+#include "Core/Public/Common/PreprocessorUtilities.h"
+
+#include "Core/Public/Containers/TDynamicArray.h"
+#include "Core/Public/Containers/TFlatHashMap.h"
+#include "Core/Public/Containers/TConcurrentQueue.h"
+
+#include "Core/Public/Types/String/ConstStringHash.h"
+
+namespace Forge {
+	namespace Event
+	{
+		enum : Size
+		{
+			/// Events are copied into fixed-size records of the event queue.
+			MAX_EVENT_SIZE      = 48,
+			MAX_EVENT_ALIGNMENT = 16
+		};
+
+		namespace Internal
+		{
+			using EventCoalesceFunc = Bool(*)(VoidPtr, ConstVoidPtr);
+
+			/**
+			 * @brief A published event copied into the event queue.
+			 */
+			struct EventRecord
+			{
+				Type::ConstStringHash m_event_id;
+				EventCoalesceFunc     m_coalesce_function;
+
+				alignas(MAX_EVENT_ALIGNMENT) Byte m_payload[MAX_EVENT_SIZE];
+
+				EventRecord(Void)
+					: m_coalesce_function(nullptr) {}
+
+				EventRecord(Type::ConstStringHash event_id, EventCoalesceFunc coalesce_function, ConstVoidPtr event, Size size)
+					: m_event_id(event_id), m_coalesce_function(coalesce_function)
+				{
+					Memory::MemoryCopy(m_payload, event, size);
+				}
+			};
+
+			/**
+			 * @brief Interns the fully qualified name of an event type, taken
+			 * from the signature of TEventId<InEventType>::Get.
+			 */
+			FORGE_API Type::ConstStringHash GetEventId(ConstCharPtr function_signature);
+
+			/**
+			 * @brief Gets the identifier of an event type, event types of the same
+			 * name in different namespaces get different identifiers.
+			 */
+			template<typename InEventType>
+			struct TEventId
+			{
+				static Type::ConstStringHash Get(Void)
+				{
+					static const Type::ConstStringHash s_event_id = GetEventId(FORGE_FUNC_SIGNATURE_LITERAL);
+
+					return s_event_id;
+				}
+			};
+
+			/**
+			 * @brief Gets the function merging two events of a type, nullptr if
+			 * the type has no Coalesce member function.
+			 */
+			template<typename InEventType, typename = Void>
+			struct TEventCoalescer
+			{
+				static constexpr EventCoalesceFunc Function = nullptr;
+			};
+
+			template<typename InEventType>
+			struct TEventCoalescer<InEventType, std::void_t<decltype(std::declval<InEventType&>().Coalesce(std::declval<const InEventType&>()))>>
+			{
+				static Bool Coalesce(VoidPtr event, ConstVoidPtr next_event)
+				{
+					return static_cast<InEventType*>(event)->Coalesce(*static_cast<const InEventType*>(next_event));
+				}
+
+				static constexpr EventCoalesceFunc Function = &Coalesce;
+			};
+
+			/**
+			 * @brief The subscribers of a single event type.
+			 */
+			class AbstractEventSubscribers
+			{
+			public:
+				/// Index of the event of this type in the batch being built and
+				/// the dispatch that batch belongs to, used for coalescing.
+				Size m_batch_index;
+				U64  m_batch_dispatch;
+
+			public:
+				AbstractEventSubscribers(Void)
+					: m_batch_index(0), m_batch_dispatch(0) {}
+
+			public:
+				virtual ~AbstractEventSubscribers(Void) = default;
+
+			public:
+				virtual Void Dispatch(ConstVoidPtr event) = 0;
+				virtual Void Remove(U32 subscription_id) = 0;
+			};
+
+			template<typename InEventType>
+			class TEventSubscribers : public AbstractEventSubscribers
+			{
+			private:
+				struct Subscriber
+				{
+					/// Zero once the subscriber is removed during a dispatch.
+					U32 m_id;
+
+					Common::TDelegate<Void(const InEventType&)> m_callback;
+				};
+
+			private:
+				Containers::TDynamicArray<Subscriber> m_subscribers;
+
+				/// Subscribers added during a dispatch of this event type, they
+				/// receive the next event.
+				Containers::TDynamicArray<Subscriber> m_pending_subscribers;
+
+			private:
+				Bool m_is_dispatching;
+				Bool m_has_removed_subscribers;
+
+			public:
+				TEventSubscribers(Void)
+					: m_is_dispatching(false), m_has_removed_subscribers(false) {}
+
+			public:
+				Void Add(U32 subscription_id, Common::TDelegate<Void(const InEventType&)>&& callback)
+				{
+					if (m_is_dispatching)
+						m_pending_subscribers.PushBack(Subscriber{ subscription_id, Algorithm::Move(callback) });
+					else
+						m_subscribers.PushBack(Subscriber{ subscription_id, Algorithm::Move(callback) });
+				}
+
+				Void Remove(U32 subscription_id) override
+				{
+					for (Size i = 0; i < m_pending_subscribers.GetCount(); i++)
+					{
+						if (m_pending_subscribers[i].m_id == subscription_id)
+						{
+							m_pending_subscribers.RemoveAt(i);
+							return;
+						}
+					}
+
+					for (Size i = 0; i < m_subscribers.GetCount(); i++)
+					{
+						if (m_subscribers[i].m_id != subscription_id)
+							continue;
+
+						/// The callback may be running, it is released once the
+						/// dispatch returns.
+						if (m_is_dispatching)
+						{
+							m_subscribers[i].m_id = 0;
+							m_has_removed_subscribers = true;
+						}
+						else
+							m_subscribers.RemoveAt(i);
+
+						return;
+					}
+				}
+
+				Void Dispatch(ConstVoidPtr event) override
+				{
+					/// Ends the dispatch even if a callback throws.
+					struct DispatchScope
+					{
+						TEventSubscribers* m_subscribers;
+
+						~DispatchScope(Void) { m_subscribers->EndDispatch(); }
+					};
+
+					m_is_dispatching = true;
+
+					DispatchScope scope = { this };
+
+					for (Size i = 0; i < m_subscribers.GetCount(); i++)
+					{
+						if (m_subscribers[i].m_id)
+							m_subscribers[i].m_callback.Invoke(*static_cast<const InEventType*>(event));
+					}
+				}
+
+			private:
+				Void EndDispatch(Void)
+				{
+					m_is_dispatching = false;
+
+					if (m_has_removed_subscribers)
+					{
+						for (Size i = m_subscribers.GetCount(); i > 0; i--)
+						{
+							if (!m_subscribers[i - 1].m_id)
+								m_subscribers.RemoveAt(i - 1);
+						}
+
+						m_has_removed_subscribers = false;
+					}
+
+					for (Size i = 0; i < m_pending_subscribers.GetCount(); i++)
+						m_subscribers.PushBack(Algorithm::Move(m_pending_subscribers[i]));
+
+					m_pending_subscribers.Clear();
+				}
+			};
+		}
+
+		/**
+		 * @brief Handle of a subscription to an event type, used to
+		 * unsubscribe.
+		 */
+		struct EventSubscription
+		{
+			Type::ConstStringHash m_event_id;
+
+			/// Zero for an invalid subscription.
+			U32 m_id;
+
+			EventSubscription(Void)
+				: m_id(0) {}
+
+			EventSubscription(Type::ConstStringHash event_id, U32 id)
+				: m_event_id(event_id), m_id(id) {}
+
+			Bool IsValid(Void) const { return m_id != 0; }
+		};
+
+		/**
+		 * @brief Delivers events published from any thread to any number of
+		 * subscribers per event type, in batches at a chosen point of the
+		 * frame.
+		 *
+		 * Publishing copies the event into a bounded lock-free queue and
+		 * returns, so an event may be published from any thread at any time,
+		 * including from the window procedure of the platform layer. Events
+		 * are only delivered when the owning thread calls Dispatch, which
+		 * drains the events queued so far into a batch and invokes the
+		 * subscribers of every event of the batch in the order the events
+		 * were published. Events of a type nobody subscribed to are dropped.
+		 *
+		 * An event type declares itself with FORGE_DECLARE_EVENT and must be
+		 * trivially copyable and at most MAX_EVENT_SIZE bytes. A type may
+		 * also declare a Coalesce member function,
+		 *
+		 *     Bool Coalesce(const EventType& next_event);
+		 *
+		 * which merges a later event into an earlier one of the same type
+		 * that is still in the batch, and returns false if they cannot be
+		 * merged. Coalesced events are delivered once, at the position of the
+		 * first one. This keeps only the last size of a window resized many
+		 * times in a frame or sums the mouse deltas of a frame, instead of
+		 * invoking every subscriber for every operating system message.
+		 *
+		 * Subscribing, unsubscribing and dispatching must happen on the thread
+		 * that owns the bus. Subscribers may subscribe and unsubscribe from
+		 * within a callback, subscribers added by a callback receive events
+		 * from the next one on, and events published by a callback are
+		 * delivered by the next dispatch.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API EventBus
+		{
+		FORGE_CLASS_NONCOPYABLE(EventBus)
+
+		public:
+			enum : Size { DEFAULT_CAPACITY = 4096 };
+
+		private:
+			struct BatchedEvent
+			{
+				Internal::AbstractEventSubscribers* m_subscribers;
+				Internal::EventRecord               m_record;
+			};
+
+		private:
+			Containers::TConcurrentQueue<Internal::EventRecord> m_queue;
+
+		private:
+			Containers::TFlatHashMap<Type::ConstStringHash, Internal::AbstractEventSubscribers*> m_subscribers;
+
+			Containers::TDynamicArray<BatchedEvent> m_batch;
+
+		private:
+			U32 m_next_subscription_id;
+			U64 m_num_of_dispatches;
+
+			Bool m_is_dispatching;
+
+		private:
+			std::atomic<Size> m_num_of_dropped_events;
+
+		public:
+			/**
+			 * @brief Capacity constructor.
+			 *
+			 * @param[in] capacity The number of events that can be queued
+			 * between two dispatches, rounded up to a power of two.
+			 */
+			explicit EventBus(Size capacity = DEFAULT_CAPACITY);
+
+		public:
+		   ~EventBus();
+
+		private:
+			Internal::AbstractEventSubscribers* FindSubscribers(const Type::ConstStringHash& event_id);
+
+		public:
+			/**
+			 * @brief Queues an event to be delivered by the next dispatch. Safe
+			 * to call from any thread.
+			 *
+			 * @param[in] event The event to publish.
+			 *
+			 * @return True if the event was queued, false if the queue is full
+			 * and the event was dropped.
+			 */
+			template<typename InEventType>
+			Bool Publish(const InEventType& event);
+
+			/**
+			 * @brief Subscribes a callback to every later event of a type.
+			 *
+			 * @param[in] callback The callback to invoke for every event.
+			 *
+			 * @return EventSubscription storing the handle to unsubscribe with.
+			 */
+			template<typename InEventType>
+			EventSubscription Subscribe(Common::TDelegate<Void(const InEventType&)> callback);
+
+			/**
+			 * @brief Removes a subscription, its callback is not invoked again.
+			 * Invalid or already removed subscriptions are ignored.
+			 *
+			 * @param[in] subscription The subscription to remove.
+			 */
+			Void Unsubscribe(const EventSubscription& subscription);
+
+		public:
+			/**
+			 * @brief Delivers the events queued since the last dispatch to
+			 * their subscribers, coalescing events of the same type.
+			 *
+			 * If a callback throws, the events left in the batch are dropped
+			 * and the exception is propagated, the bus stays usable.
+			 *
+			 * @return Size storing the number of events delivered after
+			 * coalescing.
+			 *
+			 * @throws InvalidOperationException if called from a callback of
+			 * the bus.
+			 */
+			Size Dispatch(Void);
+
+		public:
+			/**
+			 * @brief Gets the number of events dropped because the queue was
+			 * full, during the lifetime of the bus.
+			 *
+			 * @return Size storing the number of dropped events.
+			 */
+			Size GetNumOfDroppedEvents(Void) const;
+		};
+
+		template<typename InEventType>
+		FORGE_FORCE_INLINE Bool EventBus::Publish(const InEventType& event)
+		{
+			static_assert(std::is_trivially_copyable<InEventType>::value, "Events must be trivially copyable");
+			static_assert(sizeof(InEventType) <= MAX_EVENT_SIZE, "Event is larger than MAX_EVENT_SIZE");
+			static_assert(alignof(InEventType) <= MAX_EVENT_ALIGNMENT, "Event alignment is larger than MAX_EVENT_ALIGNMENT");
+
+			if (m_queue.TryEmplace(InEventType::GetEventId(), Internal::TEventCoalescer<InEventType>::Function, &event, sizeof(InEventType)))
+				return true;
+
+			m_num_of_dropped_events.fetch_add(1, std::memory_order_relaxed);
+
+			return false;
+		}
+
+		template<typename InEventType>
+		EventSubscription EventBus::Subscribe(Common::TDelegate<Void(const InEventType&)> callback)
+		{
+			Type::ConstStringHash event_id = InEventType::GetEventId();
+
+			Internal::AbstractEventSubscribers* subscribers = FindSubscribers(event_id);
+
+			if (!subscribers)
+			{
+				subscribers = new Internal::TEventSubscribers<InEventType>();
+
+				m_subscribers.Insert(event_id, subscribers);
+			}
+
+			U32 subscription_id = m_next_subscription_id++;
+
+			static_cast<Internal::TEventSubscribers<InEventType>*>(subscribers)->Add(subscription_id, Algorithm::Move(callback));
+
+			return EventSubscription(event_id, subscription_id);
+		}
+
+		FORGE_FORCE_INLINE Size EventBus::GetNumOfDroppedEvents(Void) const
+		{
+			return m_num_of_dropped_events.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+/**
+ * Declares a type as an event that can be published on an EventBus, events
+ * are identified by the fully qualified name of their type.
+ */
+#define FORGE_DECLARE_EVENT(__TYPENAME__)							\
+	static Forge::Type::ConstStringHash GetEventId(void) { return Forge::Event::Internal::TEventId<__TYPENAME__>::Get(); }
+
+#endif // EVENT_BUS_H
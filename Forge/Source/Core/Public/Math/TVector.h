@@ -3,6 +3,8 @@
 
 #include "Core/Public/Common/Common.h"
 
+#include "Core/Public/Algorithm/Hash/THash.h"
+
 namespace Forge {
 	namespace Math
 	{
@@ -181,6 +183,23 @@ namespace Forge {
 			return result;
 		}
 	}
+
+	namespace Algorithm
+	{
+		template<typename InType, Size InDim, typename InEnable>
+		struct THash<Math::TVector<InType, InDim, InEnable>>
+		{
+			U64 operator ()(const Math::TVector<InType, InDim, InEnable>& value) const
+			{
+				U64 hash = THash<InType>()(value.m_data[0]);
+
+				for (Size i = 1; i < InDim; i++)
+					hash = HashCombine(hash, THash<InType>()(value.m_data[i]));
+
+				return hash;
+			}
+		};
+	}
 }
 
 #endif
@@ -0,0 +1,360 @@
+#ifndef ALLOCATOR_POLICY_H
+#define ALLOCATOR_POLICY_H
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <utility>
+
+#include "MemoryUtilities.h"
+#include "AbstractAllocator.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+#include "Core/Public/Common/PreprocessorUtilities.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		/**
+		 * @brief Allocator policy of containers that allocate their storage
+		 * from the heap.
+		 *
+		 * The policy holds no state, containers derive from their policy so
+		 * that the default one adds nothing to their size. Alignments stricter
+		 * than the fundamental alignment of the platform are not supported.
+		 *
+		 * @author Karim Hisham
+		 */
+		class DefaultAllocatorPolicy
+		{
+		public:
+			/**
+			 * @brief Allocates a memory chunk from the heap.
+			 *
+			 * @param[in] size      The size of chunk to allocate in bytes.
+			 * @param[in] alignment The alignment of memory, ignored by the heap.
+			 *
+			 * @return VoidPtr storing the address to start of the allocated chunk.
+			 */
+			VoidPtr Allocate(Size size, Byte alignment)
+			{
+				return malloc(size);
+			}
+
+			/**
+			 * @brief Resizes a memory chunk allocated by this policy, its
+			 * content is carried over up to the smaller of both sizes.
+			 *
+			 * @param[in] address   The address of the chunk to resize, or nullptr.
+			 * @param[in] size      The current size of the chunk in bytes.
+			 * @param[in] new_size  The new size of the chunk in bytes.
+			 * @param[in] alignment The alignment of memory, ignored by the heap.
+			 *
+			 * @return VoidPtr storing the address to start of the resized chunk.
+			 */
+			VoidPtr Reallocate(VoidPtr address, Size size, Size new_size, Byte alignment)
+			{
+				return realloc(address, new_size);
+			}
+
+			/**
+			 * @brief Frees a memory chunk allocated by this policy.
+			 *
+			 * @param[in] address The address of the chunk to free.
+			 */
+			Void Deallocate(VoidPtr address)
+			{
+				free(address);
+			}
+		};
+
+		/**
+		 * @brief Allocator policy of containers that allocate their storage
+		 * from an allocator of the engine.
+		 *
+		 * Node based containers can be placed on a pool allocator and temporary
+		 * arrays on a frame linear allocator this way. A policy that refers no
+		 * allocator falls back to the heap. The allocator must outlive every
+		 * container using it.
+		 *
+		 * @author Karim Hisham
+		 */
+		class InstanceAllocatorPolicy
+		{
+		private:
+			AbstractAllocator* m_allocator;
+
+		public:
+			InstanceAllocatorPolicy(AbstractAllocator* allocator = nullptr)
+				: m_allocator(allocator) {}
+
+		public:
+			/**
+			 * @brief Gets the allocator that serves allocations.
+			 *
+			 * @return AbstractAllocator* storing the allocator or nullptr if
+			 * allocations are served by the heap.
+			 */
+			AbstractAllocator* GetAllocator(Void) const;
+
+		public:
+			/**
+			 * @brief Allocates a memory chunk from the allocator.
+			 *
+			 * @param[in] size      The size of chunk to allocate in bytes.
+			 * @param[in] alignment The alignment of memory, must be power of two.
+			 *
+			 * @return VoidPtr storing the address to start of the allocated chunk.
+			 *
+			 * @throws BadAllocationException if the allocator runs out of memory.
+			 */
+			VoidPtr Allocate(Size size, Byte alignment)
+			{
+				if (!m_allocator)
+					return malloc(size);
+
+				return m_allocator->Allocate(size, alignment);
+			}
+
+			/**
+			 * @brief Resizes a memory chunk allocated by this policy, its
+			 * content is carried over up to the smaller of both sizes.
+			 *
+			 * Not every allocator supports reallocation, so the chunk is moved
+			 * to a new allocation.
+			 *
+			 * @param[in] address   The address of the chunk to resize, or nullptr.
+			 * @param[in] size      The current size of the chunk in bytes.
+			 * @param[in] new_size  The new size of the chunk in bytes.
+			 * @param[in] alignment The alignment of memory, must be power of two.
+			 *
+			 * @return VoidPtr storing the address to start of the resized chunk.
+			 *
+			 * @throws BadAllocationException if the allocator runs out of memory.
+			 */
+			VoidPtr Reallocate(VoidPtr address, Size size, Size new_size, Byte alignment)
+			{
+				if (!m_allocator)
+					return realloc(address, new_size);
+
+				VoidPtr new_address = m_allocator->Allocate(new_size, alignment);
+
+				if (address)
+				{
+					MemoryCopy(new_address, address, size < new_size ? size : new_size);
+
+					m_allocator->Deallocate(address);
+				}
+
+				return new_address;
+			}
+
+			/**
+			 * @brief Frees a memory chunk allocated by this policy.
+			 *
+			 * @param[in] address The address of the chunk to free.
+			 */
+			Void Deallocate(VoidPtr address)
+			{
+				if (!m_allocator)
+					free(address);
+				else
+					m_allocator->Deallocate(address);
+			}
+		};
+
+		/**
+		 * @brief Allocator policy of node based containers that allocate their
+		 * nodes from a pool of slabs owned by the container.
+		 *
+		 * Nodes are carved out of slabs holding a number of nodes each, and
+		 * freed nodes are kept on a free list threaded through the nodes
+		 * themselves, like the pool allocator does. Allocating and freeing a
+		 * node is O(1), and nodes allocated one after the other are next to
+		 * each other in memory. Unlike the pool allocator the pool is not
+		 * limited in capacity, a new slab is added once all nodes are in use.
+		 *
+		 * Every allocation must be of the same size, which is fixed by the
+		 * first allocation, and the slabs are only freed when the policy is
+		 * destroyed. A copy of the policy starts with an empty pool, since the
+		 * nodes of a container are never shared with its copy.
+		 *
+		 * @author Karim Hisham
+		 */
+		class NodePoolAllocatorPolicy
+		{
+		private:
+			static constexpr Size SLAB_HEADER_SIZE = alignof(max_align_t) > sizeof(VoidPtr) ? alignof(max_align_t) : sizeof(VoidPtr);
+
+		private:
+			/// Slabs are chained through their first pointer.
+			VoidPtr m_slabs;
+
+			/// Free nodes are chained through their first pointer.
+			VoidPtr m_free_list;
+
+			Size m_chunk_size;
+			Size m_slab_capacity;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * @param[in] slab_capacity The number of nodes in each slab.
+			 */
+			NodePoolAllocatorPolicy(Size slab_capacity = 64)
+				: m_slabs(nullptr), m_free_list(nullptr), m_chunk_size(0), m_slab_capacity(slab_capacity > 0 ? slab_capacity : 1) {}
+
+			NodePoolAllocatorPolicy(NodePoolAllocatorPolicy&& other)
+				: m_slabs(nullptr), m_free_list(nullptr), m_chunk_size(0), m_slab_capacity(other.m_slab_capacity)
+			{
+				*this = std::move(other);
+			}
+			NodePoolAllocatorPolicy(const NodePoolAllocatorPolicy& other)
+				: m_slabs(nullptr), m_free_list(nullptr), m_chunk_size(0), m_slab_capacity(other.m_slab_capacity) {}
+
+		public:
+			~NodePoolAllocatorPolicy()
+			{
+				this->Release();
+			}
+
+		public:
+			NodePoolAllocatorPolicy& operator =(NodePoolAllocatorPolicy&& other)
+			{
+				if (this == &other)
+					return *this;
+
+				this->Release();
+
+				this->m_slabs = other.m_slabs;
+				this->m_free_list = other.m_free_list;
+				this->m_chunk_size = other.m_chunk_size;
+				this->m_slab_capacity = other.m_slab_capacity;
+
+				other.m_slabs = other.m_free_list = nullptr;
+				other.m_chunk_size = 0;
+
+				return *this;
+			}
+			NodePoolAllocatorPolicy& operator =(const NodePoolAllocatorPolicy& other)
+			{
+				return *this;
+			}
+
+		private:
+			Void AddSlab(Void)
+			{
+				VoidPtr slab = malloc(SLAB_HEADER_SIZE + this->m_chunk_size * this->m_slab_capacity);
+
+				if (!slab)
+					FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "Failed to allocate a node pool slab")
+
+				*reinterpret_cast<VoidPtr*>(slab) = this->m_slabs;
+				this->m_slabs = slab;
+
+				// Chains the nodes in address order, so that they are handed
+				// out in the order they are laid out in the slab.
+				VoidPtr chunk = AddAddress(slab, SLAB_HEADER_SIZE);
+
+				for (Size i = 0; i < this->m_slab_capacity - 1; i++)
+				{
+					VoidPtr next_chunk = AddAddress(chunk, this->m_chunk_size);
+
+					*reinterpret_cast<VoidPtr*>(chunk) = next_chunk;
+					chunk = next_chunk;
+				}
+
+				*reinterpret_cast<VoidPtr*>(chunk) = this->m_free_list;
+				this->m_free_list = AddAddress(slab, SLAB_HEADER_SIZE);
+			}
+
+			Void Release(Void)
+			{
+				while (this->m_slabs)
+				{
+					VoidPtr next_slab = *reinterpret_cast<VoidPtr*>(this->m_slabs);
+
+					free(this->m_slabs);
+
+					this->m_slabs = next_slab;
+				}
+
+				this->m_free_list = nullptr;
+			}
+
+		public:
+			/**
+			 * @brief Gets the size of the nodes served by the pool.
+			 *
+			 * @return Size storing the node size in bytes, or 0 if nothing has
+			 * been allocated yet.
+			 */
+			Size GetChunkSize(Void) const;
+
+			/**
+			 * @brief Gets the number of nodes in each slab.
+			 *
+			 * @return Size storing the number of nodes in each slab.
+			 */
+			Size GetSlabCapacity(Void) const;
+
+		public:
+			/**
+			 * @brief Allocates a node from the pool, adding a slab if every node
+			 * is in use.
+			 *
+			 * @param[in] size      The size of the node, not larger than the size
+			 * of the first allocation.
+			 * @param[in] alignment The alignment of memory, not stricter than the
+			 * fundamental alignment of the platform.
+			 *
+			 * @return VoidPtr storing the address to start of the allocated node.
+			 *
+			 * @throws InvalidArgumentException if the size is larger than the
+			 * size of the first allocation.
+			 * @throws BadAllocationException if a slab could not be allocated.
+			 */
+			VoidPtr Allocate(Size size, Byte alignment)
+			{
+				if (this->m_chunk_size && size > this->m_chunk_size)
+					FORGE_EXCEPT(Debug::ExceptionType::FORGE_ARGUMENT, "Node pools serve a single node size")
+
+				if (!this->m_free_list)
+				{
+					if (!this->m_chunk_size)
+					{
+						Size chunk_alignment = alignment > sizeof(VoidPtr) ? alignment : sizeof(VoidPtr);
+
+						this->m_chunk_size = (size + chunk_alignment - 1) & ~(chunk_alignment - 1);
+					}
+
+					this->AddSlab();
+				}
+
+				VoidPtr address = this->m_free_list;
+				this->m_free_list = *reinterpret_cast<VoidPtr*>(address);
+
+				return address;
+			}
+
+			/**
+			 * @brief Returns a node allocated by this policy to the pool.
+			 *
+			 * @param[in] address The address of the node to free.
+			 */
+			Void Deallocate(VoidPtr address)
+			{
+				*reinterpret_cast<VoidPtr*>(address) = this->m_free_list;
+				this->m_free_list = address;
+			}
+		};
+
+		FORGE_FORCE_INLINE AbstractAllocator* InstanceAllocatorPolicy::GetAllocator(Void) const { return m_allocator; }
+
+		FORGE_FORCE_INLINE Size NodePoolAllocatorPolicy::GetChunkSize(Void) const { return m_chunk_size; }
+		FORGE_FORCE_INLINE Size NodePoolAllocatorPolicy::GetSlabCapacity(Void) const { return m_slab_capacity; }
+	}
+}
+
+#endif // ALLOCATOR_POLICY_H
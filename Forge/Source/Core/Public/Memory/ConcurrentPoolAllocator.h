@@ -0,0 +1,233 @@
+#ifndef CONCURRENT_POOL_ALLOCATOR_H
+#define CONCURRENT_POOL_ALLOCATOR_H
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+
+#include "MemoryUtilities.h"
+#include "AbstractAllocator.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		/**
+		 * @brief Manages memory in fixed-size chunks that can be allocated and
+		 * freed concurrently from any thread.
+		 *
+		 * Free chunks form a lock-free Treiber stack. Links are stored as chunk
+		 * indices, which lets the head pack the top index together with a
+		 * modification tag in a single 64-bit word, so every push and pop is a
+		 * single compare-and-swap and the tag makes the stack safe from the
+		 * ABA problem.
+		 *
+		 * Optionally every thread keeps a small cache of chunks that is refilled
+		 * from and flushed to the shared stack in batches, which keeps most
+		 * allocations off the contended head entirely.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API ConcurrentPoolAllocator : public AbstractAllocator
+		{
+		private:
+			struct ThreadCache
+			{
+				std::thread::id m_thread_id;
+
+				U32* m_chunks;
+				U32  m_count;
+
+				std::atomic<Size> m_num_of_allocs;
+				std::atomic<Size> m_num_of_deallocs;
+
+				ThreadCache* m_next;
+			};
+
+		private:
+			alignas(64) std::atomic<U64> m_head;
+
+		private:
+			alignas(64) VoidPtr m_pool_ptr;
+
+			Size m_chunk_size;
+			Size m_chunk_alignment;
+			U32  m_num_of_chunks;
+
+		private:
+			U32 m_cache_size;
+
+			ThreadCache* m_thread_caches;
+			std::mutex   m_cache_mutex;
+
+			U64 m_id;
+
+		public:
+			/**
+			 * @brief Constructs a concurrent pool allocator object.
+			 *
+			 * The concurrent pool allocator object will allocate a memory pool
+			 * that will be owned and managed by it.
+			 *
+			 * @param[in] chunk_size Size of a single chunk in bytes.
+			 * @param[in] capacity   Size of the memory pool in bytes.
+			 * @param[in] cache_size Number of chunks every thread may cache, or
+			 * zero to always use the shared stack.
+			 * @param[in] alignment  Alignment of every chunk, must be power of
+			 * two. The chunk size is rounded up to a multiple of it.
+			 *
+			 * @throws InvalidOperationException if the chunk size is smaller
+			 * than U32 or the alignment is not a power of two.
+			 */
+			ConcurrentPoolAllocator(Size chunk_size, Size capacity, Size cache_size = 0, Byte alignment = sizeof(VoidPtr));
+
+			/**
+			 * @brief Constructs a concurrent pool allocator object.
+			 *
+			 * The concurrent pool allocater is supplied a pre-allocated memory
+			 * pool that is managed by another object.
+			 *
+			 * @param[in] start      Address of start of the pre-allocated memory pool.
+			 * @param[in] chunk_size Size of a single chunk in bytes.
+			 * @param[in] capacity   Size of the memory pool in bytes.
+			 * @param[in] cache_size Number of chunks every thread may cache, or
+			 * zero to always use the shared stack.
+			 * @param[in] alignment  Alignment of every chunk, must be power of
+			 * two. The chunk size is rounded up to a multiple of it.
+			 *
+			 * @throws InvalidOperationException if the chunk size is smaller
+			 * than U32 or the alignment is not a power of two.
+			 */
+			ConcurrentPoolAllocator(VoidPtr start, Size chunk_size, Size capacity, Size cache_size = 0, Byte alignment = sizeof(VoidPtr));
+
+		public:
+		   ~ConcurrentPoolAllocator();
+
+		private:
+			static U64 MakeHead(U32 link, U32 tag);
+
+		private:
+			VoidPtr GetChunkAddress(U32 link);
+			U32     GetChunkLink(VoidPtr address);
+
+			U32  LoadNextLink(U32 link);
+			Void StoreNextLink(U32 link, U32 next_link);
+
+		private:
+			Void InitializePool(Void);
+
+		private:
+			U32  PopChunk(Void);
+			Void PushChunks(U32 first_link, U32 last_link);
+
+		private:
+			ThreadCache* GetThreadCache(Void);
+			ThreadCache* CreateThreadCache(Void);
+
+		public:
+			/**
+			 * @brief Gets the size of a single chunk of the pool.
+			 *
+			 * @return Size storing the chunk size in bytes.
+			 */
+			Size GetChunkSize(Void);
+
+			/**
+			 * @brief Gets the alignment every chunk of the pool satisfies.
+			 *
+			 * @return Size storing the chunk alignment in bytes.
+			 */
+			Size GetChunkAlignment(Void);
+
+			/**
+			 * @brief Gets the number of chunks every thread may cache.
+			 *
+			 * @return Size storing the thread cache size in chunks.
+			 */
+			Size GetCacheSize(Void);
+
+		public:
+			/**
+			 * @brief Gets the space currently handed out from the memory pool,
+			 * not counting chunks idle in thread caches.
+			 *
+			 * @return Size storing the occupied space in bytes.
+			 */
+			Size GetUsedMemory(Void) override;
+
+			/**
+			 * @brief Gets the number of allocations made through every thread
+			 * during the lifetime of the allocator.
+			 *
+			 * @return Size storing the number of allocations made.
+			 */
+			Size GetNumOfAllocs(Void) override;
+
+			/**
+			 * @brief Gets the number of deallocations made through every thread
+			 * during the lifetime of the allocator.
+			 *
+			 * @return Size storing the number of deallocations made.
+			 */
+			Size GetNumOfDeallocs(Void) override;
+
+		public:
+			/**
+			 * @brief Retrieves a chunk from the pre-allocated memory pool. Safe
+			 * to call from any thread.
+			 *
+			 * @param[in] size      The size of chunk to retrieve in bytes.
+			 * @param[in] alignment The alignment of memory, must be power of two.
+			 *
+			 * @return VoidPtr storing the address to start of the allocated chunk.
+			 *
+			 * @throws BadAllocationException if the size requested is larger
+			 * than the chunk size, the alignment requested is larger than the
+			 * chunk alignment, or the memory pool is exhausted.
+			 */
+			VoidPtr Allocate(Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief The concurrent pool allocator does not allow reallocations
+			 * to previously allocated memory chunks.
+			 *
+			 * @throws InvalidOperationException if attempted to reallocate an
+			 * address.
+			 */
+			VoidPtr Reallocate(VoidPtr address, Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief Frees the address previously allocated from the pre-allocated
+			 * memory pool. Safe to call from any thread.
+			 *
+			 * @param[in] address The address of the chunk to free.
+			 *
+			 * @throws MemoryOutOfBoundsException if the address provided is out
+			 * of the memory pool bounds.
+			 */
+			Void Deallocate(VoidPtr address) override;
+
+		public:
+			/**
+			 * @brief Returns the calling thread's cached chunks to the shared
+			 * stack. Worker threads should call this before exiting.
+			 */
+			Void FlushThreadCache(Void);
+
+		public:
+			/**
+			 * @brief Resets the whole memory pool. No thread may use the
+			 * allocator during the reset.
+			 */
+			Void Reset(Void) override;
+		};
+
+		FORGE_FORCE_INLINE Size ConcurrentPoolAllocator::GetChunkSize(Void)      { return m_chunk_size;      }
+		FORGE_FORCE_INLINE Size ConcurrentPoolAllocator::GetChunkAlignment(Void) { return m_chunk_alignment; }
+		FORGE_FORCE_INLINE Size ConcurrentPoolAllocator::GetCacheSize(Void)      { return m_cache_size;      }
+	}
+}
+
+#endif // CONCURRENT_POOL_ALLOCATOR_H
@@ -9,6 +9,13 @@
 #include "Core/Public/Common/Compiler.h"
 #include "Core/Public/Common/TypeDefinitions.h"
 
+namespace Forge {
+	namespace Platform
+	{
+		class AbstractPlatform;
+	}
+}
+
 namespace Forge {
 	namespace Memory
 	{
@@ -23,6 +30,11 @@ namespace Forge {
 		 * To free memory, the entire memory pool must be reset. This makes the
 		 * linear allocator useful for single-frame allocations.
 		 *
+		 * When constructed with a platform, the memory pool is only reserved as
+		 * a virtual address range and pages are committed as the offset grows,
+		 * so the capacity can be sized for the worst case without paying for
+		 * it in resident memory.
+		 *
 		 * @author Karim Hisham
 		 */
 		class FORGE_API LinearAllocator : public AbstractAllocator
@@ -30,13 +42,46 @@ namespace Forge {
 		private:
 			VoidPtr m_offset_ptr;
 
+		private:
+			Platform::AbstractPlatform* m_platform;
+
+			Size m_page_size;
+			Size m_committed_size;
+			Size m_retained_size;
+
 		public:
 			LinearAllocator(Size total_size);
 			LinearAllocator(VoidPtr start, Size total_size);
 
+			/**
+			 * @brief Constructs a growable linear allocator object.
+			 *
+			 * The linear allocator reserves a virtual memory range through the
+			 * platform and commits pages only as allocations reach them.
+			 *
+			 * @param[in] platform      The platform used to reserve and commit pages.
+			 * @param[in] total_size    Size of the virtual range to reserve in bytes.
+			 * @param[in] retained_size Size of committed memory kept on reset in
+			 * bytes, any committed memory beyond it is decommitted.
+			 */
+			LinearAllocator(Platform::AbstractPlatform* platform, Size total_size, Size retained_size = 0);
+
 		public:
 		   ~LinearAllocator();
 
+		private:
+			Void CommitMemory(Size used_size);
+			Void DecommitMemory(Void);
+
+		public:
+			/**
+			 * @brief Gets the size of memory currently backed by physical pages.
+			 *
+			 * @return Size storing the committed size in bytes, or the total
+			 * size if the memory pool is not growable.
+			 */
+			Size GetCommittedSize(Void);
+
 		public:
 			/**
 			 * @brief Retrieves a properly aligned memory address from the
@@ -74,10 +119,14 @@ namespace Forge {
 			/**
 			 * @brief Resets the whole memory pool.
 			 * 
-			 * This function sets the entire allocated memory pool to zeros.
+			 * This function sets the entire allocated memory pool to zeros. A
+			 * growable memory pool only zeros the retained memory, and decommits
+			 * the rest.
 			 */
 			Void Reset(void) override;
 		};
+
+		FORGE_FORCE_INLINE Size LinearAllocator::GetCommittedSize(Void) { return m_platform ? m_committed_size : m_stats.m_total_size; }
 	}
 }
 
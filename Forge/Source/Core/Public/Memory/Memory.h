@@ -4,10 +4,18 @@
 #include "CAllocator.h"
 #include "MemorySystem.h"
 #include "PoolAllocator.h"
+#include "RecordingAllocator.h"
+#include "ConcurrentPoolAllocator.h"
+#include "TLSFAllocator.h"
 #include "StackAllocator.h"
 #include "LinearAllocator.h"
+#include "MultiFrameAllocator.h"
+#include "MemoryTracker.h"
 #include "MemoryUtilities.h"
 #include "FreeListAllocator.h"
+#include "ThreadCachingAllocator.h"
+#include "TrackingAllocator.h"
 #include "AbstractAllocator.h"
+#include "AllocatorPolicy.h"
 
 #endif // MEMORY_H
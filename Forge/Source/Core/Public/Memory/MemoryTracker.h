@@ -0,0 +1,229 @@
+#ifndef MEMORY_TRACKER_H
+#define MEMORY_TRACKER_H
+
+#include <cstdio>
+
+#include "Core/Public/Common/Common.h"
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+/**
+ * Allocation tracking is compiled into debug builds, and can be compiled into
+ * any other build by defining FORGE_ENABLE_MEMORY_TRACKING, or out of debug
+ * builds by defining FORGE_DISABLE_MEMORY_TRACKING.
+ *
+ * The engine is built with FORGE_BUILD_DEBUG while the Debug configurations
+ * of the test and benchmark projects define FORGE_DEBUG, both have to agree
+ * on whether scopes exist. Their Release configurations define neither, so
+ * scopes compile to nothing there.
+ */
+#if (defined(FORGE_BUILD_DEBUG) || defined(FORGE_DEBUG)) && !defined(FORGE_DISABLE_MEMORY_TRACKING) && !defined(FORGE_ENABLE_MEMORY_TRACKING)
+	#define FORGE_ENABLE_MEMORY_TRACKING
+#endif
+
+/**
+ * The call-site is registered once, the first time the scope is entered.
+ */
+#if defined(FORGE_ENABLE_MEMORY_TRACKING)
+	#define FORGE_MEMORY_SCOPE(__TAG__) \
+		static const Forge::U32 FORGE_CONCATENATE(memory_call_site_, __LINE__) = Forge::Memory::MemoryTracker::RegisterCallSite(__TAG__, __FILE__, __LINE__); \
+		Forge::Memory::MemoryScope FORGE_CONCATENATE(memory_scope_, __LINE__)(__TAG__, FORGE_CONCATENATE(memory_call_site_, __LINE__));
+#else
+	#define FORGE_MEMORY_SCOPE(__TAG__)
+#endif
+
+namespace Forge {
+	namespace Memory
+	{
+		enum class MemoryTag : U8
+		{
+			/**
+			 * @brief Allocations made outside of any memory scope.
+			 */
+			FORGE_ENUM_DECL(FORGE_UNTAGGED,        0)
+
+			FORGE_ENUM_DECL(FORGE_CORE,            1)
+			FORGE_ENUM_DECL(FORGE_CONTAINERS,      2)
+			FORGE_ENUM_DECL(FORGE_STRINGS,         3)
+			FORGE_ENUM_DECL(FORGE_RTTI,            4)
+			FORGE_ENUM_DECL(FORGE_PLATFORM,        5)
+			FORGE_ENUM_DECL(FORGE_GRAPHICS_DEVICE, 6)
+			FORGE_ENUM_DECL(FORGE_RENDERING,       7)
+			FORGE_ENUM_DECL(FORGE_PHYSICS,         8)
+			FORGE_ENUM_DECL(FORGE_AUDIO,           9)
+			FORGE_ENUM_DECL(FORGE_GAMEPLAY,        10)
+
+			MAX
+		};
+
+		/**
+		 * @brief Collects memory usage of every subsystem for budgeting and
+		 * post-mortem analysis.
+		 *
+		 * Every tracked allocation is attributed to a subsystem tag, and
+		 * optionally to the call-site of the memory scope it was made in. Per
+		 * tag, the tracker keeps live bytes, a high-water mark and a histogram
+		 * of allocation sizes in power of two buckets.
+		 *
+		 * Allocation counts and histograms are kept in per-thread counters that
+		 * are only written by their owning thread, while live bytes and
+		 * high-water marks are kept in shared atomics, so tracking never takes
+		 * a lock outside of a thread's first allocation.
+		 *
+		 * Allocations are reported to the tracker by the TrackingAllocator,
+		 * and the tag and call-site are picked up from the innermost memory
+		 * scope of the allocating thread.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API MemoryTracker
+		{
+		public:
+			enum
+			{
+				NUM_OF_SIZE_BUCKETS = 16,
+				MAX_NUM_OF_CALL_SITES = 1024
+			};
+
+		public:
+			struct TagStats
+			{
+				Size m_live_bytes;
+				Size m_peak_bytes;
+				Size m_total_bytes;
+				Size m_num_of_allocs;
+				Size m_num_of_deallocs;
+
+				/// Allocations of at most 16 bytes, 32 bytes and so on, the
+				/// last bucket holds everything larger.
+				Size m_histogram[NUM_OF_SIZE_BUCKETS];
+			};
+
+		public:
+			/**
+			 * @brief Gets the display name of a subsystem tag.
+			 *
+			 * @param[in] tag The subsystem tag.
+			 *
+			 * @return ConstCharPtr storing the name of the tag.
+			 */
+			static ConstCharPtr GetTagName(MemoryTag tag);
+
+			/**
+			 * @brief Gets the histogram bucket an allocation size falls into.
+			 *
+			 * @param[in] size The size of the allocation in bytes.
+			 *
+			 * @return U32 storing the index of the bucket.
+			 */
+			static U32 GetSizeBucket(Size size);
+
+		public:
+			/**
+			 * @brief Registers a call-site that allocations can be attributed to.
+			 *
+			 * Registering the same call-site again returns the same identifier.
+			 *
+			 * @param[in] tag  The subsystem tag of the call-site.
+			 * @param[in] file The source file of the call-site, must be a
+			 * string literal.
+			 * @param[in] line The source line of the call-site.
+			 *
+			 * @return U32 storing the call-site identifier, or zero if the
+			 * call-site table is full.
+			 */
+			static U32 RegisterCallSite(MemoryTag tag, ConstCharPtr file, U32 line);
+
+			/**
+			 * @brief Gets the tag of the innermost memory scope of the calling
+			 * thread.
+			 *
+			 * @return MemoryTag storing the tag, or FORGE_UNTAGGED outside of
+			 * any memory scope.
+			 */
+			static MemoryTag GetScopeTag(Void);
+
+			/**
+			 * @brief Gets the call-site of the innermost memory scope of the
+			 * calling thread.
+			 *
+			 * @return U32 storing the call-site identifier, or zero if there is
+			 * none.
+			 */
+			static U32 GetScopeCallSite(Void);
+
+		public:
+			/**
+			 * @brief Records an allocation.
+			 *
+			 * @param[in] tag       The subsystem tag of the allocation.
+			 * @param[in] call_site The call-site identifier, or zero.
+			 * @param[in] size      The size of the allocation in bytes.
+			 */
+			static Void TrackAllocation(MemoryTag tag, U32 call_site, Size size);
+
+			/**
+			 * @brief Records the deallocation of a previously recorded allocation.
+			 *
+			 * @param[in] tag       The subsystem tag of the allocation.
+			 * @param[in] call_site The call-site identifier of the allocation.
+			 * @param[in] size      The size of the allocation in bytes.
+			 */
+			static Void TrackDeallocation(MemoryTag tag, U32 call_site, Size size);
+
+		public:
+			/**
+			 * @brief Gets a snapshot of the memory usage of a subsystem.
+			 *
+			 * @param[in] tag The subsystem tag.
+			 *
+			 * @return TagStats storing the usage summed over every thread.
+			 */
+			static TagStats GetTagStats(MemoryTag tag);
+
+		public:
+			/**
+			 * @brief Writes a human readable table of the usage of every
+			 * subsystem and the call-sites holding the most live memory.
+			 *
+			 * @param[in] stream The stream to write the report to.
+			 */
+			static Void DumpReport(FILE* stream);
+
+			/**
+			 * @brief Writes a JSON snapshot of the usage of every subsystem and
+			 * every registered call-site.
+			 *
+			 * @param[in] stream The stream to write the snapshot to.
+			 */
+			static Void DumpJson(FILE* stream);
+		};
+
+		/**
+		 * @brief Attributes allocations made by the current thread to a
+		 * subsystem tag until the scope ends. Scopes may nest.
+		 *
+		 * Prefer the FORGE_MEMORY_SCOPE macro, which records the call-site and
+		 * compiles out when memory tracking is disabled.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API MemoryScope
+		{
+		FORGE_CLASS_NONCOPYABLE(MemoryScope)
+
+		private:
+			MemoryTag m_prev_tag;
+			U32       m_prev_call_site;
+
+		public:
+			MemoryScope(MemoryTag tag);
+			MemoryScope(MemoryTag tag, U32 call_site);
+
+		public:
+		   ~MemoryScope();
+		};
+	}
+}
+
+#endif // MEMORY_TRACKER_H
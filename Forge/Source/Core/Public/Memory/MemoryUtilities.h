@@ -1,6 +1,7 @@
 #ifndef MEMORY_UTILITIES_H
 #define MEMORY_UTILITIES_H
 
+#include <cstring>
 #include <iostream>
 
 #include <Core/Public/Common/Common.h>
@@ -11,20 +12,125 @@ using namespace Forge::Common;
 namespace Forge {
 	namespace Memory
 	{
+		enum class MemoryRoutineSet : Byte
+		{
+			/**
+			 * @brief Portable word-at-a-time routines, used when no vector
+			 * extension is available.
+			 */
+			FORGE_ENUM_DECL(FORGE_SCALAR, 0x0)
+
+			/**
+			 * @brief Routines operating on 16-byte SSE2 registers.
+			 */
+			FORGE_ENUM_DECL(FORGE_SSE2,   0x1)
+
+			/**
+			 * @brief Routines operating on 32-byte AVX2 registers.
+			 */
+			FORGE_ENUM_DECL(FORGE_AVX2,   0x2)
+
+			/**
+			 * @brief Routines operating on 64-byte AVX-512 (F + BW) registers.
+			 */
+			FORGE_ENUM_DECL(FORGE_AVX512, 0x3)
+
+			MAX
+		};
+
+		using MemoryCopyFunc    = Void(*)(VoidPtr dst, ConstVoidPtr src, Size bytes);
+		using MemorySetFunc     = Void(*)(VoidPtr dst, Byte value, Size bytes);
+		using MemoryCompareFunc = Bool(*)(ConstVoidPtr lh_address, ConstVoidPtr rh_address, Size bytes);
+
+		/**
+		 * @brief Dispatch table of the bulk memory routines.
+		 * 
+		 * The global table starts out pointing at resolver routines that query
+		 * the processor features through CPUID on first use, install the
+		 * widest supported routine set and forward the call. Every following
+		 * call is a single indirect call into the selected routine. The routine
+		 * set is installed once, during static initialization, or earlier if a
+		 * routine is called by the static initialization of another module.
+		 */
+		struct MemoryRoutineTable
+		{
+			MemoryCopyFunc    m_copy;
+			MemorySetFunc     m_set;
+			MemoryCompareFunc m_compare;
+		};
+
+		extern FORGE_API MemoryRoutineTable g_memory_routine_table;
+
+		/**
+		 * @brief Gets the widest routine set supported by the processor and
+		 * the operating system.
+		 *
+		 * @returns MemoryRoutineSet storing the detected routine set.
+		 */
+		FORGE_API MemoryRoutineSet DetectMemoryRoutineSet(Void);
+
+		/**
+		 * @brief Gets the routine set currently installed in the global
+		 * dispatch table.
+		 * 
+		 * @returns MemoryRoutineSet storing the active routine set.
+		 */
+		FORGE_API MemoryRoutineSet GetActiveMemoryRoutineSet(Void);
+
+		/**
+		 * @brief Gets the dispatch table of a specific routine set without
+		 * installing it.
+		 * 
+		 * @param[in] routine_set The routine set to retrieve.
+		 * 
+		 * @returns MemoryRoutineTable storing the routines of the set.
+		 * 
+		 * @throws InvalidOperationException if the routine set is not
+		 * supported by the processor.
+		 */
+		FORGE_API MemoryRoutineTable GetMemoryRoutineTable(MemoryRoutineSet routine_set);
+
+		/**
+		 * @brief Installs a specific routine set in the global dispatch table.
+		 *
+		 * This overrides the startup detection, and is meant for testing and
+		 * benchmarking of the individual routine sets. The table is written
+		 * without synchronization, so no other thread may be calling memory
+		 * routines meanwhile.
+		 *
+		 * @param[in] routine_set The routine set to install.
+		 *
+		 * @throws InvalidOperationException if the routine set is not
+		 * supported by the processor.
+		 */
+		FORGE_API Void SetActiveMemoryRoutineSet(MemoryRoutineSet routine_set);
+
 		/**
 		 * @brief Copies data from source memory buffer to destination memory buffer.
 		 *
+		 * The memory buffers must not overlap.
+		 *
 		 * @param[out] dst   The destination memory buffer where data will be copied to.
 		 * @param[in]  src   The source memory buffer where data is stored.
 		 * @param[in]  bytes The number of bytes to copy to the destination memory buffer.
 		 */
-		FORGE_FORCE_INLINE Void MemoryCopy(VoidPtr dst, VoidPtr src, Size bytes)
+		FORGE_FORCE_INLINE Void MemoryCopy(VoidPtr dst, ConstVoidPtr src, Size bytes)
 		{
-			BytePtr temp_dst = reinterpret_cast<BytePtr>(dst);
-			BytePtr temp_src = reinterpret_cast<BytePtr>(src);
+			g_memory_routine_table.m_copy(dst, src, bytes);
+		}
 
-			for (int i = 0; i < bytes; i++)
-				*(temp_dst + i) = *(temp_src + i);
+		/**
+		 * @brief Copies data from source memory buffer to destination memory buffer.
+		 *
+		 * Unlike MemoryCopy, the memory buffers may overlap.
+		 *
+		 * @param[out] dst   The destination memory buffer where data will be copied to.
+		 * @param[in]  src   The source memory buffer where data is stored.
+		 * @param[in]  bytes The number of bytes to copy to the destination memory buffer.
+		 */
+		FORGE_FORCE_INLINE Void MemoryMove(VoidPtr dst, ConstVoidPtr src, Size bytes)
+		{
+			memmove(dst, src, bytes);
 		}
 
 		/**
@@ -36,10 +142,7 @@ namespace Forge {
 		 */
 		FORGE_FORCE_INLINE Void MemorySet(VoidPtr dst, Byte value, Size bytes)
 		{
-			BytePtr temp_dst = reinterpret_cast<BytePtr>(dst);
-
-			for (int i = 0; i < bytes; i++)
-				*(temp_dst + i) = value;
+			g_memory_routine_table.m_set(dst, value, bytes);
 		}
 
 		/**
@@ -56,14 +159,7 @@ namespace Forge {
 			if (lh_address == rh_address)
 				return FORGE_TRUE;
 
-			BytePtr temp_lh = reinterpret_cast<BytePtr>(lh_address);
-			BytePtr temp_rh = reinterpret_cast<BytePtr>(rh_address);
-
-			for (U32 i = 0; i < bytes; i++)
-				if (*(temp_lh + i) != *(temp_rh + i))
-					return FORGE_FALSE;
-
-			return FORGE_TRUE;
+			return g_memory_routine_table.m_compare(lh_address, rh_address, bytes);
 		}
 
 		/**
@@ -80,14 +176,7 @@ namespace Forge {
 			if (lh_address == rh_address)
 				return FORGE_TRUE;
 
-			ConstBytePtr temp_lh = reinterpret_cast<ConstBytePtr>(lh_address);
-			ConstBytePtr temp_rh = reinterpret_cast<ConstBytePtr>(rh_address);
-
-			for (U32 i = 0; i < bytes; i++)
-				if (*(temp_lh + i) != *(temp_rh + i))
-					return FORGE_FALSE;
-
-			return FORGE_TRUE;
+			return g_memory_routine_table.m_compare(lh_address, rh_address, bytes);
 		}
 
 		namespace
@@ -95,7 +184,7 @@ namespace Forge {
 			template<typename InType>
 			FORGE_FORCE_INLINE Void ConstructImpl(InType* dst, Size count, TypeIsPod)
 			{
-				FORGE_NOT_IMPLEMENTED()
+				MemorySet(dst, 0, count * sizeof(InType));
 			}
 			template<typename InType>
 			FORGE_FORCE_INLINE Void ConstructImpl(InType* dst, Size count, TypeIsClass)
@@ -107,7 +196,6 @@ namespace Forge {
 			template<typename InType>
 			FORGE_FORCE_INLINE Void DestructImpl(InType* dst, Size count, TypeIsPod)
 			{
-				FORGE_NOT_IMPLEMENTED()
 			}
 			template<typename InType>
 			FORGE_FORCE_INLINE Void DestructImpl(InType* dst, Size count, TypeIsClass)
@@ -207,6 +295,34 @@ namespace Forge {
 					new (dst + i) InType(Algorithm::Move(*(src + i)));
 			}
 
+			template<typename InType>
+			FORGE_FORCE_INLINE Void RelocateArrayImpl(InType* dst, InType* src, Size count, TypeIsPod)
+			{
+				MemoryMove(dst, src, count * sizeof(InType));
+			}
+			template<typename InType>
+			FORGE_FORCE_INLINE Void RelocateArrayImpl(InType* dst, InType* src, Size count, TypeIsClass)
+			{
+				/// Overlapping arrays are walked away from the overlap, so that
+				/// no element is overwritten before it has been relocated.
+				if (dst < src)
+				{
+					for (Size i = 0; i < count; i++)
+					{
+						new (dst + i) InType(Algorithm::Move(*(src + i)));
+						(src + i)->~InType();
+					}
+				}
+				else
+				{
+					for (Size i = count; i > 0; i--)
+					{
+						new (dst + i - 1) InType(Algorithm::Move(*(src + i - 1)));
+						(src + i - 1)->~InType();
+					}
+				}
+			}
+
 			template<typename InType>
 			FORGE_FORCE_INLINE Void CopyConstructArrayImpl(InType* dst, InType* src, Size count, TypeIsPod)
 			{
@@ -370,6 +486,27 @@ namespace Forge {
 			MoveConstructArrayImpl(dst, src, count, TTraitInt<TIsPod<InType>::Value>());
 		}
 
+		/**
+		 * @brief Relocates the elements stored in source array to destination
+		 * array.
+		 *
+		 * The elements are constructed in the destination array and the source
+		 * array is left unconstructed. The arrays may overlap. Trivially
+		 * relocatable elements are relocated with a single bulk memory move.
+		 *
+		 * @param[out] dst   The destination array to relocate elements to.
+		 * @param[in]  src   The source array where elements will be relocated from.
+		 * @param[in]  count The number of elements to relocate to the destination array.
+		 */
+		template<typename InType>
+		FORGE_FORCE_INLINE Void RelocateArray(InType* dst, InType* src, Size count)
+		{
+			if (dst == src || !count)
+				return;
+
+			RelocateArrayImpl(dst, src, count, TTraitInt<TIsTriviallyRelocatable<InType>::Value>());
+		}
+
 		/**
 		 * @brief Copy constructs the elements stored in source array to
 		 * destiniation array.
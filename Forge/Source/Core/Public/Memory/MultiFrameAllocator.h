@@ -0,0 +1,236 @@
+#ifndef MULTI_FRAME_ALLOCATOR_H
+#define MULTI_FRAME_ALLOCATOR_H
+
+#include <atomic>
+
+#include "MemoryUtilities.h"
+#include "LinearAllocator.h"
+#include "AbstractAllocator.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		/**
+		 * @brief Manages transient memory that must outlive the frame it was
+		 * allocated in, while later frames are still being consumed.
+		 *
+		 * The multi-frame allocator keeps a ring of linear allocators, one for
+		 * every frame in flight. Beginning a frame advances to the next slot of
+		 * the ring, and allocations are then served from that slot until the
+		 * next frame begins.
+		 *
+		 * A slot is only reset when the frame that last used it was retired by
+		 * the consumer, such as the render thread or a GPU fence callback, so
+		 * memory handed out during a frame stays valid until it is signalled
+		 * that the frame is no longer in use.
+		 *
+		 * Allocations and frame advances must happen on a single thread, while
+		 * frames may be retired from any thread.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API MultiFrameAllocator : public AbstractAllocator
+		{
+		public:
+			enum
+			{
+				MAX_NUM_OF_FRAMES = 8
+			};
+
+		public:
+			/**
+			 * Usage of a single frame, as recorded by its slot of the ring.
+			 */
+			struct FrameStats
+			{
+				U64  m_frame_index;
+				Size m_used_memory;
+				Size m_committed_size;
+				Size m_num_of_allocs;
+				Bool m_is_retired;
+			};
+
+		private:
+			LinearAllocator* m_frames;
+
+			U64 m_frame_indices[MAX_NUM_OF_FRAMES];
+			U32 m_num_of_frames;
+
+		private:
+			U64 m_current_frame;
+			Size m_frame_size;
+
+			alignas(64) std::atomic<U64> m_retired_frame;
+
+		public:
+			/**
+			 * @brief Constructs a multi-frame allocator object.
+			 *
+			 * The multi-frame allocator object will allocate a memory pool for
+			 * every frame that will be owned and managed by it.
+			 *
+			 * @param[in] frame_size    Size of the memory pool of a single frame in bytes.
+			 * @param[in] num_of_frames Number of frames that may be in flight at once.
+			 *
+			 * @throws InvalidOperationException if the number of frames is zero
+			 * or larger than MAX_NUM_OF_FRAMES.
+			 */
+			MultiFrameAllocator(Size frame_size, U32 num_of_frames);
+
+			/**
+			 * @brief Constructs a growable multi-frame allocator object.
+			 *
+			 * Every frame reserves a virtual memory range through the platform
+			 * and commits pages only as allocations reach them.
+			 *
+			 * @param[in] platform      The platform used to reserve and commit pages.
+			 * @param[in] frame_size    Size of the virtual range of a single frame in bytes.
+			 * @param[in] num_of_frames Number of frames that may be in flight at once.
+			 * @param[in] retained_size Size of committed memory every frame keeps
+			 * on reset in bytes.
+			 *
+			 * @throws InvalidOperationException if the number of frames is zero
+			 * or larger than MAX_NUM_OF_FRAMES.
+			 */
+			MultiFrameAllocator(Platform::AbstractPlatform* platform, Size frame_size, U32 num_of_frames, Size retained_size = 0);
+
+		public:
+		   ~MultiFrameAllocator();
+
+		private:
+			U32 GetFrameSlot(U64 frame_index);
+
+		public:
+			/**
+			 * @brief Gets the number of frames that may be in flight at once.
+			 *
+			 * @return U32 storing the number of slots of the ring.
+			 */
+			U32 GetNumOfFrames(Void);
+
+			/**
+			 * @brief Gets the size of the memory pool of a single frame.
+			 *
+			 * @return Size storing the frame size in bytes.
+			 */
+			Size GetFrameSize(Void);
+
+			/**
+			 * @brief Gets the index of the frame allocations are served for.
+			 *
+			 * @return U64 storing the current frame index, or zero if no frame
+			 * has begun yet.
+			 */
+			U64 GetCurrentFrame(Void);
+
+			/**
+			 * @brief Gets the index of the latest frame retired by the consumer.
+			 *
+			 * @return U64 storing the retired frame index, or zero if no frame
+			 * has been retired yet.
+			 */
+			U64 GetRetiredFrame(Void);
+
+			/**
+			 * @brief Gets the usage of a frame that is still held by the ring.
+			 *
+			 * @param[in] frame_index The index of the frame.
+			 *
+			 * @return FrameStats storing the usage of the frame.
+			 *
+			 * @throws MemoryOutOfBoundsException if the frame has not begun yet,
+			 * or its slot was already reused by a later frame.
+			 */
+			FrameStats GetFrameStats(U64 frame_index);
+
+		public:
+			/**
+			 * @brief Gets the space currently occupied by every frame in flight.
+			 *
+			 * @return Size storing the occupied space in bytes.
+			 */
+			Size GetUsedMemory(Void) override;
+
+		public:
+			/**
+			 * @brief Checks whether the next frame can begin without waiting
+			 * for the consumer.
+			 *
+			 * @return True if the frame that last used the next slot is retired.
+			 */
+			Bool CanBeginFrame(Void);
+
+			/**
+			 * @brief Advances the ring to the next frame, resetting its slot.
+			 *
+			 * Blocks until the frame that last used the slot is retired.
+			 *
+			 * @return U64 storing the index of the frame that has begun.
+			 */
+			U64 BeginFrame(Void);
+
+			/**
+			 * @brief Signals that the consumer is done with a frame and every
+			 * frame before it. Safe to call from any thread.
+			 *
+			 * @param[in] frame_index The index of the retired frame.
+			 */
+			Void RetireFrame(U64 frame_index);
+
+		public:
+			/**
+			 * @brief Retrieves a properly aligned memory address from the memory
+			 * pool of the current frame.
+			 *
+			 * @param[in] size      The size of chunk to retrieve in bytes.
+			 * @param[in] alignment The alignment of memory, must be power of two.
+			 *
+			 * @return VoidPtr storing the address to start of the allocated chunk.
+			 *
+			 * @throws InvalidOperationException if no frame has begun yet.
+			 *
+			 * @throws BadAllocationException if size requsted is larger than the
+			 * remaining space of the frame.
+			 */
+			VoidPtr Allocate(Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief The multi-frame allocator does not support reallocations to
+			 * previously allocated memory chunks.
+			 *
+			 * @throws InvalidOperationException if attempted to reallocate an
+			 * address.
+			 */
+			VoidPtr Reallocate(VoidPtr address, Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief The multi-frame allocator does not support deallocations to
+			 * previously allocated memory chunks, they are freed when their
+			 * frame is reused.
+			 *
+			 * @throws InvalidOperationException if attempted to deallocate an
+			 * address.
+			 */
+			Void Deallocate(VoidPtr address) override;
+
+		public:
+			/**
+			 * @brief Resets the memory pool of every frame and restarts frame
+			 * numbering. The consumer must be done with every frame.
+			 */
+			Void Reset(Void) override;
+		};
+
+		FORGE_FORCE_INLINE U32 MultiFrameAllocator::GetFrameSlot(U64 frame_index) { return static_cast<U32>(frame_index % m_num_of_frames); }
+
+		FORGE_FORCE_INLINE U32  MultiFrameAllocator::GetNumOfFrames(Void)  { return m_num_of_frames; }
+		FORGE_FORCE_INLINE Size MultiFrameAllocator::GetFrameSize(Void)    { return m_frame_size;    }
+		FORGE_FORCE_INLINE U64  MultiFrameAllocator::GetCurrentFrame(Void) { return m_current_frame; }
+		FORGE_FORCE_INLINE U64  MultiFrameAllocator::GetRetiredFrame(Void) { return m_retired_frame.load(std::memory_order_acquire); }
+	}
+}
+
+#endif // MULTI_FRAME_ALLOCATOR_H
@@ -0,0 +1,222 @@
+#ifndef RECORDING_ALLOCATOR_H
+#define RECORDING_ALLOCATOR_H
+
+#include <mutex>
+#include <chrono>
+#include <cstdio>
+
+#include "MemoryUtilities.h"
+#include "AbstractAllocator.h"
+
+#include "Core/Public/Common/Common.h"
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		enum class AllocationTraceOp : U8
+		{
+			FORGE_ENUM_DECL(FORGE_ALLOCATE,   0)
+			FORGE_ENUM_DECL(FORGE_REALLOCATE, 1)
+			FORGE_ENUM_DECL(FORGE_DEALLOCATE, 2)
+
+			/**
+			 * @brief The whole memory pool was reset, every live address is
+			 * released.
+			 */
+			FORGE_ENUM_DECL(FORGE_RESET,      3)
+
+			MAX
+		};
+
+		/**
+		 * @brief Starts an allocation trace file, followed by its records.
+		 */
+		struct AllocationTraceHeader
+		{
+			U32 m_magic;
+			U32 m_version;
+
+			U64 m_num_of_records;
+		};
+
+		/**
+		 * @brief A single allocator call of an allocation trace file.
+		 *
+		 * Addresses only identify allocations within the trace, a replay maps
+		 * them to the addresses returned by the replaying allocator.
+		 */
+		struct AllocationTraceRecord
+		{
+			/// Nanoseconds since the recording started.
+			U64 m_timestamp;
+
+			/// The allocated, reallocated or deallocated address.
+			U64 m_address;
+
+			/// The address returned by a reallocation.
+			U64 m_new_address;
+
+			U64 m_size;
+			U32 m_thread;
+
+			AllocationTraceOp m_op;
+			Byte              m_alignment;
+			U16               m_reserved;
+		};
+
+		/**
+		 * @brief Records every call made through a backing allocator into a
+		 * binary allocation trace file.
+		 *
+		 * Records are written in the order the calls took effect on the backing
+		 * allocator, which is made unambiguous by serializing the calls of all
+		 * threads, so a trace of a multi-threaded session can be replayed
+		 * sequentially. This makes recording unsuitable for measuring, but not
+		 * for capturing, allocation patterns.
+		 *
+		 * The trace starts with an AllocationTraceHeader and is followed by one
+		 * AllocationTraceRecord per call, both in native byte order.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API RecordingAllocator : public AbstractAllocator
+		{
+		public:
+			enum
+			{
+				TRACE_MAGIC   = 0x52544146, /// "FATR"
+				TRACE_VERSION = 1,
+
+				BUFFER_SIZE   = 4096
+			};
+
+		private:
+			AbstractAllocator* m_backing_allocator;
+
+			FILE* m_file;
+
+			std::mutex m_mutex;
+			std::chrono::steady_clock::time_point m_start_time;
+
+		private:
+			AllocationTraceRecord m_buffer[BUFFER_SIZE];
+
+			Size m_buffer_count;
+			Size m_num_of_records;
+
+		public:
+			/**
+			 * @brief Constructs a recording allocator object.
+			 *
+			 * @param[in] backing_allocator The allocator that serves allocations.
+			 * @param[in] path              The path of the trace file to create.
+			 *
+			 * @throws IOException if the trace file could not be created.
+			 */
+			RecordingAllocator(AbstractAllocator* backing_allocator, ConstCharPtr path);
+
+		public:
+			/**
+			 * @brief Flushes the remaining records and completes the trace file.
+			 */
+		   ~RecordingAllocator();
+
+		private:
+			Void Record(AllocationTraceOp op, VoidPtr address, VoidPtr new_address, Size size, Byte alignment);
+			Void FlushBuffer(Void);
+
+		public:
+			/**
+			 * @brief Gets the allocator that serves allocations.
+			 *
+			 * @return AbstractAllocator* storing the backing allocator.
+			 */
+			AbstractAllocator* GetBackingAllocator(Void);
+
+			/**
+			 * @brief Gets the number of records made so far.
+			 *
+			 * @return Size storing the number of records.
+			 */
+			Size GetNumOfRecords(Void);
+
+		public:
+			/**
+			 * @brief Statistics are those of the backing allocator.
+			 */
+			VoidPtr GetStartAddress(Void) override;
+			Size    GetPeakSize(Void) override;
+			Size    GetTotalSize(Void) override;
+			Size    GetUsedMemory(Void) override;
+			Size    GetNumOfAllocs(Void) override;
+			Size    GetNumOfDeallocs(Void) override;
+
+		public:
+			/**
+			 * @brief Retrieves a properly aligned memory address from the
+			 * backing allocator and records the call.
+			 *
+			 * @param[in] size      The size of chunk to retrieve in bytes.
+			 * @param[in] alignment The alignment of memory, must be power of two.
+			 *
+			 * @return VoidPtr storing the address to start of the allocated chunk.
+			 *
+			 * @throws BadAllocationException if the backing allocator runs out
+			 * of memory.
+			 */
+			VoidPtr Allocate(Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief Resizes an allocated address through the backing allocator
+			 * and records the call.
+			 *
+			 * @param[in] address   The address of the chunk to resize.
+			 * @param[in] size      The new size of the chunk to reallocate in bytes.
+			 * @param[in] alignment The Alignment of memory, must be power of two.
+			 *
+			 * @returns VoidPtr storing the address to the start of the reallocated
+			 * chunk.
+			 *
+			 * @throws InvalidOperationException if not supported by the backing
+			 * allocator.
+			 */
+			VoidPtr Reallocate(VoidPtr address, Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief Records the call and frees the address through the backing
+			 * allocator.
+			 *
+			 * @param[in] address The address of the chunk to free.
+			 *
+			 * @throws InvalidOperationException if not supported by the backing
+			 * allocator.
+			 */
+			Void Deallocate(VoidPtr address) override;
+
+		public:
+			/**
+			 * @brief Writes the buffered records to the trace file.
+			 */
+			Void Flush(Void);
+
+		public:
+			/**
+			 * @brief Resets the backing allocator and records the reset.
+			 */
+			Void Reset(Void) override;
+		};
+
+		FORGE_FORCE_INLINE AbstractAllocator* RecordingAllocator::GetBackingAllocator(Void) { return m_backing_allocator; }
+
+		FORGE_FORCE_INLINE VoidPtr RecordingAllocator::GetStartAddress(Void)  { return m_backing_allocator->GetStartAddress();  }
+		FORGE_FORCE_INLINE Size    RecordingAllocator::GetPeakSize(Void)      { return m_backing_allocator->GetPeakSize();      }
+		FORGE_FORCE_INLINE Size    RecordingAllocator::GetTotalSize(Void)     { return m_backing_allocator->GetTotalSize();     }
+		FORGE_FORCE_INLINE Size    RecordingAllocator::GetUsedMemory(Void)    { return m_backing_allocator->GetUsedMemory();    }
+		FORGE_FORCE_INLINE Size    RecordingAllocator::GetNumOfAllocs(Void)   { return m_backing_allocator->GetNumOfAllocs();   }
+		FORGE_FORCE_INLINE Size    RecordingAllocator::GetNumOfDeallocs(Void) { return m_backing_allocator->GetNumOfDeallocs(); }
+	}
+}
+
+#endif // RECORDING_ALLOCATOR_H
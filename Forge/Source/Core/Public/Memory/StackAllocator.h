@@ -9,6 +9,13 @@
 #include "Core/Public/Common/Compiler.h"
 #include "Core/Public/Common/TypeDefinitions.h"
 
+namespace Forge {
+	namespace Platform
+	{
+		class AbstractPlatform;
+	}
+}
+
 namespace Forge {
 	namespace Memory
 	{
@@ -22,6 +29,11 @@ namespace Forge {
 		 * deallocations to the most recent address allocated, enforcing the LIFO
 		 * principle.
 		 * 
+		 * When constructed with a platform, the memory pool is only reserved as
+		 * a virtual address range and pages are committed as the offset grows,
+		 * so the capacity can be sized for the worst case without paying for
+		 * it in resident memory.
+		 * 
 		 * @author Karim Hisham
 		 */
 		class FORGE_API StackAllocator : public AbstractAllocator
@@ -37,13 +49,46 @@ namespace Forge {
 			VoidPtr m_offset_ptr;
 			VoidPtr m_prev_address;
 
+		private:
+			Platform::AbstractPlatform* m_platform;
+
+			Size m_page_size;
+			Size m_committed_size;
+			Size m_retained_size;
+
 		public:
 			StackAllocator(Size total_size);
 			StackAllocator(VoidPtr start, Size total_size);
 
+			/**
+			 * @brief Constructs a growable stack allocator object.
+			 *
+			 * The stack allocator reserves a virtual memory range through the
+			 * platform and commits pages only as allocations reach them.
+			 *
+			 * @param[in] platform      The platform used to reserve and commit pages.
+			 * @param[in] total_size    Size of the virtual range to reserve in bytes.
+			 * @param[in] retained_size Size of committed memory kept on reset in
+			 * bytes, any committed memory beyond it is decommitted.
+			 */
+			StackAllocator(Platform::AbstractPlatform* platform, Size total_size, Size retained_size = 0);
+
 		public:
 		   ~StackAllocator();
 
+		private:
+			Void CommitMemory(Size used_size);
+			Void DecommitMemory(Void);
+
+		public:
+			/**
+			 * @brief Gets the size of memory currently backed by physical pages.
+			 *
+			 * @return Size storing the committed size in bytes, or the total
+			 * size if the memory pool is not growable.
+			 */
+			Size GetCommittedSize(Void);
+
 		public:
 			/**
 			 * @brief Retrieves a properly aligned memory address from the
@@ -101,9 +146,14 @@ namespace Forge {
 		public:
 			/**
 			 * @brief Resets the whole memory pool.
+			 *
+			 * A growable memory pool decommits any committed memory beyond the
+			 * retained size.
 			 */
 			Void  Reset(void) override;
 		};
+
+		FORGE_FORCE_INLINE Size StackAllocator::GetCommittedSize(Void) { return m_platform ? m_committed_size : m_stats.m_total_size; }
 	}
 }
 
@@ -0,0 +1,198 @@
+#ifndef TLSF_ALLOCATOR_H
+#define TLSF_ALLOCATOR_H
+
+#include <stdlib.h>
+
+#include "MemoryUtilities.h"
+#include "AbstractAllocator.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		/**
+		 * @brief Manages variable-size memory chunks using a two-level
+		 * segregated-fit (TLSF) policy.
+		 *
+		 * Free blocks are kept in size-class lists indexed by a first level
+		 * (power of two) and a second level (linear subdivision of that power
+		 * of two). Two bitmaps record which lists are non-empty, so finding a
+		 * suitable block is a pair of bit scans instead of a list walk. Every
+		 * block carries boundary tags that link it to its physical neighbours,
+		 * which makes coalescing on deallocation constant-time as well.
+		 *
+		 * Allocation and deallocation are both O(1), and the worst-case
+		 * internal fragmentation is bounded by the second level granularity.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API TLSFAllocator : public AbstractAllocator
+		{
+		private:
+			enum
+			{
+				ALIGN_SIZE_LOG2      = 3,
+				ALIGN_SIZE           = 1 << ALIGN_SIZE_LOG2,
+
+				SL_INDEX_COUNT_LOG2  = 5,
+				SL_INDEX_COUNT       = 1 << SL_INDEX_COUNT_LOG2,
+
+				FL_INDEX_MAX         = 38,
+				FL_INDEX_SHIFT       = SL_INDEX_COUNT_LOG2 + ALIGN_SIZE_LOG2,
+				FL_INDEX_COUNT       = FL_INDEX_MAX - FL_INDEX_SHIFT + 1,
+
+				SMALL_BLOCK_SIZE     = 1 << FL_INDEX_SHIFT
+			};
+
+		private:
+			/**
+			 * The previous physical block pointer overlaps the last word of the
+			 * previous block, and is only valid while that block is free. The
+			 * free list links are only valid while this block is free, and
+			 * overlap the user payload otherwise.
+			 */
+			struct BlockHeader
+			{
+				BlockHeader* m_prev_physical;
+
+				Size m_size;
+
+				BlockHeader* m_next_free;
+				BlockHeader* m_prev_free;
+
+				Size GetSize(Void) const;
+				Void SetSize(Size size);
+
+				Bool IsFree(Void) const;
+				Bool IsPrevFree(Void) const;
+
+				Void SetFree(Bool is_free);
+				Void SetPrevFree(Bool is_free);
+
+				VoidPtr ToAddress(Void);
+				static BlockHeader* FromAddress(VoidPtr address);
+
+				BlockHeader* GetNext(Void);
+				BlockHeader* LinkNext(Void);
+
+				Void MarkAsFree(Void);
+				Void MarkAsUsed(Void);
+			};
+
+		private:
+			U64 m_fl_bitmap;
+			U32 m_sl_bitmap[FL_INDEX_COUNT];
+
+		private:
+			BlockHeader* m_free_lists[FL_INDEX_COUNT][SL_INDEX_COUNT];
+
+		public:
+			/**
+			 * @brief Constructs a TLSF allocator object.
+			 *
+			 * The TLSF allocator object will allocate a memory pool that will
+			 * be owned and managed by it.
+			 *
+			 * @param[in] capacity Size of the memory pool in bytes.
+			 */
+			TLSFAllocator(Size capacity);
+
+			/**
+			 * @brief Constructs a TLSF allocator object.
+			 *
+			 * The TLSF allocater is supplied a pre-allocated memory pool that
+			 * is managed by another object.
+			 *
+			 * @param[in] start    Address of start of the pre-allocated memory pool.
+			 * @param[in] capacity Size of the memory pool in bytes.
+			 */
+			TLSFAllocator(VoidPtr start, Size capacity);
+
+		public:
+		   ~TLSFAllocator();
+
+		private:
+			static Void MappingInsert(Size size, I32& fl_index, I32& sl_index);
+			static Void MappingSearch(Size size, I32& fl_index, I32& sl_index);
+			static Size AdjustRequestSize(Size size, Size alignment);
+
+		private:
+			Void InitializePool(Void);
+
+		private:
+			Void InsertFreeBlock(BlockHeader* block);
+			Void InsertFreeBlock(BlockHeader* block, I32 fl_index, I32 sl_index);
+			Void RemoveFreeBlock(BlockHeader* block);
+			Void RemoveFreeBlock(BlockHeader* block, I32 fl_index, I32 sl_index);
+			BlockHeader* LocateFreeBlock(Size size);
+
+		private:
+			BlockHeader* SplitBlock(BlockHeader* block, Size size);
+			BlockHeader* AbsorbBlock(BlockHeader* prev, BlockHeader* block);
+			BlockHeader* MergePrevBlock(BlockHeader* block);
+			BlockHeader* MergeNextBlock(BlockHeader* block);
+
+		private:
+			Void TrimFreeBlock(BlockHeader* block, Size size);
+			Void TrimUsedBlock(BlockHeader* block, Size size);
+			BlockHeader* TrimFreeLeadingBlock(BlockHeader* block, Size size);
+
+		public:
+			/**
+			 * @brief Retrieves a properly aligned memory address from the
+			 * pre-allocated memory pool in constant time.
+			 *
+			 * @param[in] size      The size of chunk to retrieve in bytes.
+			 * @param[in] alignment The alignment of memory, must be power of two.
+			 *
+			 * @return VoidPtr storing the address to start of the allocated chunk.
+			 *
+			 * @throws BadAllocationException if no free block large enough is
+			 * available in the memory pool.
+			 */
+			VoidPtr Allocate(Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief Resizes an allocated address to a new size, growing in place
+			 * into the next physical block when it is free, and otherwise copying
+			 * its content to a new chunk.
+			 *
+			 * @param[in] address   The address of the chunk to resize.
+			 * @param[in] size      The new size of the chunk to reallocate in bytes.
+			 * @param[in] alignment The Alignment of memory, must be power of two.
+			 *
+			 * @returns VoidPtr storing the address to the start of the reallocated
+			 * chunk.
+			 *
+			 * @throws BadAllocationException if no free block large enough is
+			 * available in the memory pool.
+			 *
+			 * @throws MemoryOutOfBoundsException if the address provided is out
+			 * of the memory pool bounds.
+			 */
+			VoidPtr Reallocate(VoidPtr address, Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief Frees the address previously allocated from the pre-allocated
+			 * memory pool in constant time, coalescing it with its free physical
+			 * neighbours.
+			 *
+			 * @param[in] address The address of the chunk to free.
+			 *
+			 * @throws MemoryOutOfBoundsException if the address provided is out
+			 * of the memory pool bounds.
+			 */
+			Void Deallocate(VoidPtr address) override;
+
+		public:
+			/**
+			 * @brief Resets the whole memory pool to a single free block.
+			 */
+			Void Reset(Void) override;
+		};
+	}
+}
+
+#endif // TLSF_ALLOCATOR_H
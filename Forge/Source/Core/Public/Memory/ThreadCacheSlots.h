@@ -0,0 +1,85 @@
+#ifndef THREAD_CACHE_SLOTS_H
+#define THREAD_CACHE_SLOTS_H
+
+#include <atomic>
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		namespace Internal
+		{
+			/**
+			 * Every thread keeps a small set-associative table from allocator
+			 * id to its cache for that allocator, shared by all the thread
+			 * caching allocators. Ids are hashed to pick a set, so allocators
+			 * created one after another land in different sets, and each set
+			 * holds several ways, so a few allocators hashing to the same set
+			 * still do not evict each other.
+			 *
+			 * Ids are never reused, so a slot left behind by a destroyed
+			 * allocator simply never matches again until it is evicted.
+			 */
+			constexpr Size THREAD_CACHE_SET_BITS  = 3;
+			constexpr Size THREAD_CACHE_SET_COUNT = static_cast<Size>(1) << THREAD_CACHE_SET_BITS;
+			constexpr Size THREAD_CACHE_WAY_COUNT = 4;
+
+			struct ThreadCacheSlot
+			{
+				U64     m_owner_id;
+				VoidPtr m_cache;
+			};
+
+			extern thread_local ThreadCacheSlot t_thread_cache_slots[THREAD_CACHE_SET_COUNT][THREAD_CACHE_WAY_COUNT];
+
+			/**
+			 * @brief Gets a new process-wide unique non-zero owner id.
+			 */
+			U64 AcquireThreadCacheOwnerId(Void);
+
+			/**
+			 * @brief Gets the set of the calling thread's table that the owner
+			 * id maps to.
+			 */
+			FORGE_FORCE_INLINE ThreadCacheSlot* GetThreadCacheSet(U64 owner_id)
+			{
+				/// Fibonacci hashing spreads consecutive ids over the sets.
+				return t_thread_cache_slots[(owner_id * 0x9E3779B97F4A7C15ull) >> (64 - THREAD_CACHE_SET_BITS)];
+			}
+
+			/**
+			 * @brief Gets the calling thread's cache registered for the owner
+			 * id, or nullptr if it is not in the table.
+			 */
+			FORGE_FORCE_INLINE VoidPtr FindThreadCacheSlot(U64 owner_id)
+			{
+				ThreadCacheSlot* set = GetThreadCacheSet(owner_id);
+
+				for (Size i = 0; i < THREAD_CACHE_WAY_COUNT; i++)
+					if (set[i].m_owner_id == owner_id)
+						return set[i].m_cache;
+
+				return nullptr;
+			}
+
+			/**
+			 * @brief Registers the calling thread's cache for the owner id,
+			 * evicting the least recently stored way of its set.
+			 */
+			FORGE_FORCE_INLINE Void StoreThreadCacheSlot(U64 owner_id, VoidPtr cache)
+			{
+				ThreadCacheSlot* set = GetThreadCacheSet(owner_id);
+
+				for (Size i = THREAD_CACHE_WAY_COUNT - 1; i > 0; i--)
+					set[i] = set[i - 1];
+
+				set[0].m_owner_id = owner_id;
+				set[0].m_cache = cache;
+			}
+		}
+	}
+}
+
+#endif // THREAD_CACHE_SLOTS_H
@@ -0,0 +1,235 @@
+#ifndef THREAD_CACHING_ALLOCATOR_H
+#define THREAD_CACHING_ALLOCATOR_H
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+
+#include "MemoryUtilities.h"
+#include "AbstractAllocator.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		/**
+		 * @brief Thread-safe front-end that caches small chunks per thread on
+		 * top of a single-threaded central allocator.
+		 *
+		 * Requests up to MAX_SMALL_SIZE bytes are rounded to one of a fixed set
+		 * of size classes, and served from a per-thread magazine of free chunks
+		 * of that class without any locking. Magazines are refilled from, and
+		 * flushed to, the central allocator in batches under a single lock, so
+		 * the lock is taken once per batch rather than once per allocation.
+		 *
+		 * A chunk freed by a thread other than the one that allocated it is
+		 * pushed onto the owning thread's lock-free remote-free list, which the
+		 * owner drains back into its magazines before refilling.
+		 *
+		 * Larger or over-aligned requests bypass the magazines and go straight
+		 * to the central allocator under the lock.
+		 *
+		 * The central allocator must support variable-size allocations, such
+		 * as FreeListAllocator or TLSFAllocator, and must outlive this object.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API ThreadCachingAllocator : public AbstractAllocator
+		{
+		private:
+			enum
+			{
+				NUM_OF_SIZE_CLASSES = 21,
+				LARGE_SIZE_CLASS    = NUM_OF_SIZE_CLASSES,
+
+				MAX_SMALL_SIZE      = 4096,
+				MAX_SMALL_ALIGNMENT = 16,
+
+				MAGAZINE_BYTES      = 32 * 1024,
+				MAX_MAGAZINE_SIZE   = 64,
+				MIN_MAGAZINE_SIZE   = 4
+			};
+
+		private:
+			struct ThreadCache;
+
+			/**
+			 * Precedes every chunk handed out. For small chunks it records the
+			 * cache that owns the chunk, for large chunks the requested size.
+			 */
+			struct BlockHeader
+			{
+				union
+				{
+					ThreadCache* m_owner;
+					Size         m_size;
+				};
+
+				U32 m_size_class;
+				U32 m_offset;
+			};
+
+			struct FreeNode
+			{
+				FreeNode* m_next;
+			};
+
+			struct Magazine
+			{
+				FreeNode* m_head;
+
+				U32 m_count;
+				U32 m_capacity;
+			};
+
+			struct ThreadCache
+			{
+				std::thread::id m_thread_id;
+
+				Magazine m_magazines[NUM_OF_SIZE_CLASSES];
+
+				std::atomic<Size> m_num_of_allocs;
+				std::atomic<Size> m_num_of_deallocs;
+
+				ThreadCache* m_next;
+
+				/// Written by other threads, so kept off the owner's cache line.
+				alignas(64) std::atomic<FreeNode*> m_remote_frees;
+			};
+
+		private:
+			AbstractAllocator* m_central_allocator;
+
+			std::mutex m_central_mutex;
+
+		private:
+			ThreadCache* m_thread_caches;
+
+			U64 m_id;
+
+		public:
+			/**
+			 * @brief Constructs a thread caching allocator object.
+			 *
+			 * @param[in] central_allocator The allocator that chunks are drawn
+			 * from and returned to in batches.
+			 */
+			ThreadCachingAllocator(AbstractAllocator* central_allocator);
+
+		public:
+			/**
+			 * @brief Returns every cached chunk of every thread to the central
+			 * allocator. No thread may use the allocator during destruction.
+			 */
+		   ~ThreadCachingAllocator();
+
+		private:
+			static U32  GetSizeClass(Size size);
+			static Size GetSizeClassSize(U32 size_class);
+
+		private:
+			ThreadCache* GetThreadCache(Void);
+			ThreadCache* FindThreadCache(Void);
+			ThreadCache* CreateThreadCache(Void);
+
+		private:
+			Void RefillMagazine(ThreadCache* cache, U32 size_class);
+			Void FlushMagazine(ThreadCache* cache, U32 size_class, U32 count);
+			Void DrainRemoteFrees(ThreadCache* cache);
+			Void ReleaseThreadCache(ThreadCache* cache);
+
+		private:
+			VoidPtr AllocateLarge(Size size, Byte alignment);
+			Void    DeallocateLarge(BlockHeader* header);
+
+		public:
+			/**
+			 * @brief Gets the central allocator chunks are drawn from.
+			 *
+			 * @return AbstractAllocator* storing the central allocator.
+			 */
+			AbstractAllocator* GetCentralAllocator(Void);
+
+		public:
+			/**
+			 * @brief Gets the number of allocations made through every thread
+			 * during the lifetime of the allocator.
+			 *
+			 * @return Size storing the number of allocations made.
+			 */
+			Size GetNumOfAllocs(Void) override;
+
+			/**
+			 * @brief Gets the number of deallocations made through every thread
+			 * during the lifetime of the allocator.
+			 *
+			 * @return Size storing the number of deallocations made.
+			 */
+			Size GetNumOfDeallocs(Void) override;
+
+		public:
+			/**
+			 * @brief Retrieves a properly aligned memory address, served from
+			 * the calling thread's cache when possible.
+			 *
+			 * @param[in] size      The size of chunk to retrieve in bytes.
+			 * @param[in] alignment The alignment of memory, must be power of two.
+			 *
+			 * @return VoidPtr storing the address to start of the allocated chunk.
+			 *
+			 * @throws BadAllocationException if the central allocator runs out
+			 * of memory.
+			 */
+			VoidPtr Allocate(Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief Resizes an allocated address to a new size, returning the
+			 * same address if it already fits, and otherwise copying its content
+			 * to a new chunk.
+			 *
+			 * @param[in] address   The address of the chunk to resize.
+			 * @param[in] size      The new size of the chunk to reallocate in bytes.
+			 * @param[in] alignment The Alignment of memory, must be power of two.
+			 *
+			 * @returns VoidPtr storing the address to the start of the reallocated
+			 * chunk.
+			 *
+			 * @throws BadAllocationException if the central allocator runs out
+			 * of memory.
+			 */
+			VoidPtr Reallocate(VoidPtr address, Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief Frees the address previously allocated by any thread. The
+			 * chunk is cached by the calling thread if it owns it, and otherwise
+			 * handed back to its owner through the remote-free list.
+			 *
+			 * @param[in] address The address of the chunk to free.
+			 *
+			 * @throws MemoryOutOfBoundsException if the address provided is out
+			 * of the central allocator's memory pool bounds.
+			 */
+			Void Deallocate(VoidPtr address) override;
+
+		public:
+			/**
+			 * @brief Returns the calling thread's cached chunks to the central
+			 * allocator. Worker threads should call this before exiting.
+			 */
+			Void FlushThreadCache(Void);
+
+		public:
+			/**
+			 * @brief Drops every thread's cached chunks and resets the central
+			 * allocator. No thread may use the allocator during the reset.
+			 */
+			Void Reset(Void) override;
+		};
+
+		FORGE_FORCE_INLINE AbstractAllocator* ThreadCachingAllocator::GetCentralAllocator(Void) { return m_central_allocator; }
+	}
+}
+
+#endif // THREAD_CACHING_ALLOCATOR_H
@@ -0,0 +1,151 @@
+#ifndef TRACKING_ALLOCATOR_H
+#define TRACKING_ALLOCATOR_H
+
+#include "MemoryTracker.h"
+#include "MemoryUtilities.h"
+#include "AbstractAllocator.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		/**
+		 * @brief Reports every allocation made through a backing allocator to
+		 * the memory tracker.
+		 *
+		 * Every allocation is tagged with the tag of the innermost memory scope
+		 * of the allocating thread, or the default tag of the tracking allocator
+		 * outside of any scope. The tag, call-site and size are kept in a small
+		 * header in front of the allocation, so that deallocations can be
+		 * attributed without any lookup.
+		 *
+		 * When memory tracking is compiled out, the tracking allocator forwards
+		 * every call to the backing allocator untouched.
+		 *
+		 * The tracking allocator is as thread-safe as its backing allocator,
+		 * which must outlive it.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API TrackingAllocator : public AbstractAllocator
+		{
+		private:
+			struct AllocationHeader
+			{
+				Size m_size;
+				U32  m_call_site;
+
+				MemoryTag m_tag;
+				Byte      m_offset;
+			};
+
+		private:
+			AbstractAllocator* m_backing_allocator;
+
+			MemoryTag m_default_tag;
+
+		public:
+			/**
+			 * @brief Constructs a tracking allocator object.
+			 *
+			 * @param[in] backing_allocator The allocator that serves allocations.
+			 * @param[in] default_tag       The tag of allocations made outside of
+			 * any memory scope.
+			 */
+			TrackingAllocator(AbstractAllocator* backing_allocator, MemoryTag default_tag = MemoryTag::FORGE_UNTAGGED);
+
+		public:
+		   ~TrackingAllocator() = default;
+
+		public:
+			/**
+			 * @brief Gets the allocator that serves allocations.
+			 *
+			 * @return AbstractAllocator* storing the backing allocator.
+			 */
+			AbstractAllocator* GetBackingAllocator(Void);
+
+			/**
+			 * @brief Gets the tag of allocations made outside of any memory scope.
+			 *
+			 * @return MemoryTag storing the default tag.
+			 */
+			MemoryTag GetDefaultTag(Void);
+
+		public:
+			/**
+			 * @brief Statistics are those of the backing allocator, and include
+			 * the tracking headers.
+			 */
+			VoidPtr GetStartAddress(Void) override;
+			Size    GetPeakSize(Void) override;
+			Size    GetTotalSize(Void) override;
+			Size    GetUsedMemory(Void) override;
+			Size    GetNumOfAllocs(Void) override;
+			Size    GetNumOfDeallocs(Void) override;
+
+		public:
+			/**
+			 * @brief Retrieves a properly aligned memory address from the
+			 * backing allocator and records it.
+			 *
+			 * @param[in] size      The size of chunk to retrieve in bytes.
+			 * @param[in] alignment The alignment of memory, must be power of two.
+			 *
+			 * @return VoidPtr storing the address to start of the allocated chunk.
+			 *
+			 * @throws BadAllocationException if the backing allocator runs out
+			 * of memory.
+			 */
+			VoidPtr Allocate(Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief Resizes an allocated address through the backing allocator,
+			 * keeping its tag and call-site.
+			 *
+			 * @param[in] address   The address of the chunk to resize.
+			 * @param[in] size      The new size of the chunk to reallocate in bytes.
+			 * @param[in] alignment The Alignment of memory, must be power of two.
+			 *
+			 * @returns VoidPtr storing the address to the start of the reallocated
+			 * chunk.
+			 *
+			 * @throws InvalidOperationException if not supported by the backing
+			 * allocator.
+			 */
+			VoidPtr Reallocate(VoidPtr address, Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief Frees the address through the backing allocator and
+			 * records it.
+			 *
+			 * @param[in] address The address of the chunk to free.
+			 *
+			 * @throws InvalidOperationException if not supported by the backing
+			 * allocator.
+			 */
+			Void Deallocate(VoidPtr address) override;
+
+		public:
+			/**
+			 * @brief Resets the backing allocator. Allocations still live at
+			 * the time of the reset remain counted as live by the tracker.
+			 */
+			Void Reset(Void) override;
+		};
+
+		FORGE_FORCE_INLINE AbstractAllocator* TrackingAllocator::GetBackingAllocator(Void) { return m_backing_allocator; }
+		FORGE_FORCE_INLINE MemoryTag TrackingAllocator::GetDefaultTag(Void) { return m_default_tag; }
+
+		FORGE_FORCE_INLINE VoidPtr TrackingAllocator::GetStartAddress(Void)  { return m_backing_allocator->GetStartAddress();  }
+		FORGE_FORCE_INLINE Size    TrackingAllocator::GetPeakSize(Void)      { return m_backing_allocator->GetPeakSize();      }
+		FORGE_FORCE_INLINE Size    TrackingAllocator::GetTotalSize(Void)     { return m_backing_allocator->GetTotalSize();     }
+		FORGE_FORCE_INLINE Size    TrackingAllocator::GetUsedMemory(Void)    { return m_backing_allocator->GetUsedMemory();    }
+		FORGE_FORCE_INLINE Size    TrackingAllocator::GetNumOfAllocs(Void)   { return m_backing_allocator->GetNumOfAllocs();   }
+		FORGE_FORCE_INLINE Size    TrackingAllocator::GetNumOfDeallocs(Void) { return m_backing_allocator->GetNumOfDeallocs(); }
+	}
+}
+
+#endif // TRACKING_ALLOCATOR_H
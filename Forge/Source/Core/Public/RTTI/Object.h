@@ -2,6 +2,8 @@
 #define OBJECT_H
 
 #include "TypeInfo.h"
+#include "TRefPtr.h"
+#include "RefCounted.h"
 
 #include "Core/Public/CoreFwd.h"
 
@@ -22,14 +24,21 @@ namespace Forge {
 		/**
 		 * @brief Base class for classes with run-time type information. This
 		 * class is reference-counted and is non-copyable.
+		 *
+		 * The reference count is stored in the object and updated atomically,
+		 * objects are referenced through TRefPtr and every reference shares the
+		 * same count. The casts return raw pointers and leave the count alone,
+		 * so they may also be used on objects owned by an ObjectManager.
 		 * 
 		 * @author Karim Hisham
 		 */
-		class FORGE_API Object
+		class FORGE_API Object : public RefCounted
 		{
 		public:
 			Object() = default;
-		   ~Object() = default;
+
+		public:
+			virtual ~Object() = default;
 		
 		public:
 			/**
@@ -39,24 +48,22 @@ namespace Forge {
 			 */
 			static ConstTypeInfoPtr GetTypeInfo(void);
 
-		public:
 			/**
-			 * @brief Performs a deep-copy of the object and returns the new
-			 * instance.
-			 * 
-			 * @return TSharedPtr object to the cloned object. 
+			 * @brief Gets the run-time type info of the most derived class of
+			 * the object.
+			 *
+			 * @return Const raw pointer to the type info.
 			 */
-			virtual TSharedPtr<Object> Clone(void) = 0;
+			virtual ConstTypeInfoPtr GetInstanceTypeInfo(void) const;
 
+		public:
 			/**
 			 * @brief Performs a deep-copy of the object and returns the new
-			 * instance using an allocator.
-			 *
-			 * @param[in] allocator The allocator used to construct the new object.
+			 * instance.
 			 * 
-			 * @return TSharedPtr object to the cloned object.
+			 * @return TRefPtr object to the cloned object. 
 			 */
-			virtual TSharedPtr<Object> Clone(AbstractAllocator* allocator) = 0;
+			virtual TRefPtr<Object> Clone(void) = 0;
 
 		public:
 			/**
@@ -66,7 +73,7 @@ namespace Forge {
 			 * 
 			 * @return True if the object is an instace of the type ID.
 			 */
-			Bool IsInstanceOf(ConstStringHash type_id) const;
+			Bool IsInstanceOf(Type::ConstStringHash type_id) const;
 
 			/**
 			 * @brief Check whether the current type is of the specified type info.
@@ -82,34 +89,63 @@ namespace Forge {
 			/**
 			 * @brief Casts the object to the class specified staticly.
 			 * 
-			 * @return TSharedPtr object to the class specified.
+			 * @return T* storing the address of the object as the class
+			 * specified.
 			 */
 			template<typename T> 
-			TSharedPtr<T> StaticCast(void)
+			T* StaticCast(void)
+			{
+				return static_cast<T*>(this);
+			}
+
+			/**
+			 * @brief Casts the object to the class specified staticly.
+			 *
+			 * @return const T* storing the address of the object as the class
+			 * specified.
+			 */
+			template<typename T>
+			const T* StaticCast(void) const
 			{
-				return TSharedPtr((T*)this);
+				return static_cast<const T*>(this);
 			}
 
 			/**
 			 * @brief Casts the object to the class specified dynamically.
 			 *
-			 * @return TSharedPtr to the class specified, or an empty one if not 
-			 * derived from it.
+			 * @return T* storing the address of the object as the class
+			 * specified, or nullptr if not derived from it.
 			 */
 			template<typename T> 
-			TSharedPtr<T> DynamicCast(void)
+			T* DynamicCast(void)
 			{
-				if (this->IsInstanceOf(T::GetTypeInfo()))
-					return TSharedPtr<T>((T*)this);
-				
-				return TSharedPtr<T>();
+				return this->IsInstanceOf(T::GetTypeInfo()) ? static_cast<T*>(this) : nullptr;
+			}
+
+			/**
+			 * @brief Casts the object to the class specified dynamically.
+			 *
+			 * @return const T* storing the address of the object as the class
+			 * specified, or nullptr if not derived from it.
+			 */
+			template<typename T>
+			const T* DynamicCast(void) const
+			{
+				return this->IsInstanceOf(T::GetTypeInfo()) ? static_cast<const T*>(this) : nullptr;
 			}
 		};
 
+		/**
+		 * Declares the type info of a class. The type info is registered with
+		 * the TypeRegistry during static initialization, except for class
+		 * templates, whose type infos are registered on first use.
+		 */
 		#define FORGE_DECLARE_TYPEINFO(__TYPENAME__, __BASE_TYPENAME__)	\
 			using ClassName     = __TYPENAME__;							\
 			using BaseClassName = __BASE_TYPENAME__;					\
-			static ConstTypeInfoPtr GetTypeInfo(void) { static TypeInfo static_type_info(#__TYPENAME__, sizeof(ClassName), BaseClassName::GetTypeInfo()); return &static_type_info; }
+			static ConstTypeInfoPtr GetTypeInfo(void) { static TypeInfo static_type_info(#__TYPENAME__, sizeof(ClassName), BaseClassName::GetTypeInfo()); return &static_type_info; } \
+			ConstTypeInfoPtr GetInstanceTypeInfo(void) const override { return GetTypeInfo(); } \
+			inline static const ConstTypeInfoPtr s_registered_type_info = GetTypeInfo();
 	}
 }
 
@@ -1,19 +1,180 @@
 #ifndef OBJECT_MANAGER_H
 #define OBJECT_MANAGER_H
 
+#include <utility>
+#include <type_traits>
+
 #include "Object.h"
-#include "SmartPointer.h"
 
 #include "Core/Public/Common/Compiler.h"
 #include "Core/Public/Common/TypeDefinitions.h"
 
+#include "Core/Public/Containers/TObjectPool.h"
+#include "Core/Public/Containers/TDynamicArray.h"
+
 namespace Forge {
 	namespace RTTI
 	{
+		namespace Internal
+		{
+			/**
+			 * @brief The pool of objects of a single type, owned by the object
+			 * manager.
+			 */
+			class AbstractObjectPool
+			{
+			public:
+				virtual ~AbstractObjectPool(Void) = default;
+
+			public:
+				virtual Size GetCount(Void) const = 0;
+				virtual Void Clear(Void) = 0;
+			};
+
+			template<typename InObjectType>
+			class TObjectPoolHolder final : public AbstractObjectPool
+			{
+			public:
+				Containers::TObjectPool<InObjectType> m_pool;
+
+			public:
+				Size GetCount(Void) const override { return m_pool.GetCount(); }
+				Void Clear(Void) override { m_pool.Clear(); }
+			};
+		}
+
+		/**
+		 * @brief Owns objects of classes with run-time type information in one
+		 * TObjectPool per class, and refers to them by generational handles.
+		 *
+		 * Objects of a class are packed together, so a system updating every
+		 * object of a class walks a single array, and a handle is validated
+		 * by an index and a comparison instead of chasing a reference count.
+		 * Pools are found by the type index assigned by the TypeRegistry and
+		 * created on first use. Objects are stored by their exact class, so a
+		 * handle to a derived class and a handle to its base class refer to
+		 * different pools, and every pooled class must declare its own type
+		 * info.
+		 *
+		 * Objects owned by the manager must not be referenced by TRefPtr, and
+		 * their addresses change as objects of the same class are created and
+		 * destroyed, so they are referenced by handles only.
+		 *
+		 * @author Karim Hisham
+		 */
 		class FORGE_API ObjectManager
 		{
+		FORGE_CLASS_NONCOPYABLE(ObjectManager)
+
+		private:
+			/// Pools by type index, null for classes without objects yet.
+			Containers::TDynamicArray<Internal::AbstractObjectPool*> m_pools;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 */
+			ObjectManager(Void);
+
+		public:
+			/**
+			 * @brief Default destructor, destroys every object.
+			 */
+		   ~ObjectManager(Void);
+
+		public:
+			/**
+			 * @brief Gets the pool storing the objects of a class, creating it
+			 * if needed.
+			 *
+			 * @return TObjectPool storing the objects of the class.
+			 */
+			template<typename InObjectType>
+			Containers::TObjectPool<InObjectType>& GetPool(Void);
+
+		public:
+			/**
+			 * @brief Constructs an object owned by the manager.
+			 *
+			 * @param[in] args The arguments to construct the object with.
+			 *
+			 * @return TObjectHandle storing the handle to the object.
+			 */
+			template<typename InObjectType, typename... InArgs>
+			Containers::TObjectHandle<InObjectType> Create(InArgs&&... args);
+
+			/**
+			 * @brief Destroys an object owned by the manager.
+			 *
+			 * @param[in] handle The handle to the object.
+			 *
+			 * @return True if the object was destroyed, false if the handle was
+			 * null or stale.
+			 */
+			template<typename InObjectType>
+			Bool Destroy(Containers::TObjectHandle<InObjectType> handle);
+
+			/**
+			 * @brief Gets an object owned by the manager.
+			 *
+			 * @param[in] handle The handle to the object.
+			 *
+			 * @return InObjectType* storing the address of the object, or
+			 * nullptr if the handle is null or stale.
+			 */
+			template<typename InObjectType>
+			InObjectType* Get(Containers::TObjectHandle<InObjectType> handle);
 
+		public:
+			/**
+			 * @brief Gets the number of objects owned by the manager.
+			 *
+			 * @return Size storing the number of objects.
+			 */
+			Size GetCount(Void) const;
+
+			/**
+			 * @brief Destroys every object owned by the manager, invalidating
+			 * every handle.
+			 */
+			Void Clear(Void);
 		};
+
+		template<typename InObjectType>
+		FORGE_FORCE_INLINE Containers::TObjectPool<InObjectType>& ObjectManager::GetPool(Void)
+		{
+			/// A class inheriting the type info of its base would share the pool
+			/// of the base, which stores objects of another type.
+			static_assert(std::is_same<typename InObjectType::ClassName, InObjectType>::value, "Pooled classes must declare their own type info");
+
+			Size type_index = InObjectType::GetTypeInfo()->GetTypeIndex();
+
+			while (m_pools.GetCount() <= type_index)
+				m_pools.PushBack(nullptr);
+
+			if (!m_pools[type_index])
+				m_pools[type_index] = new Internal::TObjectPoolHolder<InObjectType>();
+
+			return static_cast<Internal::TObjectPoolHolder<InObjectType>*>(m_pools[type_index])->m_pool;
+		}
+
+		template<typename InObjectType, typename... InArgs>
+		FORGE_FORCE_INLINE Containers::TObjectHandle<InObjectType> ObjectManager::Create(InArgs&&... args)
+		{
+			return this->GetPool<InObjectType>().Create(std::forward<InArgs>(args)...);
+		}
+
+		template<typename InObjectType>
+		FORGE_FORCE_INLINE Bool ObjectManager::Destroy(Containers::TObjectHandle<InObjectType> handle)
+		{
+			return this->GetPool<InObjectType>().Destroy(handle);
+		}
+
+		template<typename InObjectType>
+		FORGE_FORCE_INLINE InObjectType* ObjectManager::Get(Containers::TObjectHandle<InObjectType> handle)
+		{
+			return this->GetPool<InObjectType>().Get(handle);
+		}
 	}
 }
 
@@ -0,0 +1,149 @@
+#ifndef REF_COUNTED_H
+#define REF_COUNTED_H
+
+#include <atomic>
+
+#include "Core/Public/Common/Common.h"
+#include "Core/Public/Types/RefCounter.h"
+
+namespace Forge {
+	namespace RTTI
+	{
+		/**
+		 * @brief Base class storing the reference count of an object inside the
+		 * object itself, to be managed by TRefPtr.
+		 *
+		 * Unlike TSharedPtr, no control block is allocated and a reference is
+		 * a single pointer, and any number of references created from the raw
+		 * pointer of the object at any time share the same count.
+		 *
+		 * The count starts at zero and the object is destroyed by the TRefPtr
+		 * releasing the last reference, so reference-counted objects must be
+		 * allocated on the heap. Copying an object does not copy its count.
+		 * The destructor is virtual, so a reference to a base class destroys
+		 * the object through the destructor of its most derived class.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<Common::RefCountMode InMode>
+		class TRefCounted
+		{
+		private:
+			mutable U32 m_ref_count;
+
+		protected:
+			TRefCounted(Void)
+				: m_ref_count(0) {}
+
+			TRefCounted(const TRefCounted&)
+				: m_ref_count(0) {}
+
+			virtual ~TRefCounted(Void) = default;
+
+		protected:
+			TRefCounted& operator =(const TRefCounted&)
+			{
+				return *this;
+			}
+
+		public:
+			/**
+			 * @brief Gets the number of references to the object.
+			 *
+			 * @return U32 storing the number of references.
+			 */
+			U32 GetRefCount(Void) const
+			{
+				return m_ref_count;
+			}
+
+		public:
+			/**
+			 * @brief Adds a reference to the object.
+			 */
+			Void AddRef(Void) const
+			{
+				m_ref_count++;
+			}
+
+			/**
+			 * @brief Releases a reference to the object.
+			 *
+			 * @return True if the last reference was released and the object
+			 * must be destroyed.
+			 */
+			Bool ReleaseRef(Void) const
+			{
+				FORGE_ASSERT(m_ref_count > 0, "Reference number must be a positive integer")
+
+				return --m_ref_count == 0;
+			}
+		};
+
+		/**
+		 * @brief Base class storing the reference count of an object inside the
+		 * object itself, updated with atomic operations so references may be
+		 * added and released from several threads.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<>
+		class TRefCounted<Common::RefCountMode::THREAD_SAFE>
+		{
+		private:
+			mutable std::atomic<U32> m_ref_count;
+
+		protected:
+			TRefCounted(Void)
+				: m_ref_count(0) {}
+
+			TRefCounted(const TRefCounted&)
+				: m_ref_count(0) {}
+
+			virtual ~TRefCounted(Void) = default;
+
+		protected:
+			TRefCounted& operator =(const TRefCounted&)
+			{
+				return *this;
+			}
+
+		public:
+			/**
+			 * @brief Gets the number of references to the object, other threads
+			 * may change it before the function returns.
+			 *
+			 * @return U32 storing the number of references.
+			 */
+			U32 GetRefCount(Void) const
+			{
+				return m_ref_count.load(std::memory_order_relaxed);
+			}
+
+		public:
+			/**
+			 * @brief Adds a reference to the object.
+			 */
+			Void AddRef(Void) const
+			{
+				m_ref_count.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Releases a reference to the object.
+			 *
+			 * @return True if the last reference was released and the object
+			 * must be destroyed.
+			 */
+			Bool ReleaseRef(Void) const
+			{
+				return m_ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+			}
+		};
+
+		using RefCounted      = TRefCounted<Common::RefCountMode::THREAD_SAFE>;
+		using LocalRefCounted = TRefCounted<Common::RefCountMode::NOT_THREAD_SAFE>;
+	}
+}
+
+#endif // REF_COUNTED_H
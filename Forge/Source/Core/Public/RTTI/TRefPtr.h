@@ -0,0 +1,294 @@
+#ifndef T_REF_PTR_H
+#define T_REF_PTR_H
+
+#include <utility>
+#include <type_traits>
+
+#include "Core/Public/Common/Common.h"
+
+namespace Forge {
+	namespace RTTI
+	{
+		/**
+		 * @brief Manages a reference to an object that stores its own reference
+		 * count, such as an Object or any other class derived from TRefCounted.
+		 *
+		 * A TRefPtr is a single pointer wide. Copying it adds a reference and
+		 * destroying it releases one, the last reference deletes the object.
+		 * Since the count lives in the object, a TRefPtr may be created from
+		 * a raw pointer at any time, including from this, and every TRefPtr
+		 * to the object shares the same count.
+		 *
+		 * Dereferencing a null TRefPtr is only checked by assertions, so
+		 * accessing an object through a reference costs as much as through a
+		 * raw pointer.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InType>
+		class TRefPtr final
+		{
+			template<typename>
+			friend class TRefPtr;
+
+		public:
+			using Type         = InType;
+			using TypePtr      = InType*;
+			using TypeRef      = InType&;
+			using TypeMoveRef  = InType&&;
+			using ConstType    = const InType;
+			using ConstTypeRef = const InType&;
+			using ConstTypePtr = const InType*;
+
+		private:
+			using SelfType         = TRefPtr<Type>;
+			using SelfTypePtr      = TRefPtr<Type>*;
+			using SelfTypeRef      = TRefPtr<Type>&;
+			using SelfTypeMoveRef  = TRefPtr<Type>&&;
+			using ConstSelfType    = const TRefPtr<Type>;
+			using ConstSelfTypeRef = const TRefPtr<Type>&;
+			using ConstSelfTypePtr = const TRefPtr<Type>*;
+
+		private:
+			TypePtr m_raw_ptr;
+
+		private:
+			Void InternalAddRef(Void)
+			{
+				if (m_raw_ptr)
+					m_raw_ptr->AddRef();
+			}
+
+			Void InternalReleaseRef(Void)
+			{
+				if (m_raw_ptr && m_raw_ptr->ReleaseRef())
+					delete m_raw_ptr;
+			}
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 */
+			TRefPtr(Void)
+				: m_raw_ptr(nullptr) {}
+
+			/**
+			 * @brief Null pointer constructor.
+			 */
+			TRefPtr(std::nullptr_t)
+				: m_raw_ptr(nullptr) {}
+
+			/**
+			 * @brief Pointer constructor, adds a reference to the object.
+			 */
+			TRefPtr(TypePtr ptr)
+				: m_raw_ptr(ptr)
+			{
+				InternalAddRef();
+			}
+
+		public:
+			/**
+			 * @brief Move constructor.
+			 */
+			TRefPtr(SelfTypeMoveRef other)
+				: m_raw_ptr(other.m_raw_ptr)
+			{
+				other.m_raw_ptr = nullptr;
+			}
+
+			/**
+			 * @brief Copy constructor.
+			 */
+			TRefPtr(ConstSelfTypeRef other)
+				: m_raw_ptr(other.m_raw_ptr)
+			{
+				InternalAddRef();
+			}
+
+			/**
+			 * @brief Converting move constructor, from a reference to a derived
+			 * type.
+			 */
+			template<typename InOtherType, typename = std::enable_if_t<std::is_convertible<InOtherType*, InType*>::value>>
+			TRefPtr(TRefPtr<InOtherType>&& other)
+				: m_raw_ptr(other.m_raw_ptr)
+			{
+				other.m_raw_ptr = nullptr;
+			}
+
+			/**
+			 * @brief Converting copy constructor, from a reference to a derived
+			 * type.
+			 */
+			template<typename InOtherType, typename = std::enable_if_t<std::is_convertible<InOtherType*, InType*>::value>>
+			TRefPtr(const TRefPtr<InOtherType>& other)
+				: m_raw_ptr(other.m_raw_ptr)
+			{
+				InternalAddRef();
+			}
+
+		public:
+			/**
+			 * @brief Default destructor, releases the reference.
+			 */
+			~TRefPtr(Void)
+			{
+				InternalReleaseRef();
+			}
+
+		public:
+			/**
+			 * @brief Move assigment.
+			 */
+			SelfTypeRef operator =(SelfTypeMoveRef other)
+			{
+				if (this == &other)
+					return *this;
+
+				InternalReleaseRef();
+
+				m_raw_ptr = other.m_raw_ptr;
+				other.m_raw_ptr = nullptr;
+
+				return *this;
+			}
+
+			/**
+			 * @brief Copy assigment.
+			 */
+			SelfTypeRef operator =(ConstSelfTypeRef other)
+			{
+				/// The reference is added first, so assigning a reference to
+				/// itself does not destroy the object.
+				if (other.m_raw_ptr)
+					other.m_raw_ptr->AddRef();
+
+				InternalReleaseRef();
+
+				m_raw_ptr = other.m_raw_ptr;
+
+				return *this;
+			}
+
+		public:
+			/**
+			 * @brief Equality operator.
+			 */
+			Bool operator ==(ConstSelfTypeRef other) const
+			{
+				return m_raw_ptr == other.m_raw_ptr;
+			}
+
+			/**
+			 * @brief Inequality operator.
+			 */
+			Bool operator !=(ConstSelfTypeRef other) const
+			{
+				return m_raw_ptr != other.m_raw_ptr;
+			}
+
+		public:
+			/**
+			 * @brief Dereference operator.
+			 */
+			TypeRef operator *() const
+			{
+				FORGE_ASSERT(m_raw_ptr, "Reference pointer is storing a null pointer")
+
+				return *m_raw_ptr;
+			}
+
+			/**
+			 * @brief Arrow operator.
+			 */
+			TypePtr operator ->() const
+			{
+				FORGE_ASSERT(m_raw_ptr, "Reference pointer is storing a null pointer")
+
+				return m_raw_ptr;
+			}
+
+		public:
+			/**
+			 * @brief Checks whether the stored pointer is a null pointer.
+			 *
+			 * @return True if the stored pointer is null.
+			 */
+			Bool IsNull(Void) const
+			{
+				return !m_raw_ptr;
+			}
+
+			/**
+			 * @brief Gets the number of references to the object.
+			 *
+			 * @return U32 storing the number of references, zero if the stored
+			 * pointer is null.
+			 */
+			U32 GetRefCount(Void) const
+			{
+				return m_raw_ptr ? m_raw_ptr->GetRefCount() : 0;
+			}
+
+			/**
+			 * @brief Gets the stored pointer without adding a reference.
+			 *
+			 * @return TypePtr storing the address of the object.
+			 */
+			TypePtr GetRawPtr(Void) const
+			{
+				return m_raw_ptr;
+			}
+
+		public:
+			/**
+			 * @brief Swaps the objects of two references without altering their
+			 * reference counts.
+			 *
+			 * @param[in] other The TRefPtr object to swap content with.
+			 */
+			Void Swap(SelfTypeRef other)
+			{
+				TypePtr raw_ptr = m_raw_ptr;
+
+				m_raw_ptr = other.m_raw_ptr;
+				other.m_raw_ptr = raw_ptr;
+			}
+
+			/**
+			 * @brief Releases the reference and references the pointer passed,
+			 * null by default.
+			 *
+			 * @param[in] ptr The new object to reference.
+			 */
+			Void Reset(TypePtr ptr = nullptr)
+			{
+				SelfType(ptr).Swap(*this);
+			}
+		};
+
+		FORGE_TYPEDEF_TEMPLATE_DECL(TRefPtr)
+
+		/**
+		 * @brief Constructs a reference-counted object and references it.
+		 *
+		 * @param[in] args The arguments to construct the object with.
+		 *
+		 * @return TRefPtr storing the constructed object.
+		 */
+		template<typename InType, typename... InArgs>
+		FORGE_FORCE_INLINE TRefPtr<InType> MakeRef(InArgs&&... args)
+		{
+			return TRefPtr<InType>(new InType(std::forward<InArgs>(args)...));
+		}
+	}
+
+	namespace Common
+	{
+		template<typename InType>
+		struct TIsTriviallyRelocatable<RTTI::TRefPtr<InType>> { enum { Value = true }; };
+	}
+}
+
+#endif // T_REF_PTR_H
@@ -1,15 +1,14 @@
 #ifndef TYPE_INFO_H
 #define TYPE_INFO_H
 
+#include <atomic>
+
 #include "Core/Public/CoreFwd.h"
 
 #include "Core/Public/Common/Compiler.h"
 #include "Core/Public/Common/TypeDefinitions.h"
 
-class ConstStringHash
-{
-
-};
+#include "Core/Public/Types/String/ConstStringHash.h"
 
 namespace Forge {
 	namespace RTTI
@@ -22,22 +21,48 @@ namespace Forge {
 
 		/**
 		 * @brief Stores run-time meta-information about classes.
+		 *
+		 * Type infos register themselves with the TypeRegistry, which numbers
+		 * the class hierarchy so that derivation checks take two integer
+		 * comparisons regardless of the depth of the hierarchy. The numbers
+		 * are read as a versioned snapshot, so types may be checked while
+		 * other threads register new types.
 		 * 
 		 * @author Karim Hisham
 		 */
 		class FORGE_API TypeInfo
 		{
+		private:
+			friend class TypeRegistry;
+
 		private:
 			ConstSize		  m_type_size;
 			ConstCharPtr      m_type_name;
-			ConstStringHash	  m_type_hash_id;
+			Type::ConstStringHash m_type_hash_id;
 			ConstTypeInfoPtr  m_base_type_info;
+
+		private:
+			/// Depth-first pre-order and post-order numbers of the type in the
+			/// class hierarchy, the numbers of derived types nest within them.
+			std::atomic<U32> m_pre_order;
+			std::atomic<U32> m_post_order;
+			U32 m_type_index;
+
+		private:
+			/// Version of the numbers, odd while types registered since the
+			/// hierarchy was last numbered are waiting to be numbered.
+			static std::atomic<U32> s_numbering_version;
+
+		private:
+			/// Derived types, linked through their next sibling.
+			TypeInfoPtr m_first_derived_type_info;
+			TypeInfoPtr m_next_sibling_type_info;
 		
 		public:
-			TypeInfo(ConstCharPtr type_name, ConstSize type_Size, ConstTypeInfoPtr base_type_info);
+			TypeInfo(ConstCharPtr type_name, ConstSize type_size, ConstTypeInfoPtr base_type_info);
 
 		public:
-		   ~TypeInfo() = default;
+		   ~TypeInfo();
 
 		public:
 			/**
@@ -59,7 +84,7 @@ namespace Forge {
 			 *
 			 * @return ConstStringHash storing the ID of the type.
 			 */
-			ConstStringHash GetTypeId(void) const;
+			Type::ConstStringHash GetTypeId(void) const;
  
 			/**
 			 * @brief Get the base type of the type.
@@ -69,6 +94,17 @@ namespace Forge {
 			 */
 			ConstTypeInfoPtr GetBaseTypeInfo(void) const;
 
+			/**
+			 * @brief Gets the dense index of the type, types are indexed from
+			 * zero in the order they are registered.
+			 *
+			 * Indices are small enough to key arrays of per-type data, like
+			 * object pools or dispatch tables, but differ between runs.
+			 *
+			 * @return U32 storing the index of the type.
+			 */
+			U32 GetTypeIndex(void) const;
+
 		public:
 			/**
 			 * @brief Checks wether the type is an abstract class.
@@ -86,7 +122,7 @@ namespace Forge {
 			 * 
 			 * @return True if the object is same as the type ID.
 			 */
-			Bool IsSameAs(ConstStringHash& type_id) const;
+			Bool IsSameAs(const Type::ConstStringHash& type_id) const;
 	 
 			/**
 			 * @brief Checks wether the current type is derived from a specified 
@@ -97,7 +133,7 @@ namespace Forge {
 			 * 
 			 * @return True if the object is derived from the type ID.
 			 */
-			Bool IsDerivedFrom(ConstStringHash& type_id) const;
+			Bool IsDerivedFrom(const Type::ConstStringHash& type_id) const;
 			
 			/**
 			 * @brief Checks whether the current type is same as a specified type 
@@ -112,7 +148,7 @@ namespace Forge {
 
 			/**
 			 * @brief Checks wether the current type is derived from a specified
-			 * type info.
+			 * type info, or is the type info itself.
 			 *
 			 * @param[in] type_info The type info to check whether the object is
 			 * derived from it.
@@ -120,12 +156,47 @@ namespace Forge {
 			 * @return True if the object is derived from the type info.
 			 */
 			Bool IsDerivedFrom(ConstTypeInfoPtr type_info) const;
+
+		private:
+			static Void NumberTypes(Void);
 		};
 
 		FORGE_FORCE_INLINE ConstSize TypeInfo::GetTypeSize(void) const            { return m_type_size; }
 		FORGE_FORCE_INLINE ConstCharPtr TypeInfo::GetTypeName(void) const         { return m_type_name; }
-		FORGE_FORCE_INLINE ConstStringHash TypeInfo::GetTypeId(void) const		  { return m_type_hash_id; }
+		FORGE_FORCE_INLINE Type::ConstStringHash TypeInfo::GetTypeId(void) const  { return m_type_hash_id; }
 		FORGE_FORCE_INLINE ConstTypeInfoPtr TypeInfo::GetBaseTypeInfo(void) const { return m_base_type_info; }
+		FORGE_FORCE_INLINE U32 TypeInfo::GetTypeIndex(void) const                 { return m_type_index; }
+
+		FORGE_FORCE_INLINE Bool TypeInfo::IsSameAs(ConstTypeInfoPtr type_info) const
+		{
+			return this == type_info;
+		}
+		FORGE_FORCE_INLINE Bool TypeInfo::IsDerivedFrom(ConstTypeInfoPtr type_info) const
+		{
+			if (!type_info)
+				return false;
+
+			while (true)
+			{
+				U32 version = s_numbering_version.load(std::memory_order_acquire);
+
+				if (!(version & 1))
+				{
+					/// The type is in the subtree of the type info exactly when its
+					/// interval nests within the interval of the type info.
+					Bool is_derived = type_info->m_pre_order.load(std::memory_order_relaxed) <= m_pre_order.load(std::memory_order_relaxed) &&
+									  m_post_order.load(std::memory_order_relaxed) <= type_info->m_post_order.load(std::memory_order_relaxed);
+
+					std::atomic_thread_fence(std::memory_order_acquire);
+
+					/// The numbers were not renumbered while being read.
+					if (s_numbering_version.load(std::memory_order_relaxed) == version)
+						return is_derived;
+				}
+
+				NumberTypes();
+			}
+		}
 	}
 }
 
@@ -0,0 +1,95 @@
+#ifndef TYPE_REGISTRY_H
+#define TYPE_REGISTRY_H
+
+#include "TypeInfo.h"
+
+#include "Core/Public/CoreFwd.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace RTTI
+	{
+		/**
+		 * @brief Global registry of the type infos of every class with
+		 * run-time type information.
+		 *
+		 * Classes declaring their type info with FORGE_DECLARE_TYPEINFO are
+		 * registered during static initialization, before main runs. The class
+		 * hierarchy is numbered in depth-first order, giving each type a
+		 * pre-order and post-order number, so a type is derived from another
+		 * exactly when its numbers nest within the numbers of the other.
+		 *
+		 * Registering only links the type into the hierarchy, the hierarchy is
+		 * numbered by the first derivation check after a registration, so
+		 * registering the types at startup takes time linear in their number.
+		 * Numbering is published as a versioned snapshot, so types registered
+		 * at run-time do not race with concurrent derivation checks.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API TypeRegistry
+		{
+		private:
+			static Void NumberHierarchy(TypeInfoPtr root, U32& counter);
+
+		public:
+			/**
+			 * @brief Adds a type info to the registry, called by the type info
+			 * constructor. The base type info must already be registered.
+			 *
+			 * @param[in] type_info The type info to add.
+			 */
+			static Void Register(TypeInfoPtr type_info);
+
+			/**
+			 * @brief Removes a type info from the registry, called by the type
+			 * info destructor. Its index is not reused.
+			 *
+			 * Types derived from the type info must be removed before it.
+			 *
+			 * @param[in] type_info The type info to remove.
+			 */
+			static Void Unregister(TypeInfoPtr type_info);
+
+			/**
+			 * @brief Numbers the class hierarchy if types were registered since
+			 * it was last numbered, called by derivation checks.
+			 */
+			static Void NumberTypes(Void);
+
+		public:
+			/**
+			 * @brief Gets the number of type indices handed out, one past the
+			 * largest type index.
+			 *
+			 * @return U32 storing the number of type indices.
+			 */
+			static U32 GetNumOfTypes(Void);
+
+			/**
+			 * @brief Gets the type info of a type index.
+			 *
+			 * @param[in] type_index The index of the type.
+			 *
+			 * @return ConstTypeInfoPtr storing the type info, or nullptr if the
+			 * type was removed or the index is out of range.
+			 */
+			static ConstTypeInfoPtr GetTypeInfo(U32 type_index);
+
+			/**
+			 * @brief Finds the type info of a type by its name.
+			 *
+			 * @param[in] type_id The name of the type, when several types share
+			 * a name the first one registered is found.
+			 *
+			 * @return ConstTypeInfoPtr storing the type info, or nullptr if no
+			 * type has the name.
+			 */
+			static ConstTypeInfoPtr FindTypeInfo(const Type::ConstStringHash& type_id);
+		};
+	}
+}
+
+#endif // TYPE_REGISTRY_H
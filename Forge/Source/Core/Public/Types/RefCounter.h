@@ -1,19 +1,37 @@
 #ifndef REF_COUNTER_H
 #define REF_COUNTER_H
 
+#include <atomic>
+
 #include <Core/Public/Common/Common.h>
 
 namespace Forge {
 	namespace Common
 	{
+		/**
+		 * @brief Selects whether references are counted with atomic operations,
+		 * allowing references to be added and released from several threads,
+		 * or with plain arithmetic for objects owned by a single thread.
+		 */
+		enum class RefCountMode : U8
+		{
+			NOT_THREAD_SAFE,
+			THREAD_SAFE
+		};
+
 		/**
 		 * @brief Manages reference-counting.
-		 * 
+		 *
+		 * The weak reference count includes one reference held on behalf of
+		 * all strong references, so the counter can be released once the weak
+		 * reference count reaches zero.
+		 *
 		 * @author Karim Hisham
 		 */
-		class RefCounter
+		template<RefCountMode InMode>
+		class TRefCounter
 		{
-		FORGE_CLASS_NONCOPYABLE(RefCounter)
+		FORGE_CLASS_NONCOPYABLE(TRefCounter)
 
 		private:
 			Size m_ref;
@@ -23,28 +41,93 @@ namespace Forge {
 			/**
 			 * @brief Default constructor.
 			 */
-			RefCounter(Void);
+			TRefCounter(Void);
 
 		public:
 			/**
-			 * @brief Default destructor.
+			 * @brief Gets number of object references.
+			 *
+			 * @return Size storing number of references.
 			 */
-			virtual ~RefCounter(Void) = default;
+			Size GetRefCount(Void) const;
+
+			/**
+			 * @brief Gets number of object weak references.
+			 *
+			 * @return Size storing number of weak references.
+			 */
+			Size GetWeakRefCount(Void) const;
 
 		public:
 			/**
-			 * @brief Gets number of object references.
-			 * 
-			 * @return ConstSize storing number of references. 
+			 * @brief Increments number of object references.
 			 */
-			ConstSize GetRefCount(Void) const;
+			Void IncrementRef(Void);
 
 			/**
-			 * @brief Gets number of object weak references.
+			 * @brief Increments number of object references unless it already
+			 * reached zero.
 			 *
-			 * @return ConstSize storing number of weak references. 
+			 * @return True if the reference was added.
+			 */
+			Bool TryIncrementRef(Void);
+
+			/**
+			 * @brief Decrements number of object references.
+			 *
+			 * @return True if the last reference was released.
+			 */
+			Bool DecrementRef(Void);
+
+			/**
+			 * @brief Increments number of object weak references.
+			 */
+			Void IncrementWeakRef(Void);
+
+			/**
+			 * @brief Decrements number of object weak references.
+			 *
+			 * @return True if the last weak reference was released.
+			 */
+			Bool DecrementWeakRef(Void);
+		};
+
+		/**
+		 * @brief Manages reference-counting with atomic operations.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<>
+		class TRefCounter<RefCountMode::THREAD_SAFE>
+		{
+		FORGE_CLASS_NONCOPYABLE(TRefCounter)
+
+		private:
+			std::atomic<Size> m_ref;
+			std::atomic<Size> m_weak_ref;
+
+		public:
+			/**
+			 * @brief Default constructor.
 			 */
-			ConstSize GetWeakRefCount(Void) const;
+			TRefCounter(Void);
+
+		public:
+			/**
+			 * @brief Gets number of object references, other threads may change
+			 * it before the function returns.
+			 *
+			 * @return Size storing number of references.
+			 */
+			Size GetRefCount(Void) const;
+
+			/**
+			 * @brief Gets number of object weak references, other threads may
+			 * change it before the function returns.
+			 *
+			 * @return Size storing number of weak references.
+			 */
+			Size GetWeakRefCount(Void) const;
 
 		public:
 			/**
@@ -52,10 +135,20 @@ namespace Forge {
 			 */
 			Void IncrementRef(Void);
 
+			/**
+			 * @brief Increments number of object references unless it already
+			 * reached zero.
+			 *
+			 * @return True if the reference was added.
+			 */
+			Bool TryIncrementRef(Void);
+
 			/**
 			 * @brief Decrements number of object references.
+			 *
+			 * @return True if the last reference was released.
 			 */
-			Void DecrementRef(Void);
+			Bool DecrementRef(Void);
 
 			/**
 			 * @brief Increments number of object weak references.
@@ -64,48 +157,113 @@ namespace Forge {
 
 			/**
 			 * @brief Decrements number of object weak references.
+			 *
+			 * @return True if the last weak reference was released.
 			 */
-			Void DecrementWeakRef(Void);
+			Bool DecrementWeakRef(Void);
 		};
 
+		using RefCounter       = TRefCounter<RefCountMode::NOT_THREAD_SAFE>;
+		using AtomicRefCounter = TRefCounter<RefCountMode::THREAD_SAFE>;
+
 		FORGE_TYPEDEF_DECL(RefCounter)
+		FORGE_TYPEDEF_DECL(AtomicRefCounter)
 
-		FORGE_FORCE_INLINE RefCounter::RefCounter(Void)
+		template<RefCountMode InMode>
+		FORGE_FORCE_INLINE TRefCounter<InMode>::TRefCounter(Void)
 			: m_ref(0), m_weak_ref(0) {}
 
-		FORGE_FORCE_INLINE ConstSize RefCounter::GetRefCount(Void) const
+		template<RefCountMode InMode>
+		FORGE_FORCE_INLINE Size TRefCounter<InMode>::GetRefCount(Void) const
 		{
 			return m_ref;
 		}
-		FORGE_FORCE_INLINE ConstSize RefCounter::GetWeakRefCount(Void) const
+		template<RefCountMode InMode>
+		FORGE_FORCE_INLINE Size TRefCounter<InMode>::GetWeakRefCount(Void) const
 		{
 			return m_weak_ref;
 		}
 
-		FORGE_FORCE_INLINE Void RefCounter::IncrementRef(Void)
+		template<RefCountMode InMode>
+		FORGE_FORCE_INLINE Void TRefCounter<InMode>::IncrementRef(Void)
 		{
-			FORGE_ASSERT(m_ref >= 0, "Reference number must be a positive integer")
-				
 			m_ref++;
 		}
-		FORGE_FORCE_INLINE Void RefCounter::DecrementRef(Void)
+		template<RefCountMode InMode>
+		FORGE_FORCE_INLINE Bool TRefCounter<InMode>::TryIncrementRef(Void)
 		{
-			FORGE_ASSERT(m_ref >= 0, "Reference number must be a positive integer")
-			
-			m_ref--;
+			if (!m_ref)
+				return false;
+
+			m_ref++;
+
+			return true;
+		}
+		template<RefCountMode InMode>
+		FORGE_FORCE_INLINE Bool TRefCounter<InMode>::DecrementRef(Void)
+		{
+			FORGE_ASSERT(m_ref > 0, "Reference number must be a positive integer")
+
+			return --m_ref == 0;
 		}
 
-		FORGE_FORCE_INLINE Void RefCounter::IncrementWeakRef(Void)
+		template<RefCountMode InMode>
+		FORGE_FORCE_INLINE Void TRefCounter<InMode>::IncrementWeakRef(Void)
 		{
-			FORGE_ASSERT(m_weak_ref >= 0, "Weak reference number must be a positive integer")
-			
 			m_weak_ref++;
 		}
-		FORGE_FORCE_INLINE Void RefCounter::DecrementWeakRef(Void)
+		template<RefCountMode InMode>
+		FORGE_FORCE_INLINE Bool TRefCounter<InMode>::DecrementWeakRef(Void)
+		{
+			FORGE_ASSERT(m_weak_ref > 0, "Weak reference number must be a positive integer")
+
+			return --m_weak_ref == 0;
+		}
+
+		FORGE_FORCE_INLINE TRefCounter<RefCountMode::THREAD_SAFE>::TRefCounter(Void)
+			: m_ref(0), m_weak_ref(0) {}
+
+		FORGE_FORCE_INLINE Size TRefCounter<RefCountMode::THREAD_SAFE>::GetRefCount(Void) const
+		{
+			return m_ref.load(std::memory_order_relaxed);
+		}
+		FORGE_FORCE_INLINE Size TRefCounter<RefCountMode::THREAD_SAFE>::GetWeakRefCount(Void) const
+		{
+			return m_weak_ref.load(std::memory_order_relaxed);
+		}
+
+		FORGE_FORCE_INLINE Void TRefCounter<RefCountMode::THREAD_SAFE>::IncrementRef(Void)
+		{
+			/// A new reference is always made from an existing one, which
+			/// already keeps the object alive, so no ordering is needed.
+			m_ref.fetch_add(1, std::memory_order_relaxed);
+		}
+		FORGE_FORCE_INLINE Bool TRefCounter<RefCountMode::THREAD_SAFE>::TryIncrementRef(Void)
+		{
+			Size ref = m_ref.load(std::memory_order_relaxed);
+
+			while (ref)
+			{
+				if (m_ref.compare_exchange_weak(ref, ref + 1, std::memory_order_acquire, std::memory_order_relaxed))
+					return true;
+			}
+
+			return false;
+		}
+		FORGE_FORCE_INLINE Bool TRefCounter<RefCountMode::THREAD_SAFE>::DecrementRef(Void)
+		{
+			/// Releasing publishes the writes of this thread to the thread
+			/// that destroys the object.
+			return m_ref.fetch_sub(1, std::memory_order_acq_rel) == 1;
+		}
+
+		FORGE_FORCE_INLINE Void TRefCounter<RefCountMode::THREAD_SAFE>::IncrementWeakRef(Void)
+		{
+			m_weak_ref.fetch_add(1, std::memory_order_relaxed);
+		}
+		FORGE_FORCE_INLINE Bool TRefCounter<RefCountMode::THREAD_SAFE>::DecrementWeakRef(Void)
 		{
-			FORGE_ASSERT(m_weak_ref >= 0, "Weak reference number must be a positive integer")
-			
-			m_weak_ref--;
+			return m_weak_ref.fetch_sub(1, std::memory_order_acq_rel) == 1;
 		}
 	}
 }
@@ -1,10 +1,14 @@
 #ifndef SMART_POINTER_H
 #define SMART_POINTER_H
 
+#include <new>
+#include <type_traits>
+
 #include <Core/Public/Debug/Debug.h>
 #include <Core/Public/Common/Common.h>
 #include <Core/Public/Types/TDelegate.h>
 #include <Core/Public/Types/RefCounter.h>
+#include <Core/Public/Memory/AbstractAllocator.h>
 #include <Core/Public/Algorithm/GeneralUtilities.h>
 
 using namespace Forge::Algorithm;
@@ -12,32 +16,214 @@ using namespace Forge::Algorithm;
 namespace Forge {
 	namespace Common
 	{
-		template <typename InType>
+		template<typename InType, RefCountMode InMode>
 		class TSharedPtr;
 
-		template<typename InType>
+		template<typename InType, RefCountMode InMode>
 		class TWeakPtr;
 
+		template<typename InType, RefCountMode InMode = RefCountMode::THREAD_SAFE, typename... InArgs>
+		TSharedPtr<InType, InMode> AllocateShared(Memory::AbstractAllocator* allocator, InArgs&&... args);
+
+		namespace Internal
+		{
+			/**
+			 * @brief The reference counter shared by the TSharedPtr and TWeakPtr
+			 * objects of one managed object, which also knows how to destroy the
+			 * object and release itself.
+			 */
+			template<RefCountMode InMode>
+			class TSharedControlBlock : public TRefCounter<InMode>
+			{
+			public:
+				/**
+				 * @brief Default constructor.
+				 *
+				 * The block starts with the reference of the TSharedPtr creating
+				 * it, and the weak reference held on behalf of all references.
+				 */
+				TSharedControlBlock(Void)
+				{
+					this->IncrementRef();
+					this->IncrementWeakRef();
+				}
+
+			public:
+				virtual ~TSharedControlBlock(Void) = default;
+
+			public:
+				/**
+				 * @brief Destroys the managed object once the last reference is
+				 * released.
+				 */
+				virtual Void DestroyObject(Void) = 0;
+
+				/**
+				 * @brief Releases the control block once the last weak reference
+				 * is released.
+				 */
+				virtual Void DestroySelf(Void) = 0;
+
+			public:
+				Void ReleaseRef(Void)
+				{
+					if (this->DecrementRef())
+					{
+						this->DestroyObject();
+						this->ReleaseWeakRef();
+					}
+				}
+
+				Void ReleaseWeakRef(Void)
+				{
+					if (this->DecrementWeakRef())
+						this->DestroySelf();
+				}
+			};
+
+			/**
+			 * @brief Control block of an object allocated separately with new.
+			 */
+			template<typename InType, RefCountMode InMode>
+			class TPointerControlBlock final : public TSharedControlBlock<InMode>
+			{
+			private:
+				InType* m_ptr;
+
+			public:
+				TPointerControlBlock(InType* ptr)
+					: m_ptr(ptr) {}
+
+			public:
+				Void DestroyObject(Void) override
+				{
+					delete m_ptr;
+				}
+
+				Void DestroySelf(Void) override
+				{
+					delete this;
+				}
+			};
+
+			/**
+			 * @brief Control block of an object allocated separately and released
+			 * with a custom deleter.
+			 */
+			template<typename InType, RefCountMode InMode>
+			class TDeleterControlBlock final : public TSharedControlBlock<InMode>
+			{
+			private:
+				InType* m_ptr;
+
+				TDelegate<Void(InType*)> m_deleter_callback;
+
+			public:
+				TDeleterControlBlock(InType* ptr, TDelegate<Void(InType*)>&& deleter)
+					: m_ptr(ptr), m_deleter_callback(Algorithm::Move(deleter)) {}
+
+			public:
+				Void DestroyObject(Void) override
+				{
+					m_deleter_callback.Invoke(m_ptr);
+				}
+
+				Void DestroySelf(Void) override
+				{
+					delete this;
+				}
+			};
+
+			/**
+			 * @brief Control block storing the object right after the reference
+			 * counter, so both live in a single allocation.
+			 */
+			template<typename InType, RefCountMode InMode>
+			class TInlineControlBlock final : public TSharedControlBlock<InMode>
+			{
+			private:
+				/// Null if the block was allocated with new.
+				Memory::AbstractAllocator* m_allocator;
+
+				alignas(InType) Byte m_storage[sizeof(InType)];
+
+			public:
+				template<typename... InArgs>
+				TInlineControlBlock(Memory::AbstractAllocator* allocator, InArgs&&... args)
+					: m_allocator(allocator)
+				{
+					new (m_storage) InType(std::forward<InArgs>(args)...);
+				}
+
+			public:
+				InType* GetObjectPtr(Void)
+				{
+					return reinterpret_cast<InType*>(m_storage);
+				}
+
+			public:
+				Void DestroyObject(Void) override
+				{
+					this->GetObjectPtr()->~InType();
+				}
+
+				Void DestroySelf(Void) override
+				{
+					Memory::AbstractAllocator* allocator = m_allocator;
+
+					if (!allocator)
+					{
+						delete this;
+						return;
+					}
+
+					this->~TInlineControlBlock();
+
+					allocator->Deallocate(this);
+				}
+			};
+		}
+
 		/**
 		 * @brief Manages the storage of raw pointers, provides garbage-collection,
 		 * and allows multiple TSharedPtr to share management of the same pointer.
 		 * This ultimatly prevents accidental memory leaks and helps in monitoring
 		 * shared memory locations.
-		 * 
+		 *
 		 * Objects of TSharedPtr have the ability of taking ownership of a pointer
-		 * and share that ownership. Upon taking ownership, a reference counter 
+		 * and share that ownership. Upon taking ownership, a reference counter
 		 * is incremented indicating the number of TSharedPtr objects managing the
-		 * pointer. 
-		 * 
+		 * pointer.
+		 *
 		 * When a TSharedPtr is destroyed the reference counter is decremented.
 		 * A TSharedPtr becomes responsible for the deletion of the stored pointer
 		 * when it is the last object to release ownership.
-		 * 
+		 *
+		 * A TSharedPtr stores the pointer and a pointer to a control block
+		 * holding the reference counts and the deleter, which is shared by all
+		 * references. MakeShared and AllocateShared construct the object inside
+		 * the control block, so the object and its counts take one allocation.
+		 *
+		 * The mode selects whether the counts are updated atomically, so that
+		 * references to the same object may be copied and released from
+		 * several threads, or with plain arithmetic for objects that never
+		 * leave their thread. A single TSharedPtr object is never safe to
+		 * modify from several threads at once.
+		 *
 		 * @author Karim Hisham
 		 */
-		template<typename InType>
+		template<typename InType, RefCountMode InMode = RefCountMode::THREAD_SAFE>
 		class TSharedPtr final
 		{
+			template<typename, RefCountMode>
+			friend class TSharedPtr;
+
+			template<typename, RefCountMode>
+			friend class TWeakPtr;
+
+			template<typename InObjectType, RefCountMode InObjectMode, typename... InArgs>
+			friend TSharedPtr<InObjectType, InObjectMode> AllocateShared(Memory::AbstractAllocator* allocator, InArgs&&... args);
+
 		public:
 			using Type         = InType;
 			using TypePtr      = InType*;
@@ -48,37 +234,37 @@ namespace Forge {
  			using ConstTypePtr = const InType*;
 
 		private:
-			using SelfType         = TSharedPtr<Type>;
-			using SelfTypePtr      = TSharedPtr<Type>*;
-			using SelfTypeRef      = TSharedPtr<Type>&;
-			using SelfTypeMoveRef  = TSharedPtr<Type>&&;
-			using ConstSelfType    = const TSharedPtr<Type>;
-			using ConstSelfTypeRef = const TSharedPtr<Type>&;
-			using ConstSelfTypePtr = const TSharedPtr<Type>*;
+			using SelfType         = TSharedPtr<Type, InMode>;
+			using SelfTypePtr      = TSharedPtr<Type, InMode>*;
+			using SelfTypeRef      = TSharedPtr<Type, InMode>&;
+			using SelfTypeMoveRef  = TSharedPtr<Type, InMode>&&;
+			using ConstSelfType    = const TSharedPtr<Type, InMode>;
+			using ConstSelfTypeRef = const TSharedPtr<Type, InMode>&;
+			using ConstSelfTypePtr = const TSharedPtr<Type, InMode>*;
+
+		private:
+			using ControlBlock    = Internal::TSharedControlBlock<InMode>;
+			using ControlBlockPtr = Internal::TSharedControlBlock<InMode>*;
 
 		private:
 			TypePtr m_raw_ptr;
 
 		private:
-			RefCounterPtr m_ref_counter;
+			ControlBlockPtr m_control_block;
 
 		private:
-			TDelegate<Void(TypePtr)> m_deleter_callback;
+			/**
+			 * @brief Control block constructor, adopts the reference the control
+			 * block already holds.
+			 */
+			TSharedPtr(TypePtr ptr, ControlBlockPtr control_block)
+				: m_raw_ptr(ptr), m_control_block(control_block) {}
 
 		private:
 			Void InternalDecrementRef(Void)
 			{
-				if (m_ref_counter)
-				{
-					m_ref_counter->DecrementRef();
-
-					if (!m_ref_counter->GetRefCount())
-					{
-						m_deleter_callback.Invoke(m_raw_ptr);
-
-						FORGE_SAFE_DELETE_UNIT(m_ref_counter)
-					}
-				}
+				if (m_control_block)
+					m_control_block->ReleaseRef();
 			}
 
 		public:
@@ -86,152 +272,157 @@ namespace Forge {
 			 * @brief Default constructor.
 			 */
 			TSharedPtr(Void)
-				: m_raw_ptr(nullptr), m_ref_counter(nullptr)
-			{
-				m_deleter_callback = [](TypePtr ptr) -> Void
-				{
-					FORGE_SAFE_DELETE_UNIT(ptr)
-				};
-			}
+				: m_raw_ptr(nullptr), m_control_block(nullptr) {}
+
+			/**
+			 * @brief Null pointer constructor.
+			 */
+			TSharedPtr(std::nullptr_t)
+				: m_raw_ptr(nullptr), m_control_block(nullptr) {}
 
 			/**
 			 * @brief Pointer constructor.
 			 */
 			TSharedPtr(TypePtr ptr)
-				: m_raw_ptr(ptr), m_ref_counter(new RefCounter())
+				: m_raw_ptr(ptr), m_control_block(nullptr)
 			{
-				m_ref_counter->IncrementRef();
+				if (!ptr)
+					return;
 
-				m_deleter_callback = [](TypePtr ptr) -> Void
+				/// The object is owned from here on, so it is deleted if its
+				/// control block cannot be allocated.
+				try
 				{
-					FORGE_SAFE_DELETE_UNIT(ptr)
-				};
+					m_control_block = new Internal::TPointerControlBlock<Type, InMode>(ptr);
+				}
+				catch (...)
+				{
+					delete ptr;
+					throw;
+				}
 			}
-			
+
 			/**
 			 * @brief Pointer and Deleter constructor.
 			 */
 			TSharedPtr(TypePtr ptr, TDelegate<Void(TypePtr)> deleter)
-				: m_raw_ptr(ptr), m_ref_counter(new RefCounter()), m_deleter_callback(deleter) 
+				: m_raw_ptr(ptr), m_control_block(nullptr)
 			{
-				m_ref_counter->IncrementRef();
+				/// The deleter is only moved from once the control block is
+				/// allocated, so it still releases the object on failure.
+				try
+				{
+					m_control_block = new Internal::TDeleterControlBlock<Type, InMode>(ptr, Algorithm::Move(deleter));
+				}
+				catch (...)
+				{
+					deleter.Invoke(ptr);
+					throw;
+				}
 			}
-		   
+
 		public:
 			/**
 			 * @brief Shared pointer move constructor.
 			 */
 			TSharedPtr(SelfTypeMoveRef other)
+				: m_raw_ptr(other.m_raw_ptr), m_control_block(other.m_control_block)
 			{
-				*this = Move(other);
+				other.m_raw_ptr = nullptr;
+				other.m_control_block = nullptr;
 			}
 
 			/**
 			 * @brief Shared pointer copy constructor.
 			 */
 			TSharedPtr(ConstSelfTypeRef other)
+				: m_raw_ptr(other.m_raw_ptr), m_control_block(other.m_control_block)
 			{
-				*this = other;
+				if (m_control_block)
+					m_control_block->IncrementRef();
 			}
 
 			/**
-			 * @brief Weak pointer move constructor.
+			 * @brief Converting move constructor, from a shared pointer to a
+			 * derived type.
 			 */
-			TSharedPtr(TWeakPtr<Type>&& other)
+			template<typename InOtherType, typename = std::enable_if_t<std::is_convertible<InOtherType*, InType*>::value>>
+			TSharedPtr(TSharedPtr<InOtherType, InMode>&& other)
+				: m_raw_ptr(other.m_raw_ptr), m_control_block(other.m_control_block)
 			{
-				*this = Move(other);
+				other.m_raw_ptr = nullptr;
+				other.m_control_block = nullptr;
 			}
 
 			/**
-			 * @brief Weak pointer copy constructor.
+			 * @brief Converting copy constructor, from a shared pointer to a
+			 * derived type.
 			 */
-			TSharedPtr(const TWeakPtr<Type>& other)
+			template<typename InOtherType, typename = std::enable_if_t<std::is_convertible<InOtherType*, InType*>::value>>
+			TSharedPtr(const TSharedPtr<InOtherType, InMode>& other)
+				: m_raw_ptr(other.m_raw_ptr), m_control_block(other.m_control_block)
 			{
-				*this = other;
+				if (m_control_block)
+					m_control_block->IncrementRef();
 			}
-			
-		public:
+
 			/**
-			 * @brief Default constructor.
+			 * @brief Weak pointer constructor, the shared pointer is empty if
+			 * the weak pointer has expired.
 			 */
-			~TSharedPtr(Void)
+			TSharedPtr(const TWeakPtr<Type, InMode>& other)
+				: m_raw_ptr(nullptr), m_control_block(nullptr)
 			{
-				InternalDecrementRef();
+				if (other.m_control_block && other.m_control_block->TryIncrementRef())
+				{
+					m_raw_ptr = other.m_raw_ptr;
+					m_control_block = other.m_control_block;
+				}
 			}
 
 		public:
 			/**
-			 * @brief Shared pointer move assigment.
-			 */
-			SelfTypeRef operator =(SelfTypeMoveRef other)
-			{
-				if (m_raw_ptr == other.m_raw_ptr)
-					return *this;
-
-				InternalDecrementRef();
-
-				m_raw_ptr = other.m_raw_ptr;
-				m_ref_counter = other.m_ref_counter;
-
-				if (m_ref_counter)
-					m_ref_counter->IncrementRef();
-
-				return *this;
-			}
-			
-			/**
-			 * @brief Shared pointer copy assigment.
+			 * @brief Default destructor.
 			 */
-			SelfTypeRef operator =(ConstSelfTypeRef other)
+			~TSharedPtr(Void)
 			{
-				if (m_raw_ptr == other.m_raw_ptr)
-					return *this;
-
 				InternalDecrementRef();
-
-				m_raw_ptr = other.m_raw_ptr;
-				m_ref_counter = other.m_ref_counter;
-
-				if (m_ref_counter)
-					m_ref_counter->IncrementRef();
-
-				return *this;
 			}
 
+		public:
 			/**
-			 * @brief Weak pointer move assigment.
+			 * @brief Shared pointer move assigment.
 			 */
-			SelfTypeRef operator =(TWeakPtr<Type>&& other)
+			SelfTypeRef operator =(SelfTypeMoveRef other)
 			{
-				if (m_raw_ptr == other.m_raw_ptr)
+				if (this == &other)
 					return *this;
 
 				InternalDecrementRef();
 
 				m_raw_ptr = other.m_raw_ptr;
-				m_ref_counter = other.m_ref_counter;
+				m_control_block = other.m_control_block;
 
-				if (m_ref_counter)
-					m_ref_counter->IncrementRef();
+				other.m_raw_ptr = nullptr;
+				other.m_control_block = nullptr;
 
 				return *this;
 			}
 
 			/**
-			 * @brief Weak pointer copy assigment.
+			 * @brief Shared pointer copy assigment.
 			 */
-			SelfTypeRef operator =(const TWeakPtr<Type>& other)
+			SelfTypeRef operator =(ConstSelfTypeRef other)
 			{
-				if (m_raw_ptr == other.m_raw_ptr)
-					return *this;
+				/// The reference is added first, so assigning a pointer to
+				/// itself does not release the object.
+				if (other.m_control_block)
+					other.m_control_block->IncrementRef();
 
 				InternalDecrementRef();
 
 				m_raw_ptr = other.m_raw_ptr;
-				m_ref_counter = other.m_ref_counter;
-
-				if (m_ref_counter)
-					m_ref_counter->IncrementRef();
+				m_control_block = other.m_control_block;
 
 				return *this;
 			}
@@ -257,7 +448,7 @@ namespace Forge {
 			/**
 			 * @brief Dereference operator.
 			 */
-			TypeRef operator *()
+			TypeRef operator *() const
 			{
 				if (!m_raw_ptr)
 					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "Shared pointer is storing a null pointer")
@@ -269,14 +460,14 @@ namespace Forge {
 			/**
 			 * @brief Arrow operator.
 			 */
-			TypePtr operator ->()
+			TypePtr operator ->() const
 			{
 				if (!m_raw_ptr)
 					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "Shared pointer is storing a null pointer")
 
 				return m_raw_ptr;
 			}
-		
+
 		public:
 			/**
 			 * @brief Checks whether the stored pointer is a null pointer.
@@ -296,105 +487,102 @@ namespace Forge {
 			 * over its pointer with other shared pointers.
 			 *
 			 * @returns True if the TShartedPtr object is unique, otherwise false.
-			 * 
+			 *
 			 * @throws InvalidOperationException if the reference-counter is null.
 			 */
 			Bool IsUnique(Void) const
 			{
-				if (!m_ref_counter)
+				if (!m_control_block)
 					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 
-				return FORGE_TRUE ? m_ref_counter->GetRefCount() == 1 : FORGE_FALSE;
+				return m_control_block->GetRefCount() == 1;
 			}
 
 		public:
 			/**
 			 * @brief Gets the number of TSharedPtr objects that share ownership
 			 * over the same stored pointer including itself.
-			 * 
-			 * @returns ConstSize storing the number of refrences to the stored
+			 *
+			 * @returns Size storing the number of refrences to the stored
 			 * pointer.
-			 * 
+			 *
 			 * @throws InvalidOperationException if the reference-counter is null.
 			 */
-			ConstSize GetRefCount(Void) const
+			Size GetRefCount(Void) const
 			{
-				if (!m_ref_counter)
+				if (!m_control_block)
 					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
-				
-				return m_ref_counter->GetRefCount();
+
+				return m_control_block->GetRefCount();
 			}
 
 			/**
-			 * @brief Gets the stored pointer owned by the TSharedPtr object. 
-			 * 
+			 * @brief Gets the stored pointer owned by the TSharedPtr object.
+			 *
 			 * Avoid manually deleting the stored pointer as this may cause
-			 * undefined behaviour. 
-			 * 
+			 * undefined behaviour.
+			 *
 			 * @returns TypePtr storing the address of the stored pointer.
-			 * 
-			 * @throws InvalidOperationException if the reference-counter is null.
 			 */
-			TypePtr GetRawPtr(Void)
+			TypePtr GetRawPtr(Void) const
 			{
-				if (!m_ref_counter)
-					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
-
-				return m_ref_counter;
+				return m_raw_ptr;
 			}
 
 		public:
 			/**
 			 * @brief Swaps the content of the TSharedPtr object with the other,
 			 * without altering the reference count of either or destroying them.
-			 * 
+			 *
 			 * @param[in] other The TSharedPtr object to swap content with.
 			 */
 			Void Swap(SelfTypeRef other)
 			{
-				Algorithm::Swap(*this, other);
+				TypePtr raw_ptr = m_raw_ptr;
+				ControlBlockPtr control_block = m_control_block;
+
+				m_raw_ptr = other.m_raw_ptr;
+				m_control_block = other.m_control_block;
+
+				other.m_raw_ptr = raw_ptr;
+				other.m_control_block = control_block;
 			}
 
 			/**
-			 * @brief Resets the raw pointer to null by default, or sets a new ownership of 
+			 * @brief Resets the raw pointer to null by default, or sets a new ownership of
 			 * the pointer passed and releases ownership of the old pointer.
-			 * 
+			 *
 			 * @param[in] ptr The new pointer that will be owned by the TSharedPtr object.
 			 */
 			Void Reset(TypePtr ptr = nullptr)
 			{
-				InternalDecrementRef();
-
-				if (ptr)
-				{
-					m_ref_counter = new RefCounter();
-					m_ref_counter->IncrementRef();
-				}
-
-				m_raw_ptr = ptr;
+				SelfType(ptr).Swap(*this);
 			}
 		};
 
 		FORGE_TYPEDEF_TEMPLATE_DECL(TSharedPtr)
 
 		/**
-		 * @brief Manages the storage of raw pointers, by holding non-owning 
-		 * "weak" references to data managed by TSharedPtr. Unlike TSharedPtr it 
-		 * does not provide garabge-collection. 
-		 * 
-		 * TWeakPtr models temporary ownership, allowing data to be accessed only 
-		 * if it exists, and may be deleted at any time. 
-		 * 
-		 * TWeakPtr is used to track the object, and is converted to TSharedPtr 
-		 * to assume temporary ownership and access the data. If the original 
-		 * TSharedPtr object is destroyed at this time, the object's lifetime 
+		 * @brief Manages the storage of raw pointers, by holding non-owning
+		 * "weak" references to data managed by TSharedPtr. Unlike TSharedPtr it
+		 * does not provide garabge-collection.
+		 *
+		 * TWeakPtr models temporary ownership, allowing data to be accessed only
+		 * if it exists, and may be deleted at any time.
+		 *
+		 * TWeakPtr is used to track the object, and is converted to TSharedPtr
+		 * to assume temporary ownership and access the data. If the original
+		 * TSharedPtr object is destroyed at this time, the object's lifetime
 		 * is extended until the temporary TSharedPtr is destroyed as well.
-		 * 
+		 *
 		 * @author Karim Hisham
 		 */
-		template<typename InType>
+		template<typename InType, RefCountMode InMode = RefCountMode::THREAD_SAFE>
 		class TWeakPtr final
 		{
+			template<typename, RefCountMode>
+			friend class TSharedPtr;
+
 		public:
 			using Type         = InType;
 			using TypePtr      = InType*;
@@ -405,25 +593,28 @@ namespace Forge {
 			using ConstTypePtr = const InType*;
 
 		private:
-			using SelfType         = TWeakPtr<Type>;
-			using SelfTypePtr      = TWeakPtr<Type>*;
-			using SelfTypeRef      = TWeakPtr<Type>&;
-			using SelfTypeMoveRef  = TWeakPtr<Type>&&;
-			using ConstSelfType    = const TWeakPtr<Type>;
-			using ConstSelfTypeRef = const TWeakPtr<Type>&;
-			using ConstSelfTypePtr = const TWeakPtr<Type>*;
+			using SelfType         = TWeakPtr<Type, InMode>;
+			using SelfTypePtr      = TWeakPtr<Type, InMode>*;
+			using SelfTypeRef      = TWeakPtr<Type, InMode>&;
+			using SelfTypeMoveRef  = TWeakPtr<Type, InMode>&&;
+			using ConstSelfType    = const TWeakPtr<Type, InMode>;
+			using ConstSelfTypeRef = const TWeakPtr<Type, InMode>&;
+			using ConstSelfTypePtr = const TWeakPtr<Type, InMode>*;
+
+		private:
+			using ControlBlockPtr = Internal::TSharedControlBlock<InMode>*;
 
 		private:
 			TypePtr m_raw_ptr;
 
 		private:
-			RefCounterPtr m_ref_counter;
+			ControlBlockPtr m_control_block;
 
 		private:
 			Void InternalDecrementRef(Void)
 			{
-				if (m_ref_counter)
-					m_ref_counter->DecrementWeakRef();
+				if (m_control_block)
+					m_control_block->ReleaseWeakRef();
 			}
 
 		public:
@@ -431,39 +622,37 @@ namespace Forge {
 			 * @brief Default constructor.
 			 */
 			TWeakPtr(Void)
-				: m_raw_ptr(nullptr), m_ref_counter(nullptr) {}
+				: m_raw_ptr(nullptr), m_control_block(nullptr) {}
 
 		public:
 			/**
 			 * @brief Weak pointer move constructor.
 			 */
 			TWeakPtr(SelfTypeMoveRef other)
+				: m_raw_ptr(other.m_raw_ptr), m_control_block(other.m_control_block)
 			{
-				*this = Move(other);
+				other.m_raw_ptr = nullptr;
+				other.m_control_block = nullptr;
 			}
 
 			/**
 			 * @brief Weak pointer copy constructor.
 			 */
 			TWeakPtr(ConstSelfTypeRef other)
+				: m_raw_ptr(other.m_raw_ptr), m_control_block(other.m_control_block)
 			{
-				*this = other;
-			}
-
-			/**
-			 * @brief Smart pointer move constructor.
-			 */
-			TWeakPtr(TSharedPtr<Type>&& other)
-			{
-				*this = Move(other);
+				if (m_control_block)
+					m_control_block->IncrementWeakRef();
 			}
 
 			/**
-			 * @brief Smart pointer move constructor.
+			 * @brief Smart pointer constructor.
 			 */
-			TWeakPtr(const TSharedPtr<Type>& other)
+			TWeakPtr(const TSharedPtr<Type, InMode>& other)
+				: m_raw_ptr(other.m_raw_ptr), m_control_block(other.m_control_block)
 			{
-				*this = other;
+				if (m_control_block)
+					m_control_block->IncrementWeakRef();
 			}
 
 		public:
@@ -478,64 +667,42 @@ namespace Forge {
 		public:
 			SelfTypeRef operator =(SelfTypeMoveRef other)
 			{
-				if (m_raw_ptr == other.m_raw_ptr)
+				if (this == &other)
 					return *this;
 
 				InternalDecrementRef();
 
 				m_raw_ptr = other.m_raw_ptr;
-				m_ref_counter = other.m_ref_counter;
+				m_control_block = other.m_control_block;
 
-				if (m_ref_counter)
-					m_ref_counter->IncrementWeakRef();
+				other.m_raw_ptr = nullptr;
+				other.m_control_block = nullptr;
 
 				return *this;
 			}
 
 			SelfTypeRef operator =(ConstSelfTypeRef other)
 			{
-				if (m_raw_ptr == other.m_raw_ptr)
-					return *this;
-
-				InternalDecrementRef();
-
-				m_raw_ptr = other.m_raw_ptr;
-				m_ref_counter = other.m_ref_counter;
-
-				if (m_ref_counter)
-					m_ref_counter->IncrementWeakRef();
-
-				return *this;
-			}
-
-			SelfTypeRef operator =(TSharedPtr<Type>&& other)
-			{
-				if (m_raw_ptr == other.m_raw_ptr)
-					return *this;
+				if (other.m_control_block)
+					other.m_control_block->IncrementWeakRef();
 
 				InternalDecrementRef();
 
 				m_raw_ptr = other.m_raw_ptr;
-				m_ref_counter = other.m_ref_counter;
-
-				if (m_ref_counter)
-					m_ref_counter->IncrementWeakRef();
+				m_control_block = other.m_control_block;
 
 				return *this;
 			}
 
-			SelfTypeRef operator =(const TSharedPtr<Type>& other)
+			SelfTypeRef operator =(const TSharedPtr<Type, InMode>& other)
 			{
-				if (m_raw_ptr == other.m_raw_ptr)
-					return *this;
+				if (other.m_control_block)
+					other.m_control_block->IncrementWeakRef();
 
 				InternalDecrementRef();
 
 				m_raw_ptr = other.m_raw_ptr;
-				m_ref_counter = other.m_ref_counter;
-
-				if(m_ref_counter)
-					m_ref_counter->IncrementWeakRef();
+				m_control_block = other.m_control_block;
 
 				return *this;
 			}
@@ -561,18 +728,13 @@ namespace Forge {
 			/**
 			 * @brief Checks whether the TWeakPtr object is either empty or there
 			 * are no more TSharedPtr referencing the stored pointer.
-			 * 
-			 * @return True if no more TSharedPtr are referencing the stored 
+			 *
+			 * @return True if no more TSharedPtr are referencing the stored
 			 * pointer and has been deallocated or the TWeakPtr object is empty.
-			 * 
-			 * @throws InvalidOperationException if the reference-counter is null.m_ref_counter->
 			 */
-			Bool IsExpired(Void)
+			Bool IsExpired(Void) const
 			{
-				if (!m_ref_counter)
-					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
-
-				return !m_raw_ptr || m_ref_counter->GetRefCount() == 0;
+				return !m_control_block || m_control_block->GetRefCount() == 0;
 			}
 
 			/**
@@ -580,7 +742,7 @@ namespace Forge {
 			 *
 			 * @return True if the stored pointer is not null.
 			 */
-			Bool IsNull(Void)
+			Bool IsNull(Void) const
 			{
 				if (!m_raw_ptr)
 					return FORGE_TRUE;
@@ -594,31 +756,28 @@ namespace Forge {
 			 * over the same stored pointer. TWeakPtr objects are not counted.
 			 *
 			 * @return Number of refrences to the stored pointer.
-			 * 
+			 *
 			 * @throws InvalidOperationException if the stored pointer is null.
 			 */
-			ConstSize GetRefCount(Void)
+			Size GetRefCount(Void) const
 			{
-				if (!m_ref_counter)
+				if (!m_control_block)
 					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 
-				return m_ref_counter->GetRefCount();
+				return m_control_block->GetRefCount();
 			}
 
 		public:
 			/**
 			 * @brief Locks the stored pointer and prevents it from being released.
-			 * 
+			 *
 			 * @return TSharedPtr with the information preserved by the TWeakPtr
-			 * object if it is not expired. If the TWeakPtr object has expired, 
+			 * object if it is not expired. If the TWeakPtr object has expired,
 			 * the function returns an empty TSharedPtr.
 			 */
-			TSharedPtr<Type> Lock(Void)
+			TSharedPtr<Type, InMode> Lock(Void) const
 			{
-				if (IsExpired())
-					return TSharedPtr<Type>();
-				
-				return TSharedPtr<Type>(m_raw_ptr);
+				return TSharedPtr<Type, InMode>(*this);
 			}
 
 		public:
@@ -630,7 +789,14 @@ namespace Forge {
 			 */
 			Void Swap(SelfTypeRef other)
 			{
-				Algorithm::Swap(*this, other);
+				TypePtr raw_ptr = m_raw_ptr;
+				ControlBlockPtr control_block = m_control_block;
+
+				m_raw_ptr = other.m_raw_ptr;
+				m_control_block = other.m_control_block;
+
+				other.m_raw_ptr = raw_ptr;
+				other.m_control_block = control_block;
 			}
 
 			/**
@@ -638,13 +804,72 @@ namespace Forge {
 			 */
 			Void Reset(Void)
 			{
-				m_raw_ptr = nullptr;
-
 				InternalDecrementRef();
+
+				m_raw_ptr = nullptr;
+				m_control_block = nullptr;
 			}
 		};
 
 		FORGE_TYPEDEF_TEMPLATE_DECL(TWeakPtr)
+
+		/**
+		 * @brief Constructs an object and its reference counts in a single
+		 * allocation from an allocator.
+		 *
+		 * @param[in] allocator The allocator to allocate from, or nullptr to
+		 * allocate with new. It must outlive every TSharedPtr and TWeakPtr to
+		 * the object.
+		 * @param[in] args      The arguments to construct the object with.
+		 *
+		 * @return TSharedPtr storing the constructed object.
+		 */
+		template<typename InType, RefCountMode InMode, typename... InArgs>
+		TSharedPtr<InType, InMode> AllocateShared(Memory::AbstractAllocator* allocator, InArgs&&... args)
+		{
+			using ControlBlockType = Internal::TInlineControlBlock<InType, InMode>;
+
+			ControlBlockType* control_block;
+
+			if (!allocator)
+				control_block = new ControlBlockType(nullptr, std::forward<InArgs>(args)...);
+			else
+			{
+				VoidPtr address = allocator->Allocate(sizeof(ControlBlockType), static_cast<Byte>(alignof(ControlBlockType)));
+
+				try
+				{
+					control_block = new (address) ControlBlockType(allocator, std::forward<InArgs>(args)...);
+				}
+				catch (...)
+				{
+					allocator->Deallocate(address);
+					throw;
+				}
+			}
+
+			return TSharedPtr<InType, InMode>(control_block->GetObjectPtr(), control_block);
+		}
+
+		/**
+		 * @brief Constructs an object and its reference counts in a single
+		 * allocation.
+		 *
+		 * @param[in] args The arguments to construct the object with.
+		 *
+		 * @return TSharedPtr storing the constructed object.
+		 */
+		template<typename InType, RefCountMode InMode = RefCountMode::THREAD_SAFE, typename... InArgs>
+		FORGE_FORCE_INLINE TSharedPtr<InType, InMode> MakeShared(InArgs&&... args)
+		{
+			return AllocateShared<InType, InMode>(nullptr, std::forward<InArgs>(args)...);
+		}
+
+		template<typename InType, RefCountMode InMode>
+		struct TIsTriviallyRelocatable<TSharedPtr<InType, InMode>> { enum { Value = true }; };
+
+		template<typename InType, RefCountMode InMode>
+		struct TIsTriviallyRelocatable<TWeakPtr<InType, InMode>> { enum { Value = true }; };
 	}
 }
 
@@ -0,0 +1,192 @@
+#ifndef CONST_STRING_HASH_H
+#define CONST_STRING_HASH_H
+
+#include "StringTable.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeTraits.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+#include "Core/Public/Algorithm/Hash/THash.h"
+#include "Core/Public/Algorithm/Hash/ConstHash.h"
+#include "Core/Public/Algorithm/StringUtilities.h"
+
+namespace Forge {
+	namespace Type
+	{
+		/**
+		 * @brief Interned name of a type, asset, event or any other object
+		 * looked up by name.
+		 *
+		 * A name stores the 32-bit identifier of its string in the global
+		 * string table, so comparing names is a single integer compare and
+		 * copying them is free. The text is kept by the table and can be
+		 * recovered at any time for logging and debugging.
+		 *
+		 * Identifiers are assigned in the order names are first interned, so
+		 * they differ between runs and must not be serialized; serialize the
+		 * text or the hash instead. Names order by identifier, not by text.
+		 *
+		 * Constructing a name from text looks the text up in the table. Names
+		 * of string literals used on hot paths should be created with the
+		 * FORGE_NAME macro, which hashes the literal at compile time and
+		 * interns it once per call-site.
+		 *
+		 * @author Karim Hisham
+		 */
+		class ConstStringHash
+		{
+		private:
+			using SelfType         = ConstStringHash;
+			using SelfTypeRef      = ConstStringHash&;
+			using SelfTypePtr      = ConstStringHash*;
+			using ConstSelfType    = const ConstStringHash;
+			using ConstSelfTypeRef = const ConstStringHash&;
+			using ConstSelfTypePtr = const ConstStringHash*;
+
+		private:
+			U32 m_id;
+
+		public:
+			/**
+			 * @brief Default constructor, constructs the empty name.
+			 */
+			ConstStringHash(Void)
+				: m_id(0) {}
+
+			/**
+			 * @brief Null-terminated string constructor.
+			 *
+			 * @param[in] str The null-terminated text of the name.
+			 */
+			explicit ConstStringHash(ConstCharPtr str)
+				: ConstStringHash(str, Algorithm::GetStringLength(str)) {}
+
+			/**
+			 * @brief Character array constructor.
+			 *
+			 * @param[in] str   The characters of the name.
+			 * @param[in] count The number of characters of the name.
+			 */
+			ConstStringHash(ConstCharPtr str, Size count)
+				: ConstStringHash(str, count, StringTable::HashString(str, count)) {}
+
+			/**
+			 * @brief Pre-hashed character array constructor, skips hashing the
+			 * text.
+			 *
+			 * @param[in] str   The characters of the name.
+			 * @param[in] count The number of characters of the name.
+			 * @param[in] hash  The hash of the name computed by
+			 * StringTable::HashString.
+			 */
+			ConstStringHash(ConstCharPtr str, Size count, U64 hash)
+				: m_id(StringTable::Intern(str, count, hash)) {}
+
+		public:
+			/**
+			 * @brief Gets the name of a text without adding the text to the
+			 * string table.
+			 *
+			 * Lookups of names read from files or typed by users should use
+			 * this function, so that unknown names do not grow the table.
+			 *
+			 * @param[in] str   The characters of the name.
+			 * @param[in] count The number of characters of the name.
+			 * @param[out] name The name of the text if it was interned.
+			 *
+			 * @return True if the text was interned.
+			 */
+			static Bool TryFind(ConstCharPtr str, Size count, SelfTypeRef name);
+
+		public:
+			Bool operator ==(ConstSelfTypeRef other) const { return m_id == other.m_id; }
+			Bool operator !=(ConstSelfTypeRef other) const { return m_id != other.m_id; }
+			Bool operator <(ConstSelfTypeRef other) const  { return m_id < other.m_id; }
+
+		public:
+			/**
+			 * @brief Checks whether the name is the empty name.
+			 *
+			 * @return True if the name is empty.
+			 */
+			Bool IsEmpty(Void) const;
+
+		public:
+			/**
+			 * @brief Gets the identifier of the name in the string table.
+			 *
+			 * @return U32 storing the identifier.
+			 */
+			U32 GetId(Void) const;
+
+			/**
+			 * @brief Gets the number of characters of the name.
+			 *
+			 * @return Size storing the number of characters.
+			 */
+			Size GetCount(Void) const;
+
+			/**
+			 * @brief Gets the hash of the text of the name, which is stable
+			 * across runs and equals the compile-time hash of the same literal.
+			 *
+			 * @return U64 storing the hash.
+			 */
+			U64 GetHash(Void) const;
+
+			/**
+			 * @brief Gets the text of the name.
+			 *
+			 * @return ConstCharPtr storing the null-terminated text, valid for
+			 * the lifetime of the program.
+			 */
+			ConstCharPtr GetString(Void) const;
+		};
+
+		FORGE_FORCE_INLINE Bool ConstStringHash::TryFind(ConstCharPtr str, Size count, SelfTypeRef name)
+		{
+			U32 id = StringTable::Find(str, count, StringTable::HashString(str, count));
+
+			if (id == StringTable::INVALID_ID)
+				return false;
+
+			name.m_id = id;
+
+			return true;
+		}
+
+		FORGE_FORCE_INLINE Bool ConstStringHash::IsEmpty(Void) const { return m_id == 0; }
+
+		FORGE_FORCE_INLINE U32 ConstStringHash::GetId(Void) const              { return m_id; }
+		FORGE_FORCE_INLINE Size ConstStringHash::GetCount(Void) const          { return StringTable::GetCount(m_id); }
+		FORGE_FORCE_INLINE U64 ConstStringHash::GetHash(Void) const            { return StringTable::GetHash(m_id); }
+		FORGE_FORCE_INLINE ConstCharPtr ConstStringHash::GetString(Void) const { return StringTable::GetString(m_id); }
+	}
+
+	namespace Algorithm
+	{
+		template<>
+		struct THash<Type::ConstStringHash>
+		{
+			U64 operator ()(const Type::ConstStringHash& value) const { return HashMix64(value.GetId()); }
+		};
+	}
+}
+
+/**
+ * Gets the name of a string literal. The literal is hashed at compile time and
+ * interned the first time the call-site runs, later runs only read the name.
+ * The length is taken from the size of the literal, so pointers are rejected.
+ */
+#define FORGE_NAME(__LITERAL__)																						\
+	([]() -> Forge::Type::ConstStringHash																			\
+	{																												\
+		static_assert(Forge::Common::TIsArray<typename Forge::Common::TRemoveRefernce<decltype(__LITERAL__)>::Type>::Value,	\
+			"FORGE_NAME expects a string literal, the length of a pointer is not known at compile time.");			\
+		static const Forge::Type::ConstStringHash s_name(__LITERAL__, sizeof(__LITERAL__) - 1,						\
+			Forge::Algorithm::TConstHash<Forge::Algorithm::HashFnv1a64(__LITERAL__, sizeof(__LITERAL__) - 1)>::Value);	\
+		return s_name;																								\
+	}())
+
+#endif // CONST_STRING_HASH_H
@@ -5,6 +5,11 @@
 
 #include "Core/Public/Common/Compiler.h"
 
+#include "Core/Public/Memory/AllocatorPolicy.h"
+
+#include "Core/Public/Algorithm/Hash/THash.h"
+#include "Core/Public/Algorithm/Hash/XXHash3.h"
+
 namespace Forge {
 	namespace Type
 	{
@@ -23,6 +28,9 @@ namespace Forge {
 
 		private:
 			CharPtr m_buffer;
+
+		private:
+			Memory::InstanceAllocatorPolicy m_allocator;
 		
 		private:
 			Size m_version;
@@ -30,103 +38,89 @@ namespace Forge {
 
 		public:
 			String(void)
-				: m_buffer(nullptr), m_version(0), m_capacity(0), AbstractString(0, ~((Size)0)) {}
-
-			String(CharPtr str)
-				: m_version(0), m_capacity(0), AbstractString(0, ~((Size)0))
-			{
-				this->m_count = this->m_capacity = Algorithm::GetStringLength(str);
-
-				this->m_buffer = (CharPtr)malloc((this->GetCount() + 1) * sizeof(Char));
-
-				Memory::MemorySet(this->m_buffer, '\0', this->GetCount() + 1);
+				: AbstractString(0, ~((Size)0)), m_buffer(nullptr), m_version(0), m_capacity(0) {}
 
-				Memory::MemoryCopy(this->m_buffer, str, this->GetCount());
-			}
+			/**
+			 * @brief Constructs an empty string allocating its characters
+			 * through an allocator, or the heap if the allocator is nullptr.
+			 */
+			explicit String(Memory::AbstractAllocator* allocator)
+				: AbstractString(0, ~((Size)0)), m_buffer(nullptr), m_allocator(allocator), m_version(0), m_capacity(0) {}
 
-			String(ConstCharPtr str)
-				: m_version(0), m_capacity(0), AbstractString(0, ~((Size)0))
+			String(ConstCharPtr str, Memory::AbstractAllocator* allocator = nullptr)
+				: AbstractString(0, ~((Size)0)), m_buffer(nullptr), m_allocator(allocator), m_version(0), m_capacity(0)
 			{
-				this->m_count = this->m_capacity = Algorithm::GetStringLength(str);
-
-				this->m_buffer = (CharPtr)malloc((this->GetCount() + 1) * sizeof(Char));
-
-				Memory::MemorySet(this->m_buffer, '\0', this->GetCount() + 1);
-
-				Memory::MemoryCopy(this->m_buffer, const_cast<CharPtr>(str), this->GetCount());
+				this->Append(str, Algorithm::GetStringLength(str));
 			}
 
 		public:
 			String(SelfType&& other)
-				: AbstractString(other)
+				: AbstractString(other.m_count, other.m_max_capacity), m_buffer(other.m_buffer), m_allocator(other.m_allocator), m_version(other.m_version), m_capacity(other.m_capacity)
 			{
-				*this = Algorithm::Move(other);
+				other.m_buffer = nullptr;
+				other.m_count = other.m_capacity = 0;
 			}
 
+			/**
+			 * @brief The copy allocates through the allocator of the other
+			 * string.
+			 */
 			String(ConstSelfTypeRef other)
-				: AbstractString(other)
+				: AbstractString(0, other.m_max_capacity), m_buffer(nullptr), m_allocator(other.m_allocator), m_version(0), m_capacity(0)
 			{
-				*this = other;
+				this->Append(other.m_buffer, other.GetCount());
 			}
-		
+
 		public:
-			String& operator =(CharPtr str)
+			~String()
 			{
-				ConstSize new_count = Algorithm::GetStringLength(str);
-
-				this->Clear();
-
-				if (new_count > this->GetCount())
-					this->ReserveCapacity(new_count);
-
-				Memory::MemoryCopy(this->m_buffer, str, new_count);
-
-				this->m_count = new_count;
-
-				return *this;
+				if (this->m_buffer)
+					this->m_allocator.Deallocate(this->m_buffer);
 			}
-
+		
+		public:
 			String& operator =(ConstCharPtr str)
 			{
-				ConstSize new_count = Algorithm::GetStringLength(str);
+				this->m_count = 0;
 
-				this->Clear();
-
-				if (new_count > this->GetCount())
-					this->ReserveCapacity(new_count);
-
-				Memory::MemoryCopy(this->m_buffer, const_cast<CharPtr>(str), new_count);
-
-				this->m_count = new_count;
+				this->Append(str, Algorithm::GetStringLength(str));
 
 				return *this;
 			}
 
+			/**
+			 * @brief The string takes over the buffer of the other string along
+			 * with the allocator it was allocated through.
+			 */
 			String& operator =(SelfType&& other)
 			{
-				this->Clear();
+				if (this == &other)
+					return *this;
+
+				if (this->m_buffer)
+					this->m_allocator.Deallocate(this->m_buffer);
 
-				Memory::MemoryCopy(this, &other, sizeof(SelfType));
+				this->m_buffer = other.m_buffer;
+				this->m_allocator = other.m_allocator;
+				this->m_count = other.m_count;
+				this->m_capacity = other.m_capacity;
+				this->m_max_capacity = other.m_max_capacity;
+				this->m_version++;
 
 				other.m_buffer = nullptr;
-				other.m_count = other.m_version = other.m_capacity = 0;
+				other.m_count = other.m_capacity = 0;
 
 				return *this;
 			}
 
 			String& operator =(ConstSelfTypeRef other)
 			{
-				this->Clear();
+				if (this == &other)
+					return *this;
 
-				if (other.GetCount() > this->GetCount())
-					this->ReserveCapacity(other.GetCount());
+				this->m_count = 0;
 
-				Memory::MemoryCopy(this->m_buffer, other.m_buffer, other.GetCount());
-
-				this->m_count = other.GetCount();
-				this->m_version = other.GetVersion();
-				this->m_capacity = other.GetCapacity();
-				this->m_max_capacity = other.GetMaxCapacity();
+				this->Append(other.m_buffer, other.GetCount());
 
 				return *this;
 			}
@@ -134,77 +128,115 @@ namespace Forge {
 		public:
 			String& operator +=(Char c)
 			{
+				this->Append(&c, 1);
 
-			}
-
-			String& operator +=(CharPtr str)
-			{
-
+				return *this;
 			}
 
 			String& operator +=(ConstCharPtr str)
 			{
+				this->Append(str, Algorithm::GetStringLength(str));
 
+				return *this;
 			}
 
 			String& operator +=(ConstSelfTypeRef other)
 			{
+				this->Append(other.m_buffer, other.GetCount());
 
+				return *this;
 			}
 
 		public:
+			ConstCharPtr GetRawData(void) const override;
+
 			ConstSize GetVersion(void) const;
 
 			ConstSize GetCapacity(void) const;
 
-		public:
-			Void Resize(Size capacity)
+		private:
+			/// The buffer always holds one more character than the capacity
+			/// for the null terminator. The previous buffer is returned rather
+			/// than freed, as the characters being added may still live in it.
+			CharPtr GrowCapacity(Size capacity)
 			{
-				if (capacity)
-				{
-					CharPtr temp_buffer = this->m_buffer;
+				if (this->m_buffer && capacity <= this->GetCapacity())
+					return nullptr;
+
+				Size new_capacity;
 
-					this->m_buffer = (CharPtr)malloc(capacity * sizeof(Char));
+				new_capacity = this->GetCapacity() + (this->GetCapacity() >> 1);
+				new_capacity = new_capacity > capacity ? new_capacity : capacity;
+				new_capacity = new_capacity < this->GetMaxCapacity() ? new_capacity : this->GetMaxCapacity();
+				new_capacity = (new_capacity + (CAPACITY_ALIGNMENT - 1)) & ~(CAPACITY_ALIGNMENT - 1);
 
-					Memory::MemorySet(this->m_buffer, '\0', this->GetCapacity());
+				CharPtr prev_buffer = this->m_buffer;
 
-					Memory::MemoryCopy(this->m_buffer, temp_buffer, this->GetCount());
+				this->m_buffer = (CharPtr)this->m_allocator.Allocate((new_capacity + 1) * sizeof(Char), alignof(Char));
 
-					free(temp_buffer);
-				}	
+				if (prev_buffer)
+					Memory::MemoryCopy(this->m_buffer, prev_buffer, this->GetCount() * sizeof(Char));
+
+				this->m_buffer[this->GetCount()] = '\0';
+
+				this->m_capacity = new_capacity;
+				this->m_version++;
+
+				return prev_buffer;
 			}
 
+			Void Append(ConstCharPtr str, Size count)
+			{
+				CharPtr prev_buffer = this->GrowCapacity(this->GetCount() + count);
+
+				Memory::MemoryCopy(this->m_buffer + this->GetCount(), str, count * sizeof(Char));
+
+				this->m_count += count;
+				this->m_buffer[this->GetCount()] = '\0';
+
+				if (prev_buffer)
+					this->m_allocator.Deallocate(prev_buffer);
+			}
+
+		public:
 			Void ReserveCapacity(Size capacity)
 			{
-				if (!this->m_buffer)
-				{
-					this->m_buffer = (CharPtr)malloc(capacity * sizeof(Char));
-					return;
-				}
-
-				if (capacity && capacity > this->GetCapacity())
-				{
-					Size new_capacity;
-
-					new_capacity = this->GetCapacity() + (this->GetCapacity() >> 1);
-					new_capacity = new_capacity > capacity ? new_capacity : capacity;
-					new_capacity = new_capacity < this->GetMaxCapacity() ? new_capacity : this->GetMaxCapacity();
-					new_capacity = (new_capacity + (CAPACITY_ALIGNMENT - 1)) & ~(CAPACITY_ALIGNMENT - 1);
-
-					this->Resize(new_capacity);
-
-					this->m_capacity = new_capacity;
-					this->m_version++;
-				}
+				CharPtr prev_buffer = this->GrowCapacity(capacity);
+
+				if (prev_buffer)
+					this->m_allocator.Deallocate(prev_buffer);
 			}
 
 		public:
-			Void Clear(void);
+			Void Clear(void)
+			{
+				this->m_count = 0;
+
+				if (this->m_buffer)
+					this->m_buffer[0] = '\0';
+			}
 		};
 
-		FORGE_FORCE_INLINE ConstSize String::GetVersion(void) { return this->m_version; };
+		FORGE_FORCE_INLINE ConstCharPtr String::GetRawData(void) const { return this->m_buffer ? this->m_buffer : ""; }
 
-		FORGE_FORCE_INLINE ConstSize String::GetCapacity(void) { return this->m_capacity; };
+		FORGE_FORCE_INLINE ConstSize String::GetVersion(void) const { return this->m_version; }
+
+		FORGE_FORCE_INLINE ConstSize String::GetCapacity(void) const { return this->m_capacity; }
+	}
+
+	namespace Common
+	{
+		template<>
+		struct TIsTriviallyRelocatable<Type::String> { enum { Value = true }; };
+	}
+
+	namespace Algorithm
+	{
+		template<>
+		struct THash<Type::String>
+		{
+			U64 operator ()(const Type::AbstractString& value) const { return HashBytes(value.GetRawData(), value.GetCount()); }
+		};
 	}
 }
 
@@ -0,0 +1,136 @@
+#ifndef STRING_TABLE_H
+#define STRING_TABLE_H
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+#include "Core/Public/Algorithm/Hash/ConstHash.h"
+
+namespace Forge {
+	namespace Type
+	{
+		/**
+		 * @brief Global table of interned strings, mapping every distinct
+		 * string to a dense 32-bit identifier for the lifetime of the program.
+		 *
+		 * Strings are copied into arena chunks that are never freed, so the
+		 * text of an identifier stays valid and never moves. The table only
+		 * grows: identifiers are never reused and lookups never wait on a
+		 * lock. Interning a string that is not in the table yet takes a single
+		 * writer lock.
+		 *
+		 * Strings are keyed by their FNV-1a hash, which can be computed at
+		 * compile time for literals. Identifier zero is always the empty
+		 * string.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API StringTable
+		{
+		public:
+			enum : U32
+			{
+				INVALID_ID = 0xFFFFFFFF,
+
+				/// Identifiers are stored in pages allocated on demand.
+				PAGE_SIZE = 4096,
+				MAX_NUM_OF_PAGES = 1024,
+
+				MAX_NUM_OF_STRINGS = PAGE_SIZE * MAX_NUM_OF_PAGES
+			};
+
+		public:
+			/**
+			 * @brief Computes the hash strings are keyed by in the table.
+			 *
+			 * @param[in] str   The characters of the string.
+			 * @param[in] count The number of characters of the string.
+			 *
+			 * @return U64 storing the hash.
+			 */
+			static constexpr U64 HashString(ConstCharPtr str, Size count)
+			{
+				return Algorithm::HashFnv1a64(str, count);
+			}
+
+		public:
+			/**
+			 * @brief Gets the identifier of a string, adding the string to the
+			 * table if it is not in it yet.
+			 *
+			 * @param[in] str   The characters of the string.
+			 * @param[in] count The number of characters of the string.
+			 * @param[in] hash  The hash of the string computed by HashString.
+			 *
+			 * @return U32 storing the identifier of the string.
+			 *
+			 * @throws InvalidOperationException if the table is full.
+			 */
+			static U32 Intern(ConstCharPtr str, Size count, U64 hash);
+
+			/**
+			 * @brief Gets the identifier of a string without adding it to the
+			 * table, never blocks.
+			 *
+			 * @param[in] str   The characters of the string.
+			 * @param[in] count The number of characters of the string.
+			 * @param[in] hash  The hash of the string computed by HashString.
+			 *
+			 * @return U32 storing the identifier of the string, or INVALID_ID if
+			 * the string was never interned.
+			 */
+			static U32 Find(ConstCharPtr str, Size count, U64 hash);
+
+		public:
+			/**
+			 * @brief Gets the text of an interned string.
+			 *
+			 * @param[in] id The identifier of the string.
+			 *
+			 * @return ConstCharPtr storing the null-terminated text, or nullptr
+			 * if the identifier is not in the table.
+			 */
+			static ConstCharPtr GetString(U32 id);
+
+			/**
+			 * @brief Gets the number of characters of an interned string.
+			 *
+			 * @param[in] id The identifier of the string.
+			 *
+			 * @return Size storing the number of characters, zero if the
+			 * identifier is not in the table.
+			 */
+			static Size GetCount(U32 id);
+
+			/**
+			 * @brief Gets the hash of an interned string, which is stable across
+			 * runs unlike its identifier.
+			 *
+			 * @param[in] id The identifier of the string.
+			 *
+			 * @return U64 storing the hash, zero if the identifier is not in the
+			 * table.
+			 */
+			static U64 GetHash(U32 id);
+
+		public:
+			/**
+			 * @brief Gets the number of strings in the table, including the
+			 * empty string.
+			 *
+			 * @return Size storing the number of strings.
+			 */
+			static Size GetNumOfStrings(Void);
+
+			/**
+			 * @brief Gets the memory held by the table in bytes, including its
+			 * arena and lookup index.
+			 *
+			 * @return Size storing the memory in bytes.
+			 */
+			static Size GetUsedMemory(Void);
+		};
+	}
+}
+
+#endif // STRING_TABLE_H
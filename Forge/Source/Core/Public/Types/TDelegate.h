@@ -15,7 +15,7 @@ using namespace Forge::Algorithm;
 namespace Forge {
 	namespace Common
 	{
-		template<typename Type>
+		template<typename Type, Size InInlineSize = 32>
 		class TDelegate {};
 
 		/**
@@ -30,125 +30,224 @@ namespace Forge {
 		 * This ability to refer to a function as a parameter makes delegates ideal
 		 * for defining callback functions.
 		 * 
+		 * Invokables of up to InInlineSize bytes are stored inside the delegate
+		 * object, only larger ones are allocated on the heap. Global functions,
+		 * member functions and trivially copyable lambdas are copied and moved
+		 * as plain bytes, other lambdas through their own constructors, so
+		 * lambdas capturing move-only objects can be bound and moved but not
+		 * copied.
+		 * 
 		 * @author Karim Hisham
 		 */
-		template<typename InReturnType, typename... InParams>
-		class TDelegate<InReturnType(InParams...)>
+		template<typename InReturnType, typename... InParams, Size InInlineSize>
+		class TDelegate<InReturnType(InParams...), InInlineSize>
 		{
 		private:
-			using SelfType         = TDelegate<InReturnType(InParams...)>;
-			using SelfTypePtr      = TDelegate<InReturnType(InParams...)>*;
-			using SelfTypeRef      = TDelegate<InReturnType(InParams...)>&;
-			using SelfTypeMoveRef  = TDelegate<InReturnType(InParams...)>&&;
-			using ConstSelfType    = const TDelegate<InReturnType(InParams...)>;
-			using ConstSelfTypeRef = const TDelegate<InReturnType(InParams...)>&;
-			using ConstSelfTypePtr = const TDelegate<InReturnType(InParams...)>*;
+			using SelfType         = TDelegate<InReturnType(InParams...), InInlineSize>;
+			using SelfTypePtr      = TDelegate<InReturnType(InParams...), InInlineSize>*;
+			using SelfTypeRef      = TDelegate<InReturnType(InParams...), InInlineSize>&;
+			using SelfTypeMoveRef  = TDelegate<InReturnType(InParams...), InInlineSize>&&;
+			using ConstSelfType    = const TDelegate<InReturnType(InParams...), InInlineSize>;
+			using ConstSelfTypeRef = const TDelegate<InReturnType(InParams...), InInlineSize>&;
+			using ConstSelfTypePtr = const TDelegate<InReturnType(InParams...), InInlineSize>*;
 
 		private:
-			using SignatureFunc = InReturnType(*)(InParams...);
-			using InvokableFunc = InReturnType(*)(ConstSelfTypeRef, InParams...);
+			static constexpr Size STORAGE_ALIGNMENT = 16;
 
 		private:
-			template<typename InLambdaFunctor>
-			struct LambdaStorage 
-			{ 
-				InLambdaFunctor m_lambda; 
-				LambdaStorage(InLambdaFunctor lambda) : m_lambda(lambda) {}
+			enum class StorageOperation : U8
+			{
+				COPY,
+				MOVE,
+				DESTROY
 			};
 
 		private:
-			union
+			using SignatureFunc = InReturnType(*)(InParams...);
+			using InvokableFunc = InReturnType(*)(VoidPtr, InParams&&...);
+			using ManagerFunc   = Void(*)(StorageOperation, VoidPtr, VoidPtr);
+
+		private:
+			/**
+			 * @brief Binds a member function to the instance it is called on,
+			 * InClass is const for const member functions.
+			 */
+			template<typename InFunction, typename InClass>
+			struct MemberFunctionBinding
+			{
+				InFunction m_function;
+				InClass*   m_instance;
+
+				InReturnType operator ()(InParams&&... params) const
+				{
+					return (m_instance->*m_function)(std::forward<InParams>(params)...);
+				}
+			};
+
+			/**
+			 * @brief Tests whether an invokable fits in the inline storage.
+			 */
+			template<typename InFunction>
+			struct TIsStoredInline
+			{
+				enum
+				{
+					Value = sizeof(InFunction) <= InInlineSize && alignof(InFunction) <= STORAGE_ALIGNMENT &&
+							std::is_nothrow_move_constructible<InFunction>::value
+				};
+			};
+
+			/**
+			 * @brief Tests whether an invokable is stored inline and can be
+			 * copied, moved and released as plain bytes.
+			 */
+			template<typename InFunction>
+			struct TIsStoredTrivially
+			{
+				enum { Value = TIsStoredInline<InFunction>::Value && std::is_trivially_copyable<InFunction>::value };
+			};
+
+			/**
+			 * @brief Inline storage of the bound invokable, a struct so that
+			 * trivially stored invokables are copied with fixed-size moves.
+			 */
+			struct InlineStorage
 			{
-				VoidPtr m_instance_ptr;
-				ConstVoidPtr m_const_instance_ptr;
+				FORGE_ALIGN(16) Byte m_bytes[InInlineSize];
 			};
 
 		private:
-			InvokableFunc m_invokable_function;
+			mutable InlineStorage m_storage;
 
 		private:
-			 Size m_function_size;
-			 mutable BytePtr m_function_address;
+			InvokableFunc m_invokable_function;
+
+			/// Copies, moves and destroys the bound invokable, nullptr if the
+			/// invokable is stored trivially.
+			ManagerFunc m_manager_function;
 
 		private:
 			/**
-			 * @brief Invokes the lambda functor currently bound inplace in the
+			 * @brief Invokes the invokable currently bound inplace in the
 			 * delegate object.
 			 *
-			 * This function is used internally by the delegate object to call a
-			 * function pointer with the appropriate parameter semantics it was
-			 * passed.
+			 * This function is used internally by the delegate object to call
+			 * the bound invokable with the appropriate parameter semantics it
+			 * was passed.
 			 *
-			 * @param[in] self_type The calling delegate object to this function.
-			 * @param[in] InParams    The parameters to pass to the bound function.
+			 * @param[in] storage  The storage of the calling delegate object.
+			 * @param[in] InParams The parameters to pass to the bound function.
 			 *
 			 * @return InReturnType storing the return value of the bound function.
 			 */
 			template<typename InFunction>
-			static InReturnType InvokeLambda(ConstSelfTypeRef self_type, InParams... params)
+			static InReturnType InvokeInline(VoidPtr storage, InParams&&... params)
 			{
-				return reinterpret_cast<LambdaStorage<InFunction>*>(self_type.m_function_address)->m_lambda(params...);
+				return (*reinterpret_cast<InFunction*>(storage))(std::forward<InParams>(params)...);
 			}
 
 			/**
-			 * @brief Invokes the global function currently bound inplace in the
-			 * delegate object.
+			 * @brief Invokes the invokable currently bound on the heap.
 			 *
-			 * This function is used internally by the delegate object to call a
-			 * function pointer with the appropriate parameter semantics it was
-			 * passed.
+			 * This function is used internally by the delegate object to call
+			 * the bound invokable with the appropriate parameter semantics it
+			 * was passed.
 			 *
-			 * @param[in] self_type The calling delegate object to this function.
-			 * @param[in] InParams    The parameters to pass to the bound function.
+			 * @param[in] storage  The storage of the calling delegate object.
+			 * @param[in] InParams The parameters to pass to the bound function.
 			 *
 			 * @return InReturnType storing the return value of the bound function.
 			 */
 			template<typename InFunction>
-			static InReturnType InvokeFunction(ConstSelfTypeRef self_type, InParams... params)
+			static InReturnType InvokeHeap(VoidPtr storage, InParams&&... params)
 			{
-				return (*(reinterpret_cast<InFunction*>(self_type.m_function_address)))(params...);
+				return (**reinterpret_cast<InFunction**>(storage))(std::forward<InParams>(params)...);
 			}
 
 			/**
-			 * @brief Invokes the member function currently bound inplace in the
-			 * delegate object.
-			 *
-			 * This function is used internally by the delegate object to call a
-			 * function pointer with the appropriate parameter semantics it was
-			 * passed.
+			 * @brief Copies, moves or destroys a non-trivial invokable stored
+			 * inplace in the delegate object.
 			 *
-			 * @param[in] self_type The calling delegate object to this function.
-			 * @param[in] InParams    The parameters to pass to the bound function.
-			 *
-			 * @return InReturnType storing the return value of the bound function.
+			 * @throws InvalidOperationException if a move-only invokable is copied.
 			 */
-			template<typename InFunction, typename InClass>
-			static InReturnType InvokeClassFunction(ConstSelfTypeRef self_type, InParams... params)
+			template<typename InFunction>
+			static Void ManageInline(StorageOperation operation, VoidPtr storage, VoidPtr other_storage)
 			{
-				InFunction function = *(reinterpret_cast<InFunction*>(self_type.m_function_address));
+				switch (operation)
+				{
+				case StorageOperation::COPY:
+					if constexpr (std::is_copy_constructible<InFunction>::value)
+						new (storage) InFunction(*reinterpret_cast<const InFunction*>(other_storage));
+					else
+						FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The bound invokable cannot be copied")
+					break;
+
+				case StorageOperation::MOVE:
+					new (storage) InFunction(Move(*reinterpret_cast<InFunction*>(other_storage)));
+					reinterpret_cast<InFunction*>(other_storage)->~InFunction();
+					break;
 
-				return (static_cast<InClass*>(self_type.m_instance_ptr)->*function)(params...);
+				case StorageOperation::DESTROY:
+					reinterpret_cast<InFunction*>(storage)->~InFunction();
+					break;
+				}
 			}
 
 			/**
-			 * @brief Invokes the const member function currently bound inplace in
-			 * the delegate object.
-			 *
-			 * This function is used internally by the delegate object to call a
-			 * function pointer with the appropriate parameter semantics it was
-			 * passed.
-			 *
-			 * @param[in] self_type The calling delegate object to this function.
-			 * @param[in] InParams    The parameters to pass to the bound function.
+			 * @brief Copies, moves or destroys an invokable stored on the heap.
 			 *
-			 * @return InReturnType storing the return value of the bound function.
+			 * @throws InvalidOperationException if a move-only invokable is copied.
 			 */
-			template<typename InFunction, typename InClass>
-			static InReturnType InvokeClassConstFunction(ConstSelfTypeRef self_type, InParams... params)
+			template<typename InFunction>
+			static Void ManageHeap(StorageOperation operation, VoidPtr storage, VoidPtr other_storage)
 			{
-				InFunction function = *(reinterpret_cast<InFunction*>(self_type.m_function_address));
+				InFunction*& function = *reinterpret_cast<InFunction**>(storage);
+
+				switch (operation)
+				{
+				case StorageOperation::COPY:
+					if constexpr (std::is_copy_constructible<InFunction>::value)
+						function = new InFunction(**reinterpret_cast<InFunction**>(other_storage));
+					else
+						FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The bound invokable cannot be copied")
+					break;
 
-				return (static_cast<const InClass*>(self_type.m_const_instance_ptr)->*function)(params...);
+				case StorageOperation::MOVE:
+					function = *reinterpret_cast<InFunction**>(other_storage);
+					break;
+
+				case StorageOperation::DESTROY:
+					delete function;
+					break;
+				}
+			}
+
+		private:
+			/**
+			 * @brief Binds an invokable to the empty delegate object, choosing
+			 * its storage by its size and whether it is trivially copyable.
+			 */
+			template<typename InFunction, typename InArg>
+			Void Bind(InArg&& function)
+			{
+				/// Trivially stored invokables are compared as plain bytes, so
+				/// the bytes they leave unused must be zero.
+				m_storage = InlineStorage();
+
+				if constexpr (TIsStoredInline<InFunction>::Value)
+				{
+					new (m_storage.m_bytes) InFunction(std::forward<InArg>(function));
+
+					m_invokable_function = &InvokeInline<InFunction>;
+					m_manager_function = TIsStoredTrivially<InFunction>::Value ? nullptr : &ManageInline<InFunction>;
+				}
+				else
+				{
+					*reinterpret_cast<InFunction**>(m_storage.m_bytes) = new InFunction(std::forward<InArg>(function));
+
+					m_invokable_function = &InvokeHeap<InFunction>;
+					m_manager_function = &ManageHeap<InFunction>;
+				}
 			}
 
 		public:
@@ -158,46 +257,25 @@ namespace Forge {
 			 * Constructs an empty delegate object with the invokable to null.
 			 */
 			TDelegate(Void)
-				: m_function_size(0), m_function_address(nullptr), m_invokable_function(nullptr) {}
+				: m_invokable_function(nullptr), m_manager_function(nullptr) {}
 
 			/**
 			 * @brief Global invokable constructor.
 			 * 
 			 * Constructs a delegate object with the passed invokable bound to the
-			 * delegate object.
+			 * delegate object. Lambdas without captures are bound as global
+			 * functions.
 			 */
-			template<typename InFunction>
-			TDelegate(InFunction function)
+			template<typename InFunction, typename = typename TEnableIf<!TAreSameType<typename std::decay<InFunction>::type, SelfType>::Value, Void>::Type>
+			TDelegate(InFunction&& function)
+				: m_invokable_function(nullptr), m_manager_function(nullptr)
 			{
-				if (TIsAssignable<SignatureFunc&, InFunction>::Value)
-				{
-					ConstSize size = sizeof(InFunction);
+				using FunctionType = typename std::decay<InFunction>::type;
 
-					m_function_address = new Byte[size];
-					
-					if (size > 1 && size <= sizeof(SignatureFunc))
-						MemoryCopy(m_function_address, &function, size);
-					else
-						MemorySet(m_function_address, 0, size);
-
-					m_instance_ptr = nullptr;
-
-					m_function_size = size;
-					m_invokable_function = reinterpret_cast<InvokableFunc>(&InvokeFunction<InFunction>);
-				}
+				if constexpr (TIsAssignable<SignatureFunc&, FunctionType>::Value)
+					Bind<SignatureFunc>(static_cast<SignatureFunc>(function));
 				else
-				{
-					ConstSize size = sizeof(LambdaStorage<InFunction>);
-
-					m_function_address = new Byte[size];
-						
-					new (m_function_address) LambdaStorage<InFunction>(function);
-				
-					m_instance_ptr = nullptr;
-
-					m_function_size = size;
-					m_invokable_function = reinterpret_cast<InvokableFunc>(&InvokeLambda<InFunction>);
-				}
+					Bind<FunctionType>(std::forward<InFunction>(function));
 			}
 			
 			/**
@@ -208,17 +286,9 @@ namespace Forge {
 			 */
 			template<typename InFunction, typename InClass>
 			TDelegate(InFunction function, InClass* instance)
+				: m_invokable_function(nullptr), m_manager_function(nullptr)
 			{
-				ConstSize size = sizeof(InFunction);
-
-				m_function_address = new Byte[size];
-
-				MemoryCopy(m_function_address, &function, size);
-
-				m_instance_ptr = instance;
-
-				m_function_size = size;
-				m_invokable_function = &InvokeClassFunction<InFunction, InClass>;
+				Bind<MemberFunctionBinding<InFunction, InClass>>(MemberFunctionBinding<InFunction, InClass>{ function, instance });
 			}
 			
 			/**
@@ -229,17 +299,9 @@ namespace Forge {
 			 */
 			template<typename InFunction, typename InClass>
 			TDelegate(InFunction function, const InClass* instance)
+				: m_invokable_function(nullptr), m_manager_function(nullptr)
 			{
-				ConstSize size = sizeof(InFunction);
-
-				m_function_address = new Byte[size];
-
-				MemoryCopy(m_function_address, &function, size);
-
-				m_const_instance_ptr = instance;
-
-				m_function_size = size;
-				m_invokable_function = &InvokeClassFunction<InFunction, InClass>;
+				Bind<MemberFunctionBinding<InFunction, const InClass>>(MemberFunctionBinding<InFunction, const InClass>{ function, instance });
 			}
 
 		public:
@@ -247,16 +309,19 @@ namespace Forge {
 			 * @brief Move constructor.
 			 */
 			TDelegate(SelfTypeMoveRef other)
-				: m_function_size(0), m_function_address(nullptr), m_invokable_function(nullptr)
+				: m_invokable_function(nullptr), m_manager_function(nullptr)
 			{
 				*this = Move(other);
 			}
 
 			/**
 			 * @brief Copy constructor.
+			 *
+			 * @throws InvalidOperationException if the bound invokable of the
+			 * other delegate object is move-only.
 			 */
 			TDelegate(ConstSelfTypeRef other)
-				: m_function_size(0), m_function_address(nullptr), m_invokable_function(nullptr)
+				: m_invokable_function(nullptr), m_manager_function(nullptr)
 			{
 				*this = other;
 			}
@@ -276,33 +341,45 @@ namespace Forge {
 			 */
 			SelfTypeRef operator =(SelfTypeMoveRef other)
 			{
+				if (this == &other)
+					return *this;
+
 				Invalidate();
 
-				MemoryCopy(this, &other, sizeof(SelfType));
-			
-				other.m_function_size = 0;
-				other.m_instance_ptr = nullptr;
-				other.m_function_address = nullptr;
+				if (other.m_manager_function)
+					other.m_manager_function(StorageOperation::MOVE, m_storage.m_bytes, other.m_storage.m_bytes);
+				else
+					m_storage = other.m_storage;
+
+				m_invokable_function = other.m_invokable_function;
+				m_manager_function = other.m_manager_function;
+
 				other.m_invokable_function = nullptr;
+				other.m_manager_function = nullptr;
 
 				return *this;
 			}
 
 			/**
 			 * @brief Copy assignment.
+			 *
+			 * @throws InvalidOperationException if the bound invokable of the
+			 * other delegate object is move-only.
 			 */
 			SelfTypeRef operator =(ConstSelfTypeRef other)
 			{
-				Invalidate();
-
-				m_function_address = new Byte[other.m_function_size];
+				if (this == &other)
+					return *this;
 
-				MemoryCopy(m_function_address, other.m_function_address, other.m_function_size);
+				Invalidate();
 
-				m_instance_ptr = other.m_instance_ptr;
+				if (other.m_manager_function)
+					other.m_manager_function(StorageOperation::COPY, m_storage.m_bytes, other.m_storage.m_bytes);
+				else
+					m_storage = other.m_storage;
 
-				m_function_size = other.m_function_size;
 				m_invokable_function = other.m_invokable_function;
+				m_manager_function = other.m_manager_function;
 
 				return *this;
 			}
@@ -316,7 +393,7 @@ namespace Forge {
 			 * 
 			 * @return True if the delegate object has a bound function.
 			 */
-			Bool IsValid(Void)
+			Bool IsValid(Void) const
 			{
 				return m_invokable_function != nullptr;
 			}
@@ -325,36 +402,36 @@ namespace Forge {
 			 * @brief Checks wether two delegate objects are bound to the same
 			 * invokables, including the same instance.
 			 * 
+			 * Lambdas that are not trivially copyable are only equal to the
+			 * delegate object they are bound to.
+			 * 
 			 * @param[in] other The other delegate object to check for equality.
 			 * 
 			 * @return True if both delegate objects are equal.
 			 */
-			Bool IsEqual(ConstSelfTypeRef other)
+			Bool IsEqual(ConstSelfTypeRef other) const
 			{
-				return m_instance_ptr == other.m_instance_ptr &&
-					   m_invokable_function == other.m_invokable_function &&
-					   MemoryCompare(m_function_address, other.m_function_address, sizeof(InReturnType(*)(InParams...)));
+				if (m_manager_function)
+					return this == &other;
+
+				return m_invokable_function == other.m_invokable_function && !other.m_manager_function &&
+					   MemoryCompare(m_storage.m_bytes, other.m_storage.m_bytes, InInlineSize);
 			}
 
 		public:
 			/**
 			 * @brief Releases the currently bound invokable.
 			 * 
-			 * This function invalidates the delegate object by resseting its
-			 * inplace memory storage for function address.
+			 * This function invalidates the delegate object by destroying the
+			 * bound invokable.
 			 */
 			Void Invalidate(Void)
 			{
-				if (m_function_address)
-				{
-					MemorySet(m_function_address, 0, m_function_size);
-					delete m_function_address;
-				}
+				if (m_manager_function)
+					m_manager_function(StorageOperation::DESTROY, m_storage.m_bytes, nullptr);
 
-				m_function_size = 0;
-				m_instance_ptr = nullptr;
-				m_function_address = nullptr;
 				m_invokable_function = nullptr;
+				m_manager_function = nullptr;
 			}
 
 			/**
@@ -366,12 +443,12 @@ namespace Forge {
 			 * 
 			 * @throws InvalidOperationException if the delegate object is invalid.
 			 */
-			InReturnType Invoke(InParams... params)
+			InReturnType Invoke(InParams... params) const
 			{
 				if (!IsValid())
 					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 
-				return (m_invokable_function)(*this, params...);
+				return (m_invokable_function)(m_storage.m_bytes, std::forward<InParams>(params)...);
 			}
 		};
 	}
@@ -4,6 +4,7 @@
 #include <Core/Public/Common/Common.h>
 
 #include <Core/Public/Algorithm/GeneralUtilities.h>
+#include <Core/Public/Algorithm/Hash/THash.h>
 
 using namespace Forge::Algorithm;
 
@@ -109,6 +110,24 @@ namespace Forge {
 				return *this;
 			}
 		};
+
+		template<typename InTypeOne, typename InTypeTwo>
+		struct TIsTriviallyRelocatable<TPair<InTypeOne, InTypeTwo>>
+		{
+			enum { Value = TIsTriviallyRelocatable<InTypeOne>::Value && TIsTriviallyRelocatable<InTypeTwo>::Value };
+		};
+	}
+
+	namespace Algorithm
+	{
+		template<typename InTypeOne, typename InTypeTwo>
+		struct THash<Common::TPair<InTypeOne, InTypeTwo>>
+		{
+			U64 operator ()(const Common::TPair<InTypeOne, InTypeTwo>& value) const
+			{
+				return HashCombine(THash<InTypeOne>()(value.m_first), THash<InTypeTwo>()(value.m_second));
+			}
+		};
 	}
 }
 
@@ -1,11 +1,329 @@
 #ifndef T_TUPLE_H
 #define T_TUPLE_H
 
+#include <utility>
+
+#include <Core/Public/Common/Common.h>
+
+#include <Core/Public/Algorithm/GeneralUtilities.h>
+
 namespace Forge {
 	namespace Containers
 	{
+		template<typename... InTypes>
+		struct TTuple;
+
+		namespace Internal
+		{
+			/// Holds one element of a tuple, the index tells apart elements of
+			/// the same type.
+			template<Size InIndex, typename InType>
+			struct TTupleElement
+			{
+			public:
+				InType m_value;
+
+			public:
+				TTupleElement(Void)
+					: m_value() {}
+
+				template<typename InArg>
+				explicit TTupleElement(InArg&& arg)
+					: m_value(std::forward<InArg>(arg)) {}
+			};
+
+			/// Tags the constructor of the storage taking the elements.
+			struct TTupleArgsTag {};
+
+			template<typename InIndices, typename... InTypes>
+			struct TTupleStorage;
+
+			template<Size... InIndices, typename... InTypes>
+			struct TTupleStorage<std::index_sequence<InIndices...>, InTypes...> : TTupleElement<InIndices, InTypes>...
+			{
+			public:
+				TTupleStorage(Void) = default;
+
+				template<typename... InArgs>
+				explicit TTupleStorage(TTupleArgsTag, InArgs&&... args)
+					: TTupleElement<InIndices, InTypes>(std::forward<InArgs>(args))... {}
+			};
+
+			/// Tags the constructor converting the elements of another tuple.
+			struct TTupleConvertTag {};
+
+			template<typename InType>
+			struct TIsTuple { enum { Value = false }; };
+
+			template<typename... InTypes>
+			struct TIsTuple<TTuple<InTypes...>> { enum { Value = true }; };
+
+			/// Tells whether the arguments of a constructor are a single tuple,
+			/// which is a copy, a move or a conversion rather than the items.
+			template<typename... InArgs>
+			struct TIsSingleTuple { enum { Value = false }; };
+
+			template<typename InArg>
+			struct TIsSingleTuple<InArg> { enum { Value = TIsTuple<typename std::decay<InArg>::type>::Value }; };
+
+			template<Size InIndex, typename InType, typename... InTypes>
+			struct TTupleElementTypeImpl : TTupleElementTypeImpl<InIndex - 1, InTypes...> {};
+
+			template<typename InType, typename... InTypes>
+			struct TTupleElementTypeImpl<0, InType, InTypes...> { using Type = InType; };
+		}
+
+		/**
+		 * @brief Gets the type of an element of a tuple.
+		 */
+		template<Size InIndex, typename InTuple>
+		struct TTupleElementType;
+
+		template<Size InIndex, typename... InTypes>
+		struct TTupleElementType<InIndex, TTuple<InTypes...>>
+		{
+			static_assert(InIndex < sizeof...(InTypes), "Tuple element index is out of range.");
+
+			using Type = typename Internal::TTupleElementTypeImpl<InIndex, InTypes...>::Type;
+		};
+
+		/**
+		 * @brief Class template that allows to store a fixed number of
+		 * heterogeneous objects as a single unit.
+		 *
+		 * Elements are accessed by their index known at compile time, through
+		 * Get, and are laid out like the members of a struct would be.
+		 *
+		 * A tuple converts from and assigns from any tuple of the same number
+		 * of elements element by element, so a tuple of references, like the
+		 * records of a TSoAArray, reads into and writes from a tuple of values.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename... InTypes>
+		struct TTuple : private Internal::TTupleStorage<std::index_sequence_for<InTypes...>, InTypes...>
+		{
+		private:
+			using StorageType = Internal::TTupleStorage<std::index_sequence_for<InTypes...>, InTypes...>;
+
+		private:
+			using SelfType         = TTuple<InTypes...>;
+			using SelfTypeRef      = TTuple<InTypes...>&;
+			using ConstSelfTypeRef = const TTuple<InTypes...>&;
+
+		public:
+			static constexpr Size COUNT = sizeof...(InTypes);
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Value initializes every element.
+			 */
+			TTuple(Void) = default;
+
+			/**
+			 * @brief Items constructor.
+			 *
+			 * Constructs every element from the argument at its index.
+			 */
+			template<typename... InArgs, typename = typename Common::TEnableIf<sizeof...(InArgs) == sizeof...(InTypes) && (sizeof...(InArgs) > 0) && !Internal::TIsSingleTuple<InArgs...>::Value, Void>::Type>
+			TTuple(InArgs&&... args)
+				: StorageType(Internal::TTupleArgsTag(), std::forward<InArgs>(args)...) {}
 
+			/**
+			 * @brief Converting copy constructor.
+			 *
+			 * Constructs every element from the element at the same index of a
+			 * tuple of other types.
+			 */
+			template<typename... InOtherTypes, typename = typename Common::TEnableIf<sizeof...(InOtherTypes) == sizeof...(InTypes) && !Common::TAreSameType<SelfType, TTuple<InOtherTypes...>>::Value, Void>::Type>
+			TTuple(const TTuple<InOtherTypes...>& other)
+				: TTuple(Internal::TTupleConvertTag(), other, std::index_sequence_for<InTypes...>()) {}
+
+			/**
+			 * @brief Converting move constructor.
+			 *
+			 * Constructs every element from the element at the same index of a
+			 * tuple of other types, moving elements that are not references.
+			 */
+			template<typename... InOtherTypes, typename = typename Common::TEnableIf<sizeof...(InOtherTypes) == sizeof...(InTypes) && !Common::TAreSameType<SelfType, TTuple<InOtherTypes...>>::Value, Void>::Type>
+			TTuple(TTuple<InOtherTypes...>&& other)
+				: TTuple(Internal::TTupleConvertTag(), std::move(other), std::index_sequence_for<InTypes...>()) {}
+
+		public:
+			TTuple(SelfType&& other) = default;
+			TTuple(ConstSelfTypeRef other) = default;
+
+		private:
+			template<typename... InOtherTypes, Size... InIndices>
+			TTuple(Internal::TTupleConvertTag, const TTuple<InOtherTypes...>& other, std::index_sequence<InIndices...>)
+				: StorageType(Internal::TTupleArgsTag(), other.template Get<InIndices>()...) {}
+
+			template<typename... InOtherTypes, Size... InIndices>
+			TTuple(Internal::TTupleConvertTag, TTuple<InOtherTypes...>&& other, std::index_sequence<InIndices...>)
+				: StorageType(Internal::TTupleArgsTag(), std::forward<InOtherTypes>(other.template Get<InIndices>())...) {}
+
+		public:
+			/**
+			 * @brief Copy assignment.
+			 *
+			 * Assigns element by element, so a tuple of references assigns to
+			 * the objects it refers to.
+			 */
+			SelfTypeRef operator =(ConstSelfTypeRef other)
+			{
+				this->AssignImpl(other, std::index_sequence_for<InTypes...>());
+
+				return *this;
+			}
+
+			/**
+			 * @brief Move assignment.
+			 *
+			 * Assigns element by element, so a tuple of references assigns to
+			 * the objects it refers to.
+			 */
+			SelfTypeRef operator =(SelfType&& other)
+			{
+				this->AssignImpl(std::move(other), std::index_sequence_for<InTypes...>());
+
+				return *this;
+			}
+
+			/**
+			 * @brief Converting copy assignment.
+			 *
+			 * Assigns every element from the element at the same index of a
+			 * tuple of other types.
+			 */
+			template<typename... InOtherTypes, typename = typename Common::TEnableIf<sizeof...(InOtherTypes) == sizeof...(InTypes) && !Common::TAreSameType<SelfType, TTuple<InOtherTypes...>>::Value, Void>::Type>
+			SelfTypeRef operator =(const TTuple<InOtherTypes...>& other)
+			{
+				this->AssignImpl(other, std::index_sequence_for<InTypes...>());
+
+				return *this;
+			}
+
+			/**
+			 * @brief Converting move assignment.
+			 *
+			 * Assigns every element from the element at the same index of a
+			 * tuple of other types, moving elements that are not references.
+			 */
+			template<typename... InOtherTypes, typename = typename Common::TEnableIf<sizeof...(InOtherTypes) == sizeof...(InTypes) && !Common::TAreSameType<SelfType, TTuple<InOtherTypes...>>::Value, Void>::Type>
+			SelfTypeRef operator =(TTuple<InOtherTypes...>&& other)
+			{
+				this->AssignImpl(std::move(other), std::index_sequence_for<InTypes...>());
+
+				return *this;
+			}
+
+		public:
+			/**
+			 * @brief Gets the element at an index.
+			 *
+			 * @return Reference to the element.
+			 */
+			template<Size InIndex>
+			typename TTupleElementType<InIndex, SelfType>::Type& Get(Void)
+			{
+				return static_cast<Internal::TTupleElement<InIndex, typename TTupleElementType<InIndex, SelfType>::Type>&>(*this).m_value;
+			}
+
+			/**
+			 * @brief Gets the element at an index.
+			 *
+			 * @return Const reference to the element.
+			 */
+			template<Size InIndex>
+			const typename TTupleElementType<InIndex, SelfType>::Type& Get(Void) const
+			{
+				return static_cast<const Internal::TTupleElement<InIndex, typename TTupleElementType<InIndex, SelfType>::Type>&>(*this).m_value;
+			}
+
+		public:
+			/**
+			 * @brief Performs an operation on each element in order of index.
+			 *
+			 * @param[in] function The operation, callable with every element type.
+			 */
+			template<typename InFunction>
+			Void ForEach(InFunction&& function)
+			{
+				this->ForEachImpl(function, std::index_sequence_for<InTypes...>());
+			}
+
+			/**
+			 * @brief Performs an operation on each element in order of index.
+			 *
+			 * @param[in] function The operation, callable with every element type.
+			 */
+			template<typename InFunction>
+			Void ForEach(InFunction&& function) const
+			{
+				this->ForEachImpl(function, std::index_sequence_for<InTypes...>());
+			}
+
+		public:
+			Bool operator ==(ConstSelfTypeRef other) const
+			{
+				return this->IsEqualImpl(other, std::index_sequence_for<InTypes...>());
+			}
+			Bool operator !=(ConstSelfTypeRef other) const
+			{
+				return !(*this == other);
+			}
+
+		private:
+			template<typename InFunction, Size... InIndices>
+			Void ForEachImpl(InFunction& function, std::index_sequence<InIndices...>)
+			{
+				(function(this->template Get<InIndices>()), ...);
+			}
+			template<typename InFunction, Size... InIndices>
+			Void ForEachImpl(InFunction& function, std::index_sequence<InIndices...>) const
+			{
+				(function(this->template Get<InIndices>()), ...);
+			}
+
+			template<typename... InOtherTypes, Size... InIndices>
+			Void AssignImpl(const TTuple<InOtherTypes...>& other, std::index_sequence<InIndices...>)
+			{
+				((this->template Get<InIndices>() = other.template Get<InIndices>()), ...);
+			}
+			template<typename... InOtherTypes, Size... InIndices>
+			Void AssignImpl(TTuple<InOtherTypes...>&& other, std::index_sequence<InIndices...>)
+			{
+				((this->template Get<InIndices>() = std::forward<InOtherTypes>(other.template Get<InIndices>())), ...);
+			}
+
+			template<Size... InIndices>
+			Bool IsEqualImpl(ConstSelfTypeRef other, std::index_sequence<InIndices...>) const
+			{
+				return ((this->template Get<InIndices>() == other.template Get<InIndices>()) && ...);
+			}
+		};
+
+		/**
+		 * @brief Constructs a tuple deducing the types of its elements from
+		 * the arguments.
+		 */
+		template<typename... InTypes>
+		FORGE_FORCE_INLINE TTuple<typename std::decay<InTypes>::type...> MakeTuple(InTypes&&... args)
+		{
+			return TTuple<typename std::decay<InTypes>::type...>(std::forward<InTypes>(args)...);
+		}
+	}
+
+	namespace Common
+	{
+		template<typename... InTypes>
+		struct TIsTriviallyRelocatable<Containers::TTuple<InTypes...>>
+		{
+			enum { Value = (TIsTriviallyRelocatable<InTypes>::Value && ... && true) };
+		};
 	}
 }
 
-#endif
+#endif // T_TUPLE_H
@@ -27,13 +27,13 @@ namespace Forge {
 			return m_vertex_binding_list.GetCount();
 		}
 
-		ConstTDynamicArray<VertexElement> AbstractVertexDecleration::GetVertexElements(Void) const
+		const TInlineArray<VertexElement, AbstractVertexDecleration::INLINE_ELEMENT_COUNT> AbstractVertexDecleration::GetVertexElements(Void) const
 		{
 			return m_vertex_element_list;
 		}
-		ConstTDynamicArray<VertexElement> AbstractVertexDecleration::GetVertexElements(U16 source) const
+		const TInlineArray<VertexElement, AbstractVertexDecleration::INLINE_ELEMENT_COUNT> AbstractVertexDecleration::GetVertexElements(U16 source) const
 		{
-			TDynamicArray<VertexElement> result;
+			TInlineArray<VertexElement, INLINE_ELEMENT_COUNT> result;
 
 			m_vertex_element_list.ForEach([&result, source](ConstVertexElementRef element) -> Void
 				{
@@ -45,7 +45,7 @@ namespace Forge {
 			return result;
 		}
 
-		ConstTDynamicArray<TWeakPtr<AbstractHardwareBuffer>> AbstractVertexDecleration::GetVertexBindings(Void) const
+		const TInlineArray<TWeakPtr<AbstractHardwareBuffer>, AbstractVertexDecleration::INLINE_ELEMENT_COUNT> AbstractVertexDecleration::GetVertexBindings(Void) const
 		{
 			return m_vertex_binding_list;
 		}
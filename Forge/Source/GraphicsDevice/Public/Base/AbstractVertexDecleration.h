@@ -7,7 +7,7 @@
 
 #include <Core/Public/Memory/MemoryUtilities.h>
 
-#include <Core/Public/Containers/TDynamicArray.h>
+#include <Core/Public/Containers/TInlineArray.h>
 
 #include <GraphicsDevice/Public/GraphicsObject.h>
 #include <GraphicsDevice/Public/VertexElement.h>
@@ -28,14 +28,19 @@ namespace Forge {
 		 */
 		class FORGE_API AbstractVertexDecleration : public GraphicsObject
 		{
+		public:
+			/// Number of vertex elements, bindings and attributes stored inside
+			/// the vertex decleration before its lists allocate.
+			static constexpr Size INLINE_ELEMENT_COUNT = 16;
+
 		protected:
-			TDynamicArray<VertexElement> m_vertex_element_list;
+			TInlineArray<VertexElement, INLINE_ELEMENT_COUNT> m_vertex_element_list;
 			
 		protected:
-			TDynamicArray<TWeakPtr<AbstractHardwareBuffer>> m_vertex_binding_list;
+			TInlineArray<TWeakPtr<AbstractHardwareBuffer>, INLINE_ELEMENT_COUNT> m_vertex_binding_list;
 
 		protected:
-			TDynamicArray<Common::TPair<U32, TWeakPtr<AbstractHardwareBuffer>>> m_vertex_attribute_list;
+			TInlineArray<Common::TPair<U32, TWeakPtr<AbstractHardwareBuffer>>, INLINE_ELEMENT_COUNT> m_vertex_attribute_list;
 			
 		public:
 			/**
@@ -86,9 +91,9 @@ namespace Forge {
 			 * 
 			 * This function provides read-only access to the returned elements.
 			 * 
-			 * @returns ConstTDynamicArray storing the vertex elements.
+			 * @returns TInlineArray storing the vertex elements.
 			 */
-			ConstTDynamicArray<VertexElement> GetVertexElements(Void) const;
+			const TInlineArray<VertexElement, INLINE_ELEMENT_COUNT> GetVertexElements(Void) const;
 
 			/**
 			 * @brief Gets the vertex elements in the vertex decleration using
@@ -98,9 +103,9 @@ namespace Forge {
 			 *
 			 * @param source[in] The source of the vertex element.
 			 * 
-			 * @returns ConstTDynamicArray storing the vertex elements.
+			 * @returns TInlineArray storing the vertex elements.
 			 */
-			ConstTDynamicArray<VertexElement> GetVertexElements(U16 source) const;
+			const TInlineArray<VertexElement, INLINE_ELEMENT_COUNT> GetVertexElements(U16 source) const;
 
 		public:
 			/**
@@ -109,9 +114,9 @@ namespace Forge {
 			 * This function provides read-only access to the returned vertex
 			 * bindings.
 			 *
-			 * @returns ConstTDynamicArray storing the vertex bindings.
+			 * @returns TInlineArray storing the vertex bindings.
 			 */
-			ConstTDynamicArray<TWeakPtr<AbstractHardwareBuffer>> GetVertexBindings(Void) const;
+			const TInlineArray<TWeakPtr<AbstractHardwareBuffer>, INLINE_ELEMENT_COUNT> GetVertexBindings(Void) const;
 
 		public:
 			/**
@@ -3,6 +3,8 @@
 
 #include <Core/Public/Common/Common.h>
 
+#include <Core/Public/Algorithm/Hash/THash.h>
+
 namespace Forge {
 	namespace Graphics
 	{
@@ -100,6 +102,19 @@ namespace Forge {
 			return m_handle;
 		}
 	}
+
+	namespace Algorithm
+	{
+		/**
+		 * @brief Handles hash their numeric identifier only, handles storing
+		 * a pointer compare equal whenever its low bits are equal.
+		 */
+		template<>
+		struct THash<Graphics::GraphicsObject::Handle>
+		{
+			U64 operator ()(const Graphics::GraphicsObject::Handle& value) const { return HashMix64(value.m_id_num); }
+		};
+	}
 }
 
 #endif
@@ -288,14 +288,28 @@ namespace Forge {
 		{
 			// TODO: Implement WindowsPlatform::DeallocateMemory
 		}
+		Size WindowsPlatform::GetPageSize(Void)
+		{
+			SYSTEM_INFO system_info;
+			GetSystemInfo(&system_info);
+
+			return system_info.dwPageSize;
+		}
 		VoidPtr WindowsPlatform::AllocatePages(Size count, Size size)
 		{
-			// TODO: Implement WindowsPlatform::AllocatePages
-			return nullptr;
+			return VirtualAlloc(nullptr, count * size, MEM_RESERVE, PAGE_NOACCESS);
+		}
+		Bool WindowsPlatform::CommitPages(VoidPtr address, Size count, Size size)
+		{
+			return VirtualAlloc(address, count * size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+		}
+		Void WindowsPlatform::DecommitPages(VoidPtr address, Size count, Size size)
+		{
+			VirtualFree(address, count * size, MEM_DECOMMIT);
 		}
 		Void WindowsPlatform::DeallocatePages(VoidPtr address)
 		{
-			// TODO: Implement WindowsPlatform::DeallocatePages
+			VirtualFree(address, 0, MEM_RELEASE);
 		}
 
 		I32 WindowsPlatform::StartProcess(ConstCharPtr filename, ConstCharPtr args, ConstCharPtr working_directory)
@@ -0,0 +1,228 @@
+#ifndef PLATFORM_EVENTS_H
+#define PLATFORM_EVENTS_H
+
+#include "Core/Public/Common/Common.h"
+#include "Core/Public/Event/EventBus.h"
+
+namespace Forge {
+	namespace Platform
+	{
+		class AbstractWindow;
+
+		/**
+		 * @brief Published when a window is requested to close.
+		 */
+		struct WindowCloseEvent
+		{
+			FORGE_DECLARE_EVENT(WindowCloseEvent)
+
+			AbstractWindow* m_window;
+		};
+
+		/**
+		 * @brief Published when a window gains or loses focus, only the last
+		 * state of a window in a frame is delivered.
+		 */
+		struct WindowFocusEvent
+		{
+			FORGE_DECLARE_EVENT(WindowFocusEvent)
+
+			AbstractWindow* m_window;
+			Bool            m_is_focused;
+
+			Bool Coalesce(const WindowFocusEvent& next_event);
+		};
+
+		/**
+		 * @brief Published when a window is minimized or restored, only the
+		 * last state of a window in a frame is delivered.
+		 */
+		struct WindowMinimizeEvent
+		{
+			FORGE_DECLARE_EVENT(WindowMinimizeEvent)
+
+			AbstractWindow* m_window;
+			Bool            m_is_minimized;
+
+			Bool Coalesce(const WindowMinimizeEvent& next_event);
+		};
+
+		/**
+		 * @brief Published when a window is maximized or restored, only the
+		 * last state of a window in a frame is delivered.
+		 */
+		struct WindowMaximizeEvent
+		{
+			FORGE_DECLARE_EVENT(WindowMaximizeEvent)
+
+			AbstractWindow* m_window;
+			Bool            m_is_maximized;
+
+			Bool Coalesce(const WindowMaximizeEvent& next_event);
+		};
+
+		/**
+		 * @brief Published when a window is moved, only the last position of
+		 * a window in a frame is delivered.
+		 */
+		struct WindowMoveEvent
+		{
+			FORGE_DECLARE_EVENT(WindowMoveEvent)
+
+			AbstractWindow* m_window;
+			U32             m_x;
+			U32             m_y;
+
+			Bool Coalesce(const WindowMoveEvent& next_event);
+		};
+
+		/**
+		 * @brief Published when a window is resized, only the last size of a
+		 * window in a frame is delivered.
+		 */
+		struct WindowResizeEvent
+		{
+			FORGE_DECLARE_EVENT(WindowResizeEvent)
+
+			AbstractWindow* m_window;
+			U32             m_width;
+			U32             m_height;
+
+			Bool Coalesce(const WindowResizeEvent& next_event);
+		};
+
+		/**
+		 * @brief Published when the mouse cursor moves over a window. The moves
+		 * of a frame are delivered as one event with the last position and
+		 * the summed deltas.
+		 */
+		struct MouseMoveEvent
+		{
+			FORGE_DECLARE_EVENT(MouseMoveEvent)
+
+			AbstractWindow* m_window;
+			I32             m_x;
+			I32             m_y;
+			I32             m_delta_x;
+			I32             m_delta_y;
+
+			Bool Coalesce(const MouseMoveEvent& next_event);
+		};
+
+		/**
+		 * @brief Published when the mouse wheel is scrolled over a window, the
+		 * scrolls of a frame are delivered as one event with summed deltas.
+		 */
+		struct MouseScrollEvent
+		{
+			FORGE_DECLARE_EVENT(MouseScrollEvent)
+
+			AbstractWindow* m_window;
+			I32             m_delta_x;
+			I32             m_delta_y;
+
+			Bool Coalesce(const MouseScrollEvent& next_event);
+		};
+
+		/**
+		 * @brief Published when a mouse button is pressed or released, every
+		 * press and release is delivered.
+		 */
+		struct MouseButtonEvent
+		{
+			FORGE_DECLARE_EVENT(MouseButtonEvent)
+
+			AbstractWindow* m_window;
+			I32             m_button;
+			I32             m_action;
+			I32             m_modifiers;
+		};
+
+		/**
+		 * @brief Published when a key is pressed, repeated or released, every
+		 * key stroke is delivered.
+		 */
+		struct KeyboardEvent
+		{
+			FORGE_DECLARE_EVENT(KeyboardEvent)
+
+			AbstractWindow* m_window;
+			I32             m_key;
+			I32             m_scan_code;
+			I32             m_action;
+			I32             m_modifiers;
+		};
+
+		FORGE_FORCE_INLINE Bool WindowFocusEvent::Coalesce(const WindowFocusEvent& next_event)
+		{
+			if (m_window != next_event.m_window)
+				return false;
+
+			m_is_focused = next_event.m_is_focused;
+
+			return true;
+		}
+		FORGE_FORCE_INLINE Bool WindowMinimizeEvent::Coalesce(const WindowMinimizeEvent& next_event)
+		{
+			if (m_window != next_event.m_window)
+				return false;
+
+			m_is_minimized = next_event.m_is_minimized;
+
+			return true;
+		}
+		FORGE_FORCE_INLINE Bool WindowMaximizeEvent::Coalesce(const WindowMaximizeEvent& next_event)
+		{
+			if (m_window != next_event.m_window)
+				return false;
+
+			m_is_maximized = next_event.m_is_maximized;
+
+			return true;
+		}
+		FORGE_FORCE_INLINE Bool WindowMoveEvent::Coalesce(const WindowMoveEvent& next_event)
+		{
+			if (m_window != next_event.m_window)
+				return false;
+
+			m_x = next_event.m_x;
+			m_y = next_event.m_y;
+
+			return true;
+		}
+		FORGE_FORCE_INLINE Bool WindowResizeEvent::Coalesce(const WindowResizeEvent& next_event)
+		{
+			if (m_window != next_event.m_window)
+				return false;
+
+			m_width = next_event.m_width;
+			m_height = next_event.m_height;
+
+			return true;
+		}
+		FORGE_FORCE_INLINE Bool MouseMoveEvent::Coalesce(const MouseMoveEvent& next_event)
+		{
+			if (m_window != next_event.m_window)
+				return false;
+
+			m_x = next_event.m_x;
+			m_y = next_event.m_y;
+			m_delta_x += next_event.m_delta_x;
+			m_delta_y += next_event.m_delta_y;
+
+			return true;
+		}
+		FORGE_FORCE_INLINE Bool MouseScrollEvent::Coalesce(const MouseScrollEvent& next_event)
+		{
+			if (m_window != next_event.m_window)
+				return false;
+
+			m_delta_x += next_event.m_delta_x;
+			m_delta_y += next_event.m_delta_y;
+
+			return true;
+		}
+	}
+}
+
+#endif // PLATFORM_EVENTS_H
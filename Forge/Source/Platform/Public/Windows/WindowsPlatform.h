@@ -178,11 +178,19 @@ namespace Forge {
 			 */
 			Void DeallocateMemory(VoidPtr address) override;
 
+			/**
+			 * @brief Gets the size of a virtual memory page.
+			 *
+			 * @returns Size storing the page size in bytes.
+			 */
+			Size GetPageSize(Void) override;
+
 			/**
 			 * @brief Allocates a number of pages with a specified size.
 			 *
-			 * This function allocates pages on the memory using the
-			 * platform dependant allocation routine.
+			 * This function reserves a range of pages on the memory using the
+			 * platform dependant allocation routine. The pages are not backed
+			 * by physical memory until committed.
 			 *
 			 * @param count The number of pages to allocate.
 			 * @param size The size of the allocated page in bytes.
@@ -191,6 +199,28 @@ namespace Forge {
 			 */
 			VoidPtr AllocatePages(Size count, Size size) override;
 
+			/**
+			 * @brief Backs a range of previously allocated pages with physical
+			 * memory, the committed pages are zero-initialized.
+			 *
+			 * @param address The address of the first page to commit.
+			 * @param count The number of pages to commit.
+			 * @param size The size of the allocated page in bytes.
+			 *
+			 * @returns True if the pages were committed, otherwise false.
+			 */
+			Bool CommitPages(VoidPtr address, Size count, Size size) override;
+
+			/**
+			 * @brief Releases the physical memory backing a range of committed
+			 * pages, while keeping the pages allocated.
+			 *
+			 * @param address The address of the first page to decommit.
+			 * @param count The number of pages to decommit.
+			 * @param size The size of the allocated page in bytes.
+			 */
+			Void DecommitPages(VoidPtr address, Size count, Size size) override;
+
 			/**
 			 * @brief Deallocates a block of allocated pages.
 			 *
@@ -1,12 +1,42 @@
 #include <gtest/gtest.h>
 
 #include "Source/Core/Common/TDelegateTest.h"
+#include "Source/Core/Common/TSharedPtrTest.h"
+#include "Source/Core/Common/ConstStringHashTest.h"
+#include "Source/Core/Common/StringTest.h"
+
+#include "Source/Core/Algorithm/XXHash3Test.h"
+
+#include "Source/Core/Memory/MemoryUtilitiesTest.h"
+#include "Source/Core/Memory/TLSFAllocatorTest.h"
+#include "Source/Core/Memory/ThreadCachingAllocatorTest.h"
+#include "Source/Core/Memory/ConcurrentPoolAllocatorTest.h"
+#include "Source/Core/Memory/LinearAllocatorTest.h"
+#include "Source/Core/Memory/StackAllocatorTest.h"
+#include "Source/Core/Memory/MultiFrameAllocatorTest.h"
+#include "Source/Core/Memory/TrackingAllocatorTest.h"
+
+#include "Source/Core/RTTI/TRefPtrTest.h"
+#include "Source/Core/RTTI/ObjectManagerTest.h"
+#include "Source/Core/RTTI/TypeRegistryTest.h"
+
+#include "Source/Core/Event/EventBusTest.h"
 
 #include "Source/Core/Containers/TLinkedListTest.h"
 #include "Source/Core/Containers/TStaticArrayTest.h"
 #include "Source/Core/Containers/TDynamicStackTest.h"
+#include "Source/Core/Containers/TStaticQueueTest.h"
 #include "Source/Core/Containers/TDynamicQueueTest.h"
+#include "Source/Core/Containers/TDequeTest.h"
+#include "Source/Core/Containers/TIntrusiveListTest.h"
+#include "Source/Core/Containers/TInlineArrayTest.h"
+#include "Source/Core/Containers/TSoAArrayTest.h"
+#include "Source/Core/Containers/TChunkedArrayTest.h"
 #include "Source/Core/Containers/TDynamicArrayTest.h"
+#include "Source/Core/Containers/TFlatHashMapTest.h"
+#include "Source/Core/Containers/TFlatHashSetTest.h"
+#include "Source/Core/Containers/TConcurrentQueueTest.h"
+#include "Source/Core/Containers/TObjectPoolTest.h"
 
 int main(int argc, char** args)
 {
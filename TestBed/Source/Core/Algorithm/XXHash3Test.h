@@ -0,0 +1,177 @@
+#ifndef XX_HASH_3_TEST_H
+#define XX_HASH_3_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Algorithm/Hash/THash.h"
+#include "Core/Public/Algorithm/Hash/XXHash3.h"
+#include "Core/Public/Algorithm/Hash/ConstHash.h"
+
+#include "Core/Public/Math/TVector.h"
+#include "Core/Public/Types/TPair.h"
+
+using namespace Forge;
+using namespace Forge::Algorithm;
+
+namespace XXHash3Test
+{
+	/**
+	 * Reference hashes of the first bytes of the test buffer computed by the
+	 * xxHash 0.8 library, covering every size class of the algorithm.
+	 */
+	struct Hash64Vector
+	{
+		Size m_size;
+		U64  m_hash;
+		U64  m_seeded_hash;
+	};
+
+	struct Hash128Vector
+	{
+		Size m_size;
+		U64  m_low;
+		U64  m_high;
+	};
+
+	constexpr Size BUFFER_SIZE = 4096;
+	constexpr U64  SEED        = 0x9E3779B97F4A7C15ULL;
+
+	const Hash64Vector HASH_64_VECTORS[] =
+	{
+		{    0, 0x2D06800538D394C2ULL, 0x602B0E2CD6662C8BULL },
+		{    1, 0x4C5CCA45D0F4811FULL, 0x2F3ACD3805F81DE3ULL },
+		{    3, 0x15F7093B173D005CULL, 0x079DD5D54D89480AULL },
+		{    4, 0xDCA012F95811B6B9ULL, 0x1A246E2EFB9C9B2EULL },
+		{    8, 0xDEC6A9A43575982EULL, 0x19EF7D3919108AFFULL },
+		{    9, 0xCBE393399F17FFBDULL, 0x9C98D3E24DC54D34ULL },
+		{   16, 0x7E484C18D74895D0ULL, 0xA106510078B0A252ULL },
+		{   17, 0x208BDE5EE2BED407ULL, 0x0B2CAF8BF9648EFFULL },
+		{  128, 0xF92B70EAA21A6288ULL, 0x95425530BEB89FE8ULL },
+		{  129, 0xF8F76713F2BB60FAULL, 0x29FA850B97ED9666ULL },
+		{  240, 0xCCC7375172C41F03ULL, 0x2D882E7899FF64CCULL },
+		{  241, 0x0B3B630948CE4A00ULL, 0x422E82E8913E49E0ULL },
+		{ 1024, 0x23BC880EBF0D29C6ULL, 0x7E249ADC60E1F9B4ULL },
+		{ 1025, 0xC09FDFBC398C7D82ULL, 0x16CFE055154FF1DDULL },
+		{ 4096, 0xA3C19F8174CDE0BBULL, 0x224E1AFF9C0F0707ULL },
+	};
+
+	const Hash128Vector HASH_128_VECTORS[] =
+	{
+		{    0, 0x6001C324468D497FULL, 0x99AA06D3014798D8ULL },
+		{    3, 0x15F7093B173D005CULL, 0x46F66CB935381565ULL },
+		{   16, 0xF853DD94614DFA07ULL, 0x650FE308C566747DULL },
+		{  100, 0xD61D8DBFF22D515FULL, 0x7F5A1F03462E52B4ULL },
+		{  200, 0x60EA018811F9A437ULL, 0x8D8629A1AEF9EF90ULL },
+		{ 4096, 0xA3C19F8174CDE0BBULL, 0x49D3842B33D51E8AULL },
+	};
+
+	Void FillBuffer(Byte* buffer)
+	{
+		for (Size i = 0; i < BUFFER_SIZE; i++)
+			buffer[i] = static_cast<Byte>(i * 31 + 7);
+	}
+
+	/**
+	 * Tests the 64-bit hashes against the reference hashes.
+	 */
+	TEST(XXHash3Test, Hash64)
+	{
+		Byte buffer[BUFFER_SIZE];
+		FillBuffer(buffer);
+
+		for (const Hash64Vector& vector : HASH_64_VECTORS)
+		{
+			EXPECT_EQ(XXHash3::Hash64(buffer, vector.m_size), vector.m_hash);
+			EXPECT_EQ(XXHash3::Hash64(buffer, vector.m_size, SEED), vector.m_seeded_hash);
+		}
+	}
+
+	/**
+	 * Tests the 128-bit hashes against the reference hashes.
+	 */
+	TEST(XXHash3Test, Hash128)
+	{
+		Byte buffer[BUFFER_SIZE];
+		FillBuffer(buffer);
+
+		for (const Hash128Vector& vector : HASH_128_VECTORS)
+		{
+			HashResult128 hash = XXHash3::Hash128(buffer, vector.m_size);
+
+			EXPECT_EQ(hash.m_low, vector.m_low);
+			EXPECT_EQ(hash.m_high, vector.m_high);
+		}
+	}
+
+	/**
+	 * Tests that feeding data in parts of any size produces the same hashes
+	 * as hashing it at once.
+	 */
+	TEST(XXHash3Test, Streaming)
+	{
+		Byte buffer[BUFFER_SIZE];
+		FillBuffer(buffer);
+
+		const Size part_sizes[] = { 1, 7, 64, 100, 256, 300, 1000 };
+
+		for (Size part_size : part_sizes)
+		{
+			for (Size size = 0; size <= BUFFER_SIZE; size += 61)
+			{
+				XXHash3 hash(SEED);
+
+				for (Size offset = 0; offset < size; offset += part_size)
+					hash.Update(buffer + offset, size - offset < part_size ? size - offset : part_size);
+
+				EXPECT_EQ(hash.GetHash64(), XXHash3::Hash64(buffer, size, SEED));
+				EXPECT_EQ(hash.GetHash128() == XXHash3::Hash128(buffer, size, SEED), true);
+			}
+		}
+
+		/// Hashes can be read in the middle of the stream.
+		XXHash3 hash;
+
+		hash.Update(buffer, 1000);
+		EXPECT_EQ(hash.GetHash64(), XXHash3::Hash64(buffer, 1000));
+
+		hash.Update(buffer + 1000, 3000);
+		EXPECT_EQ(hash.GetHash64(), XXHash3::Hash64(buffer, 4000));
+
+		hash.Reset();
+		EXPECT_EQ(hash.GetHash64(), XXHash3::Hash64(buffer, 0));
+	}
+
+	/**
+	 * Tests the compile time hashes of strings.
+	 */
+	TEST(XXHash3Test, ConstHash)
+	{
+		using namespace Forge::Algorithm::Literals;
+
+		static_assert(HashFnv1a64("") == 0xCBF29CE484222325ULL, "");
+		static_assert(HashFnv1a64("a") == 0xAF63DC4C8601EC8CULL, "");
+		static_assert("foobar"_hash == 0x85944171F73967E8ULL, "");
+		static_assert(FORGE_CONST_HASH("foobar") == HashFnv1a64("foobar", 6), "");
+
+		const char* name = "foobar";
+
+		EXPECT_EQ(HashFnv1a64(name), "foobar"_hash);
+	}
+
+	/**
+	 * Tests the hashes of aggregate types.
+	 */
+	TEST(XXHash3Test, AggregateHash)
+	{
+		Math::Vector3 one(1.0f, 2.0f, 3.0f), two(1.0f, 2.0f, 3.0f), three(3.0f, 2.0f, 1.0f);
+
+		EXPECT_EQ(THash<Math::Vector3>()(one), THash<Math::Vector3>()(two));
+		EXPECT_NE(THash<Math::Vector3>()(one), THash<Math::Vector3>()(three));
+
+		Common::TPair<int, int> pair_one(1, 2), pair_two(2, 1);
+
+		EXPECT_NE((THash<Common::TPair<int, int>>()(pair_one)), (THash<Common::TPair<int, int>>()(pair_two)));
+	}
+}
+
+#endif // XX_HASH_3_TEST_H
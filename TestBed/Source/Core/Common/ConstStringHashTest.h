@@ -0,0 +1,156 @@
+#ifndef CONST_STRING_HASH_TEST_H
+#define CONST_STRING_HASH_TEST_H
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/RTTI/TypeInfo.h"
+#include "Core/Public/Types/String/ConstStringHash.h"
+
+using namespace Forge;
+using namespace Forge::Type;
+
+namespace ConstStringHashTest
+{
+	/**
+	 * Tests that equal texts intern to the same name and different texts to
+	 * different names.
+	 */
+	TEST(ConstStringHashTest, Intern)
+	{
+		ConstStringHash position("position");
+		ConstStringHash normal("normal");
+
+		std::string text = "position";
+
+		EXPECT_EQ(ConstStringHash(text.c_str()) == position, true);
+		EXPECT_EQ(ConstStringHash("position", 3) == position, false);
+		EXPECT_EQ(position != normal, true);
+
+		EXPECT_STREQ(position.GetString(), "position");
+		EXPECT_EQ(position.GetCount(), 8);
+		EXPECT_EQ(position.GetHash(), Forge::Algorithm::HashFnv1a64("position"));
+	}
+
+	/**
+	 * Tests the empty name.
+	 */
+	TEST(ConstStringHashTest, Empty)
+	{
+		ConstStringHash empty;
+
+		EXPECT_EQ(empty.IsEmpty(), true);
+		EXPECT_EQ(empty.GetId(), 0);
+		EXPECT_EQ(ConstStringHash("") == empty, true);
+		EXPECT_STREQ(empty.GetString(), "");
+	}
+
+	/**
+	 * Tests names of literals hashed at compile time.
+	 */
+	TEST(ConstStringHashTest, Literal)
+	{
+		ConstStringHash name = FORGE_NAME("OnCollisionEnter");
+
+		EXPECT_EQ(name == ConstStringHash("OnCollisionEnter"), true);
+		EXPECT_EQ(name.GetHash(), FORGE_CONST_HASH("OnCollisionEnter"));
+
+		for (int i = 0; i < 3; i++)
+			EXPECT_EQ(FORGE_NAME("OnCollisionEnter") == name, true);
+	}
+
+	/**
+	 * Tests that finding a name does not add it to the string table.
+	 */
+	TEST(ConstStringHashTest, TryFind)
+	{
+		ConstStringHash name;
+
+		Size num_of_strings = StringTable::GetNumOfStrings();
+
+		EXPECT_EQ(ConstStringHash::TryFind("never-interned", 14, name), false);
+		EXPECT_EQ(StringTable::GetNumOfStrings(), num_of_strings);
+
+		ConstStringHash interned("interned");
+
+		EXPECT_EQ(ConstStringHash::TryFind("interned", 8, name), true);
+		EXPECT_EQ(name == interned, true);
+	}
+
+	/**
+	 * Tests interning enough names to grow the lookup index several times.
+	 */
+	TEST(ConstStringHashTest, Growth)
+	{
+		std::vector<ConstStringHash> names;
+
+		for (int i = 0; i < 10000; i++)
+			names.push_back(ConstStringHash(("asset_" + std::to_string(i)).c_str()));
+
+		for (int i = 0; i < 10000; i++)
+		{
+			std::string text = "asset_" + std::to_string(i);
+
+			EXPECT_EQ(ConstStringHash(text.c_str()) == names[i], true);
+			EXPECT_EQ(text, names[i].GetString());
+		}
+
+		/// Strings longer than a chunk fraction are stored on their own.
+		std::string long_text(100000, 'x');
+
+		ConstStringHash long_name(long_text.c_str());
+
+		EXPECT_EQ(long_name.GetCount(), 100000);
+		EXPECT_EQ(long_text, long_name.GetString());
+	}
+
+	/**
+	 * Tests interning the same names from several threads at once.
+	 */
+	TEST(ConstStringHashTest, Concurrency)
+	{
+		constexpr int NUM_OF_THREADS = 4;
+		constexpr int NUM_OF_NAMES = 5000;
+
+		std::vector<U32> ids[NUM_OF_THREADS];
+		std::vector<std::thread> threads;
+
+		for (int t = 0; t < NUM_OF_THREADS; t++)
+			threads.emplace_back([t, &ids]()
+				{
+					for (int i = 0; i < NUM_OF_NAMES; i++)
+					{
+						int index = (t % 2) ? NUM_OF_NAMES - i - 1 : i;
+
+						ids[t].push_back(ConstStringHash(("event_" + std::to_string(index)).c_str()).GetId());
+					}
+				}
+			);
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		for (int t = 1; t < NUM_OF_THREADS; t++)
+			for (int i = 0; i < NUM_OF_NAMES; i++)
+				EXPECT_EQ(ids[t][(t % 2) ? NUM_OF_NAMES - i - 1 : i], ids[0][i]);
+	}
+
+	/**
+	 * Tests the type checks of type infos by name.
+	 */
+	TEST(ConstStringHashTest, TypeInfo)
+	{
+		RTTI::TypeInfo base("Base", 8, nullptr);
+		RTTI::TypeInfo derived("Derived", 16, &base);
+
+		EXPECT_EQ(derived.IsSameAs(ConstStringHash("Derived")), true);
+		EXPECT_EQ(derived.IsSameAs(ConstStringHash("Base")), false);
+		EXPECT_EQ(derived.IsDerivedFrom(ConstStringHash("Base")), true);
+		EXPECT_EQ(base.IsDerivedFrom(ConstStringHash("Derived")), false);
+	}
+}
+
+#endif // CONST_STRING_HASH_TEST_H
@@ -0,0 +1,130 @@
+#ifndef STRING_TEST_H
+#define STRING_TEST_H
+
+#include <cstring>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Types/String/String.h"
+#include "Core/Public/Memory/TLSFAllocator.h"
+#include "Core/Public/Containers/TDynamicArray.h"
+
+using namespace Forge;
+using namespace Forge::Type;
+
+namespace StringTest
+{
+	/**
+	 * Tests that appending grows the string and keeps it null terminated,
+	 * including appending a string to itself.
+	 */
+	TEST(StringTest, Append)
+	{
+		String empty;
+
+		EXPECT_TRUE(empty.IsEmpty());
+		EXPECT_STREQ(empty.GetRawData(), "");
+
+		String a("Forge");
+
+		a += ' ';
+		a += "Engine";
+
+		EXPECT_EQ(a.GetCount(), 12);
+		EXPECT_STREQ(a.GetRawData(), "Forge Engine");
+		EXPECT_GE(a.GetCapacity(), a.GetCount());
+
+		for (int i = 0; i < 4; i++)
+			a += a;
+
+		EXPECT_EQ(a.GetCount(), 12 * 16);
+		EXPECT_EQ(strlen(a.GetRawData()), 12 * 16);
+		EXPECT_EQ(a.FindFirstOf('E', 1), 6);
+
+		a.Clear();
+
+		EXPECT_TRUE(a.IsEmpty());
+		EXPECT_STREQ(a.GetRawData(), "");
+	}
+
+	/**
+	 * Tests that copies own their characters, and that moves hand the buffer
+	 * over and leave the source empty.
+	 */
+	TEST(StringTest, CopyAndMove)
+	{
+		String a("first");
+		String b(a);
+
+		b += "!";
+
+		EXPECT_STREQ(a.GetRawData(), "first");
+		EXPECT_STREQ(b.GetRawData(), "first!");
+
+		a = b;
+
+		EXPECT_TRUE(a == b);
+
+		ConstCharPtr buffer = b.GetRawData();
+
+		String c(std::move(b));
+
+		EXPECT_EQ(c.GetRawData(), buffer);
+		EXPECT_TRUE(b.IsEmpty());
+
+		a = std::move(c);
+
+		EXPECT_EQ(a.GetRawData(), buffer);
+		EXPECT_TRUE(c.IsEmpty());
+
+		a = "second";
+
+		EXPECT_STREQ(a.GetRawData(), "second");
+		EXPECT_TRUE(a != c);
+	}
+
+	/**
+	 * Tests that a string allocates through its allocator, and that copies
+	 * and moves keep releasing to the right one.
+	 */
+	TEST(StringTest, Allocator)
+	{
+		Memory::TLSFAllocator allocator(1 << 16);
+
+		{
+			String a("pooled", &allocator);
+			String b(a);
+
+			b += " copy that grows past the first buffer";
+
+			String c(std::move(a));
+
+			EXPECT_EQ(allocator.GetNumOfAllocs() - allocator.GetNumOfDeallocs(), 2);
+		}
+
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+	}
+
+	/**
+	 * Tests that strings are relocated as a whole when stored in containers,
+	 * and hash by their characters.
+	 */
+	TEST(StringTest, Containers)
+	{
+		Containers::TDynamicArray<String> strings;
+
+		for (int i = 0; i < 100; i++)
+			strings.PushBack(String("value"));
+
+		for (Size i = 0; i < strings.GetCount(); i++)
+			EXPECT_STREQ(strings[i].GetRawData(), "value");
+
+		Algorithm::THash<String> hash;
+
+		EXPECT_EQ(hash(String("value")), hash(strings[42]));
+		EXPECT_NE(hash(String("value")), hash(String("other")));
+	}
+}
+
+#endif // STRING_TEST_H
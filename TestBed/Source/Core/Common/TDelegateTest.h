@@ -3,6 +3,8 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
+
 #include "Core/Public/Types/TDelegate.h"
 
 using namespace Forge::Common;
@@ -18,6 +20,17 @@ namespace DelegateUnitTest
 			int TestMemberFunc(int value) { return value; } 
 			int ConstTestMemberFunc(int value) const { return value; }
 		};
+
+		/// Counts the live copies of a lambda capture.
+		struct CaptureCounter
+		{
+			int* m_count;
+
+			CaptureCounter(int* count) : m_count(count) { ++*m_count; }
+			CaptureCounter(const CaptureCounter& other) : m_count(other.m_count) { ++*m_count; }
+			CaptureCounter(CaptureCounter&& other) noexcept : m_count(other.m_count) { ++*m_count; }
+		   ~CaptureCounter() { --*m_count; }
+		};
 	}
 
 	/**
@@ -206,6 +219,93 @@ namespace DelegateUnitTest
 
 		EXPECT_EQ(d.IsValid(), false);
 	}
+
+	/**
+	 * Tests that a lambda capture larger than the inline storage is copied
+	 * and moved with the delegate object.
+	 */
+	TEST(DelegateTest, LargeCaptureLambda)
+	{
+		int values[16];
+
+		for (int i = 0; i < 16; i++)
+			values[i] = i;
+
+		TDelegate<int(int)> d1 = [values](int index) -> int { return values[index]; };
+		TDelegate<int(int)> d2 = d1;
+		TDelegate<int(int)> d3 = std::move(d1);
+
+		EXPECT_EQ(d1.IsValid(), false);
+
+		EXPECT_EQ(d2.Invoke(3), 3);
+		EXPECT_EQ(d3.Invoke(15), 15);
+	}
+
+	/**
+	 * Tests that captures are destroyed exactly once, whether they are stored
+	 * inline or on the heap.
+	 */
+	TEST(DelegateTest, CaptureLifetime)
+	{
+		int count = 0;
+
+		{
+			Internal::CaptureCounter counter(&count);
+
+			TDelegate<int(void)> d1 = [counter]() -> int { return *counter.m_count; };
+			TDelegate<int(void), 8> d2 = [counter]() -> int { return *counter.m_count; };
+
+			EXPECT_EQ(count, 3);
+
+			TDelegate<int(void)> d3 = d1;
+			TDelegate<int(void), 8> d4 = d2;
+
+			EXPECT_EQ(count, 5);
+
+			d1 = std::move(d3);
+			d2 = std::move(d4);
+
+			EXPECT_EQ(count, 3);
+			EXPECT_EQ(d1.Invoke(), 3);
+			EXPECT_EQ(d2.Invoke(), 3);
+		}
+
+		EXPECT_EQ(count, 0);
+	}
+
+	/**
+	 * Tests binding a lambda with a move-only capture.
+	 */
+	TEST(DelegateTest, MoveOnlyCaptureLambda)
+	{
+		std::unique_ptr<int> value(new int(5));
+
+		TDelegate<int(int)> d1 = [value = std::move(value)](int add) -> int { return *value + add; };
+		TDelegate<int(int)> d2 = std::move(d1);
+
+		EXPECT_EQ(d1.IsValid(), false);
+		EXPECT_EQ(d2.Invoke(1), 6);
+
+		EXPECT_ANY_THROW(TDelegate<int(int)> d3 = d2);
+	}
+
+	/**
+	 * Tests that arguments are forwarded to the bound invokable without
+	 * copies.
+	 */
+	TEST(DelegateTest, ForwardParameters)
+	{
+		TDelegate<int(std::unique_ptr<int>)> d1 = [](std::unique_ptr<int> value) -> int { return *value; };
+		TDelegate<void(int&)> d2 = [](int& value) { value = 7; };
+
+		int value = 0;
+
+		EXPECT_EQ(d1.Invoke(std::unique_ptr<int>(new int(3))), 3);
+
+		d2.Invoke(value);
+
+		EXPECT_EQ(value, 7);
+	}
 }
 
 #endif // T_DELEGATE_TEST_H
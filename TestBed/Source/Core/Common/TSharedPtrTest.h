@@ -0,0 +1,207 @@
+#ifndef T_SHARED_PTR_TEST_H
+#define T_SHARED_PTR_TEST_H
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Types/SmartPointer.h"
+#include "Core/Public/Memory/FreeListAllocator.h"
+
+using namespace Forge;
+using namespace Forge::Common;
+
+namespace TSharedPtrTest
+{
+	struct Base
+	{
+		int* m_num_of_destroyed;
+
+		Base(int* num_of_destroyed)
+			: m_num_of_destroyed(num_of_destroyed) {}
+
+		virtual ~Base() { (*m_num_of_destroyed)++; }
+	};
+
+	struct Derived : public Base
+	{
+		int m_value;
+
+		Derived(int* num_of_destroyed, int value)
+			: Base(num_of_destroyed), m_value(value) {}
+	};
+
+	/**
+	 * Tests that copies share the object and the last one destroys it.
+	 */
+	TEST(TSharedPtrTest, SharedOwnership)
+	{
+		int num_of_destroyed = 0;
+
+		{
+			TSharedPtr<Base> a(new Base(&num_of_destroyed));
+			TSharedPtr<Base> b = a;
+
+			EXPECT_EQ(a.GetRefCount(), 2);
+			EXPECT_FALSE(a.IsUnique());
+
+			TSharedPtr<Base> c = Move(b);
+
+			EXPECT_TRUE(b.IsNull());
+			EXPECT_EQ(a.GetRefCount(), 2);
+
+			a = a;
+			c.Reset();
+
+			EXPECT_TRUE(a.IsUnique());
+			EXPECT_EQ(num_of_destroyed, 0);
+		}
+
+		EXPECT_EQ(num_of_destroyed, 1);
+	}
+
+	/**
+	 * Tests that the custom deleter is invoked once.
+	 */
+	TEST(TSharedPtrTest, Deleter)
+	{
+		int num_of_destroyed = 0;
+		int num_of_deleted = 0;
+
+		{
+			TSharedPtr<Base> a(new Base(&num_of_destroyed), [&num_of_deleted](Base* ptr) -> Void
+			{
+				num_of_deleted++;
+				delete ptr;
+			});
+
+			TSharedPtr<Base> b = a;
+		}
+
+		EXPECT_EQ(num_of_deleted, 1);
+		EXPECT_EQ(num_of_destroyed, 1);
+	}
+
+	/**
+	 * Tests that MakeShared constructs the object in place and converts to
+	 * a shared pointer of a base type.
+	 */
+	TEST(TSharedPtrTest, MakeShared)
+	{
+		int num_of_destroyed = 0;
+
+		{
+			TSharedPtr<Derived> derived = MakeShared<Derived>(&num_of_destroyed, 7);
+			TSharedPtr<Base> base = derived;
+
+			EXPECT_EQ(derived->m_value, 7);
+			EXPECT_EQ(base.GetRawPtr(), derived.GetRawPtr());
+			EXPECT_EQ(base.GetRefCount(), 2);
+
+			TSharedPtr<Derived, RefCountMode::NOT_THREAD_SAFE> local = MakeShared<Derived, RefCountMode::NOT_THREAD_SAFE>(&num_of_destroyed, 3);
+
+			EXPECT_EQ(local->m_value, 3);
+		}
+
+		EXPECT_EQ(num_of_destroyed, 2);
+	}
+
+	/**
+	 * Tests that AllocateShared takes a single allocation from the
+	 * allocator and returns it once the last weak reference is released.
+	 */
+	TEST(TSharedPtrTest, AllocateShared)
+	{
+		Forge::Memory::FreeListAllocator allocator(1024);
+
+		int num_of_destroyed = 0;
+
+		TWeakPtr<Derived> weak;
+
+		{
+			TSharedPtr<Derived> a = AllocateShared<Derived>(&allocator, &num_of_destroyed, 5);
+
+			EXPECT_EQ(allocator.GetNumOfAllocs(), 1);
+			EXPECT_EQ(a->m_value, 5);
+
+			weak = a;
+		}
+
+		EXPECT_EQ(num_of_destroyed, 1);
+		EXPECT_EQ(allocator.GetNumOfDeallocs(), 0);
+
+		weak.Reset();
+
+		EXPECT_EQ(allocator.GetNumOfDeallocs(), 1);
+	}
+
+	/**
+	 * Tests that a weak pointer locks while the object is alive and expires
+	 * once it is destroyed.
+	 */
+	TEST(TSharedPtrTest, WeakPtr)
+	{
+		int num_of_destroyed = 0;
+
+		TWeakPtr<Base> weak;
+
+		EXPECT_TRUE(weak.IsExpired());
+		EXPECT_TRUE(weak.Lock().IsNull());
+
+		{
+			TSharedPtr<Base> a = MakeShared<Base>(&num_of_destroyed);
+
+			weak = a;
+
+			TSharedPtr<Base> locked = weak.Lock();
+
+			EXPECT_FALSE(weak.IsExpired());
+			EXPECT_EQ(locked, a);
+			EXPECT_EQ(weak.GetRefCount(), 2);
+		}
+
+		EXPECT_EQ(num_of_destroyed, 1);
+		EXPECT_TRUE(weak.IsExpired());
+		EXPECT_TRUE(weak.Lock().IsNull());
+	}
+
+	/**
+	 * Tests that references to an atomically counted object may be copied
+	 * and released from several threads.
+	 */
+	TEST(TSharedPtrTest, Concurrency)
+	{
+		int num_of_destroyed = 0;
+
+		{
+			TSharedPtr<Base> shared = MakeShared<Base>(&num_of_destroyed);
+			TWeakPtr<Base> weak = shared;
+
+			std::vector<std::thread> threads;
+
+			for (int i = 0; i < 4; i++)
+			{
+				threads.emplace_back([shared, weak]()
+				{
+					for (int j = 0; j < 10000; j++)
+					{
+						TSharedPtr<Base> copy = shared;
+						TSharedPtr<Base> locked = weak.Lock();
+
+						EXPECT_FALSE(locked.IsNull());
+					}
+				});
+			}
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			EXPECT_TRUE(shared.IsUnique());
+		}
+
+		EXPECT_EQ(num_of_destroyed, 1);
+	}
+}
+
+#endif // T_SHARED_PTR_TEST_H
@@ -0,0 +1,123 @@
+#ifndef T_CHUNKED_ARRAY_TEST_H
+#define T_CHUNKED_ARRAY_TEST_H
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Containers/TChunkedArray.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace TChunkedArrayTest
+{
+	/**
+	 * Tests that elements keep their address while the array grows.
+	 */
+	TEST(TChunkedArrayTest, StableAddresses)
+	{
+		TChunkedArray<std::string, 4> a;
+
+		std::string* first = &a[a.Add("0")];
+
+		for (int i = 1; i < 100; i++)
+			EXPECT_EQ(a.Add(std::to_string(i)), i);
+
+		EXPECT_EQ(&a[0], first);
+		EXPECT_EQ(*first, "0");
+		EXPECT_EQ(a.GetCount(), 100);
+		EXPECT_EQ(a.GetChunkCount(), 25);
+		EXPECT_EQ(a.GetCapacity(), 100);
+
+		for (Size i = 0; i < a.GetChunkCount(); i++)
+		{
+			auto chunk = a.GetChunk(i);
+
+			EXPECT_EQ(chunk.GetCount(), 4);
+			EXPECT_EQ(chunk[3], std::to_string(i * 4 + 3));
+		}
+	}
+
+	/**
+	 * Tests that removing elements leaves holes that iterators skip and that
+	 * later elements fill.
+	 */
+	TEST(TChunkedArrayTest, Recycling)
+	{
+		TChunkedArray<int, 64> a;
+
+		for (int i = 0; i < 200; i++)
+			a.Add(i);
+
+		for (Size i = 0; i < 200; i += 3)
+			a.RemoveAt(i);
+
+		EXPECT_FALSE(a.IsAllocated(0));
+		EXPECT_TRUE(a.IsAllocated(1));
+		EXPECT_FALSE(a.IsAllocated(200));
+		EXPECT_EQ(a.GetCount(), 133);
+
+		Size count = 0;
+
+		for (auto itr = a.GetStartItr(); itr != a.GetEndItr(); itr++, count++)
+		{
+			EXPECT_NE(itr.GetIndex() % 3, 0);
+			EXPECT_EQ(*itr, itr.GetIndex());
+		}
+
+		EXPECT_EQ(count, 133);
+
+		int* address = &a[1];
+
+		EXPECT_EQ(a.Add(-1), 198);
+		EXPECT_EQ(a.Add(-2), 195);
+		EXPECT_EQ(a.GetSlotCount(), 200);
+		EXPECT_EQ(&a[1], address);
+
+		for (auto itr = a.GetStartItr(); itr != a.GetEndItr(); itr++)
+			if (*itr < 0)
+				a.RemoveAt(itr.GetIndex());
+
+		EXPECT_EQ(a.GetCount(), 133);
+
+		a.Clear();
+
+		EXPECT_TRUE(a.IsEmpty());
+		EXPECT_TRUE(a.GetStartItr() == a.GetEndItr());
+		EXPECT_EQ(a.Add(7), 0);
+		EXPECT_EQ(a.GetChunkCount(), 4);
+	}
+	/**
+	 * Tests that a throwing constructor leaves the slot it was given free.
+	 */
+	TEST(TChunkedArrayTest, ThrowingAdd)
+	{
+		struct Throwing
+		{
+			Throwing(Bool is_throwing)
+			{
+				if (is_throwing)
+					throw 0;
+			}
+		};
+
+		TChunkedArray<Throwing, 4> a;
+
+		EXPECT_EQ(a.Add(false), 0);
+		EXPECT_EQ(a.Add(false), 1);
+		EXPECT_ANY_THROW(a.Add(true));
+		EXPECT_EQ(a.GetSlotCount(), 2);
+		EXPECT_FALSE(a.IsAllocated(2));
+
+		a.RemoveAt(0);
+
+		EXPECT_ANY_THROW(a.Add(true));
+		EXPECT_FALSE(a.IsAllocated(0));
+		EXPECT_EQ(a.GetCount(), 1);
+		EXPECT_EQ(a.Add(false), 0);
+		EXPECT_EQ(a.Add(false), 2);
+	}
+}
+
+#endif // T_CHUNKED_ARRAY_TEST_H
@@ -0,0 +1,211 @@
+#ifndef T_CONCURRENT_QUEUE_TEST_H
+#define T_CONCURRENT_QUEUE_TEST_H
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Containers/TConcurrentQueue.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace ConcurrentQueueTest
+{
+	/**
+	 * Tests that the capacity of a concurrent queue is rounded up to a power
+	 * of two.
+	 */
+	TEST(ConcurrentQueueTest, Capacity)
+	{
+		TConcurrentQueue<int> queue(100);
+
+		EXPECT_EQ(queue.GetCapacity(), 128);
+		EXPECT_EQ(queue.IsEmpty(), true);
+
+		EXPECT_ANY_THROW(TConcurrentQueue<int> empty_queue(0));
+	}
+
+	/**
+	 * Tests that elements are dequeued in the order they were enqueued, and
+	 * that a full queue rejects elements.
+	 */
+	TEST(ConcurrentQueueTest, EnqueueDequeue)
+	{
+		TConcurrentQueue<int> queue(4);
+
+		int value;
+
+		EXPECT_EQ(queue.TryDequeue(value), false);
+
+		for (int lap = 0; lap < 3; lap++)
+		{
+			for (int i = 0; i < 4; i++)
+				EXPECT_EQ(queue.TryEnqueue(lap * 4 + i), true);
+
+			EXPECT_EQ(queue.TryEnqueue(-1), false);
+			EXPECT_EQ(queue.GetCount(), 4);
+
+			for (int i = 0; i < 4; i++)
+			{
+				EXPECT_EQ(queue.TryDequeue(value), true);
+				EXPECT_EQ(value, lap * 4 + i);
+			}
+
+			EXPECT_EQ(queue.TryDequeue(value), false);
+		}
+	}
+
+	/**
+	 * Tests enqueuing move-only elements, and that the elements left in the
+	 * queue are destroyed with it.
+	 */
+	TEST(ConcurrentQueueTest, MoveOnlyElements)
+	{
+		std::shared_ptr<int> counter = std::make_shared<int>(0);
+
+		{
+			TConcurrentQueue<std::unique_ptr<std::shared_ptr<int>>> queue(8);
+
+			for (int i = 0; i < 5; i++)
+				EXPECT_EQ(queue.TryEmplace(new std::shared_ptr<int>(counter)), true);
+
+			std::unique_ptr<std::shared_ptr<int>> element;
+
+			EXPECT_EQ(queue.TryDequeue(element), true);
+			EXPECT_EQ(counter.use_count(), 6);
+
+			element.reset();
+
+			EXPECT_EQ(counter.use_count(), 5);
+		}
+
+		EXPECT_EQ(counter.use_count(), 1);
+	}
+
+	/**
+	 * Tests that an element whose constructor throws does not claim a cell,
+	 * which would stall every consumer reaching it.
+	 */
+	TEST(ConcurrentQueueTest, ThrowingConstructor)
+	{
+		struct Element
+		{
+			int m_value;
+
+			Element(void) : m_value(0) {}
+			Element(int value) : m_value(value) { if (value < 0) throw value; }
+		};
+
+		TConcurrentQueue<Element> queue(4);
+
+		EXPECT_EQ(queue.TryEmplace(1), true);
+		EXPECT_ANY_THROW(queue.TryEmplace(-1));
+		EXPECT_EQ(queue.TryEmplace(2), true);
+		EXPECT_EQ(queue.GetCount(), 2);
+
+		Element element;
+
+		EXPECT_EQ(queue.TryDequeue(element), true);
+		EXPECT_EQ(element.m_value, 1);
+		EXPECT_EQ(queue.TryDequeue(element), true);
+		EXPECT_EQ(element.m_value, 2);
+		EXPECT_EQ(queue.TryDequeue(element), false);
+	}
+
+	/**
+	 * Tests enqueuing elements whose move constructor may throw, which are
+	 * constructed before claiming a cell and moved into it.
+	 */
+	TEST(ConcurrentQueueTest, ThrowingMove)
+	{
+		struct Element
+		{
+			int m_value;
+
+			Element(void) : m_value(0) {}
+			Element(int value) : m_value(value) {}
+			Element(const Element& other) : m_value(other.m_value) {}
+			Element(Element&& other) : m_value(other.m_value) { if (m_value < 0) throw m_value; }
+			Element& operator =(const Element& other) { m_value = other.m_value; return *this; }
+		};
+
+		TConcurrentQueue<Element> queue(4);
+
+		Element first(1);
+
+		EXPECT_EQ(queue.TryEnqueue(first), true);
+		EXPECT_EQ(queue.TryEnqueue(Element(2)), true);
+		EXPECT_EQ(queue.TryEmplace(3), true);
+		EXPECT_EQ(queue.GetCount(), 3);
+
+		Element element;
+
+		for (int i = 1; i <= 3; i++)
+		{
+			EXPECT_EQ(queue.TryDequeue(element), true);
+			EXPECT_EQ(element.m_value, i);
+		}
+
+		EXPECT_EQ(queue.TryDequeue(element), false);
+	}
+
+	/**
+	 * Tests several producers and consumers sharing a queue, every element
+	 * must be dequeued exactly once.
+	 */
+	TEST(ConcurrentQueueTest, Concurrency)
+	{
+		constexpr int NUM_OF_PRODUCERS = 4;
+		constexpr int NUM_OF_CONSUMERS = 4;
+		constexpr int NUM_OF_ELEMENTS = 20000;
+
+		TConcurrentQueue<int> queue(64);
+
+		std::vector<std::atomic<int>> received(NUM_OF_PRODUCERS * NUM_OF_ELEMENTS);
+		std::atomic<int> num_of_received(0);
+
+		std::vector<std::thread> threads;
+
+		for (int t = 0; t < NUM_OF_PRODUCERS; t++)
+			threads.emplace_back([t, &queue]()
+				{
+					for (int i = 0; i < NUM_OF_ELEMENTS; i++)
+					{
+						while (!queue.TryEnqueue(t * NUM_OF_ELEMENTS + i))
+							std::this_thread::yield();
+					}
+				}
+			);
+
+		for (int t = 0; t < NUM_OF_CONSUMERS; t++)
+			threads.emplace_back([&queue, &received, &num_of_received]()
+				{
+					int value;
+
+					while (num_of_received.load() < NUM_OF_PRODUCERS * NUM_OF_ELEMENTS)
+					{
+						if (queue.TryDequeue(value))
+						{
+							received[value].fetch_add(1);
+							num_of_received.fetch_add(1);
+						}
+						else
+							std::this_thread::yield();
+					}
+				}
+			);
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		for (std::atomic<int>& count : received)
+			EXPECT_EQ(count.load(), 1);
+
+		EXPECT_EQ(queue.IsEmpty(), true);
+	}
+}
+
+#endif // T_CONCURRENT_QUEUE_TEST_H
@@ -0,0 +1,124 @@
+#ifndef T_DEQUE_TEST_H
+#define T_DEQUE_TEST_H
+
+#include <deque>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Containers/TDeque.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace TDequeTest
+{
+	/**
+	 * Tests pushing and popping at both ends across several blocks.
+	 */
+	TEST(TDequeTest, PushPop)
+	{
+		TDeque<int> deque;
+
+		const int count = static_cast<int>(TDeque<int>::BLOCK_SIZE) * 3 + 5;
+
+		for (int i = 0; i < count; i++)
+		{
+			deque.PushBack(i);
+			deque.PushFront(-i - 1);
+		}
+
+		EXPECT_EQ(deque.GetCount(), count * 2);
+		EXPECT_EQ(deque.PeekFront(), -count);
+		EXPECT_EQ(deque.PeekBack(), count - 1);
+
+		for (int i = 0; i < count * 2; i++)
+			EXPECT_EQ(deque[i], i - count);
+
+		for (int i = 0; i < count; i++)
+		{
+			deque.PopFront();
+			deque.PopBack();
+		}
+
+		EXPECT_TRUE(deque.IsEmpty());
+	}
+
+	/**
+	 * Tests the deque against std::deque through a pseudo random sequence of
+	 * operations.
+	 */
+	TEST(TDequeTest, MatchesStdDeque)
+	{
+		TDeque<std::string> deque;
+		std::deque<std::string> expected;
+
+		U32 state = 12345;
+
+		for (int i = 0; i < 20000; i++)
+		{
+			state = state * 1664525u + 1013904223u;
+
+			switch ((state >> 16) % 5)
+			{
+			case 0:
+			case 1:
+				deque.PushBack(std::to_string(i));
+				expected.push_back(std::to_string(i));
+				break;
+			case 2:
+				deque.PushFront(std::to_string(i));
+				expected.push_front(std::to_string(i));
+				break;
+			case 3:
+				if (!expected.empty())
+				{
+					deque.PopFront();
+					expected.pop_front();
+				}
+				break;
+			default:
+				if (!expected.empty())
+				{
+					deque.PopBack();
+					expected.pop_back();
+				}
+				break;
+			}
+		}
+
+		ASSERT_EQ(deque.GetCount(), expected.size());
+
+		Size index = 0;
+
+		for (auto itr = deque.GetStartConstItr(); itr != deque.GetEndConstItr(); itr++)
+			EXPECT_EQ(*itr, expected[index++]);
+	}
+
+	/**
+	 * Tests copying and moving a deque.
+	 */
+	TEST(TDequeTest, CopyMove)
+	{
+		TDeque<std::string> deque;
+
+		for (int i = 0; i < 1000; i++)
+			deque.PushBack(std::to_string(i));
+
+		TDeque<std::string> copy = deque;
+		TDeque<std::string> moved = std::move(deque);
+
+		EXPECT_EQ(deque.GetCount(), 0);
+		EXPECT_EQ(copy.GetCount(), 1000);
+		EXPECT_EQ(moved.GetCount(), 1000);
+
+		for (int i = 0; i < 1000; i++)
+			EXPECT_EQ(copy[i], moved[i]);
+
+		moved.Clear();
+
+		EXPECT_TRUE(moved.IsEmpty());
+	}
+}
+
+#endif // T_DEQUE_TEST_H
@@ -5,6 +5,8 @@
 
 #include "Core/Public/Containers/TDynamicArray.h"
 
+#include "Core/Public/Memory/FreeListAllocator.h"
+
 using namespace Forge::Containers;
 
 namespace TDynamicArrayTest
@@ -52,6 +54,32 @@ namespace TDynamicArrayTest
 			EXPECT_EQ(a[i], 10);
 	}
 
+	/**
+	 * Tests the allocator constructor of a dynamic array object.
+	 */
+	TEST(TDynamicArrayTest, AllocatorConstructor)
+	{
+		Forge::Memory::FreeListAllocator allocator(1024);
+
+		{
+			TDynamicArray<int, Forge::Memory::InstanceAllocatorPolicy> a(10, 10, &allocator);
+
+			EXPECT_EQ(a.GetCount(), 10);
+			EXPECT_EQ(allocator.GetNumOfAllocs(), 1);
+
+			a.ReserveCapacity(20);
+
+			EXPECT_EQ(allocator.GetNumOfAllocs(), 2);
+			EXPECT_EQ(allocator.GetNumOfDeallocs(), 1);
+
+			for (int i = 0; i < 10; i++)
+				EXPECT_EQ(a[i], 10);
+		}
+
+		EXPECT_EQ(allocator.GetNumOfDeallocs(), 2);
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+	}
+
 	/**
 	 * Tests the move constructor of a static array object.
 	 */
@@ -329,6 +357,79 @@ namespace TDynamicArrayTest
 		EXPECT_EQ(a.FirstIndexOf(30), 4);
 	}
 
+	/**
+	 * Element that points to itself, and is therefore not trivially
+	 * relocatable.
+	 */
+	struct SelfReferencingElement
+	{
+		SelfReferencingElement* m_self;
+		int m_value;
+
+		SelfReferencingElement(int value)
+			: m_self(this), m_value(value) {}
+		SelfReferencingElement(SelfReferencingElement&& other)
+			: m_self(this), m_value(other.m_value) {}
+		SelfReferencingElement(const SelfReferencingElement& other)
+			: m_self(this), m_value(other.m_value) {}
+
+		SelfReferencingElement& operator =(const SelfReferencingElement& other)
+		{
+			m_value = other.m_value;
+
+			return *this;
+		}
+	};
+
+	/**
+	 * Tests that elements which are not trivially relocatable are relocated
+	 * through their constructors when a dynamic array grows and shifts.
+	 */
+	TEST(TDynamicArrayTest, RelocateElements)
+	{
+		TDynamicArray<SelfReferencingElement> a;
+
+		for (int i = 0; i < 100; i++)
+			a.PushBack(SelfReferencingElement(i));
+
+		a.InsertAt(0, SelfReferencingElement(-1));
+		a.RemoveAt(50);
+
+		EXPECT_EQ(a.GetCount(), 100);
+
+		for (int i = 0; i < 100; i++)
+		{
+			EXPECT_EQ(a[i].m_self, &a[i]);
+			EXPECT_EQ(a[i].m_value, i < 50 ? i - 1 : i);
+		}
+	}
+
+	/**
+	 * Tests the ShrinkToFit member function of a dynamic array object.
+	 */
+	TEST(TDynamicArrayTest, ShrinkToFit)
+	{
+		TDynamicArray<TDynamicArray<int>> a;
+
+		for (int i = 0; i < 100; i++)
+			a.PushBack(TDynamicArray<int>(i, 3));
+
+		a.ShrinkToFit();
+
+		EXPECT_EQ(a.GetCount(), 100);
+
+		for (int i = 0; i < 100; i++)
+		{
+			EXPECT_EQ(a[i].GetCount(), 3);
+			EXPECT_EQ(a[i][2], i);
+		}
+
+		a.Clear();
+		a.ShrinkToFit();
+
+		EXPECT_EQ(a.GetRawData(), nullptr);
+	}
+
 	/**
 	 * Tests the RemoveAt member function of a static array object.
 	 */
@@ -0,0 +1,329 @@
+#ifndef T_FLAT_HASH_MAP_TEST_H
+#define T_FLAT_HASH_MAP_TEST_H
+
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Containers/TFlatHashMap.h"
+#include "Core/Public/Memory/FreeListAllocator.h"
+
+using namespace Forge::Containers;
+
+namespace FlatHashMapTest
+{
+	/**
+	 * Hashes strings and string literals alike for heterogeneous lookups.
+	 */
+	struct StringHasher
+	{
+		Forge::U64 operator ()(const std::string& key) const { return std::hash<std::string_view>()(key); }
+		Forge::U64 operator ()(const char* key) const { return std::hash<std::string_view>()(key); }
+	};
+
+	/**
+	 * Maps every key to one of a few hashes, which makes keys probe past
+	 * full groups.
+	 */
+	struct CollidingHasher
+	{
+		Forge::U64 operator ()(int key) const { return static_cast<Forge::U64>(key % 3) << 7; }
+	};
+
+	/**
+	 * Throws from its copy constructor while the flag is set.
+	 */
+	struct ThrowingValue
+	{
+		static bool s_throw;
+
+		int m_value;
+
+		ThrowingValue(int value = 0) : m_value(value) {}
+		ThrowingValue(ThrowingValue&& other) : m_value(other.m_value) {}
+		ThrowingValue(const ThrowingValue& other) : m_value(other.m_value) { if (s_throw) throw 0; }
+
+		ThrowingValue& operator =(ThrowingValue&& other) = default;
+		ThrowingValue& operator =(const ThrowingValue& other) = default;
+	};
+
+	bool ThrowingValue::s_throw = false;
+
+	/**
+	 * Tests the default constructor of a flat hash map object.
+	 */
+	TEST(FlatHashMapTest, DefaultConstructor)
+	{
+		TFlatHashMap<int, int> map;
+
+		EXPECT_EQ(map.GetCount(), 0);
+		EXPECT_EQ(map.GetCapacity(), 0);
+		EXPECT_EQ(map.IsEmpty(), true);
+		EXPECT_EQ(map.Contains(10), false);
+		EXPECT_EQ(map.GetStartItr() == map.GetEndItr(), true);
+	}
+
+	/**
+	 * Tests the allocator constructor of a flat hash map object.
+	 */
+	TEST(FlatHashMapTest, AllocatorConstructor)
+	{
+		Forge::Memory::FreeListAllocator allocator(64 * 1024);
+
+		{
+			TFlatHashMap<int, int, Forge::Algorithm::THash<int>, Forge::Memory::InstanceAllocatorPolicy> map(&allocator);
+
+			for (int i = 0; i < 1000; i++)
+				map.Insert(i, i);
+
+			EXPECT_EQ(map.GetCount(), 1000);
+			EXPECT_EQ(allocator.GetNumOfAllocs() > 0, true);
+		}
+
+		EXPECT_EQ(allocator.GetNumOfAllocs(), allocator.GetNumOfDeallocs());
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+	}
+
+	/**
+	 * Tests the insert and find functions of a flat hash map object.
+	 */
+	TEST(FlatHashMapTest, InsertFind)
+	{
+		TFlatHashMap<int, int> map;
+
+		for (int i = 0; i < 10000; i++)
+			EXPECT_EQ(map.Insert(i, i * 2), true);
+
+		EXPECT_EQ(map.GetCount(), 10000);
+		EXPECT_EQ(map.Insert(10, 0), false);
+
+		for (int i = 0; i < 10000; i++)
+		{
+			TFlatHashMap<int, int>::Iterator itr = map.Find(i);
+
+			EXPECT_EQ(itr != map.GetEndItr(), true);
+			EXPECT_EQ(itr->m_first, i);
+			EXPECT_EQ(itr->m_second, i * 2);
+		}
+
+		EXPECT_EQ(map.Find(10000) == map.GetEndItr(), true);
+		EXPECT_EQ(map.FindValue(-1), nullptr);
+	}
+
+	/**
+	 * Tests the insert or assign function and the subscript operator of a
+	 * flat hash map object.
+	 */
+	TEST(FlatHashMapTest, InsertOrAssign)
+	{
+		TFlatHashMap<int, std::string> map;
+
+		map.InsertOrAssign(1, std::string("one"));
+		map.InsertOrAssign(1, std::string("uno"));
+
+		map[2] = "two";
+		map[2] += "!";
+
+		EXPECT_EQ(map.GetCount(), 2);
+		EXPECT_EQ(*map.FindValue(1), "uno");
+		EXPECT_EQ(*map.FindValue(2), "two!");
+		EXPECT_EQ(map[3].empty(), true);
+		EXPECT_EQ(map.GetCount(), 3);
+	}
+
+	/**
+	 * Tests the remove function of a flat hash map object.
+	 */
+	TEST(FlatHashMapTest, Remove)
+	{
+		TFlatHashMap<int, int> map;
+
+		for (int i = 0; i < 10000; i++)
+			map.Insert(i, i);
+
+		for (int i = 0; i < 10000; i += 2)
+			EXPECT_EQ(map.Remove(i), true);
+
+		EXPECT_EQ(map.Remove(0), false);
+		EXPECT_EQ(map.GetCount(), 5000);
+
+		for (int i = 0; i < 10000; i++)
+			EXPECT_EQ(map.Contains(i), (i % 2) == 1);
+
+		/// Removed slots are reused without growing the table.
+		Forge::Size capacity = map.GetCapacity();
+
+		for (int i = 0; i < 10000; i += 2)
+			map.Insert(i, i);
+
+		EXPECT_EQ(map.GetCapacity(), capacity);
+		EXPECT_EQ(map.GetCount(), 10000);
+	}
+
+	/**
+	 * Tests lookups and removals of keys probing past full groups.
+	 */
+	TEST(FlatHashMapTest, Collisions)
+	{
+		TFlatHashMap<int, int, CollidingHasher> map;
+
+		for (int i = 0; i < 300; i++)
+			map.Insert(i, i);
+
+		for (int i = 0; i < 300; i += 3)
+			map.Remove(i);
+
+		for (int i = 0; i < 600; i++)
+			EXPECT_EQ(map.Contains(i), i < 300 && (i % 3) != 0);
+
+		for (int i = 0; i < 300; i++)
+			map.Remove(i);
+
+		EXPECT_EQ(map.IsEmpty(), true);
+		EXPECT_EQ(map.Contains(1), false);
+
+		for (int i = 0; i < 300; i++)
+			map.Insert(i, -i);
+
+		for (int i = 0; i < 300; i++)
+			EXPECT_EQ(*map.FindValue(i), -i);
+	}
+
+	/**
+	 * Tests that a throwing element constructor leaves the map unchanged,
+	 * whether or not the insertion grows the table.
+	 */
+	TEST(FlatHashMapTest, ThrowingInsert)
+	{
+		TFlatHashMap<int, ThrowingValue> map;
+
+		ThrowingValue value(7);
+
+		for (int i = 0; i < 100; i++)
+		{
+			ThrowingValue::s_throw = true;
+
+			EXPECT_ANY_THROW(map.Insert(-1, value));
+			EXPECT_EQ(map.GetCount(), i);
+			EXPECT_EQ(map.Contains(-1), false);
+
+			ThrowingValue::s_throw = false;
+
+			map.Insert(i, value);
+		}
+
+		int count = 0;
+
+		for (TFlatHashMap<int, ThrowingValue>::Iterator itr = map.GetStartItr(); itr != map.GetEndItr(); itr++)
+			count += itr->m_second.m_value == 7;
+
+		EXPECT_EQ(count, 100);
+	}
+
+	/**
+	 * Tests inserting values that refer to elements of the map itself, across
+	 * the insertions that grow the table.
+	 */
+	TEST(FlatHashMapTest, SelfReferencingInsert)
+	{
+		TFlatHashMap<int, std::string> map;
+
+		map.Insert(0, std::string("a value too long for the small string buffer"));
+
+		for (int i = 1; i < 200; i++)
+		{
+			map.Insert(i, *map.FindValue(i - 1));
+			map.InsertOrAssign(i + 1000, *map.FindValue(i));
+		}
+
+		EXPECT_EQ(*map.FindValue(199), "a value too long for the small string buffer");
+		EXPECT_EQ(*map.FindValue(1199), "a value too long for the small string buffer");
+	}
+
+	/**
+	 * Tests the lookup of keys by a type other than the key type.
+	 */
+	TEST(FlatHashMapTest, HeterogeneousLookup)
+	{
+		TFlatHashMap<std::string, int, StringHasher> map;
+
+		map.Insert(std::string("position"), 0);
+		map.Insert(std::string("normal"), 1);
+
+		EXPECT_EQ(*map.FindValue("normal"), 1);
+		EXPECT_EQ(map.Contains("position"), true);
+		EXPECT_EQ(map.Contains("color"), false);
+		EXPECT_EQ(map.Remove("position"), true);
+		EXPECT_EQ(map.GetCount(), 1);
+	}
+
+	/**
+	 * Tests the iterators of a flat hash map object.
+	 */
+	TEST(FlatHashMapTest, Iterators)
+	{
+		TFlatHashMap<int, int> map;
+
+		for (int i = 0; i < 1000; i++)
+			map.Insert(i, i);
+
+		int sum = 0, count = 0;
+
+		for (TFlatHashMap<int, int>::ConstIterator itr = map.GetStartConstItr(); itr != map.GetEndConstItr(); itr++)
+		{
+			sum += itr->m_second;
+			count++;
+		}
+
+		EXPECT_EQ(count, 1000);
+		EXPECT_EQ(sum, 999 * 1000 / 2);
+
+		/// Removal does not invalidate iterators to other elements.
+		for (TFlatHashMap<int, int>::Iterator itr = map.GetStartItr(); itr != map.GetEndItr();)
+		{
+			TFlatHashMap<int, int>::Iterator current = itr++;
+
+			if (current->m_first % 2)
+				map.Remove(current);
+		}
+
+		EXPECT_EQ(map.GetCount(), 500);
+
+		map.ForEach([](Forge::Common::TPair<int, int>& element)
+			{
+				EXPECT_EQ(element.m_first % 2, 0);
+			}
+		);
+	}
+
+	/**
+	 * Tests the copy and move constructors of a flat hash map object.
+	 */
+	TEST(FlatHashMapTest, CopyMove)
+	{
+		TFlatHashMap<int, std::string> map;
+
+		for (int i = 0; i < 100; i++)
+			map.Insert(i, std::to_string(i));
+
+		TFlatHashMap<int, std::string> copy(map);
+
+		EXPECT_EQ(copy.GetCount(), 100);
+		EXPECT_EQ(*copy.FindValue(42), "42");
+
+		TFlatHashMap<int, std::string> moved(std::move(map));
+
+		EXPECT_EQ(moved.GetCount(), 100);
+		EXPECT_EQ(map.GetCount(), 0);
+		EXPECT_EQ(map.Contains(42), false);
+
+		copy.Clear();
+		copy = moved;
+
+		EXPECT_EQ(copy.GetCount(), 100);
+		EXPECT_EQ(*copy.FindValue(99), "99");
+	}
+}
+
+#endif // T_FLAT_HASH_MAP_TEST_H
@@ -0,0 +1,68 @@
+#ifndef T_FLAT_HASH_SET_TEST_H
+#define T_FLAT_HASH_SET_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Containers/TFlatHashSet.h"
+
+using namespace Forge::Containers;
+
+namespace FlatHashSetTest
+{
+	/**
+	 * Tests the default constructor of a flat hash set object.
+	 */
+	TEST(FlatHashSetTest, DefaultConstructor)
+	{
+		TFlatHashSet<int> set;
+
+		EXPECT_EQ(set.GetCount(), 0);
+		EXPECT_EQ(set.IsEmpty(), true);
+		EXPECT_EQ(set.Contains(0), false);
+	}
+
+	/**
+	 * Tests the capacity constructor of a flat hash set object.
+	 */
+	TEST(FlatHashSetTest, CapacityConstructor)
+	{
+		TFlatHashSet<int> set(1000);
+
+		Forge::Size capacity = set.GetCapacity();
+
+		for (int i = 0; i < 1000; i++)
+			set.Insert(i);
+
+		EXPECT_EQ(set.GetCapacity(), capacity);
+	}
+
+	/**
+	 * Tests the insert, contains and remove functions of a flat hash set
+	 * object.
+	 */
+	TEST(FlatHashSetTest, InsertRemove)
+	{
+		TFlatHashSet<void*> set;
+
+		int values[64];
+
+		for (int i = 0; i < 64; i++)
+			EXPECT_EQ(set.Insert(&values[i]), true);
+
+		EXPECT_EQ(set.Insert(&values[0]), false);
+		EXPECT_EQ(set.GetCount(), 64);
+
+		for (int i = 0; i < 64; i += 4)
+			EXPECT_EQ(set.Remove(&values[i]), true);
+
+		for (int i = 0; i < 64; i++)
+			EXPECT_EQ(set.Contains(&values[i]), (i % 4) != 0);
+
+		set.Clear();
+
+		EXPECT_EQ(set.IsEmpty(), true);
+		EXPECT_EQ(set.Contains(&values[1]), false);
+	}
+}
+
+#endif // T_FLAT_HASH_SET_TEST_H
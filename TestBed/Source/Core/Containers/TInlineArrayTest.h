@@ -0,0 +1,112 @@
+#ifndef T_INLINE_ARRAY_TEST_H
+#define T_INLINE_ARRAY_TEST_H
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Containers/TInlineArray.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace TInlineArrayTest
+{
+	/**
+	 * Tests that an array stays inline up to its inline capacity and moves
+	 * its elements to allocated storage past it.
+	 */
+	TEST(TInlineArrayTest, SpillToAllocator)
+	{
+		TInlineArray<int, 4> a;
+
+		EXPECT_TRUE(a.IsInline());
+		EXPECT_EQ(a.GetCapacity(), 4);
+
+		for (int i = 0; i < 4; i++)
+			a.PushBack(i);
+
+		EXPECT_TRUE(a.IsInline());
+
+		a.PushBack(4);
+		a.PushFront(-1);
+
+		EXPECT_FALSE(a.IsInline());
+		EXPECT_EQ(a.GetCount(), 6);
+
+		int value = -1;
+
+		for (auto itr = a.GetStartItr(); itr != a.GetEndItr(); itr++)
+			EXPECT_EQ(*itr, value++);
+
+		a.RemoveAt(0);
+		a.PopBack();
+		a.ShrinkToFit();
+
+		EXPECT_TRUE(a.IsInline());
+		EXPECT_EQ(a.GetCapacity(), 4);
+
+		for (int i = 0; i < 4; i++)
+			EXPECT_EQ(a[i], i);
+	}
+
+	/**
+	 * Tests the constructors of an inline array object, inline and spilled.
+	 */
+	TEST(TInlineArrayTest, Constructors)
+	{
+		TInlineArray<int, 4> a = { 1, 2, 3 };
+		TInlineArray<int, 4> b(7, 10);
+
+		EXPECT_TRUE(a.IsInline());
+		EXPECT_FALSE(b.IsInline());
+
+		EXPECT_EQ(a.GetByIndex(2), 3);
+		EXPECT_EQ(b.GetCount(), 10);
+		EXPECT_EQ(b.LastIndexOf(7), 9);
+		EXPECT_EQ(a.FirstIndexOf(4), -1);
+	}
+
+	/**
+	 * Tests copying and moving inline and spilled arrays of elements with a
+	 * non trivial lifetime.
+	 */
+	TEST(TInlineArrayTest, CopyMove)
+	{
+		TInlineArray<std::string, 2> small;
+		TInlineArray<std::string, 2> large;
+
+		small.PushBack("a");
+
+		for (int i = 0; i < 5; i++)
+			large.PushBack(std::to_string(i));
+
+		TInlineArray<std::string, 2> small_copy = small;
+		TInlineArray<std::string, 2> large_copy = large;
+
+		EXPECT_TRUE(small_copy.IsInline());
+		EXPECT_EQ(large_copy[4], "4");
+
+		TInlineArray<std::string, 2> small_moved = std::move(small);
+		TInlineArray<std::string, 2> large_moved = std::move(large);
+
+		EXPECT_EQ(small.GetCount(), 0);
+		EXPECT_EQ(large.GetCount(), 0);
+		EXPECT_TRUE(large.IsInline());
+
+		EXPECT_TRUE(small_moved.IsInline());
+		EXPECT_EQ(small_moved[0], "a");
+		EXPECT_FALSE(large_moved.IsInline());
+
+		for (int i = 0; i < 5; i++)
+			EXPECT_EQ(large_moved[i], large_copy[i]);
+
+		large_moved = std::move(small_moved);
+
+		EXPECT_TRUE(large_moved.IsInline());
+		EXPECT_EQ(large_moved.GetCount(), 1);
+		EXPECT_EQ(large_moved[0], "a");
+	}
+}
+
+#endif // T_INLINE_ARRAY_TEST_H
@@ -0,0 +1,137 @@
+#ifndef T_INTRUSIVE_LIST_TEST_H
+#define T_INTRUSIVE_LIST_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Containers/TIntrusiveList.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace TIntrusiveListTest
+{
+	struct Resource
+	{
+		int m_id;
+
+		IntrusiveListHook m_lru_hook;
+		IntrusiveListHook m_dirty_hook;
+
+		Resource(int id)
+			: m_id(id) {}
+	};
+
+	using LruList   = TIntrusiveList<Resource, &Resource::m_lru_hook>;
+	using DirtyList = TIntrusiveList<Resource, &Resource::m_dirty_hook>;
+
+	/**
+	 * Tests inserting and removing objects at both ends and in the middle.
+	 */
+	TEST(TIntrusiveListTest, InsertRemove)
+	{
+		Resource resources[5] = { 0, 1, 2, 3, 4 };
+
+		LruList list;
+
+		list.PushBack(resources[1]);
+		list.PushBack(resources[3]);
+		list.PushFront(resources[0]);
+		list.InsertBefore(resources[3], resources[2]);
+		list.InsertAfter(resources[3], resources[4]);
+
+		EXPECT_EQ(list.GetCount(), 5);
+		EXPECT_EQ(list.PeekFront().m_id, 0);
+		EXPECT_EQ(list.PeekBack().m_id, 4);
+		EXPECT_EQ(list.GetNext(resources[1])->m_id, 2);
+		EXPECT_EQ(list.GetPrev(resources[0]), nullptr);
+
+		int id = 0;
+
+		for (auto itr = list.GetStartItr(); itr != list.GetEndItr(); itr++)
+			EXPECT_EQ(itr->m_id, id++);
+
+		list.Remove(resources[2]);
+		list.PopFront();
+		list.PopBack();
+
+		EXPECT_EQ(list.GetCount(), 2);
+		EXPECT_FALSE(LruList::IsLinked(resources[2]));
+		EXPECT_EQ(list.PeekFront().m_id, 1);
+		EXPECT_EQ(list.PeekBack().m_id, 3);
+
+		list.Clear();
+
+		for (Resource& resource : resources)
+			EXPECT_FALSE(LruList::IsLinked(resource));
+	}
+
+	/**
+	 * Tests an object being in two lists at once through two hooks, and
+	 * moving objects to the front of a list like a least recently used list.
+	 */
+	TEST(TIntrusiveListTest, SeveralLists)
+	{
+		Resource resources[4] = { 0, 1, 2, 3 };
+
+		LruList lru;
+		DirtyList dirty;
+
+		for (Resource& resource : resources)
+			lru.PushBack(resource);
+
+		dirty.PushBack(resources[2]);
+		dirty.PushBack(resources[0]);
+
+		lru.MoveToFront(resources[2]);
+		lru.MoveToBack(resources[0]);
+
+		int expected_lru[] = { 2, 1, 3, 0 };
+		int index = 0;
+
+		for (auto itr = lru.GetStartConstItr(); itr != lru.GetEndConstItr(); itr++)
+			EXPECT_EQ((*itr).m_id, expected_lru[index++]);
+
+		EXPECT_EQ(dirty.GetCount(), 2);
+		EXPECT_EQ(dirty.PeekFront().m_id, 2);
+		EXPECT_EQ(dirty.PeekBack().m_id, 0);
+
+		dirty.Remove(resources[2]);
+
+		EXPECT_TRUE(LruList::IsLinked(resources[2]));
+		EXPECT_FALSE(DirtyList::IsLinked(resources[2]));
+	}
+
+	/**
+	 * Tests moving a list, which has to relink its front and back objects to
+	 * the new list.
+	 */
+	TEST(TIntrusiveListTest, Move)
+	{
+		Resource resources[3] = { 0, 1, 2 };
+
+		LruList list;
+
+		for (Resource& resource : resources)
+			list.PushBack(resource);
+
+		LruList moved = std::move(list);
+
+		EXPECT_TRUE(list.IsEmpty());
+		EXPECT_EQ(moved.GetCount(), 3);
+
+		int id = 0;
+
+		for (auto itr = moved.GetStartItr(); itr != moved.GetEndItr(); itr++)
+			EXPECT_EQ(itr->m_id, id++);
+
+		moved.PopFront();
+		moved.PopBack();
+
+		EXPECT_EQ(moved.PeekFront().m_id, 1);
+		EXPECT_EQ(moved.PeekBack().m_id, 1);
+
+		moved.Clear();
+	}
+}
+
+#endif // T_INTRUSIVE_LIST_TEST_H
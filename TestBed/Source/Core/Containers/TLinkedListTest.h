@@ -5,6 +5,8 @@
 
 #include "Core/Public/Containers/TLinkedList.h"
 
+#include "Core/Public/Memory/PoolAllocator.h"
+
 using namespace Forge::Containers;
 
 namespace LinkedListTest
@@ -77,6 +79,73 @@ namespace LinkedListTest
 		);
 	}
 
+	/**
+	 * Tests the allocator constructor of a linked list object.
+	 */
+	TEST(LinkedListTest, AllocatorConstructor)
+	{
+		Forge::Memory::PoolAllocator allocator(32, 32 * 16);
+
+		{
+			TLinkedList<int, Forge::Memory::InstanceAllocatorPolicy> ll(&allocator);
+
+			for (int i = 0; i < 10; i++)
+				ll.PushBack(i);
+
+			EXPECT_EQ(ll.GetCount(), 10);
+			EXPECT_EQ(allocator.GetNumOfAllocs(), 10);
+
+			int value = 0;
+
+			ll.ForEach([&value](int& element)
+				{
+					EXPECT_EQ(element, value++);
+				}
+			);
+		}
+
+		EXPECT_EQ(allocator.GetNumOfDeallocs(), 10);
+	}
+
+	/**
+	 * Tests a linked list allocating its nodes from a node pool, and that
+	 * nodes freed by removals are reused.
+	 */
+	TEST(LinkedListTest, NodePoolAllocator)
+	{
+		TLinkedList<int, Forge::Memory::NodePoolAllocatorPolicy> ll(Forge::Memory::NodePoolAllocatorPolicy(4));
+
+		for (int i = 0; i < 10; i++)
+			ll.PushBack(i);
+
+		EXPECT_EQ(ll.GetCount(), 10);
+		EXPECT_EQ(ll.GetByIndex(0), 0);
+		EXPECT_EQ(ll.GetByIndex(8), 8);
+
+		ll.RemoveAt(7);
+		ll.RemoveAt(2);
+		ll.InsertAt(2, 20);
+		ll.InsertAt(7, 70);
+
+		for (int i = 0; i < 10; i++)
+			EXPECT_EQ(ll.GetByIndex(i), i * (i == 2 || i == 7 ? 10 : 1));
+
+		TLinkedList<int, Forge::Memory::NodePoolAllocatorPolicy> copy = ll;
+		TLinkedList<int, Forge::Memory::NodePoolAllocatorPolicy> moved = std::move(ll);
+
+		EXPECT_EQ(ll.GetCount(), 0);
+		EXPECT_EQ(copy.GetAllocator().GetSlabCapacity(), 4);
+
+		for (int i = 0; i < 10; i++)
+			EXPECT_EQ(copy.GetByIndex(i), moved.GetByIndex(i));
+
+		Forge::Memory::NodePoolAllocatorPolicy pool(4);
+
+		pool.Deallocate(pool.Allocate(16, 8));
+
+		EXPECT_ANY_THROW(pool.Allocate(64, 8));
+	}
+
 	/**
 	 * Tests the move constructor of a linked list object. 
 	 */
@@ -0,0 +1,145 @@
+#ifndef T_OBJECT_POOL_TEST_H
+#define T_OBJECT_POOL_TEST_H
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Containers/TObjectPool.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace TObjectPoolTest
+{
+	/**
+	 * Tests that handles resolve to their objects and the objects stay
+	 * packed as they are created and destroyed.
+	 */
+	TEST(TObjectPoolTest, CreateDestroy)
+	{
+		TObjectPool<std::string> pool;
+
+		TObjectHandle<std::string> a = pool.Create("a");
+		TObjectHandle<std::string> b = pool.Create("b");
+		TObjectHandle<std::string> c = pool.Create("c");
+
+		EXPECT_FALSE(a.IsNull());
+		EXPECT_EQ(pool.GetCount(), 3);
+		EXPECT_EQ(*pool.Get(b), "b");
+
+		EXPECT_TRUE(pool.Destroy(a));
+		EXPECT_FALSE(pool.Destroy(a));
+
+		EXPECT_EQ(pool.GetCount(), 2);
+		EXPECT_EQ(*pool.Get(b), "b");
+		EXPECT_EQ(*pool.Get(c), "c");
+
+		std::string joined;
+
+		for (Size i = 0; i < pool.GetCount(); i++)
+		{
+			joined += pool.GetData()[i];
+
+			EXPECT_EQ(pool.Get(pool.GetHandle(i)), &pool.GetData()[i]);
+		}
+
+		EXPECT_EQ(joined.size(), 2);
+	}
+
+	/**
+	 * Tests that handles to destroyed objects are detected, including after
+	 * their slot is reused.
+	 */
+	TEST(TObjectPoolTest, StaleHandles)
+	{
+		TObjectPool<int> pool;
+
+		TObjectHandle<int> a = pool.Create(1);
+
+		pool.Destroy(a);
+
+		TObjectHandle<int> b = pool.Create(2);
+
+		EXPECT_EQ(a.GetIndex(), b.GetIndex());
+		EXPECT_NE(a, b);
+
+		EXPECT_FALSE(pool.IsValid(a));
+		EXPECT_EQ(pool.Get(a), nullptr);
+		EXPECT_EQ(*pool.Get(b), 2);
+
+		EXPECT_FALSE(pool.IsValid(TObjectHandle<int>()));
+		EXPECT_FALSE(pool.IsValid(TObjectHandle<int>(7, 1)));
+
+		/// A handle read back from its serialized value still resolves.
+		TObjectHandle<int> loaded(b.m_value);
+
+		EXPECT_EQ(*pool.Get(loaded), 2);
+
+		pool.Clear();
+
+		EXPECT_EQ(pool.GetCount(), 0);
+		EXPECT_FALSE(pool.IsValid(b));
+	}
+
+	/**
+	 * Tests 32-bit handles and the wrap around of their generation.
+	 */
+	TEST(TObjectPoolTest, SmallHandles)
+	{
+		EXPECT_EQ(sizeof(TObjectHandle<int, U32>), 4);
+
+		TObjectPool<int, U32> pool;
+
+		TObjectHandle<int, U32> first = pool.Create(0);
+		TObjectHandle<int, U32> handle = first;
+
+		for (int i = 0; i < 5000; i++)
+		{
+			pool.Destroy(handle);
+			handle = pool.Create(i);
+
+			EXPECT_FALSE(handle.IsNull());
+			EXPECT_EQ(handle.GetIndex(), 0);
+		}
+
+		EXPECT_EQ(*pool.Get(handle), 4999);
+	}
+	/**
+	 * Tests that an object whose constructor throws leaves the pool and its
+	 * free slots unchanged.
+	 */
+	TEST(TObjectPoolTest, ThrowingCreate)
+	{
+		struct Element
+		{
+			int m_value;
+
+			Element(int value) : m_value(value) { if (value < 0) throw value; }
+		};
+
+		TObjectPool<Element> pool;
+
+		TObjectHandle<Element> a = pool.Create(1);
+		TObjectHandle<Element> b = pool.Create(2);
+
+		EXPECT_ANY_THROW(pool.Create(-1));
+		EXPECT_EQ(pool.GetCount(), 2);
+
+		pool.Destroy(a);
+
+		EXPECT_ANY_THROW(pool.Create(-1));
+		EXPECT_EQ(pool.GetCount(), 1);
+
+		TObjectHandle<Element> c = pool.Create(3);
+		TObjectHandle<Element> d = pool.Create(4);
+
+		EXPECT_EQ(c.GetIndex(), a.GetIndex());
+		EXPECT_EQ(d.GetIndex(), 2);
+		EXPECT_EQ(pool.Get(b)->m_value, 2);
+		EXPECT_EQ(pool.Get(c)->m_value, 3);
+		EXPECT_EQ(pool.Get(d)->m_value, 4);
+	}
+}
+
+#endif // T_OBJECT_POOL_TEST_H
@@ -0,0 +1,198 @@
+#ifndef T_SOA_ARRAY_TEST_H
+#define T_SOA_ARRAY_TEST_H
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Containers/TSoAArray.h"
+
+using namespace Forge;
+using namespace Forge::Containers;
+
+namespace TSoAArrayTest
+{
+	/**
+	 * Tests constructing, accessing and comparing tuples.
+	 */
+	TEST(TSoAArrayTest, Tuple)
+	{
+		TTuple<int, std::string, float> a(1, "a", 2.0f);
+		TTuple<int, std::string, float> b = a;
+		auto c = MakeTuple(1, std::string("a"), 2.0f);
+
+		EXPECT_EQ(a.Get<0>(), 1);
+		EXPECT_EQ(a.Get<1>(), "a");
+		EXPECT_TRUE(a == b);
+		EXPECT_TRUE(a == c);
+
+		b.Get<1>() = "b";
+
+		EXPECT_TRUE(a != b);
+
+		int sum = 0;
+		TTuple<int, int, int> d(1, 2, 3);
+
+		d.ForEach([&sum](int value) { sum += value; });
+
+		EXPECT_EQ(sum, 6);
+		EXPECT_EQ((TTuple<int, int, int>::COUNT), 3);
+	}
+
+	/**
+	 * Tests that pushing, removing and swapping records keeps the columns in
+	 * lockstep.
+	 */
+	TEST(TSoAArrayTest, Lockstep)
+	{
+		TSoAArray<int, float, std::string> a;
+
+		for (int i = 0; i < 10; i++)
+			a.PushBack(i, i * 0.5f, std::to_string(i));
+
+		EXPECT_EQ(a.GetCount(), 10);
+
+		a.RemoveAt(2);
+
+		EXPECT_EQ(a.Get<0>(2), 3);
+		EXPECT_EQ(a.Get<2>(2), "3");
+		EXPECT_EQ(a.GetCount(), 9);
+
+		a.RemoveAtSwap(0);
+
+		EXPECT_EQ(a.Get<0>(0), 9);
+		EXPECT_EQ(a.Get<1>(0), 4.5f);
+		EXPECT_EQ(a.Get<2>(0), "9");
+
+		a.Swap(0, 1);
+
+		EXPECT_EQ(a.Get<0>(0), 1);
+		EXPECT_EQ(a.Get<2>(1), "9");
+
+		a.PopBack();
+		a.PushBack(MakeTuple(42, 1.0f, std::string("42")));
+
+		EXPECT_EQ(a.GetCount(), 8);
+		EXPECT_EQ(a.Get<2>(7), "42");
+	}
+
+	/**
+	 * Tests that each column is contiguous and aligned, and that the
+	 * iterators and the accessor yield references into the columns.
+	 */
+	TEST(TSoAArrayTest, Columns)
+	{
+		TSoAArray<float, char, double> a;
+
+		for (int i = 0; i < 100; i++)
+			a.PushBack(float(i), char(i), double(i));
+
+		auto xs = a.GetColumn<0>();
+		auto cs = a.GetColumn<1>();
+		auto ds = a.GetColumn<2>();
+
+		EXPECT_EQ(xs.GetCount(), 100);
+		EXPECT_EQ(reinterpret_cast<U64>(xs.GetPointer()) % a.COLUMN_ALIGNMENT, 0);
+		EXPECT_EQ(reinterpret_cast<U64>(cs.GetPointer()) % a.COLUMN_ALIGNMENT, 0);
+		EXPECT_EQ(reinterpret_cast<U64>(ds.GetPointer()) % a.COLUMN_ALIGNMENT, 0);
+
+		for (Size i = 0; i < xs.GetCount(); i++)
+			xs[i] *= 2.0f;
+
+		for (auto itr = a.GetStartItr(); itr != a.GetEndItr(); itr++)
+		{
+			auto record = *itr;
+
+			EXPECT_EQ(record.Get<0>(), float(itr.GetIndex() * 2));
+			EXPECT_EQ(record.Get<2>(), double(itr.GetIndex()));
+
+			record.Get<2>() = 0.0;
+		}
+
+		EXPECT_EQ(a[50].Get<2>(), 0.0);
+		EXPECT_EQ(ds[99], 0.0);
+	}
+
+	/**
+	 * Tests copying and moving an array of records with a non trivial
+	 * lifetime.
+	 */
+	TEST(TSoAArrayTest, CopyMove)
+	{
+		TSoAArray<std::string, int> a;
+
+		for (int i = 0; i < 20; i++)
+			a.PushBack(std::to_string(i), i);
+
+		TSoAArray<std::string, int> b = a;
+		TSoAArray<std::string, int> c = std::move(a);
+
+		EXPECT_EQ(a.GetCount(), 0);
+		EXPECT_EQ(b.GetCount(), 20);
+		EXPECT_EQ(c.GetCount(), 20);
+
+		for (auto itr = b.GetStartConstItr(); itr != b.GetEndConstItr(); itr++)
+			EXPECT_EQ((*itr).Get<0>(), c[itr.GetIndex()].Get<0>());
+
+		b = std::move(c);
+		c = b;
+		c.Clear();
+
+		EXPECT_TRUE(c.IsEmpty());
+		EXPECT_EQ(b.Get<0>(19), "19");
+	}
+	/**
+	 * Tests that records convert to and from tuples of values, and that
+	 * assigning a record writes through to the columns.
+	 */
+	TEST(TSoAArrayTest, Records)
+	{
+		TSoAArray<int, float, std::string> a;
+
+		a.PushBack(1, 1.0f, std::string("1"));
+		a.PushBack(2, 2.0f, std::string("2"));
+
+		TTuple<int, float, std::string> record = a[0];
+
+		EXPECT_EQ(record.Get<2>(), "1");
+
+		a[0] = a[1];
+
+		EXPECT_EQ(a.Get<0>(0), 2);
+		EXPECT_EQ(a.Get<2>(0), "2");
+		EXPECT_EQ(a.Get<2>(1), "2");
+
+		record.Get<0>() = 3;
+
+		*a.GetStartItr() = record;
+
+		EXPECT_EQ(a.Get<0>(0), 3);
+		EXPECT_EQ(a.Get<2>(0), "1");
+
+		a.PushBack(a[0]);
+
+		EXPECT_EQ(a.GetCount(), 3);
+		EXPECT_EQ(a.Get<0>(2), 3);
+		EXPECT_EQ(a.Get<2>(2), "1");
+
+		const TSoAArray<int, float, std::string>& c = a;
+
+		TTuple<int, float, std::string> copy = c[1];
+
+		EXPECT_EQ(copy.Get<0>(), 2);
+
+		TSoAArray<int> b;
+
+		b.PushBack(7);
+
+		TTuple<int> single = b[0];
+
+		EXPECT_EQ(single.Get<0>(), 7);
+
+		b[0] = TTuple<int>(8);
+
+		EXPECT_EQ(b.Get<0>(0), 8);
+	}
+}
+
+#endif // T_SOA_ARRAY_TEST_H
@@ -0,0 +1,130 @@
+#ifndef T_STATIC_QUEUE_TEST_H
+#define T_STATIC_QUEUE_TEST_H
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Containers/TStaticQueue.h"
+
+using namespace Forge::Containers;
+
+namespace StaticQueueTest
+{
+	/**
+	 * Tests the initializer list constructor of a static queue object.
+	 */
+	TEST(StaticQueueTest, InitializerListConstructor)
+	{
+		TStaticQueue<int, 8> queue = { 1, 2, 3, 4, 5 };
+
+		EXPECT_EQ(queue.GetCount(), 5);
+		EXPECT_EQ(queue.Peek(), 1);
+
+		int value = 1;
+
+		queue.ForEach([&value](int& element)
+			{
+				EXPECT_EQ(element, value++);
+			}
+		);
+	}
+
+	/**
+	 * Tests that elements are only inserted at the front and removed at the
+	 * front, in first-in first-out order.
+	 */
+	TEST(StaticQueueTest, PushFront)
+	{
+		TStaticQueue<int, 4> queue;
+
+		queue.PushFront(1);
+		queue.Push(2);
+
+		EXPECT_ANY_THROW(queue.PushBack(3));
+		EXPECT_ANY_THROW(queue.PopBack());
+		EXPECT_EQ(queue.GetCount(), 2);
+
+		EXPECT_EQ(queue.Peek(), 1);
+
+		queue.PopFront();
+
+		EXPECT_EQ(queue.Peek(), 2);
+
+		queue.PushFront(3);
+		queue.PushFront(4);
+		queue.PushFront(5);
+
+		EXPECT_ANY_THROW(queue.PushFront(6));
+	}
+
+	/**
+	 * Tests that pushing and popping keeps first-in first-out order while the
+	 * elements wrap around the end of the buffer.
+	 */
+	TEST(StaticQueueTest, WrapAround)
+	{
+		TStaticQueue<int, 4> queue;
+
+		int next_push = 0;
+		int next_pop = 0;
+
+		for (int i = 0; i < 100; i++)
+		{
+			while (!queue.IsFull())
+				queue.Push(next_push++);
+
+			queue.Pop();
+			EXPECT_EQ(queue.Peek(), ++next_pop);
+
+			queue.Pop();
+			next_pop++;
+		}
+
+		int value = next_pop;
+
+		for (auto itr = queue.GetStartItr(); itr != queue.GetEndItr(); itr++)
+			EXPECT_EQ(*itr, value++);
+
+		EXPECT_EQ(value, next_push);
+		EXPECT_EQ(queue.GetByIndex(1), next_pop + 1);
+		EXPECT_EQ(queue.LastIndexOf(next_push - 1), queue.GetCount() - 1);
+
+		int* array_ptr = queue.ToArray();
+
+		for (int i = 0; i < queue.GetCount(); i++)
+			EXPECT_EQ(array_ptr[i], next_pop + i);
+
+		free(array_ptr);
+	}
+
+	/**
+	 * Tests that only the elements in the queue are constructed and destroyed.
+	 */
+	TEST(StaticQueueTest, ElementLifetime)
+	{
+		TStaticQueue<std::string, 3> queue;
+
+		queue.Push("a");
+		queue.Push("b");
+		queue.Pop();
+		queue.Push("c");
+		queue.Push("d");
+
+		TStaticQueue<std::string, 3> copy = queue;
+
+		EXPECT_EQ(copy.GetCount(), 3);
+		EXPECT_EQ(copy.Peek(), "b");
+
+		TStaticQueue<std::string, 3> moved = std::move(queue);
+
+		EXPECT_EQ(queue.GetCount(), 0);
+		EXPECT_EQ(moved.GetByIndex(2), "d");
+
+		moved.Clear();
+
+		EXPECT_EQ(moved.IsEmpty(), true);
+	}
+}
+
+#endif // T_STATIC_QUEUE_TEST_H
@@ -0,0 +1,329 @@
+#ifndef EVENT_BUS_TEST_H
+#define EVENT_BUS_TEST_H
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Event/EventBus.h"
+
+using namespace Forge;
+using namespace Forge::Event;
+
+namespace EventBusTest
+{
+	struct KeyEvent
+	{
+		FORGE_DECLARE_EVENT(KeyEvent)
+
+		int m_key;
+	};
+
+	struct ResizeEvent
+	{
+		FORGE_DECLARE_EVENT(ResizeEvent)
+
+		int m_window;
+		int m_width;
+
+		Bool Coalesce(const ResizeEvent& next_event)
+		{
+			if (m_window != next_event.m_window)
+				return false;
+
+			m_width = next_event.m_width;
+
+			return true;
+		}
+	};
+
+	struct MoveEvent
+	{
+		FORGE_DECLARE_EVENT(MoveEvent)
+
+		int m_delta;
+
+		Bool Coalesce(const MoveEvent& next_event)
+		{
+			m_delta += next_event.m_delta;
+
+			return true;
+		}
+	};
+
+	namespace Editor
+	{
+		/// Shares its name with the event above.
+		struct KeyEvent
+		{
+			FORGE_DECLARE_EVENT(KeyEvent)
+
+			int m_key;
+		};
+	}
+
+	/**
+	 * Tests that events are delivered to every subscriber on dispatch only.
+	 */
+	TEST(EventBusTest, Dispatch)
+	{
+		EventBus bus;
+
+		std::vector<int> first_keys, second_keys;
+
+		bus.Subscribe<KeyEvent>([&first_keys](const KeyEvent& event) { first_keys.push_back(event.m_key); });
+		bus.Subscribe<KeyEvent>([&second_keys](const KeyEvent& event) { second_keys.push_back(event.m_key); });
+
+		EXPECT_EQ(bus.Publish(KeyEvent{ 1 }), true);
+		EXPECT_EQ(bus.Publish(KeyEvent{ 2 }), true);
+		EXPECT_EQ(bus.Publish(ResizeEvent{ 0, 100 }), true);
+
+		EXPECT_EQ(first_keys.size(), 0);
+
+		EXPECT_EQ(bus.Dispatch(), 2);
+
+		EXPECT_EQ(first_keys, std::vector<int>({ 1, 2 }));
+		EXPECT_EQ(second_keys, std::vector<int>({ 1, 2 }));
+
+		EXPECT_EQ(bus.Dispatch(), 0);
+	}
+
+	/**
+	 * Tests that events of a type are merged within a dispatch and keep the
+	 * position of the first one.
+	 */
+	TEST(EventBusTest, Coalesce)
+	{
+		EventBus bus;
+
+		std::vector<int> order;
+		std::vector<ResizeEvent> resizes;
+
+		int delta = 0;
+
+		bus.Subscribe<KeyEvent>([&order](const KeyEvent& event) { order.push_back(event.m_key); });
+		bus.Subscribe<MoveEvent>([&order, &delta](const MoveEvent& event) { order.push_back(-1); delta += event.m_delta; });
+		bus.Subscribe<ResizeEvent>([&resizes](const ResizeEvent& event) { resizes.push_back(event); });
+
+		bus.Publish(MoveEvent{ 1 });
+		bus.Publish(KeyEvent{ 7 });
+		bus.Publish(MoveEvent{ 2 });
+		bus.Publish(MoveEvent{ 3 });
+
+		bus.Publish(ResizeEvent{ 0, 100 });
+		bus.Publish(ResizeEvent{ 0, 200 });
+		bus.Publish(ResizeEvent{ 1, 300 });
+		bus.Publish(ResizeEvent{ 1, 400 });
+
+		EXPECT_EQ(bus.Dispatch(), 4);
+
+		EXPECT_EQ(order, std::vector<int>({ -1, 7 }));
+		EXPECT_EQ(delta, 6);
+
+		EXPECT_EQ(resizes.size(), 2);
+		EXPECT_EQ(resizes[0].m_width, 200);
+		EXPECT_EQ(resizes[1].m_width, 400);
+
+		bus.Publish(MoveEvent{ 4 });
+
+		EXPECT_EQ(bus.Dispatch(), 1);
+		EXPECT_EQ(delta, 10);
+	}
+
+	/**
+	 * Tests subscribing and unsubscribing, including from within a callback.
+	 */
+	TEST(EventBusTest, Unsubscribe)
+	{
+		EventBus bus;
+
+		int num_of_first = 0, num_of_second = 0, num_of_late = 0;
+
+		EventSubscription first = bus.Subscribe<KeyEvent>([&num_of_first](const KeyEvent&) { num_of_first++; });
+		EventSubscription second;
+		EventSubscription late;
+
+		second = bus.Subscribe<KeyEvent>([&](const KeyEvent&)
+			{
+				num_of_second++;
+
+				/// Removes itself and adds a subscriber that only receives
+				/// the following events.
+				bus.Unsubscribe(second);
+
+				late = bus.Subscribe<KeyEvent>([&num_of_late](const KeyEvent&) { num_of_late++; });
+			}
+		);
+
+		bus.Publish(KeyEvent{ 0 });
+		bus.Publish(KeyEvent{ 0 });
+		bus.Dispatch();
+
+		EXPECT_EQ(num_of_first, 2);
+		EXPECT_EQ(num_of_second, 1);
+		EXPECT_EQ(num_of_late, 1);
+
+		bus.Unsubscribe(first);
+		bus.Unsubscribe(first);
+		bus.Unsubscribe(EventSubscription());
+
+		bus.Publish(KeyEvent{ 0 });
+		bus.Dispatch();
+
+		EXPECT_EQ(num_of_first, 2);
+		EXPECT_EQ(num_of_late, 2);
+	}
+
+	/**
+	 * Tests that events published by a callback are delivered by the next
+	 * dispatch, and that dispatching from a callback is rejected.
+	 */
+	TEST(EventBusTest, PublishFromCallback)
+	{
+		EventBus bus;
+
+		std::vector<int> keys;
+		Bool has_thrown = false;
+
+		bus.Subscribe<KeyEvent>([&](const KeyEvent& event)
+			{
+				keys.push_back(event.m_key);
+
+				if (event.m_key < 3)
+					bus.Publish(KeyEvent{ event.m_key + 1 });
+
+				try { bus.Dispatch(); } catch (...) { has_thrown = true; }
+			}
+		);
+
+		bus.Publish(KeyEvent{ 1 });
+
+		EXPECT_EQ(bus.Dispatch(), 1);
+		EXPECT_EQ(bus.Dispatch(), 1);
+		EXPECT_EQ(bus.Dispatch(), 1);
+		EXPECT_EQ(bus.Dispatch(), 0);
+
+		EXPECT_EQ(keys, std::vector<int>({ 1, 2, 3 }));
+		EXPECT_EQ(has_thrown, true);
+	}
+
+	/**
+	 * Tests that event types of the same name in different namespaces are
+	 * told apart.
+	 */
+	TEST(EventBusTest, QualifiedEventId)
+	{
+		EventBus bus;
+
+		EXPECT_NE(KeyEvent::GetEventId(), Editor::KeyEvent::GetEventId());
+		EXPECT_STREQ(KeyEvent::GetEventId().GetString(), "EventBusTest::KeyEvent");
+
+		int game_keys = 0, editor_keys = 0;
+
+		bus.Subscribe<KeyEvent>([&game_keys](const KeyEvent&) { game_keys++; });
+		bus.Subscribe<Editor::KeyEvent>([&editor_keys](const Editor::KeyEvent&) { editor_keys++; });
+
+		bus.Publish(KeyEvent{ 1 });
+		bus.Publish(Editor::KeyEvent{ 2 });
+		bus.Publish(Editor::KeyEvent{ 3 });
+
+		EXPECT_EQ(bus.Dispatch(), 3);
+		EXPECT_EQ(game_keys, 1);
+		EXPECT_EQ(editor_keys, 2);
+	}
+
+	/**
+	 * Tests that a throwing callback drops the rest of the batch and leaves
+	 * the bus usable.
+	 */
+	TEST(EventBusTest, ThrowingCallback)
+	{
+		EventBus bus;
+
+		std::vector<int> keys;
+
+		EventSubscription subscription = bus.Subscribe<KeyEvent>([&](const KeyEvent& event)
+			{
+				keys.push_back(event.m_key);
+
+				if (event.m_key == 2)
+					throw event.m_key;
+			}
+		);
+
+		bus.Publish(KeyEvent{ 1 });
+		bus.Publish(KeyEvent{ 2 });
+		bus.Publish(KeyEvent{ 3 });
+
+		EXPECT_ANY_THROW(bus.Dispatch());
+		EXPECT_EQ(keys, std::vector<int>({ 1, 2 }));
+
+		bus.Unsubscribe(subscription);
+		bus.Subscribe<KeyEvent>([&keys](const KeyEvent& event) { keys.push_back(-event.m_key); });
+
+		bus.Publish(KeyEvent{ 4 });
+
+		EXPECT_EQ(bus.Dispatch(), 1);
+		EXPECT_EQ(keys, std::vector<int>({ 1, 2, -4 }));
+	}
+
+	/**
+	 * Tests that a full queue drops events and counts them.
+	 */
+	TEST(EventBusTest, DroppedEvents)
+	{
+		EventBus bus(4);
+
+		int num_of_keys = 0;
+
+		bus.Subscribe<KeyEvent>([&num_of_keys](const KeyEvent&) { num_of_keys++; });
+
+		for (int i = 0; i < 6; i++)
+			bus.Publish(KeyEvent{ i });
+
+		EXPECT_EQ(bus.GetNumOfDroppedEvents(), 2);
+		EXPECT_EQ(bus.Dispatch(), 4);
+		EXPECT_EQ(num_of_keys, 4);
+	}
+
+	/**
+	 * Tests publishing from several threads while the owning thread
+	 * dispatches.
+	 */
+	TEST(EventBusTest, Concurrency)
+	{
+		constexpr int NUM_OF_THREADS = 4;
+		constexpr int NUM_OF_EVENTS = 10000;
+
+		EventBus bus(256);
+
+		long long sum = 0;
+		int num_of_keys = 0;
+
+		bus.Subscribe<KeyEvent>([&](const KeyEvent& event) { sum += event.m_key; num_of_keys++; });
+
+		std::vector<std::thread> threads;
+
+		for (int t = 0; t < NUM_OF_THREADS; t++)
+			threads.emplace_back([&bus]()
+				{
+					for (int i = 1; i <= NUM_OF_EVENTS; i++)
+					{
+						while (!bus.Publish(KeyEvent{ i }))
+							std::this_thread::yield();
+					}
+				}
+			);
+
+		while (num_of_keys < NUM_OF_THREADS * NUM_OF_EVENTS)
+			bus.Dispatch();
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		EXPECT_EQ(sum, NUM_OF_THREADS * (static_cast<long long>(NUM_OF_EVENTS) * (NUM_OF_EVENTS + 1) / 2));
+	}
+}
+
+#endif // EVENT_BUS_TEST_H
@@ -0,0 +1,131 @@
+#ifndef CONCURRENT_POOL_ALLOCATOR_TEST_H
+#define CONCURRENT_POOL_ALLOCATOR_TEST_H
+
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/ConcurrentPoolAllocator.h"
+
+#include "Source/Core/Memory/ThreadCacheTestUtilities.h"
+
+using namespace Forge;
+using namespace Forge::Memory;
+
+namespace ConcurrentPoolAllocatorTest
+{
+	/**
+	 * Tests that every chunk of the pool is handed out exactly once, that an
+	 * exhausted pool throws, and that freed chunks can be allocated again.
+	 */
+	TEST(ConcurrentPoolAllocatorTest, Exhaustion)
+	{
+		for (Size cache_size : { 0, 16 })
+		{
+			ConcurrentPoolAllocator allocator(32, 32 * 100 + 8, cache_size);
+
+			std::set<VoidPtr> chunks;
+
+			for (U32 i = 0; i < 100; i++)
+				EXPECT_TRUE(chunks.insert(allocator.Allocate(32, 8)).second);
+
+			EXPECT_ANY_THROW(allocator.Allocate(32, 8));
+			EXPECT_ANY_THROW(allocator.Allocate(33, 8));
+
+			for (VoidPtr address : chunks)
+				allocator.Deallocate(address);
+
+			EXPECT_EQ(allocator.GetUsedMemory(), 0);
+
+			allocator.FlushThreadCache();
+
+			for (U32 i = 0; i < 100; i++)
+				EXPECT_EQ(chunks.count(allocator.Allocate(32, 8)), 1);
+		}
+	}
+
+	/**
+	 * Tests that chunks are aligned to the alignment the pool was created
+	 * with, and that stricter alignments are rejected.
+	 */
+	TEST(ConcurrentPoolAllocatorTest, Alignment)
+	{
+		for (U32 alignment = 4; alignment <= 128; alignment *= 2)
+		{
+			ConcurrentPoolAllocator allocator(24, 1 << 14, 4, static_cast<Byte>(alignment));
+
+			EXPECT_EQ(allocator.GetChunkAlignment(), alignment);
+			EXPECT_EQ(allocator.GetChunkSize() % alignment, 0);
+			EXPECT_GE(allocator.GetChunkSize(), 24);
+
+			std::vector<VoidPtr> chunks;
+
+			for (U32 i = 0; i < 32; i++)
+			{
+				chunks.push_back(allocator.Allocate(24, static_cast<Byte>(alignment)));
+
+				EXPECT_EQ(reinterpret_cast<U64>(chunks.back()) % alignment, 0);
+			}
+
+			if (alignment < 128)
+				EXPECT_ANY_THROW(allocator.Allocate(24, static_cast<Byte>(alignment * 2)));
+
+			for (VoidPtr address : chunks)
+				allocator.Deallocate(address);
+		}
+
+		EXPECT_ANY_THROW(ConcurrentPoolAllocator(24, 1 << 14, 4, 24));
+	}
+
+	/**
+	 * Tests that chunks freed on another thread, which keeps them in its own
+	 * cache, all return to the pool once that thread flushes.
+	 */
+	TEST(ConcurrentPoolAllocatorTest, CrossThreadHandoff)
+	{
+		ConcurrentPoolAllocator allocator(16, 16 * 1000 + 8, 32);
+
+		ThreadCacheTestUtilities::HandOffChunks(allocator, 16, 1000, true);
+
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+
+		std::set<VoidPtr> reused;
+
+		for (U32 i = 0; i < 1000; i++)
+			EXPECT_TRUE(reused.insert(allocator.Allocate(16, 8)).second);
+
+		EXPECT_ANY_THROW(allocator.Allocate(16, 8));
+	}
+
+	/**
+	 * Tests that pools shared by several threads still hand out exactly
+	 * their fixed number of slots afterwards.
+	 */
+	TEST(ConcurrentPoolAllocatorTest, ManyAllocators)
+	{
+		std::vector<ConcurrentPoolAllocator*> allocators;
+
+		for (Size i = 0; i < 20; i++)
+			allocators.push_back(new ConcurrentPoolAllocator(16, 16 * 64 + 8, 8));
+
+		ThreadCacheTestUtilities::ShareAllocators(allocators, 16, 4, 200);
+
+		for (ConcurrentPoolAllocator* allocator : allocators)
+		{
+			EXPECT_EQ(allocator->GetNumOfAllocs(), 200 * 4);
+			EXPECT_EQ(allocator->GetUsedMemory(), 0);
+
+			std::set<VoidPtr> chunks;
+
+			for (U32 i = 0; i < 64; i++)
+				EXPECT_TRUE(chunks.insert(allocator->Allocate(16, 8)).second);
+
+			EXPECT_ANY_THROW(allocator->Allocate(16, 8));
+
+			delete allocator;
+		}
+	}
+}
+
+#endif // CONCURRENT_POOL_ALLOCATOR_TEST_H
@@ -0,0 +1,112 @@
+#ifndef LINEAR_ALLOCATOR_TEST_H
+#define LINEAR_ALLOCATOR_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/LinearAllocator.h"
+#include "Platform/Public/Platform.h"
+
+using namespace Forge;
+using namespace Forge::Memory;
+
+namespace LinearAllocatorTest
+{
+	/**
+	 * Tests that allocations honour their alignment, and that resetting
+	 * rewinds the pool and clears it.
+	 */
+	TEST(LinearAllocatorTest, RoundTrip)
+	{
+		LinearAllocator allocator(1 << 16);
+
+		BytePtr first = nullptr;
+
+		for (U32 alignment = 1; alignment <= 128; alignment *= 2)
+		{
+			BytePtr address = reinterpret_cast<BytePtr>(allocator.Allocate(3, static_cast<Byte>(alignment)));
+
+			EXPECT_EQ(reinterpret_cast<U64>(address) % alignment, 0);
+
+			address[0] = address[1] = address[2] = 0xFF;
+
+			if (!first)
+				first = address;
+		}
+
+		EXPECT_EQ(allocator.GetNumOfAllocs(), 8);
+		EXPECT_GE(allocator.GetUsedMemory(), 8 * 3);
+
+		allocator.Reset();
+
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+		EXPECT_EQ(allocator.Allocate(3, 1), first);
+		EXPECT_EQ(first[0], 0);
+	}
+
+	/**
+	 * Tests that a growable pool commits pages only as allocations reach
+	 * them, and decommits everything beyond the retained size on reset.
+	 */
+	TEST(LinearAllocatorTest, Growable)
+	{
+		Platform::AbstractPlatform* platform = &Platform::Platform::GetInstance();
+
+		Size retained_size = 256 * 1024;
+
+		LinearAllocator allocator(platform, 16 << 20, retained_size);
+
+		EXPECT_EQ(allocator.GetCommittedSize(), 0);
+
+		BytePtr first = reinterpret_cast<BytePtr>(allocator.Allocate(100, 16));
+
+		EXPECT_GE(allocator.GetCommittedSize(), 100);
+		EXPECT_LT(allocator.GetCommittedSize(), 1 << 20);
+
+		first[0] = 0xFF;
+
+		for (U32 i = 0; i < 64; i++)
+		{
+			BytePtr address = reinterpret_cast<BytePtr>(allocator.Allocate(64 * 1024, 16));
+
+			address[0] = address[64 * 1024 - 1] = static_cast<Byte>(i);
+
+			EXPECT_GE(allocator.GetCommittedSize(), allocator.GetUsedMemory());
+		}
+
+		EXPECT_LT(allocator.GetCommittedSize(), 8 << 20);
+
+		allocator.Reset();
+
+		EXPECT_EQ(allocator.GetCommittedSize(), retained_size);
+		EXPECT_EQ(allocator.Allocate(100, 16), first);
+		EXPECT_EQ(first[0], 0);
+	}
+
+	/**
+	 * Tests that a growable pool throws once the reserved range is used up,
+	 * and keeps working after a reset.
+	 */
+	TEST(LinearAllocatorTest, Exhaustion)
+	{
+		Platform::AbstractPlatform* platform = &Platform::Platform::GetInstance();
+
+		LinearAllocator allocator(platform, 1 << 20);
+
+		EXPECT_ANY_THROW(
+		{
+			for (;;)
+				allocator.Allocate(1000, 8);
+		});
+
+		EXPECT_LE(allocator.GetUsedMemory(), allocator.GetTotalSize());
+		EXPECT_EQ(allocator.GetCommittedSize(), allocator.GetTotalSize());
+
+		allocator.Reset();
+
+		EXPECT_EQ(allocator.GetCommittedSize(), 0);
+
+		allocator.Allocate(1000, 8);
+	}
+}
+
+#endif // LINEAR_ALLOCATOR_TEST_H
@@ -0,0 +1,98 @@
+#ifndef MEMORY_UTILITIES_TEST_H
+#define MEMORY_UTILITIES_TEST_H
+
+#include <thread>
+#include <vector>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/MemoryUtilities.h"
+
+using namespace Forge;
+using namespace Forge::Memory;
+
+namespace MemoryUtilitiesTest
+{
+	/**
+	 * Tests every routine set supported by the processor against the C
+	 * library, over every size up to a few vector widths and every
+	 * misalignment of the source and destination.
+	 */
+	TEST(MemoryUtilitiesTest, RoutineSets)
+	{
+		Byte src[512 + 64];
+		Byte dst[512 + 64];
+		Byte expected[512 + 64];
+
+		for (Size i = 0; i < sizeof(src); i++)
+			src[i] = static_cast<Byte>(i * 7 + 3);
+
+		for (Byte set = 0; set <= static_cast<Byte>(DetectMemoryRoutineSet()); set++)
+		{
+			MemoryRoutineTable table = GetMemoryRoutineTable(static_cast<MemoryRoutineSet>(set));
+
+			for (Size bytes = 0; bytes <= 512; bytes += bytes < 80 ? 1 : 29)
+			{
+				for (Size offset = 0; offset < 64; offset += 13)
+				{
+					memset(dst, 0xCD, sizeof(dst));
+					memset(expected, 0xCD, sizeof(expected));
+
+					table.m_copy(dst + offset, src + (63 - offset), bytes);
+					memcpy(expected + offset, src + (63 - offset), bytes);
+
+					EXPECT_EQ(memcmp(dst, expected, sizeof(dst)), 0) << "copy set " << U32(set) << " bytes " << bytes;
+					EXPECT_TRUE(table.m_compare(dst + offset, expected + offset, bytes));
+
+					if (bytes)
+					{
+						dst[offset + bytes - 1] ^= 1;
+
+						EXPECT_FALSE(table.m_compare(dst + offset, expected + offset, bytes)) << "compare set " << U32(set) << " bytes " << bytes;
+					}
+
+					table.m_set(dst + offset, 0x5A, bytes);
+					memset(expected + offset, 0x5A, bytes);
+
+					EXPECT_EQ(memcmp(dst, expected, sizeof(dst)), 0) << "set set " << U32(set) << " bytes " << bytes;
+				}
+			}
+		}
+	}
+
+	/**
+	 * Tests that the detected routine set is the installed one and that
+	 * threads calling the routines concurrently see a consistent table.
+	 */
+	TEST(MemoryUtilitiesTest, Dispatch)
+	{
+		EXPECT_EQ(GetActiveMemoryRoutineSet(), DetectMemoryRoutineSet());
+
+		std::vector<std::thread> threads;
+
+		for (U32 i = 0; i < 4; i++)
+		{
+			threads.emplace_back([]()
+			{
+				Byte a[256];
+				Byte b[256];
+
+				for (U32 j = 0; j < 1000; j++)
+				{
+					MemorySet(a, static_cast<Byte>(j), sizeof(a));
+					MemoryCopy(b, a, sizeof(a));
+
+					EXPECT_TRUE(MemoryCompare(a, b, sizeof(a)));
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		EXPECT_EQ(GetActiveMemoryRoutineSet(), DetectMemoryRoutineSet());
+	}
+}
+
+#endif // MEMORY_UTILITIES_TEST_H
@@ -0,0 +1,160 @@
+#ifndef MULTI_FRAME_ALLOCATOR_TEST_H
+#define MULTI_FRAME_ALLOCATOR_TEST_H
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/MultiFrameAllocator.h"
+#include "Platform/Public/Platform.h"
+
+using namespace Forge;
+using namespace Forge::Memory;
+
+namespace MultiFrameAllocatorTest
+{
+	/**
+	 * Tests that memory of a frame stays intact while later frames are in
+	 * flight, and that its slot is only reused once the frame is retired.
+	 */
+	TEST(MultiFrameAllocatorTest, Ring)
+	{
+		MultiFrameAllocator allocator(4096, 3);
+
+		EXPECT_ANY_THROW(allocator.Allocate(16, 8));
+
+		U32* chunks[3];
+
+		for (U64 frame = 1; frame <= 3; frame++)
+		{
+			EXPECT_TRUE(allocator.CanBeginFrame());
+			EXPECT_EQ(allocator.BeginFrame(), frame);
+
+			chunks[frame - 1] = static_cast<U32*>(allocator.Allocate(sizeof(U32), 4));
+
+			*chunks[frame - 1] = static_cast<U32>(frame);
+		}
+
+		EXPECT_FALSE(allocator.CanBeginFrame());
+		EXPECT_FALSE(allocator.GetFrameStats(1).m_is_retired);
+		EXPECT_EQ(allocator.GetFrameStats(2).m_num_of_allocs, 1);
+
+		for (U32 i = 0; i < 3; i++)
+			EXPECT_EQ(*chunks[i], i + 1);
+
+		allocator.RetireFrame(1);
+
+		EXPECT_TRUE(allocator.GetFrameStats(1).m_is_retired);
+		EXPECT_TRUE(allocator.CanBeginFrame());
+		EXPECT_EQ(allocator.BeginFrame(), 4);
+		EXPECT_ANY_THROW(allocator.GetFrameStats(1));
+
+		EXPECT_EQ(allocator.Allocate(sizeof(U32), 4), chunks[0]);
+		EXPECT_EQ(*chunks[0], 0);
+		EXPECT_EQ(*chunks[1], 2);
+
+		allocator.RetireFrame(3);
+		allocator.RetireFrame(2);
+
+		EXPECT_EQ(allocator.GetRetiredFrame(), 3);
+
+		EXPECT_ANY_THROW(allocator.Deallocate(chunks[0]));
+		EXPECT_ANY_THROW(allocator.Reallocate(chunks[0], 8, 4));
+	}
+
+	/**
+	 * Tests that a frame throws once its memory pool is used up, without
+	 * spilling into the other frames.
+	 */
+	TEST(MultiFrameAllocatorTest, Exhaustion)
+	{
+		MultiFrameAllocator allocator(4096, 2);
+
+		allocator.BeginFrame();
+
+		EXPECT_ANY_THROW(
+		{
+			for (;;)
+				allocator.Allocate(100, 8);
+		});
+
+		EXPECT_LE(allocator.GetUsedMemory(), 4096);
+
+		allocator.BeginFrame();
+
+		EXPECT_EQ(allocator.GetFrameStats(2).m_used_memory, 0);
+
+		allocator.Allocate(4000, 8);
+	}
+
+	/**
+	 * Tests that beginning a frame waits for the consumer to retire the
+	 * frame that last used its slot.
+	 */
+	TEST(MultiFrameAllocatorTest, Retirement)
+	{
+		MultiFrameAllocator allocator(1024, 2);
+
+		std::atomic<U64> submitted_frame(0);
+
+		std::thread consumer([&]()
+		{
+			for (U64 frame = 1; frame <= 1000; frame++)
+			{
+				while (submitted_frame.load(std::memory_order_acquire) < frame)
+					std::this_thread::yield();
+
+				allocator.RetireFrame(frame);
+			}
+		});
+
+		for (U64 frame = 1; frame <= 1000; frame++)
+		{
+			EXPECT_EQ(allocator.BeginFrame(), frame);
+			EXPECT_LE(allocator.GetCurrentFrame() - allocator.GetRetiredFrame(), 2);
+
+			*static_cast<U64*>(allocator.Allocate(sizeof(U64), 8)) = frame;
+
+			submitted_frame.store(frame, std::memory_order_release);
+		}
+
+		consumer.join();
+
+		EXPECT_EQ(allocator.GetRetiredFrame(), 1000);
+
+		allocator.Reset();
+
+		EXPECT_EQ(allocator.GetCurrentFrame(), 0);
+		EXPECT_EQ(allocator.GetRetiredFrame(), 0);
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+	}
+
+	/**
+	 * Tests that growable frames commit pages only as allocations reach them,
+	 * and give them back when their slot is reused.
+	 */
+	TEST(MultiFrameAllocatorTest, Growable)
+	{
+		Platform::AbstractPlatform* platform = &Platform::Platform::GetInstance();
+
+		MultiFrameAllocator allocator(platform, 4 << 20, 2);
+
+		allocator.BeginFrame();
+
+		EXPECT_EQ(allocator.GetFrameStats(1).m_committed_size, 0);
+
+		allocator.Allocate(1 << 20, 16);
+
+		EXPECT_GE(allocator.GetFrameStats(1).m_committed_size, 1 << 20);
+
+		allocator.BeginFrame();
+		allocator.RetireFrame(1);
+		allocator.BeginFrame();
+
+		EXPECT_EQ(allocator.GetFrameStats(3).m_committed_size, 0);
+		EXPECT_EQ(allocator.GetFrameStats(3).m_used_memory, 0);
+	}
+}
+
+#endif // MULTI_FRAME_ALLOCATOR_TEST_H
@@ -0,0 +1,147 @@
+#ifndef STACK_ALLOCATOR_TEST_H
+#define STACK_ALLOCATOR_TEST_H
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/StackAllocator.h"
+#include "Platform/Public/Platform.h"
+
+using namespace Forge;
+using namespace Forge::Memory;
+
+namespace StackAllocatorTest
+{
+	/**
+	 * Tests that allocations honour their alignment, and that freeing them in
+	 * reverse order rewinds the pool to where it started.
+	 */
+	TEST(StackAllocatorTest, RoundTrip)
+	{
+		StackAllocator allocator(1 << 16);
+
+		std::vector<BytePtr> chunks;
+
+		for (U32 round = 0; round < 3; round++)
+		{
+			for (U32 alignment = 1; alignment <= 128; alignment *= 2)
+			{
+				BytePtr address = reinterpret_cast<BytePtr>(allocator.Allocate(alignment + 5, static_cast<Byte>(alignment)));
+
+				EXPECT_EQ(reinterpret_cast<U64>(address) % alignment, 0);
+
+				MemorySet(address, static_cast<Byte>(alignment), alignment + 5);
+
+				chunks.push_back(address);
+			}
+
+			for (U32 alignment = 128; alignment >= 1; alignment /= 2)
+			{
+				BytePtr address = chunks.back();
+
+				for (Size i = 0; i < alignment + 5; i++)
+					ASSERT_EQ(address[i], static_cast<Byte>(alignment));
+
+				allocator.Deallocate(address);
+
+				chunks.pop_back();
+			}
+
+			EXPECT_EQ(allocator.GetUsedMemory(), 0);
+		}
+	}
+
+	/**
+	 * Tests that reallocating the most recent chunk grows it in place.
+	 */
+	TEST(StackAllocatorTest, Reallocate)
+	{
+		StackAllocator allocator(1 << 16);
+
+		allocator.Allocate(10, 8);
+
+		BytePtr address = reinterpret_cast<BytePtr>(allocator.Allocate(16, 16));
+
+		for (Byte i = 0; i < 16; i++)
+			address[i] = i;
+
+		Size used_memory = allocator.GetUsedMemory();
+
+		EXPECT_EQ(allocator.Reallocate(address, 4096, 16), address);
+		EXPECT_EQ(allocator.GetUsedMemory(), used_memory + 4096 - 16);
+
+		for (Byte i = 0; i < 16; i++)
+			EXPECT_EQ(address[i], i);
+	}
+
+	/**
+	 * Tests that a growable pool commits pages only as allocations reach
+	 * them, throws once the reserved range is used up, and decommits
+	 * everything beyond the retained size on reset.
+	 */
+	TEST(StackAllocatorTest, Growable)
+	{
+		Platform::AbstractPlatform* platform = &Platform::Platform::GetInstance();
+
+		Size retained_size = 256 * 1024;
+
+		StackAllocator allocator(platform, 4 << 20, retained_size);
+
+		EXPECT_EQ(allocator.GetCommittedSize(), 0);
+
+		BytePtr first = reinterpret_cast<BytePtr>(allocator.Allocate(100, 16));
+
+		EXPECT_GE(allocator.GetCommittedSize(), 100);
+		EXPECT_LT(allocator.GetCommittedSize(), 1 << 20);
+
+		first[0] = 0xFF;
+
+		BytePtr address = reinterpret_cast<BytePtr>(allocator.Allocate(16, 16));
+
+		address = reinterpret_cast<BytePtr>(allocator.Reallocate(address, 2 << 20, 16));
+
+		address[(2 << 20) - 1] = 0xFF;
+
+		EXPECT_GE(allocator.GetCommittedSize(), allocator.GetUsedMemory());
+
+		EXPECT_ANY_THROW(
+		{
+			for (;;)
+				allocator.Allocate(64 * 1024, 16);
+		});
+
+		EXPECT_EQ(allocator.GetCommittedSize(), allocator.GetTotalSize());
+
+		allocator.Reset();
+
+		EXPECT_EQ(allocator.GetCommittedSize(), retained_size);
+		EXPECT_EQ(allocator.Allocate(100, 16), first);
+		EXPECT_EQ(first[0], 0);
+	}
+	/**
+	 * Tests that the tail given back by shrinking the most recent chunk is
+	 * cleared, so no stale bytes survive a reset of a growable pool.
+	 */
+	TEST(StackAllocatorTest, ShrinkReset)
+	{
+		Platform::AbstractPlatform* platform = &Platform::Platform::GetInstance();
+
+		StackAllocator allocator(platform, 1 << 20, 256 * 1024);
+
+		BytePtr address = reinterpret_cast<BytePtr>(allocator.Allocate(1024, 16));
+
+		MemorySet(address, 0xFF, 1024);
+
+		EXPECT_EQ(allocator.Reallocate(address, 16, 16), address);
+
+		allocator.Reset();
+
+		address = reinterpret_cast<BytePtr>(allocator.Allocate(1024, 16));
+
+		for (Size i = 0; i < 1024; i++)
+			ASSERT_EQ(address[i], 0);
+	}
+}
+
+#endif // STACK_ALLOCATOR_TEST_H
@@ -0,0 +1,188 @@
+#ifndef TLSF_ALLOCATOR_TEST_H
+#define TLSF_ALLOCATOR_TEST_H
+
+#include <vector>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/TLSFAllocator.h"
+
+using namespace Forge;
+using namespace Forge::Memory;
+
+namespace TLSFAllocatorTest
+{
+	/**
+	 * Tests that interleaved allocations and deallocations of mixed sizes
+	 * never overlap and keep their content.
+	 */
+	TEST(TLSFAllocatorTest, RoundTrip)
+	{
+		struct Chunk
+		{
+			BytePtr m_address;
+			Size    m_size;
+			Byte    m_tag;
+		};
+
+		TLSFAllocator allocator(1 << 20);
+
+		std::vector<Chunk> chunks;
+
+		U32 seed = 12345;
+
+		for (U32 i = 0; i < 20000; i++)
+		{
+			seed = seed * 1103515245 + 12345;
+
+			if (chunks.size() < 64 && (seed & 3) != 0)
+			{
+				Chunk chunk = { nullptr, 1 + (seed >> 8) % 2000, static_cast<Byte>(i) };
+
+				chunk.m_address = reinterpret_cast<BytePtr>(allocator.Allocate(chunk.m_size, 8));
+
+				memset(chunk.m_address, chunk.m_tag, chunk.m_size);
+
+				chunks.push_back(chunk);
+			}
+			else if (!chunks.empty())
+			{
+				Size index = (seed >> 8) % chunks.size();
+
+				Chunk chunk = chunks[index];
+
+				for (Size j = 0; j < chunk.m_size; j++)
+					ASSERT_EQ(chunk.m_address[j], chunk.m_tag);
+
+				allocator.Deallocate(chunk.m_address);
+
+				chunks[index] = chunks.back();
+				chunks.pop_back();
+			}
+		}
+
+		for (Chunk& chunk : chunks)
+			allocator.Deallocate(chunk.m_address);
+	}
+
+	/**
+	 * Tests that allocations honour alignments up to 128 bytes.
+	 */
+	TEST(TLSFAllocatorTest, Alignment)
+	{
+		TLSFAllocator allocator(1 << 16);
+
+		std::vector<VoidPtr> chunks;
+
+		for (U32 alignment = 8; alignment <= 128; alignment *= 2)
+		{
+			for (Size size = 1; size < 300; size += 37)
+			{
+				VoidPtr address = allocator.Allocate(size, static_cast<Byte>(alignment));
+
+				EXPECT_EQ(reinterpret_cast<U64>(address) % alignment, 0);
+
+				chunks.push_back(address);
+			}
+		}
+
+		for (VoidPtr address : chunks)
+			allocator.Deallocate(address);
+	}
+
+	/**
+	 * Tests that an exhausted pool throws, and that freeing every chunk
+	 * coalesces the pool back into a block large enough for a big request.
+	 */
+	TEST(TLSFAllocatorTest, Exhaustion)
+	{
+		TLSFAllocator allocator(1 << 16);
+
+		std::vector<VoidPtr> chunks;
+
+		EXPECT_ANY_THROW(
+		{
+			for (;;)
+				chunks.push_back(allocator.Allocate(100, 8));
+		});
+
+		EXPECT_GT(chunks.size(), 400);
+
+		for (Size i = 0; i < chunks.size(); i += 2)
+			allocator.Deallocate(chunks[i]);
+
+		EXPECT_ANY_THROW(allocator.Allocate(1 << 12, 8));
+
+		for (Size i = 1; i < chunks.size(); i += 2)
+			allocator.Deallocate(chunks[i]);
+
+		allocator.Deallocate(allocator.Allocate((1 << 16) - (1 << 12), 8));
+	}
+
+	/**
+	 * Tests that reallocating keeps the content of a chunk, in place and
+	 * when it has to move.
+	 */
+	TEST(TLSFAllocatorTest, Reallocate)
+	{
+		TLSFAllocator allocator(1 << 16);
+
+		BytePtr a = reinterpret_cast<BytePtr>(allocator.Allocate(64, 8));
+		BytePtr b = reinterpret_cast<BytePtr>(allocator.Allocate(64, 8));
+
+		for (Byte i = 0; i < 64; i++)
+			a[i] = i;
+
+		a = reinterpret_cast<BytePtr>(allocator.Reallocate(a, 4096, 8));
+
+		for (Byte i = 0; i < 64; i++)
+			EXPECT_EQ(a[i], i);
+
+		allocator.Deallocate(b);
+
+		b = reinterpret_cast<BytePtr>(allocator.Reallocate(a, 8192, 8));
+
+		for (Byte i = 0; i < 64; i++)
+			EXPECT_EQ(b[i], i);
+
+		allocator.Deallocate(b);
+	}
+	/**
+	 * Tests that reallocating to a larger alignment than the chunk has moves
+	 * it, whether it grows or shrinks.
+	 */
+	TEST(TLSFAllocatorTest, ReallocateAlignment)
+	{
+		TLSFAllocator allocator(1 << 16);
+
+		for (U32 alignment = 64; alignment <= 128; alignment *= 2)
+		{
+			for (Size size = 16; size <= 256; size *= 16)
+			{
+				/// The chunk right after a 128 aligned one is only 8 aligned.
+				VoidPtr anchor = allocator.Allocate(8, 128);
+				BytePtr address = reinterpret_cast<BytePtr>(allocator.Allocate(32, 8));
+
+				ASSERT_FALSE(IsAddressAligned(address, static_cast<Byte>(alignment)));
+
+				for (Byte i = 0; i < 16; i++)
+					address[i] = i;
+
+				address = reinterpret_cast<BytePtr>(allocator.Reallocate(address, size, static_cast<Byte>(alignment)));
+
+				EXPECT_EQ(reinterpret_cast<U64>(address) % alignment, 0);
+
+				for (Byte i = 0; i < 16; i++)
+					EXPECT_EQ(address[i], i);
+
+				allocator.Deallocate(address);
+				allocator.Deallocate(anchor);
+			}
+		}
+
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+	}
+}
+
+#endif // TLSF_ALLOCATOR_TEST_H
@@ -0,0 +1,93 @@
+#ifndef THREAD_CACHE_TEST_UTILITIES_H
+#define THREAD_CACHE_TEST_UTILITIES_H
+
+#include <vector>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Common/TypeDefinitions.h"
+
+using namespace Forge;
+
+namespace ThreadCacheTestUtilities
+{
+	/**
+	 * Allocates chunks on the calling thread and frees them on another one,
+	 * which checks their content first and optionally flushes its own cache
+	 * before exiting.
+	 */
+	template<typename InAllocator>
+	Void HandOffChunks(InAllocator& allocator, Size size, U32 count, Bool is_flushing)
+	{
+		std::vector<VoidPtr> chunks;
+
+		for (U32 i = 0; i < count; i++)
+		{
+			chunks.push_back(allocator.Allocate(size, 8));
+
+			*static_cast<U32*>(chunks.back()) = i;
+		}
+
+		std::thread consumer([&]()
+		{
+			for (U32 i = 0; i < chunks.size(); i++)
+			{
+				EXPECT_EQ(*static_cast<U32*>(chunks[i]), i);
+
+				allocator.Deallocate(chunks[i]);
+			}
+
+			if (is_flushing)
+				allocator.FlushThreadCache();
+		});
+
+		consumer.join();
+	}
+
+	/**
+	 * Has several threads allocate a chunk from every allocator and free it
+	 * again for a number of rounds, each checking that its chunks keep what
+	 * it wrote, then flush their caches of every allocator.
+	 */
+	template<typename InAllocator>
+	Void ShareAllocators(const std::vector<InAllocator*>& allocators, Size size, Size num_of_threads, U32 num_of_rounds)
+	{
+		std::vector<std::thread> threads;
+
+		for (Size t = 0; t < num_of_threads; t++)
+		{
+			threads.emplace_back([&allocators, size, num_of_rounds, t]()
+			{
+				std::vector<U32*> chunks;
+
+				for (U32 round = 0; round < num_of_rounds; round++)
+				{
+					for (Size i = 0; i < allocators.size(); i++)
+					{
+						chunks.push_back(static_cast<U32*>(allocators[i]->Allocate(size, 8)));
+
+						*chunks.back() = static_cast<U32>(t * 1000 + i);
+					}
+
+					for (Size i = 0; i < allocators.size(); i++)
+					{
+						EXPECT_EQ(*chunks[i], t * 1000 + i);
+
+						allocators[i]->Deallocate(chunks[i]);
+					}
+
+					chunks.clear();
+				}
+
+				for (InAllocator* allocator : allocators)
+					allocator->FlushThreadCache();
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+	}
+}
+
+#endif // THREAD_CACHE_TEST_UTILITIES_H
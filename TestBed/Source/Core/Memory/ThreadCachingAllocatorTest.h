@@ -0,0 +1,173 @@
+#ifndef THREAD_CACHING_ALLOCATOR_TEST_H
+#define THREAD_CACHING_ALLOCATOR_TEST_H
+
+#include <vector>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/TLSFAllocator.h"
+#include "Core/Public/Memory/ThreadCachingAllocator.h"
+
+#include "Source/Core/Memory/ThreadCacheTestUtilities.h"
+
+using namespace Forge;
+using namespace Forge::Memory;
+
+namespace ThreadCachingAllocatorTest
+{
+	/**
+	 * Tests that small and large chunks keep their content, and that
+	 * flushing the thread cache returns every chunk to the central allocator.
+	 */
+	TEST(ThreadCachingAllocatorTest, RoundTrip)
+	{
+		TLSFAllocator central(1 << 22);
+
+		{
+			ThreadCachingAllocator allocator(&central);
+
+			std::vector<BytePtr> chunks;
+
+			for (U32 round = 0; round < 4; round++)
+			{
+				for (Size size = 1; size <= 8192; size = size * 3 / 2 + 1)
+				{
+					BytePtr address = reinterpret_cast<BytePtr>(allocator.Allocate(size, 8));
+
+					memset(address, static_cast<Byte>(size), size);
+
+					chunks.push_back(address);
+				}
+
+				Size index = 0;
+
+				for (Size size = 1; size <= 8192; size = size * 3 / 2 + 1, index++)
+				{
+					for (Size j = 0; j < size; j++)
+						ASSERT_EQ(chunks[index][j], static_cast<Byte>(size));
+
+					allocator.Deallocate(chunks[index]);
+				}
+
+				chunks.clear();
+			}
+
+			EXPECT_EQ(allocator.GetNumOfAllocs(), allocator.GetNumOfDeallocs());
+
+			allocator.FlushThreadCache();
+
+			EXPECT_EQ(allocator.GetUsedMemory(), 0);
+		}
+
+		EXPECT_EQ(central.GetUsedMemory(), 0);
+	}
+
+	/**
+	 * Tests that allocations honour alignments up to 128 bytes, whether they
+	 * come from the magazines or from the central allocator.
+	 */
+	TEST(ThreadCachingAllocatorTest, Alignment)
+	{
+		TLSFAllocator central(1 << 20);
+		ThreadCachingAllocator allocator(&central);
+
+		std::vector<VoidPtr> chunks;
+
+		for (U32 alignment = 4; alignment <= 128; alignment *= 2)
+		{
+			for (Size size = 1; size < 6000; size += 397)
+			{
+				VoidPtr address = allocator.Allocate(size, static_cast<Byte>(alignment));
+
+				EXPECT_EQ(reinterpret_cast<U64>(address) % alignment, 0);
+
+				chunks.push_back(address);
+			}
+		}
+
+		for (VoidPtr address : chunks)
+			allocator.Deallocate(address);
+	}
+
+	/**
+	 * Tests that an exhausted central allocator surfaces as an exception,
+	 * and that the allocator keeps working once chunks are freed.
+	 */
+	TEST(ThreadCachingAllocatorTest, Exhaustion)
+	{
+		TLSFAllocator central(1 << 16);
+		ThreadCachingAllocator allocator(&central);
+
+		std::vector<VoidPtr> chunks;
+
+		EXPECT_ANY_THROW(
+		{
+			for (;;)
+				chunks.push_back(allocator.Allocate(1000, 8));
+		});
+
+		EXPECT_GT(chunks.size(), 32);
+
+		for (VoidPtr address : chunks)
+			allocator.Deallocate(address);
+
+		allocator.FlushThreadCache();
+
+		allocator.Deallocate(allocator.Allocate(1 << 14, 8));
+	}
+
+	/**
+	 * Tests that chunks allocated on one thread and freed on another go back
+	 * to the owning thread's cache.
+	 */
+	TEST(ThreadCachingAllocatorTest, CrossThreadHandoff)
+	{
+		TLSFAllocator central(1 << 22);
+		ThreadCachingAllocator allocator(&central);
+
+		ThreadCacheTestUtilities::HandOffChunks(allocator, 48, 1000, false);
+
+		std::vector<VoidPtr> reused;
+
+		for (U32 i = 0; i < 1000; i++)
+			reused.push_back(allocator.Allocate(48, 8));
+
+		for (VoidPtr address : reused)
+			allocator.Deallocate(address);
+
+		allocator.FlushThreadCache();
+
+		EXPECT_EQ(allocator.GetNumOfAllocs(), allocator.GetNumOfDeallocs());
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+		EXPECT_EQ(central.GetUsedMemory(), 0);
+	}
+
+	/**
+	 * Tests that many allocators used from many threads at once each keep
+	 * their own chunks, including allocators whose ids are far apart.
+	 */
+	TEST(ThreadCachingAllocatorTest, ManyAllocators)
+	{
+		TLSFAllocator central(1 << 24);
+
+		std::vector<ThreadCachingAllocator*> allocators;
+
+		for (Size i = 0; i < 20; i++)
+			allocators.push_back(new ThreadCachingAllocator(&central));
+
+		ThreadCacheTestUtilities::ShareAllocators(allocators, 32, 4, 200);
+
+		for (ThreadCachingAllocator* allocator : allocators)
+		{
+			EXPECT_EQ(allocator->GetNumOfAllocs(), 200 * 4);
+			EXPECT_EQ(allocator->GetUsedMemory(), 0);
+
+			delete allocator;
+		}
+
+		EXPECT_EQ(central.GetUsedMemory(), 0);
+	}
+}
+
+#endif // THREAD_CACHING_ALLOCATOR_TEST_H
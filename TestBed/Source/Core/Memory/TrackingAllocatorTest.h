@@ -0,0 +1,83 @@
+#ifndef TRACKING_ALLOCATOR_TEST_H
+#define TRACKING_ALLOCATOR_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/TLSFAllocator.h"
+#include "Core/Public/Memory/TrackingAllocator.h"
+
+using namespace Forge;
+using namespace Forge::Memory;
+
+namespace TrackingAllocatorTest
+{
+#if defined(FORGE_ENABLE_MEMORY_TRACKING)
+	/**
+	 * Tests that allocations made inside a memory scope are attributed to
+	 * its tag, and that freeing them gives the bytes back.
+	 */
+	TEST(TrackingAllocatorTest, Scope)
+	{
+		TLSFAllocator backing(1 << 16);
+		TrackingAllocator allocator(&backing);
+
+		MemoryTracker::TagStats before = MemoryTracker::GetTagStats(MemoryTag::FORGE_AUDIO);
+
+		VoidPtr address;
+
+		{
+			FORGE_MEMORY_SCOPE(MemoryTag::FORGE_AUDIO)
+
+			address = allocator.Allocate(100, 8);
+		}
+
+		MemoryTracker::TagStats after = MemoryTracker::GetTagStats(MemoryTag::FORGE_AUDIO);
+
+		EXPECT_EQ(after.m_live_bytes - before.m_live_bytes, 100);
+		EXPECT_EQ(after.m_num_of_allocs - before.m_num_of_allocs, 1);
+
+		allocator.Deallocate(address);
+		allocator.Deallocate(nullptr);
+
+		after = MemoryTracker::GetTagStats(MemoryTag::FORGE_AUDIO);
+
+		EXPECT_EQ(after.m_live_bytes, before.m_live_bytes);
+		EXPECT_EQ(after.m_num_of_deallocs - before.m_num_of_deallocs, 1);
+	}
+#endif
+
+	/**
+	 * Tests that reallocating keeps the content and honours a changed
+	 * alignment, in both directions.
+	 */
+	TEST(TrackingAllocatorTest, Reallocate)
+	{
+		TLSFAllocator backing(1 << 16);
+		TrackingAllocator allocator(&backing);
+
+		BytePtr address = reinterpret_cast<BytePtr>(allocator.Reallocate(nullptr, 64, 8));
+
+		for (Byte i = 0; i < 64; i++)
+			address[i] = i;
+
+		address = reinterpret_cast<BytePtr>(allocator.Reallocate(address, 256, 8));
+
+		for (U32 alignment = 16; alignment <= 128; alignment *= 2)
+		{
+			address = reinterpret_cast<BytePtr>(allocator.Reallocate(address, 256, static_cast<Byte>(alignment)));
+
+			EXPECT_EQ(reinterpret_cast<U64>(address) % alignment, 0);
+		}
+
+		address = reinterpret_cast<BytePtr>(allocator.Reallocate(address, 32, 4));
+
+		for (Byte i = 0; i < 32; i++)
+			EXPECT_EQ(address[i], i);
+
+		allocator.Deallocate(address);
+
+		EXPECT_EQ(backing.GetUsedMemory(), 0);
+	}
+}
+
+#endif // TRACKING_ALLOCATOR_TEST_H
@@ -0,0 +1,80 @@
+#ifndef OBJECT_MANAGER_TEST_H
+#define OBJECT_MANAGER_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/RTTI/ObjectManager.h"
+
+using namespace Forge;
+using namespace Forge::RTTI;
+using namespace Forge::Containers;
+
+namespace ObjectManagerTest
+{
+	class Entity : public Object
+	{
+	public:
+		FORGE_DECLARE_TYPEINFO(Entity, Object)
+
+	public:
+		int m_id;
+
+	public:
+		Entity(int id)
+			: m_id(id) {}
+
+	public:
+		TRefPtr<Object> Clone(void) override { return TRefPtr<Object>(new Entity(m_id)); }
+	};
+
+	class Light : public Entity
+	{
+	public:
+		FORGE_DECLARE_TYPEINFO(Light, Entity)
+
+	public:
+		Light(int id)
+			: Entity(id) {}
+
+	public:
+		TRefPtr<Object> Clone(void) override { return TRefPtr<Object>(new Light(m_id)); }
+	};
+
+	/**
+	 * Tests that every class gets its own pool and objects resolve through
+	 * their handles.
+	 */
+	TEST(ObjectManagerTest, Pools)
+	{
+		ObjectManager manager;
+
+		TObjectHandle<Entity> entity = manager.Create<Entity>(1);
+		TObjectHandle<Light> light = manager.Create<Light>(2);
+
+		manager.Create<Light>(3);
+
+		EXPECT_EQ(manager.GetCount(), 3);
+		EXPECT_EQ(manager.GetPool<Entity>().GetCount(), 1);
+		EXPECT_EQ(manager.GetPool<Light>().GetCount(), 2);
+
+		EXPECT_EQ(manager.Get(entity)->m_id, 1);
+		EXPECT_EQ(manager.Get(light)->m_id, 2);
+		EXPECT_TRUE(manager.Get(light)->IsInstanceOf(Entity::GetTypeInfo()));
+
+		/// Casting a pooled object does not take a reference that would
+		/// destroy it.
+		EXPECT_EQ(manager.Get(light)->DynamicCast<Entity>()->m_id, 2);
+		EXPECT_EQ(manager.Get(entity)->DynamicCast<Light>(), nullptr);
+		EXPECT_EQ(manager.Get(light)->m_id, 2);
+
+		EXPECT_TRUE(manager.Destroy(light));
+		EXPECT_EQ(manager.Get(light), nullptr);
+
+		manager.Clear();
+
+		EXPECT_EQ(manager.GetCount(), 0);
+		EXPECT_EQ(manager.Get(entity), nullptr);
+	}
+}
+
+#endif // OBJECT_MANAGER_TEST_H
@@ -0,0 +1,189 @@
+#ifndef T_REF_PTR_TEST_H
+#define T_REF_PTR_TEST_H
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/RTTI/Object.h"
+#include "Core/Public/RTTI/TRefPtr.h"
+
+using namespace Forge;
+using namespace Forge::RTTI;
+
+namespace TRefPtrTest
+{
+	class Shape : public Object
+	{
+	public:
+		FORGE_DECLARE_TYPEINFO(Shape, Object)
+
+	public:
+		int* m_num_of_destroyed;
+
+	public:
+		Shape(int* num_of_destroyed)
+			: m_num_of_destroyed(num_of_destroyed) {}
+
+		~Shape() { (*m_num_of_destroyed)++; }
+
+	public:
+		TRefPtr<Object> Clone(void) override { return TRefPtr<Object>(new Shape(m_num_of_destroyed)); }
+	};
+
+	class Circle : public Shape
+	{
+	public:
+		FORGE_DECLARE_TYPEINFO(Circle, Shape)
+
+	public:
+		Circle(int* num_of_destroyed)
+			: Shape(num_of_destroyed) {}
+	};
+
+	/// A reference-counted type outside of the RTTI hierarchy.
+	struct Node : public LocalRefCounted
+	{
+		TRefPtr<Node> m_next;
+	};
+
+	/// Derives from a reference-counted type without virtual functions.
+	struct CountedNode : public Node
+	{
+		int* m_num_of_destroyed;
+
+		CountedNode(int* num_of_destroyed)
+			: m_num_of_destroyed(num_of_destroyed) {}
+
+		~CountedNode() { (*m_num_of_destroyed)++; }
+	};
+
+	/**
+	 * Tests that a reference is a single pointer wide and copies share the
+	 * count stored in the object.
+	 */
+	TEST(TRefPtrTest, SharedCount)
+	{
+		EXPECT_EQ(sizeof(TRefPtr<Shape>), sizeof(Shape*));
+
+		int num_of_destroyed = 0;
+
+		{
+			TRefPtr<Shape> a = MakeRef<Shape>(&num_of_destroyed);
+			TRefPtr<Shape> b = a;
+
+			EXPECT_EQ(a.GetRefCount(), 2);
+
+			TRefPtr<Shape> c = Move(b);
+
+			EXPECT_TRUE(b.IsNull());
+			EXPECT_EQ(c.GetRefCount(), 2);
+
+			a = a;
+			c.Reset();
+
+			EXPECT_EQ(a.GetRefCount(), 1);
+			EXPECT_EQ(num_of_destroyed, 0);
+		}
+
+		EXPECT_EQ(num_of_destroyed, 1);
+	}
+
+	/**
+	 * Tests that the casts leave the count alone, and that references made
+	 * from raw pointers share the count of the object, so it is destroyed
+	 * once.
+	 */
+	TEST(TRefPtrTest, Casts)
+	{
+		int num_of_destroyed = 0;
+
+		{
+			TRefPtr<Object> object = MakeRef<Circle>(&num_of_destroyed);
+
+			Shape* shape = object->StaticCast<Shape>();
+			Circle* circle = object->DynamicCast<Circle>();
+
+			EXPECT_EQ(shape, circle);
+			EXPECT_EQ(object.GetRefCount(), 1);
+
+			TRefPtr<Object> from_raw(circle);
+
+			EXPECT_EQ(object.GetRefCount(), 2);
+
+			TRefPtr<Object> clone = object->Clone();
+
+			EXPECT_EQ(clone.GetRefCount(), 1);
+			EXPECT_EQ(clone->DynamicCast<Circle>(), nullptr);
+			EXPECT_NE(clone->DynamicCast<Shape>(), nullptr);
+			EXPECT_EQ(num_of_destroyed, 0);
+		}
+
+		EXPECT_EQ(num_of_destroyed, 2);
+	}
+
+	/**
+	 * Tests the non-atomic count of types outside of the RTTI hierarchy.
+	 */
+	TEST(TRefPtrTest, LocalRefCounted)
+	{
+		TRefPtr<Node> head = MakeRef<Node>();
+
+		head->m_next = MakeRef<Node>();
+		head->m_next->m_next = MakeRef<Node>();
+
+		TRefPtr<Node> tail = head->m_next->m_next;
+
+		EXPECT_EQ(tail.GetRefCount(), 2);
+
+		head.Reset();
+
+		EXPECT_EQ(tail.GetRefCount(), 1);
+
+		/// Releasing a reference to the base destroys the derived object.
+		int num_of_destroyed = 0;
+
+		TRefPtr<Node> node(new CountedNode(&num_of_destroyed));
+
+		node.Reset();
+
+		EXPECT_EQ(num_of_destroyed, 1);
+	}
+
+	/**
+	 * Tests that references to an object may be copied and released from
+	 * several threads.
+	 */
+	TEST(TRefPtrTest, Concurrency)
+	{
+		int num_of_destroyed = 0;
+
+		{
+			TRefPtr<Shape> shape = MakeRef<Shape>(&num_of_destroyed);
+
+			std::vector<std::thread> threads;
+
+			for (int i = 0; i < 4; i++)
+			{
+				threads.emplace_back([shape]()
+				{
+					for (int j = 0; j < 10000; j++)
+					{
+						TRefPtr<Shape> copy = shape;
+						TRefPtr<Object> object(copy->StaticCast<Object>());
+					}
+				});
+			}
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			EXPECT_EQ(shape.GetRefCount(), 1);
+		}
+
+		EXPECT_EQ(num_of_destroyed, 1);
+	}
+}
+
+#endif // T_REF_PTR_TEST_H
@@ -0,0 +1,165 @@
+#ifndef TYPE_REGISTRY_TEST_H
+#define TYPE_REGISTRY_TEST_H
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/RTTI/Object.h"
+#include "Core/Public/RTTI/TypeRegistry.h"
+
+using namespace Forge;
+using namespace Forge::RTTI;
+
+namespace TypeRegistryTest
+{
+	/// A small component hierarchy, the classes are never instantiated.
+	class Component : public Object
+	{
+	public:
+		FORGE_DECLARE_TYPEINFO(Component, Object)
+	};
+
+	class Transform : public Component
+	{
+	public:
+		FORGE_DECLARE_TYPEINFO(Transform, Component)
+	};
+
+	class MeshRenderer : public Component
+	{
+	public:
+		FORGE_DECLARE_TYPEINFO(MeshRenderer, Component)
+	};
+
+	class SkinnedMeshRenderer : public MeshRenderer
+	{
+	public:
+		FORGE_DECLARE_TYPEINFO(SkinnedMeshRenderer, MeshRenderer)
+	};
+
+	/**
+	 * Tests that declared types are registered before they are first used.
+	 */
+	TEST(TypeRegistryTest, StaticRegistration)
+	{
+		ConstTypeInfoPtr type_info = TypeRegistry::FindTypeInfo(Type::ConstStringHash("SkinnedMeshRenderer"));
+
+		EXPECT_EQ(type_info, SkinnedMeshRenderer::GetTypeInfo());
+		EXPECT_STREQ(type_info->GetTypeName(), "SkinnedMeshRenderer");
+		EXPECT_EQ(type_info->GetTypeSize(), sizeof(SkinnedMeshRenderer));
+		EXPECT_EQ(type_info->GetBaseTypeInfo(), MeshRenderer::GetTypeInfo());
+
+		EXPECT_EQ(TypeRegistry::FindTypeInfo(Type::ConstStringHash("Unknown")), nullptr);
+	}
+
+	/**
+	 * Tests derivation checks across the hierarchy.
+	 */
+	TEST(TypeRegistryTest, IsDerivedFrom)
+	{
+		ConstTypeInfoPtr object = Object::GetTypeInfo();
+		ConstTypeInfoPtr component = Component::GetTypeInfo();
+		ConstTypeInfoPtr transform = Transform::GetTypeInfo();
+		ConstTypeInfoPtr mesh = MeshRenderer::GetTypeInfo();
+		ConstTypeInfoPtr skinned_mesh = SkinnedMeshRenderer::GetTypeInfo();
+
+		EXPECT_EQ(skinned_mesh->IsDerivedFrom(skinned_mesh), true);
+		EXPECT_EQ(skinned_mesh->IsDerivedFrom(mesh), true);
+		EXPECT_EQ(skinned_mesh->IsDerivedFrom(component), true);
+		EXPECT_EQ(skinned_mesh->IsDerivedFrom(object), true);
+		EXPECT_EQ(skinned_mesh->IsDerivedFrom(transform), false);
+
+		EXPECT_EQ(transform->IsDerivedFrom(mesh), false);
+		EXPECT_EQ(mesh->IsDerivedFrom(skinned_mesh), false);
+		EXPECT_EQ(component->IsDerivedFrom(transform), false);
+		EXPECT_EQ(object->IsDerivedFrom(component), false);
+		EXPECT_EQ(object->IsDerivedFrom(nullptr), false);
+
+		EXPECT_EQ(skinned_mesh->IsDerivedFrom(Type::ConstStringHash("Component")), true);
+		EXPECT_EQ(transform->IsDerivedFrom(Type::ConstStringHash("MeshRenderer")), false);
+	}
+
+	/**
+	 * Tests type infos registered and removed after startup.
+	 */
+	TEST(TypeRegistryTest, RuntimeRegistration)
+	{
+		ConstTypeInfoPtr mesh = MeshRenderer::GetTypeInfo();
+
+		U32 num_of_types = TypeRegistry::GetNumOfTypes();
+
+		{
+			TypeInfo base("RuntimeBase", 8, mesh);
+			TypeInfo derived("RuntimeDerived", 16, &base);
+
+			EXPECT_EQ(TypeRegistry::GetNumOfTypes(), num_of_types + 2);
+			EXPECT_EQ(TypeRegistry::GetTypeInfo(derived.GetTypeIndex()), &derived);
+
+			EXPECT_EQ(derived.IsDerivedFrom(&base), true);
+			EXPECT_EQ(derived.IsDerivedFrom(Component::GetTypeInfo()), true);
+			EXPECT_EQ(derived.IsDerivedFrom(Transform::GetTypeInfo()), false);
+			EXPECT_EQ(SkinnedMeshRenderer::GetTypeInfo()->IsDerivedFrom(&base), false);
+		}
+
+		/// Indices of removed types are not reused.
+		EXPECT_EQ(TypeRegistry::GetNumOfTypes(), num_of_types + 2);
+		EXPECT_EQ(TypeRegistry::GetTypeInfo(num_of_types), nullptr);
+		EXPECT_EQ(TypeRegistry::FindTypeInfo(Type::ConstStringHash("RuntimeBase")), nullptr);
+
+		EXPECT_EQ(SkinnedMeshRenderer::GetTypeInfo()->IsDerivedFrom(mesh), true);
+	}
+
+	/**
+	 * Tests derivation checks while another thread registers and removes
+	 * types, which numbers the hierarchy again.
+	 */
+	TEST(TypeRegistryTest, ConcurrentRegistration)
+	{
+		std::atomic<Bool> is_done(false);
+
+		std::thread registrar([&]()
+		{
+			for (U32 i = 0; i < 1000; i++)
+			{
+				TypeInfo base("ConcurrentBase", 8, Transform::GetTypeInfo());
+				TypeInfo derived("ConcurrentDerived", 16, &base);
+
+				EXPECT_EQ(derived.IsDerivedFrom(Component::GetTypeInfo()), true);
+				EXPECT_EQ(derived.IsDerivedFrom(MeshRenderer::GetTypeInfo()), false);
+			}
+
+			is_done.store(true);
+		});
+
+		while (!is_done.load())
+		{
+			EXPECT_EQ(SkinnedMeshRenderer::GetTypeInfo()->IsDerivedFrom(MeshRenderer::GetTypeInfo()), true);
+			EXPECT_EQ(SkinnedMeshRenderer::GetTypeInfo()->IsDerivedFrom(Transform::GetTypeInfo()), false);
+			EXPECT_EQ(Transform::GetTypeInfo()->IsDerivedFrom(Object::GetTypeInfo()), true);
+		}
+
+		registrar.join();
+	}
+
+	/**
+	 * Tests that type indices are dense.
+	 */
+	TEST(TypeRegistryTest, TypeIndex)
+	{
+		ConstTypeInfoPtr type_infos[] =
+		{
+			Object::GetTypeInfo(), Component::GetTypeInfo(), Transform::GetTypeInfo(),
+			MeshRenderer::GetTypeInfo(), SkinnedMeshRenderer::GetTypeInfo()
+		};
+
+		for (ConstTypeInfoPtr type_info : type_infos)
+		{
+			EXPECT_EQ(type_info->GetTypeIndex() < TypeRegistry::GetNumOfTypes(), true);
+			EXPECT_EQ(TypeRegistry::GetTypeInfo(type_info->GetTypeIndex()), type_info);
+		}
+	}
+}
+
+#endif // TYPE_REGISTRY_TEST_H